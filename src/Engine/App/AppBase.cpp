@@ -38,7 +38,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Platform/AbstractTimer.h"
 #include "Platform/AbstractWindow.h"
 #include "Platform/PlatformInterface.h"
+#include "Profiling/CpuProfiler.h"
+#include "Profiling/FrameStatistics.h"
 #include "Properties/Settings.h"
+#include "RenderBackend/DbgRenderer.h"
 #include "RenderBackend/Pipeline.h"
 #include "RenderBackend/RenderBackendService.h"
 #include "RenderBackend/2D/CanvasRenderer.h"
@@ -121,10 +124,23 @@ bool AppBase::destroy() {
 }
 
 void AppBase::update() {
+    OSRE_PROFILE_SCOPE("AppBase::update");
     if (mAppState == State::Created) {
         mAppState = State::Running;
     }
 
+    // Dispatch the finished asynchronous reads
+    IOService *ioService = ServiceProvider::getService<IOService>(ServiceType::IOService);
+    if (ioService != nullptr) {
+        ioService->update();
+    }
+
+    // Dispatch the finished resource loads
+    ResourceCacheService *rcService = ServiceProvider::getService<ResourceCacheService>(ServiceType::ResourceService);
+    if (rcService != nullptr) {
+        rcService->update();
+    }
+
     onUpdate();
 }
 
@@ -149,17 +165,31 @@ void AppBase::resize(i32 x, i32 y, i32 w, i32 h) {
 }
 
 void AppBase::requestNextFrame() {
+    OSRE_PROFILE_SCOPE("AppBase::requestNextFrame");
     osre_assert(mRbService != nullptr);
+    Profiling::FrameStatistics *frameStatistics = Profiling::FrameStatistics::getInstance();
     if (mActiveScene == nullptr) {
         osre_debug(Tag, "Invalid active world.");
-        return;
+    } else {
+        mActiveScene->render(mRbService);
+        if (mSettings->getBool(Settings::ShowFrameStatistics) && DbgRenderer::getInstance() != nullptr) {
+            DbgRenderer::getInstance()->renderFrameStatistics(10, 570);
+        }
+        mRbService->update();
     }
 
-    mActiveScene->render(mRbService);
-    mRbService->update();
+    if (frameStatistics != nullptr) {
+        frameStatistics->endFrame(Profiling::FrameThread::Main);
+    }
 }
 
 bool AppBase::handleEvents() {
+    OSRE_PROFILE_SCOPE("AppBase::handleEvents");
+    Profiling::FrameStatistics *frameStatistics = Profiling::FrameStatistics::getInstance();
+    if (frameStatistics != nullptr) {
+        frameStatistics->beginFrame(Profiling::FrameThread::Main);
+    }
+
     if (mPlatformInterface == nullptr) {
         osre_debug(Tag, "AppBase::PlatformInterface not in proper state: not nullptr.");
         return false;
@@ -256,6 +286,15 @@ bool AppBase::onCreate() {
         return false;
     }
 
+    // Start profiling before any thread is created to get the whole timeline
+    if (mSettings->getBool(Settings::CpuProfiling)) {
+        Profiling::CpuProfiler::setThreadName("Main");
+        Profiling::CpuProfiler::setEnabled(true);
+    }
+    if (mSettings->getBool(Settings::AsyncLogging)) {
+        Logger::getInstance()->startAsync();
+    }
+
     ServiceProvider::create();
     mIds = new Ids;
     mEnvironment = new Environment;
@@ -311,8 +350,12 @@ bool AppBase::onCreate() {
 
     mTimer = PlatformInterface::getInstance()->getTimer();
 
-    MaterialBuilder::create(GLSLVersion::GLSL_400);
+    MaterialBuilder::create(GLSLVersion::GLSL_400, &mRbService->getTextureDecoder());
     auto *rcSrv = new ResourceCacheService;
+    if (!rcSrv->open()) {
+        osre_error(Tag, "Error while opening the resource cache service.");
+        return false;
+    }
     ServiceProvider::setService(ServiceType::ResourceService, rcSrv);
 
     // Setup onMouse event-listener
@@ -330,6 +373,10 @@ bool AppBase::onCreate() {
     }
 
     AbstractService *ioSrv = IOService::create();
+    if (!ioSrv->open()) {
+        osre_error(Tag, "Error while opening the IO service.");
+        return false;
+    }
     ServiceProvider::setService(ServiceType::IOService, ioSrv);
 
     AssetRegistry::registerAssetPathInBinFolder("assets", "assets");
@@ -368,9 +415,24 @@ bool AppBase::onDestroy() {
         attachKeyboardEventPtrs(eventArray);
         evHandler->unregisterAllEventHandler(eventArray);
     }
+
+    if (Profiling::CpuProfiler::isEnabled()) {
+        Profiling::CpuProfiler::setEnabled(false);
+        Profiling::CpuProfiler::exportChromeTrace(mSettings->getString(Settings::ProfileTraceFile));
+    }
+
     AssetRegistry::destroy();
     ResourceCacheService *service = ServiceProvider::getService<ResourceCacheService>(ServiceType::ResourceService);
-    delete service;
+    if (service != nullptr) {
+        service->close();
+        delete service;
+    }
+
+    IOService *ioService = ServiceProvider::getService<IOService>(ServiceType::IOService);
+    if (ioService != nullptr) {
+        ioService->close();
+        delete ioService;
+    }
 
     ServiceProvider::destroy();
 
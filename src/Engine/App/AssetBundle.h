@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "Common/osre_common.h"
+#include "IO/AssetArchive.h"
 
 #include <cppcore/Container/TArray.h>
 
@@ -32,7 +33,8 @@ namespace App {
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
-///	@brief	This helper class can be used to bundle files.
+///	@brief	This helper class can be used to bundle files. The files will be packed into an asset 
+/// archive named like the bundle, mount it with an IO::ArchiveFileSystem.
 //-------------------------------------------------------------------------------------------------
 class AssetBundle {
 public:
@@ -68,6 +70,11 @@ public:
     /// @return The asset name.
     const String &getAssetAt(size_t index) const;
 
+    /// @brief Will pack all files of the bundle into the archive named by the bundle.
+    /// @param compress true to compress the files.
+    /// @return true if successful, false in case of an error.
+    bool pack(bool compress) const;
+
 private:
     bool isSupported(const String &file) const;
 
@@ -117,7 +124,20 @@ inline bool AssetBundle::isSupported(const String &file) const {
         return false;
     }
 
-    return false;
+    return file.substr(pos + 1) == IO::AssetArchive::getExtension();
+}
+
+inline bool AssetBundle::pack(bool compress) const {
+    if (!isValid()) {
+        return false;
+    }
+
+    IO::AssetArchiveSourceArray sources;
+    for (size_t i = 0; i < mAssetArray.size(); ++i) {
+        sources.add({ mAssetArray[i], mAssetArray[i] });
+    }
+
+    return IO::AssetArchive::create(getName(), sources, compress);
 }
 
 } // Namespace Assets
@@ -34,6 +34,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IO/IOService.h"
 #include "IO/Uri.h"
 #include "RenderBackend/Mesh.h"
+#include "RenderBackend/MeshCache.h"
+#include "RenderBackend/MeshProcessor.h"
 #include "RenderBackend/RenderCommon.h"
 #include "RenderBackend/Material.h"
 #include "RenderBackend/MaterialBuilder.h"
@@ -45,6 +47,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <assimp/Importer.hpp>
 
 #include <iostream>
+#include <cstring>
 
 namespace OSRE::App {
 
@@ -60,6 +63,17 @@ constexpr unsigned int DefaultImportFlags = aiProcess_CalcTangentSpace | aiProce
                                             aiProcess_ImproveCacheLocality | aiProcess_LimitBoneWeights | aiProcess_RemoveRedundantMaterials |
                                             aiProcess_SplitLargeMeshes | aiProcess_Triangulate | aiProcess_GenUVCoords | aiProcess_SortByPType;
 
+// Skinned meshes keep their vertex order, the bone weights are referencing the vertices by their index
+constexpr ui32 SkinnedMeshOptimizeFlags = MeshProcessor::OptimizeVertexCache | MeshProcessor::OptimizeOverdraw;
+constexpr ui32 MeshOptimizeFlags = SkinnedMeshOptimizeFlags | MeshProcessor::WeldVertices | MeshProcessor::OptimizeVertexFetch |
+                                   MeshProcessor::CompactIndices;
+
+// The settings which change the meshes stored in the cache, changed settings invalidate the cache file
+static ui64 getMeshCacheOptions(ui32 importFlags) {
+    return static_cast<ui64>(importFlags) | (static_cast<ui64>(MeshOptimizeFlags) << 32) |
+           (static_cast<ui64>(MeshOptimizer::DefaultCacheSize) << 48);
+}
+
 static void setColor4(const aiColor4D &aiCol, Color4 &col) {
     col.m_r = aiCol.r;
     col.m_g = aiCol.g;
@@ -67,6 +81,15 @@ static void setColor4(const aiColor4D &aiCol, Color4 &col) {
     col.m_a = aiCol.a;
 }
 
+// Compressed meshes need the shader variant which decodes the compressed normals
+static Material *createMeshMaterial(const String &matName, const TextureResourceArray &texResArray, bool compressed) {
+    if (compressed) {
+        return MaterialBuilder::createBuildinMaterial(matName + ".compressed", texResArray, VertexType::CompressedRenderVertex);
+    }
+
+    return MaterialBuilder::createBuildinMaterial(matName, texResArray, VertexType::RenderVertex);
+}
+
 static void setTexture(const String &resolvedPath, const aiString &texPath,
         TextureResourceArray &texResArray, TextureStageType stage) {
     // Check for an embedded texture
@@ -104,6 +127,11 @@ AssimpWrapper::AssetContext::AssetContext(Ids &ids, Scene *world) :
 
 AssimpWrapper::AssimpWrapper(Ids &ids, Scene *world) :
         mImporter(nullptr),
+        mUseMeshCache(true),
+        mLoadedFromMeshCache(false),
+        mLodConfig(),
+        mCompressionConfig(),
+        mCompressionReport(),
         mAssetContext(ids, world) {
     // empty
 }
@@ -135,6 +163,19 @@ bool AssimpWrapper::importAsset(const IO::Uri &file, ui32 flags) {
     }
 
     filename = mAssetContext.mRoot + filename;
+    mLoadedFromMeshCache = false;
+    HashId sourceHash = 0;
+    if (mUseMeshCache) {
+        sourceHash = MeshCache::computeSourceHash(filename, getMeshCacheOptions(flags));
+        if (sourceHash != 0 && loadFromMeshCache(MeshCache::getCachePath(filename), sourceHash)) {
+            osre_debug(Tag, "Loaded " + filename + " from mesh cache.");
+            mLoadedFromMeshCache = true;
+            generateLods();
+            compressVertices();
+            return true;
+        }
+    }
+
     if (mImporter != nullptr) {
         delete mImporter;
     }
@@ -156,6 +197,14 @@ bool AssimpWrapper::importAsset(const IO::Uri &file, ui32 flags) {
     convertScene();
     osre_debug(Tag, "Converting " + filename + " finished.");
 
+    if (sourceHash != 0) {
+        storeMeshCache(MeshCache::getCachePath(filename), sourceHash);
+    }
+
+    // The mesh cache stores the full detail level with uncompressed vertices only
+    generateLods();
+    compressVertices();
+
     osre_debug(Tag, "Finish importing " + filename + ".");
 
     return true;
@@ -174,6 +223,26 @@ const aiScene *AssimpWrapper::getScene() const {
     return mAssetContext.mScene;
 }
 
+void AssimpWrapper::setMeshCacheEnabled(bool enabled) {
+    mUseMeshCache = enabled;
+}
+
+bool AssimpWrapper::isLoadedFromMeshCache() const {
+    return mLoadedFromMeshCache;
+}
+
+void AssimpWrapper::setLodChainConfig(const LodChainConfig &config) {
+    mLodConfig = config;
+}
+
+void AssimpWrapper::setVertexCompressionConfig(const VertexCompressionConfig &config) {
+    mCompressionConfig = config;
+}
+
+const VertexCompressionReport &AssimpWrapper::getVertexCompressionReport() const {
+    return mCompressionReport;
+}
+
 Entity *AssimpWrapper::convertScene() {
     if (mAssetContext.mScene == nullptr) {
         return nullptr;
@@ -387,7 +456,10 @@ void AssimpWrapper::importMeshes(aiMesh **meshes, ui32 numMeshes) {
             }
 
             indexOffset += currentMesh->mNumVertices;
+        }
 
+        // All sub-meshes share one material, so they are stored in one buffer and drawn by one group
+        if (currentMesh != nullptr && !indexArray.isEmpty()) {
             const size_t vbSize = sizeof(RenderVert) * numVerts;
             newMesh.createVertexBuffer(&vertices[0], vbSize, BufferAccessType::ReadOnly);
 
@@ -403,12 +475,67 @@ void AssimpWrapper::importMeshes(aiMesh **meshes, ui32 numMeshes) {
     }
     mAssetContext.mEntity->setAABB(aabb);
 
+    optimizeMeshes();
+
     for (auto &it : mat2MeshMap) {
         delete it.second;
     }
     mat2MeshMap.clear();
 }
 
+void AssimpWrapper::optimizeMeshes() {
+    MeshProcessor processor;
+    bool hasBones = false;
+    for (ui32 i = 0; i < mAssetContext.mScene->mNumMeshes; ++i) {
+        hasBones |= mAssetContext.mScene->mMeshes[i]->HasBones();
+    }
+    processor.setProcessingFlags(hasBones ? SkinnedMeshOptimizeFlags : MeshOptimizeFlags);
+
+    for (size_t i = 0; i < mAssetContext.mMeshArray.size(); ++i) {
+        processor.addMesh(mAssetContext.mMeshArray[i]);
+    }
+    if (!processor.execute()) {
+        return;
+    }
+
+    const VertexCacheStatistics &before = processor.getStatisticsBefore();
+    const VertexCacheStatistics &after = processor.getStatisticsAfter();
+    osre_debug(Tag, "Vertex cache ACMR " + std::to_string(before.getACMR()) + " -> " + std::to_string(after.getACMR()) +
+            ", ATVR " + std::to_string(before.getATVR()) + " -> " + std::to_string(after.getATVR()));
+}
+
+void AssimpWrapper::generateLods() {
+    if (mLodConfig.mNumLevels == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < mAssetContext.mMeshArray.size(); ++i) {
+        Mesh *mesh = mAssetContext.mMeshArray[i];
+        const size_t numLevels = MeshSimplifier::generateLodChain(mesh, mLodConfig);
+        if (numLevels > 0) {
+            osre_debug(Tag, "Generated " + std::to_string(numLevels) + " LOD levels for mesh " + mesh->getName());
+        }
+    }
+}
+
+void AssimpWrapper::compressVertices() {
+    mCompressionReport = VertexCompressionReport();
+    if (!mCompressionConfig.mEnabled) {
+        return;
+    }
+
+    for (size_t i = 0; i < mAssetContext.mMeshArray.size(); ++i) {
+        VertexCompressor::compress(mAssetContext.mMeshArray[i], mCompressionConfig, &mCompressionReport);
+    }
+
+    if (mCompressionReport.mNumMeshes > 0) {
+        osre_debug(Tag, "Compressed " + std::to_string(mCompressionReport.mNumVertices) + " vertices in " +
+                std::to_string(mCompressionReport.mNumMeshes) + " meshes: " + std::to_string(mCompressionReport.mSizeBefore) +
+                " -> " + std::to_string(mCompressionReport.mSizeAfter) + " bytes, saved " +
+                std::to_string(static_cast<i32>(mCompressionReport.getSavedRatio() * 100.0f)) + "%");
+    }
+}
+
 void AssimpWrapper::importNode(const aiNode *node, TransformComponent *parent) {
     if (nullptr == node) {
         return;
@@ -469,13 +596,19 @@ void AssimpWrapper::importMaterial(aiMaterial *material) {
         matName = "material1";
     }
 
-    Material *osreMat = MaterialBuilder::createBuildinMaterial(matName, texResArray, VertexType::RenderVertex);
+    Material *osreMat = createMeshMaterial(matName, texResArray, mCompressionConfig.mEnabled);
     if (nullptr == osreMat) {
         osre_error(Tag, "Error while creating material for " + matName);
         return;
     }
 
     mAssetContext.mMatArray.add(osreMat);
+    MeshCacheMaterial cacheMat;
+    cacheMat.Name = matName;
+    if (!texResArray.isEmpty()) {
+        cacheMat.DiffuseTexture = texResArray[0]->getUri().getUri();
+    }
+
     Color4 color;
     const aiColor4D defaultColor(1, 1, 1, 1);
     aiColor4D diffuse = defaultColor;
@@ -511,6 +644,13 @@ void AssimpWrapper::importMaterial(aiMaterial *material) {
     if (AI_SUCCESS == aiGetMaterialFloatArray(material, AI_MATKEY_SHININESS_STRENGTH, &strength, &max)) {
         osreMat->setFloatParameter(MaterialParameterType::ShinenessStrength, strength);
     }
+
+    for (ui32 i = 0; i < MaxMatColorType; ++i) {
+        cacheMat.Colors[i] = osreMat->getColor(static_cast<MaterialColorType>(i));
+    }
+    cacheMat.Shininess = osreMat->getFloatParameter(MaterialParameterType::Shineness);
+    cacheMat.ShininessStrength = osreMat->getFloatParameter(MaterialParameterType::ShinenessStrength);
+    mAssetContext.mCacheMatArray.add(cacheMat);
 }
 
 using Bone2NodeMap = cppcore::THashMap<int, TransformComponent *>;
@@ -552,4 +692,128 @@ void AssimpWrapper::importAnimations(const aiScene *scene) {
     }
 }
 
+bool AssimpWrapper::loadFromMeshCache(const String &cachePath, HashId sourceHash) {
+    MeshCacheEntryArray entries;
+    MeshCacheMaterialArray materials;
+    if (!MeshCache::load(cachePath, sourceHash, entries, materials)) {
+        return false;
+    }
+
+    if (mAssetContext.mWorld == nullptr) {
+        mAssetContext.mWorld = new Scene("scene");
+    }
+    mAssetContext.mEntity = new Entity(mAssetContext.mAbsPathWithFile, mAssetContext.mIds, mAssetContext.mWorld);
+
+    for (size_t i = 0; i < materials.size(); ++i) {
+        const MeshCacheMaterial &cacheMat = materials[i];
+        TextureResourceArray texResArray;
+        if (!cacheMat.DiffuseTexture.empty()) {
+            auto *texRes = new TextureResource(cacheMat.DiffuseTexture, Uri(cacheMat.DiffuseTexture));
+            texRes->setTextureStage(TextureStageType::TextureStage0);
+            texResArray.add(texRes);
+        }
+
+        // Keep the material indices stable, even if a material cannot be created
+        Material *osreMat = createMeshMaterial(cacheMat.Name, texResArray, mCompressionConfig.mEnabled);
+        mAssetContext.mMatArray.add(osreMat);
+        if (nullptr == osreMat) {
+            osre_error(Tag, "Error while creating material for " + cacheMat.Name);
+            continue;
+        }
+        for (ui32 j = 0; j < MaxMatColorType; ++j) {
+            osreMat->setColor(static_cast<MaterialColorType>(j), cacheMat.Colors[j]);
+        }
+        osreMat->setFloatParameter(MaterialParameterType::Shineness, cacheMat.Shininess);
+        osreMat->setFloatParameter(MaterialParameterType::ShinenessStrength, cacheMat.ShininessStrength);
+    }
+
+    // The cache stores the final model matrices, so one root node is enough
+    auto *root = new TransformComponent(mAssetContext.mAbsPathWithFile, mAssetContext.mEntity, mAssetContext.mIds, nullptr);
+    mAssetContext.mParentNode = root;
+    mAssetContext.mEntity->setNode(root);
+
+    AABB aabb;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        MeshCacheEntry &entry = entries[i];
+        Mesh *mesh = entry.mMesh;
+        if (entry.mMaterialIndex >= 0 && static_cast<size_t>(entry.mMaterialIndex) < mAssetContext.mMatArray.size()) {
+            mesh->setMaterial(mAssetContext.mMatArray[entry.mMaterialIndex]);
+        }
+        mAssetContext.mMeshArray.add(mesh);
+        root->addMeshReference(i);
+        aabb.merge(entry.mAabb.getMin());
+        aabb.merge(entry.mAabb.getMax());
+
+        if (mesh->getVertexBuffer() != nullptr) {
+            mAssetContext.mNumVertices += static_cast<ui32>(mesh->getVertexBuffer()->getSize() / Mesh::getVertexSize(mesh->getVertexType()));
+        }
+        for (size_t j = 0; j < mesh->getNumberOfPrimitiveGroups(); ++j) {
+            mAssetContext.mNumTriangles += static_cast<ui32>(mesh->getPrimitiveGroupAt(j)->m_numIndices / 3);
+        }
+    }
+    mAssetContext.mEntity->setAABB(aabb);
+
+    RenderComponent *rc = (RenderComponent *)mAssetContext.mEntity->getComponent(ComponentType::RenderComponentType);
+    rc->addStaticMeshArray(mAssetContext.mMeshArray);
+
+    return true;
+}
+
+static AABB computeMeshAABB(Mesh *mesh) {
+    AABB aabb;
+    BufferData *vb = mesh->getVertexBuffer();
+    const size_t stride = Mesh::getVertexSize(mesh->getVertexType());
+    if (vb == nullptr || stride == 0) {
+        return aabb;
+    }
+
+    const c8 *data = vb->getData();
+    const size_t numVertices = vb->getSize() / stride;
+    for (size_t i = 0; i < numVertices; ++i) {
+        glm::vec3 pos;
+        ::memcpy(&pos.x, &data[i * stride], sizeof(glm::vec3));
+        aabb.merge(pos);
+    }
+
+    return aabb;
+}
+
+void AssimpWrapper::storeMeshCache(const String &cachePath, HashId sourceHash) {
+    const aiScene *scene = mAssetContext.mScene;
+    if (scene == nullptr || mAssetContext.mMeshArray.isEmpty()) {
+        return;
+    }
+
+    // Skinned and animated assets need the node hierarchy, which is not part of the cache
+    if (scene->HasAnimations()) {
+        return;
+    }
+    for (ui32 i = 0; i < scene->mNumMeshes; ++i) {
+        if (scene->mMeshes[i]->HasBones()) {
+            return;
+        }
+    }
+
+    MeshCacheEntryArray entries;
+    for (size_t i = 0; i < mAssetContext.mMeshArray.size(); ++i) {
+        MeshCacheEntry entry;
+        entry.mMesh = mAssetContext.mMeshArray[i];
+        if (entry.mMesh == nullptr) {
+            return;
+        }
+        for (size_t j = 0; j < mAssetContext.mMatArray.size(); ++j) {
+            if (mAssetContext.mMatArray[j] == entry.mMesh->getMaterial()) {
+                entry.mMaterialIndex = static_cast<i32>(j);
+                break;
+            }
+        }
+        entry.mAabb = computeMeshAABB(entry.mMesh);
+        entries.add(entry);
+    }
+
+    if (!MeshCache::write(cachePath, sourceHash, entries, mAssetContext.mCacheMatArray)) {
+        osre_debug(Tag, "Cannot write mesh cache " + cachePath);
+    }
+}
+
 } // namespace OSRE::App
\ No newline at end of file
@@ -23,6 +23,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/MeshCache.h"
+#include "RenderBackend/Mesh/MeshSimplifier.h"
+#include "RenderBackend/Mesh/VertexCompressor.h"
 #include "Animation/AnimatorBase.h"
 #include "Common/Ids.h"
 #include "Common/TAABB.h"
@@ -106,22 +109,53 @@ public:
     /// @return The scene.
     const aiScene *getScene() const;
 
+    /// @brief Will enable or disable the binary mesh cache, enabled by default.
+    /// @param enabled  true to read and write mesh cache files.
+    void setMeshCacheEnabled(bool enabled);
+
+    /// @brief Will return true, if the last import was served from the mesh cache.
+    /// @return true for a cache hit.
+    bool isLoadedFromMeshCache() const;
+
+    /// @brief Will set the description of the level of detail chain generated for each mesh.
+    /// @param config   The chain description, use zero levels to disable the generation.
+    void setLodChainConfig(const RenderBackend::LodChainConfig &config);
+
+    /// @brief Will set the description of the vertex compression, disabled by default.
+    /// @param config   The compression description.
+    void setVertexCompressionConfig(const RenderBackend::VertexCompressionConfig &config);
+
+    /// @brief Will return the memory statistics of the vertex compression of the last import.
+    /// @return The compression report.
+    const RenderBackend::VertexCompressionReport &getVertexCompressionReport() const;
+
 protected:
     Entity *convertScene();
     void importMeshes( aiMesh **meshes, ui32 numMeshes );
+    void optimizeMeshes();
     void importNode(const aiNode *node, TransformComponent *parent );
     void importMaterial( aiMaterial *material );
     void importAnimations(const aiScene *scene);
+    bool loadFromMeshCache(const String &cachePath, HashId sourceHash);
+    void storeMeshCache(const String &cachePath, HashId sourceHash);
+    void generateLods();
+    void compressVertices();
 
 private:
     aiLogStream mStream;
     Assimp::Importer *mImporter;
+    bool mUseMeshCache;
+    bool mLoadedFromMeshCache;
+    RenderBackend::LodChainConfig mLodConfig;
+    RenderBackend::VertexCompressionConfig mCompressionConfig;
+    RenderBackend::VertexCompressionReport mCompressionReport;
     struct AssetContext {
         const aiScene *mScene;
         RenderBackend::MeshArray mMeshArray;
         Entity *mEntity;
         Scene *mWorld;
         MaterialArray mMatArray;
+        RenderBackend::MeshCacheMaterialArray mCacheMatArray;
         App::TransformComponent *mParentNode;
         Common::Ids &mIds;
         String mRoot;
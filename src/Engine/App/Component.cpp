@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "App/Component.h"
 #include "App/Entity.h"
+#include "RenderBackend/Mesh.h"
 #include "RenderBackend/RenderBackendService.h"
 #include "RenderBackend/RenderCommon.h"
 
@@ -45,7 +46,7 @@ void Component::render(RenderBackendService *renderBackendSrv) {
 }
 
 RenderComponent::RenderComponent(Entity *owner) :
-        Component(owner, ComponentType::RenderComponentType), m_newGeo() {
+        Component(owner, ComponentType::RenderComponentType), m_newGeo(), m_lodGeo() {
     // empty
 }
 
@@ -87,6 +88,9 @@ bool RenderComponent::onRender(RenderBackendService *renderBackendSrv) {
     if (!m_newGeo.isEmpty()) {
         for (ui32 i = 0; i < m_newGeo.size(); i++) {
             renderBackendSrv->addMesh(m_newGeo[i], 0);
+            if (m_newGeo[i]->getNumberOfLods() > 1) {
+                m_lodGeo.add(m_newGeo[i]);
+            }
         }
         m_newGeo.resize(0);
     }
@@ -94,4 +98,15 @@ bool RenderComponent::onRender(RenderBackendService *renderBackendSrv) {
     return true;
 }
 
+void RenderComponent::updateLod(f32 screenSize, RenderBackendService *renderBackendSrv) {
+    for (ui32 i = 0; i < m_lodGeo.size(); ++i) {
+        Mesh *mesh = m_lodGeo[i];
+        const size_t lod = mesh->selectLod(screenSize);
+        if (lod != mesh->getActiveLod()) {
+            mesh->setActiveLod(lod);
+            renderBackendSrv->updateMeshLod(mesh);
+        }
+    }
+}
+
 } // namespace OSRE::App
\ No newline at end of file
@@ -148,6 +148,11 @@ public:
     /// @param array    The array with enw meshes.
     void addStaticMeshArray(const RenderBackend::MeshArray &array);
 
+    /// @brief Will select the level of detail for all meshes with a LOD chain.
+    /// @param screenSize   The projected size of the entity, relative to the viewport height.
+    /// @param rbSrv        The render backend service to update the meshes.
+    void updateLod(f32 screenSize, RenderBackend::RenderBackendService *rbSrv);
+
 protected:
     /// The update callback.
     bool onUpdate(Time dt) override;
@@ -156,6 +161,7 @@ protected:
 
 private:
     cppcore::TArray<RenderBackend::Mesh*> m_newGeo;
+    cppcore::TArray<RenderBackend::Mesh*> m_lodGeo;
 };
 
 
@@ -63,6 +63,12 @@ Entity::~Entity() {
     }
 }
 
+void Entity::onNameChanged(StringId oldNameId) {
+    if (nullptr != mOwner) {
+        mOwner->onEntityRenamed(this, oldNameId);
+    }
+}
+
 void Entity::setNode(TransformComponent *node) {
     mTransformNode = node;
 }
@@ -77,6 +77,9 @@ public:
     void setAABB( const Common::AABB &aabb );
     const Common::AABB &getAABB() const;
 
+protected:
+    void onNameChanged(Common::StringId oldNameId) override;
+
 private:
     RenderComponent *mRenderComponent;
     ComponentArray mComponentArray;
@@ -26,9 +26,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/MeshBuilder.h"
 #include "RenderBackend/MaterialBuilder.h"
+#include "RenderBackend/Mesh/MeshOptimizer.h"
 
 #include <cppcore/Random/RandomGenerator.h>
 
+#include <algorithm>
+
 namespace OSRE::App {
 
 using namespace ::OSRE::RenderBackend;
@@ -38,7 +41,6 @@ ParticleEmitter::ParticleEmitter(RenderBackendService *rbSrv) :
         mNumPoints(0),
         mCol(nullptr),
         mPos(nullptr),
-        mPtIndices(nullptr),
         mPtGeo(nullptr),
         mUseBounds(false),
         mBounds() {
@@ -68,9 +70,11 @@ void ParticleEmitter::init(ui32 numPoints) {
         mPos[i] = glm::vec3(x, y, z);
     }
 
-    mPtIndices = new GLushort[mNumPoints];
+    // The points are split into ranges of 16-bit indices, each range starts at its own base vertex
+    cppcore::TArray<ui16> ptIndices;
+    ptIndices.resize(mNumPoints);
     for (ui32 i = 0; i < mNumPoints; i++) {
-        mPtIndices[i] = static_cast<GLushort>(i);
+        ptIndices[i] = static_cast<ui16>(i % MeshOptimizer::MaxShortIndexVertices);
     }
 
     MeshBuilder meshBuilder;
@@ -78,11 +82,15 @@ void ParticleEmitter::init(ui32 numPoints) {
     mPtGeo = meshBuilder.getMesh();
     mRbSrv->addMesh(mPtGeo, 0);
     MeshBuilder::allocVertices(mPtGeo, VertexType::ColorVertex, mNumPoints, mPos, mCol, nullptr, BufferAccessType::ReadOnly);
-    ui32 pt_size = sizeof(GLushort) * mNumPoints;
-    mPtGeo->createIndexBuffer(mPtIndices, pt_size, IndexType::UnsignedShort, BufferAccessType::ReadOnly);
+    ui32 pt_size = sizeof(ui16) * mNumPoints;
+    mPtGeo->createIndexBuffer(&ptIndices[0], pt_size, IndexType::UnsignedShort, BufferAccessType::ReadOnly);
 
     // setup primitives
-    mPtGeo->addPrimitiveGroup(mNumPoints, PrimitiveType::PointList, 0);
+    for (ui32 start = 0; start < mNumPoints; start += MeshOptimizer::MaxShortIndexVertices) {
+        const size_t numPoints = std::min<size_t>(mNumPoints - start, MeshOptimizer::MaxShortIndexVertices);
+        mPtGeo->addPrimitiveGroup(numPoints, PrimitiveType::PointList, start);
+        mPtGeo->getPrimitiveGroupAt(mPtGeo->getNumberOfPrimitiveGroups() - 1)->m_baseVertex = start;
+    }
     mPtGeo->setModelMatrix(true, glm::mat4(1.0f));
 
     // setup material
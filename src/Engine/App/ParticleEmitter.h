@@ -57,7 +57,6 @@ private:
     ui32 mNumPoints;
     glm::vec3 *mCol;
     glm::vec3 *mPos;
-    GLushort *mPtIndices;
     RenderBackend::Mesh *mPtGeo;
     bool mUseBounds;
     Common::AABB mBounds;
@@ -0,0 +1,75 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "App/ResourceCacheService.h"
+#include "RenderBackend/MaterialBuilder.h"
+
+namespace OSRE::App {
+
+using namespace ::OSRE::Common;
+using namespace ::OSRE::RenderBackend;
+
+DECL_OSRE_LOG_MODULE(ResourceCacheService)
+
+LoadJobId ResourceCacheService::loadMaterialAsync(const String &matName, const TextureResourceArray &texResArray,
+        VertexType type, const MaterialLoadedFunc &onCompleted) {
+    if (matName.empty()) {
+        osre_debug(Tag, "Material name is empty.");
+        return 0;
+    }
+
+    // Decode the textures on the load threads, the material is created on the main thread afterwards
+    LoadJobArray dependencies;
+    TextureLoader loader;
+    for (size_t i = 0; i < texResArray.size(); ++i) {
+        const LoadJobId id = loadAsync(texResArray[i], loader);
+        if (id != 0) {
+            dependencies.add(id);
+        }
+    }
+
+    return mLoadQueue.enqueue(LoadWorkFunc(), [matName, texResArray, type, onCompleted](bool) {
+        Material *mat = MaterialBuilder::createBuildinMaterial(matName, texResArray, type);
+        if (onCompleted) {
+            onCompleted(mat);
+        }
+    }, dependencies);
+}
+
+bool ResourceCacheService::onOpen() {
+    return mLoadQueue.start(NumLoadThreads);
+}
+
+bool ResourceCacheService::onClose() {
+    mLoadQueue.stop();
+    mLoadQueue.dispatchCompleted();
+
+    return true;
+}
+
+bool ResourceCacheService::onUpdate() {
+    mLoadQueue.dispatchCompleted();
+
+    return true;
+}
+
+} // namespace OSRE::App
@@ -22,8 +22,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #pragma once
 
+#include "App/ResourceLoadQueue.h"
 #include "Common/AbstractService.h"
+#include "Common/Logger.h"
 #include "Common/TResourceCache.h"
+#include "RenderBackend/Material.h"
 #include "RenderBackend/RenderCommon.h"
 
 namespace OSRE::App {
@@ -35,9 +38,19 @@ using TextureResourceCache = Common::TResourceCache<TextureResourceFactory, Rend
 ///	@ingroup    Engine
 ///
 /// @brief The resource cache service.
+///
+/// Resources can be loaded on the load threads of the service. A resource moves from Unloaded 
+/// to Loading when it is queued and to Loaded or Error on the load thread, the completion 
+/// callbacks will be called on the main thread during the update of the service.
 //-------------------------------------------------------------------------------------------------
 class ResourceCacheService : public Common::AbstractService {
 public:
+    /// @brief The number of load threads.
+    static constexpr ui32 NumLoadThreads = 2;
+
+    /// @brief The callback for materials loaded in the background.
+    using MaterialLoadedFunc = std::function<void(RenderBackend::Material *mat)>;
+
     /// @brief The class constructor.
     ResourceCacheService();
 
@@ -48,19 +61,38 @@ public:
     /// @return The resource cache for textures.
     TextureResourceCache *getTextureResourceCache() const;
 
+    /// @brief Will return the queue running the background loads.
+    /// @return The load queue.
+    ResourceLoadQueue &getLoadQueue();
+
+    /// @brief Will load a resource on a load thread.
+    /// @param[in] res          The resource to load, must stay alive until the callback was called.
+    /// @param[in] loader       The loader, will be copied into the load job.
+    /// @param[in] onCompleted  Will be called on the main thread once the resource is loaded or failed.
+    /// @param[in] dependencies The load jobs to wait for before loading.
+    /// @return The id of the load job, 0 if the resource is already loading.
+    template <class TRes, class TLoader>
+    LoadJobId loadAsync(TRes *res, const TLoader &loader, const LoadCompletedFunc &onCompleted = LoadCompletedFunc(),
+        const LoadJobArray &dependencies = LoadJobArray());
+
+    /// @brief Will load the textures of a built-in material on the load threads and create the material 
+    ///        once all of them are available.
+    /// @param[in] matName      The name of the material.
+    /// @param[in] texResArray  The textures of the material.
+    /// @param[in] type         The vertex type.
+    /// @param[in] onCompleted  Will be called on the main thread with the created material.
+    /// @return The id of the load job creating the material.
+    LoadJobId loadMaterialAsync(const String &matName, const RenderBackend::TextureResourceArray &texResArray,
+        RenderBackend::VertexType type, const MaterialLoadedFunc &onCompleted);
+
 protected:
-    bool onOpen() override {
-        return true;
-    }
-    bool onClose() override {
-        return true;
-    }
-    bool onUpdate() override {
-        return true;
-    }
+    bool onOpen() override;
+    bool onClose() override;
+    bool onUpdate() override;
 
 private:
     TextureResourceCache *m_texResCache;
+    ResourceLoadQueue mLoadQueue;
 };
 
 inline ResourceCacheService::ResourceCacheService() :
@@ -77,4 +109,30 @@ inline TextureResourceCache *ResourceCacheService::getTextureResourceCache() con
     return m_texResCache;
 }
 
+inline ResourceLoadQueue &ResourceCacheService::getLoadQueue() {
+    return mLoadQueue;
+}
+
+template <class TRes, class TLoader>
+inline LoadJobId ResourceCacheService::loadAsync(TRes *res, const TLoader &loader, const LoadCompletedFunc &onCompleted,
+        const LoadJobArray &dependencies) {
+    if (res == nullptr) {
+        return 0;
+    }
+
+    if (res->getState() == Common::ResourceState::Loaded) {
+        // Nothing to load, just keep the order of the callbacks
+        return mLoadQueue.enqueue(LoadWorkFunc(), onCompleted, dependencies);
+    }
+
+    if (!res->beginLoad()) {
+        osre_debug(getName(), "Resource " + res->getName() + " is already loading.");
+        return 0;
+    }
+
+    return mLoadQueue.enqueue([res, loader]() mutable {
+        return res->load(loader) == Common::ResourceState::Loaded;
+    }, onCompleted, dependencies);
+}
+
 } // namespace OSRE::App
@@ -0,0 +1,255 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "App/ResourceLoadQueue.h"
+#include "Common/Logger.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OSRE::App {
+
+DECL_OSRE_LOG_MODULE(ResourceLoadQueue)
+
+/// One enqueued job, kept until its callback was dispatched.
+struct LoadJob {
+    LoadWorkFunc mWork;
+    LoadCompletedFunc mOnCompleted;
+    size_t mNumWaiting = 0;
+    std::vector<LoadJobId> mDependents;
+    bool mDone = false;
+};
+
+/// A finished job waiting for dispatchCompleted().
+struct CompletedJob {
+    LoadJobId mId;
+    bool mSuccess;
+};
+
+struct ResourceLoadQueueImpl {
+    mutable std::mutex mLock;
+    std::condition_variable mWakeup;
+    std::condition_variable mIdle;
+    std::unordered_map<LoadJobId, LoadJob> mJobs;
+    std::deque<LoadJobId> mReady;
+    std::vector<CompletedJob> mCompleted;
+    std::vector<std::thread> mWorkers;
+    LoadJobId mNextId = 1;
+    size_t mNumUnfinished = 0;
+    bool mRunning = false;
+
+    bool takeJob(LoadJobId &id, LoadWorkFunc &work);
+    void finish(LoadJobId id, bool success);
+    void execute(LoadJobId id, const LoadWorkFunc &work);
+    void workerLoop();
+};
+
+bool ResourceLoadQueueImpl::takeJob(LoadJobId &id, LoadWorkFunc &work) {
+    if (mReady.empty()) {
+        return false;
+    }
+
+    id = mReady.front();
+    mReady.pop_front();
+    work = std::move(mJobs[id].mWork);
+
+    return true;
+}
+
+void ResourceLoadQueueImpl::finish(LoadJobId id, bool success) {
+    {
+        std::lock_guard<std::mutex> guard(mLock);
+        LoadJob &job = mJobs[id];
+        job.mDone = true;
+        mCompleted.push_back({ id, success });
+        for (const LoadJobId dependent : job.mDependents) {
+            if (--mJobs[dependent].mNumWaiting == 0) {
+                mReady.push_back(dependent);
+            }
+        }
+        job.mDependents.clear();
+        --mNumUnfinished;
+        if (mNumUnfinished != 0) {
+            mWakeup.notify_all();
+            return;
+        }
+    }
+    mIdle.notify_all();
+}
+
+void ResourceLoadQueueImpl::execute(LoadJobId id, const LoadWorkFunc &work) {
+    // Jobs without work only wait for their dependencies
+    const bool success = work ? work() : true;
+    if (!success) {
+        osre_debug(Tag, "Load job " + std::to_string(id) + " failed.");
+    }
+    finish(id, success);
+}
+
+void ResourceLoadQueueImpl::workerLoop() {
+    for (;;) {
+        LoadJobId id = 0;
+        LoadWorkFunc work;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mWakeup.wait(lock, [this]() { return !mRunning || !mReady.empty(); });
+            if (!mRunning) {
+                return;
+            }
+            takeJob(id, work);
+        }
+        execute(id, work);
+    }
+}
+
+ResourceLoadQueue::ResourceLoadQueue() :
+        mImpl(new ResourceLoadQueueImpl) {
+    // empty
+}
+
+ResourceLoadQueue::~ResourceLoadQueue() {
+    stop();
+    delete mImpl;
+}
+
+bool ResourceLoadQueue::start(ui32 numThreads) {
+    if (numThreads == 0) {
+        osre_error(Tag, "At least one load thread is required.");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    if (mImpl->mRunning) {
+        osre_debug(Tag, "Load threads already running.");
+        return false;
+    }
+
+    mImpl->mRunning = true;
+    for (ui32 i = 0; i < numThreads; ++i) {
+        mImpl->mWorkers.emplace_back(&ResourceLoadQueueImpl::workerLoop, mImpl);
+    }
+
+    return true;
+}
+
+void ResourceLoadQueue::stop() {
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        if (!mImpl->mRunning) {
+            return;
+        }
+        mImpl->mRunning = false;
+    }
+    mImpl->mWakeup.notify_all();
+    for (auto &worker : mImpl->mWorkers) {
+        worker.join();
+    }
+    mImpl->mWorkers.clear();
+    mImpl->mIdle.notify_all();
+}
+
+bool ResourceLoadQueue::isRunning() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    return mImpl->mRunning;
+}
+
+LoadJobId ResourceLoadQueue::enqueue(const LoadWorkFunc &work, const LoadCompletedFunc &onCompleted, 
+        const LoadJobArray &dependencies) {
+    LoadJobId id = 0;
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        id = mImpl->mNextId++;
+        LoadJob &job = mImpl->mJobs[id];
+        job.mWork = work;
+        job.mOnCompleted = onCompleted;
+        for (size_t i = 0; i < dependencies.size(); ++i) {
+            auto it = mImpl->mJobs.find(dependencies[i]);
+            if (it == mImpl->mJobs.end() || it->first == id || it->second.mDone) {
+                continue;
+            }
+            it->second.mDependents.push_back(id);
+            ++job.mNumWaiting;
+        }
+        ++mImpl->mNumUnfinished;
+        if (job.mNumWaiting == 0) {
+            mImpl->mReady.push_back(id);
+        }
+    }
+    mImpl->mWakeup.notify_one();
+
+    return id;
+}
+
+size_t ResourceLoadQueue::dispatchCompleted() {
+    std::vector<std::pair<LoadCompletedFunc, bool>> callbacks;
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        callbacks.reserve(mImpl->mCompleted.size());
+        for (const CompletedJob &completed : mImpl->mCompleted) {
+            auto it = mImpl->mJobs.find(completed.mId);
+            callbacks.emplace_back(std::move(it->second.mOnCompleted), completed.mSuccess);
+            mImpl->mJobs.erase(it);
+        }
+        mImpl->mCompleted.clear();
+    }
+
+    // Callbacks may enqueue new jobs, so call them without holding the lock
+    for (const auto &callback : callbacks) {
+        if (callback.first) {
+            callback.first(callback.second);
+        }
+    }
+
+    return callbacks.size();
+}
+
+void ResourceLoadQueue::waitIdle() {
+    std::unique_lock<std::mutex> lock(mImpl->mLock);
+    if (mImpl->mRunning) {
+        mImpl->mIdle.wait(lock, [this]() {
+            return !mImpl->mRunning || mImpl->mNumUnfinished == 0;
+        });
+        return;
+    }
+
+    // No load threads, so do the work here. Dependencies are always enqueued before their 
+    // dependents, so every job becomes ready eventually.
+    LoadJobId id = 0;
+    LoadWorkFunc work;
+    while (mImpl->takeJob(id, work)) {
+        lock.unlock();
+        mImpl->execute(id, work);
+        lock.lock();
+    }
+}
+
+size_t ResourceLoadQueue::getNumPending() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    return mImpl->mNumUnfinished;
+}
+
+} // Namespace OSRE::App
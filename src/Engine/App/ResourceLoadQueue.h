@@ -0,0 +1,103 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+
+#include <cppcore/Container/TArray.h>
+#include <functional>
+
+namespace OSRE::App {
+
+/// @brief  Identifies a job of the resource load queue, 0 is not a valid job.
+using LoadJobId = ui64;
+
+/// @brief  An array of job ids, used to describe dependencies.
+using LoadJobArray = cppcore::TArray<LoadJobId>;
+
+/// @brief  The work of a job, runs on a worker thread and returns true on success.
+using LoadWorkFunc = std::function<bool()>;
+
+/// @brief  The completion callback of a job, runs on the thread calling dispatchCompleted.
+using LoadCompletedFunc = std::function<void(bool success)>;
+
+struct ResourceLoadQueueImpl;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class runs resource load jobs on a pool of worker threads.
+///
+/// A job starts once all its dependencies are finished, successful or not, so a material job
+/// can wait for its texture and shader jobs. Jobs without work only wait for their dependencies.
+/// The completion callbacks are not called on the workers, dispatchCompleted() calls them on
+/// the owning thread in the order the jobs finished, so a dependency is always reported before
+/// the jobs waiting for it.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT ResourceLoadQueue {
+public:
+    /// @brief  The default class constructor.
+    ResourceLoadQueue();
+
+    /// @brief  The class destructor, will stop the workers.
+    ~ResourceLoadQueue();
+
+    /// @brief  Will start the worker threads.
+    /// @param  numThreads      [in] The number of worker threads.
+    /// @return true, if successful.
+    bool start(ui32 numThreads);
+
+    /// @brief  Will stop the worker threads, jobs not started yet are kept.
+    void stop();
+
+    /// @brief  Returns true, if the worker threads are running.
+    /// @return true if running.
+    bool isRunning() const;
+
+    /// @brief  Will enqueue a job.
+    /// @param  work            [in] The work to run on a worker, empty for a job which only waits.
+    /// @param  onCompleted     [in] The callback to call once the job is finished, may be empty.
+    /// @param  dependencies    [in] The jobs to wait for. Unknown ids count as finished.
+    /// @return The id of the job.
+    LoadJobId enqueue(const LoadWorkFunc &work, const LoadCompletedFunc &onCompleted = LoadCompletedFunc(),
+        const LoadJobArray &dependencies = LoadJobArray());
+
+    /// @brief  Will call the callbacks of all finished jobs on the calling thread.
+    /// @return The number of finished jobs.
+    size_t dispatchCompleted();
+
+    /// @brief  Will block until all jobs are finished. When no worker is running the jobs will
+    ///         run on the calling thread.
+    void waitIdle();
+
+    /// @brief  Returns the number of jobs not finished yet.
+    /// @return The number of pending jobs.
+    size_t getNumPending() const;
+
+    OSRE_NON_COPYABLE(ResourceLoadQueue)
+
+private:
+    ResourceLoadQueueImpl *mImpl;
+};
+
+} // Namespace OSRE::App
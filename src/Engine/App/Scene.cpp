@@ -25,9 +25,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/Logger.h"
 #include "Common/StringUtils.h"
 #include "Debugging/osre_debugging.h"
+#include "Profiling/CpuProfiler.h"
 #include "RenderBackend/MeshProcessor.h"
 #include "RenderBackend/RenderBackendService.h"
 #include "App/CameraComponent.h"
+#include "App/TransformComponent.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace OSRE::App {
 
@@ -45,13 +50,35 @@ Scene::Scene(const String &worldName) :
     // empty
 }
 
-void Scene::addEntity(Entity *entity) {
+EntityHandle Scene::addEntity(Entity *entity) {
     if (nullptr == entity) {
         osre_debug(Tag, "Pointer to entity are nullptr");
-        return;
+        return EntityHandle();
     }
-    mDirtry = true;
+
+    EntityHandle handle = getEntityHandle(entity);
+    if (handle.isValid()) {
+        return handle;
+    }
+
+    // Released slots are reused, new slots are appended
+    const ui32 slotIndex = static_cast<ui32>(mFreeEntitySlots.getUniqueId());
+    osre_assert(slotIndex <= mEntitySlots.size());
+    if (slotIndex == mEntitySlots.size()) {
+        mEntitySlots.add(EntitySlot{ EntityHandle::InvalidIndex, 1 });
+    }
+    EntitySlot &slot = mEntitySlots[slotIndex];
+    slot.DenseIndex = static_cast<ui32>(mEntities.size());
     mEntities.add(entity);
+    mEntitySlotIndices.add(slotIndex);
+    mEntityNames.emplace(entity->getNameId(), entity);
+
+    handle.Index = slotIndex;
+    handle.Generation = slot.Generation;
+    entity->setGuid(handle.toGuid());
+    mDirtry = true;
+
+    return handle;
 }
 
 Entity *Scene::findEntity(const String &name) {
@@ -59,33 +86,109 @@ Entity *Scene::findEntity(const String &name) {
         return nullptr;
     }
 
-    Entity *currentEntity{ nullptr };
-    for (size_t i = 0; i < mEntities.size(); ++i) {
-        currentEntity = mEntities[i];
-        if (currentEntity != nullptr) {
-            if (currentEntity->getName() == name) {
-                return currentEntity;
-            }
+    return findEntity(StringId::find(name));
+}
+
+Entity *Scene::findEntity(StringId nameId) const {
+    if (nameId.isEmpty()) {
+        return nullptr;
+    }
+
+    // Entities added to a scene they were not created for do not report a rename
+    auto range = mEntityNames.equal_range(nameId);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->getNameId() == nameId) {
+            return it->second;
         }
     }
 
     return nullptr;
 }
 
+void Scene::onEntityRenamed(Entity *entity, StringId oldNameId) {
+    if (!getEntityHandle(entity).isValid()) {
+        return;
+    }
+
+    removeFromNameIndex(entity, oldNameId);
+    mEntityNames.emplace(entity->getNameId(), entity);
+}
+
 bool Scene::removeEntity(Entity *entity) {
     if (nullptr == entity) {
         return false;
     }
 
-    bool found = false;
-    TArray<Entity *>::Iterator it = mEntities.linearSearch(entity);
-    if (mEntities.end() != it) {
-        mEntities.remove(it);
-        found = true;
-        mDirtry = true;
+    return removeEntity(getEntityHandle(entity));
+}
+
+bool Scene::removeEntity(EntityHandle handle) {
+    Entity *entity = getEntity(handle);
+    if (nullptr == entity) {
+        return false;
+    }
+
+    // Move the last entity into the gap
+    EntitySlot &slot = mEntitySlots[handle.Index];
+    const ui32 denseIndex = slot.DenseIndex;
+    const ui32 lastIndex = static_cast<ui32>(mEntities.size() - 1);
+    if (denseIndex != lastIndex) {
+        mEntities[denseIndex] = mEntities[lastIndex];
+        mEntitySlotIndices[denseIndex] = mEntitySlotIndices[lastIndex];
+        mEntitySlots[mEntitySlotIndices[denseIndex]].DenseIndex = denseIndex;
+    }
+    mEntities.removeBack();
+    mEntitySlotIndices.removeBack();
+
+    removeFromNameIndex(entity, entity->getNameId());
+
+    // Outdate all handles of the slot
+    slot.DenseIndex = EntityHandle::InvalidIndex;
+    ++slot.Generation;
+    if (slot.Generation == 0) {
+        slot.Generation = 1;
+    }
+    mFreeEntitySlots.releaseId(handle.Index);
+    entity->setGuid(0);
+    mDirtry = true;
+
+    return true;
+}
+
+void Scene::removeFromNameIndex(Entity *entity, StringId nameId) {
+    auto range = mEntityNames.equal_range(nameId);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == entity) {
+            mEntityNames.erase(it);
+            return;
+        }
+    }
+}
+
+Entity *Scene::getEntity(EntityHandle handle) const {
+    if (!handle.isValid() || handle.Index >= mEntitySlots.size()) {
+        return nullptr;
     }
 
-    return found;
+    const EntitySlot &slot = mEntitySlots[handle.Index];
+    if (slot.Generation != handle.Generation || slot.DenseIndex == EntityHandle::InvalidIndex) {
+        return nullptr;
+    }
+
+    return mEntities[slot.DenseIndex];
+}
+
+EntityHandle Scene::getEntityHandle(const Entity *entity) const {
+    if (nullptr == entity) {
+        return EntityHandle();
+    }
+
+    const EntityHandle handle = EntityHandle::fromGuid(entity->getGuid());
+    if (getEntity(handle) != entity) {
+        return EntityHandle();
+    }
+
+    return handle;
 }
 
 size_t Scene::getNumEntities() const {
@@ -115,17 +218,7 @@ Entity *Scene::getEntityByName(const String &name) const {
         return nullptr;
     }
 
-    Entity *entity = nullptr;
-    for (size_t i = 0; i < mEntities.size(); ++i) {
-        if (nullptr != mEntities[i]) {
-            if (mEntities[i]->getName() == name) {
-                entity = mEntities[i];
-                break;
-            }
-        }
-    }
-
-    return entity;
+    return findEntity(StringId::find(name));
 }
 
 void Scene::setSceneRoot(TransformComponent *root) {
@@ -139,6 +232,7 @@ void Scene::init() {
 }
 
 void Scene::update(Time dt) {
+    OSRE_PROFILE_SCOPE("Scene::update");
     if (mActiveCamera != nullptr) {
         mActiveCamera->update(dt);
     }
@@ -154,6 +248,27 @@ void Scene::update(Time dt) {
     }
 }
 
+// Returns the projected size of the bounding sphere, relative to the viewport height
+static f32 computeScreenSize(Entity *entity, CameraComponent *camera) {
+    const AABB &aabb = entity->getAABB();
+    glm::mat4 world(1.0f);
+    TransformComponent *node = entity->getNode();
+    if (node != nullptr) {
+        world = node->getWorlTransformMatrix();
+    }
+
+    const f32 scale = std::max(glm::length(glm::vec3(world[0])), std::max(glm::length(glm::vec3(world[1])), glm::length(glm::vec3(world[2]))));
+    const f32 radius = aabb.getDiameter() * 0.5f * scale;
+    const glm::vec3 center = glm::vec3(world * glm::vec4(aabb.getCenter(), 1.0f));
+    const f32 distance = glm::length(center - camera->getEye());
+    const f32 tanHalfFov = std::tan(camera->getFov() * 0.5f);
+    if (distance <= radius || tanHalfFov <= 0.0f) {
+        return 1.0f;
+    }
+
+    return radius / (distance * tanHalfFov);
+}
+
 void Scene::render(RenderBackendService *rbSrv) {
     osre_assert(nullptr != rbSrv);
 
@@ -165,8 +280,16 @@ void Scene::render(RenderBackendService *rbSrv) {
     }
 
     for (Entity *entity : mEntities) {
-        if (nullptr != entity) {
-            entity->render(rbSrv);
+        if (nullptr == entity) {
+            continue;
+        }
+
+        entity->render(rbSrv);
+        if (mActiveCamera != nullptr) {
+            RenderComponent *rc = (RenderComponent *)entity->getComponent(ComponentType::RenderComponentType);
+            if (rc != nullptr) {
+                rc->updateLod(computeScreenSize(entity, mActiveCamera), rbSrv);
+            }
         }
     }
 
@@ -30,12 +30,47 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cppcore/Container/TArray.h>
 #include <cppcore/Container/THashMap.h>
 
+#include <unordered_map>
+
 namespace OSRE {
 namespace App {
 
 // Forward declarations ---------------------------------------------------------------------------
 class Entity;
 
+/// @brief  A stable handle to an entity of a scene. The handle of a removed entity stays invalid,
+///         even when its slot is reused by another entity.
+struct EntityHandle {
+    static constexpr ui32 InvalidIndex = 0xffffffff;
+
+    ui32 Index = InvalidIndex;  ///< The slot index.
+    ui32 Generation = 0;        ///< The generation of the slot, 0 for an invalid handle.
+
+    /// @brief  Will return true, if the handle was assigned by a scene.
+    /// @return true for a valid handle.
+    bool isValid() const {
+        return Generation != 0;
+    }
+
+    /// @brief  Will pack the handle into a guid, 0 for an invalid handle.
+    /// @return The guid.
+    guid toGuid() const {
+        return isValid() ? (static_cast<guid>(Generation) << 32) | Index : 0;
+    }
+
+    /// @brief  Will unpack a handle from a guid.
+    /// @param[in] id   The guid.
+    /// @return The handle.
+    static EntityHandle fromGuid(guid id) {
+        EntityHandle handle;
+        if (id != 0) {
+            handle.Index = static_cast<ui32>(id & 0xffffffff);
+            handle.Generation = static_cast<ui32>(id >> 32);
+        }
+        return handle;
+    }
+};
+
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
@@ -43,6 +78,12 @@ class Entity;
 ///
 /// Scenes are the container for all content which shall be rendered.
 /// A scene can be seen by defining one or more active cameras. 
+///
+/// The entities are stored in a dense array, which is reordered when entities are removed. Each
+/// entity gets a generation-counted handle, stored as its guid, and is indexed by its name. Renamed
+/// entities notify the scene they were created for, so its name index stays current. Entities added
+/// to another scene are not found there by a new name. Lookups by handle or name and removals take
+/// constant time.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT Scene : public Common::Object {
 public:
@@ -54,14 +95,31 @@ public:
     /// @brief  The class destructor.
     ~Scene() override = default;
 
-    /// @brief Will add a new entity.
+    /// @brief Will add a new entity, an entity which is already part of the scene is not added again.
     /// @param entity   The entity to add.
-    void addEntity(Entity *entity);
+    /// @return The handle of the entity, invalid in case of an error.
+    EntityHandle addEntity(Entity *entity);
     
     /// @brief Will remove the entity from the world.
     /// @param entity   The entity to remove.
+    /// @return true if the entity was removed, false if it is not part of the scene.
     bool removeEntity(Entity *entity);
 
+    /// @brief Will remove the entity of a handle from the world.
+    /// @param handle   The handle of the entity to remove.
+    /// @return true if the entity was removed, false for an invalid or outdated handle.
+    bool removeEntity(EntityHandle handle);
+
+    /// @brief Will return the entity of a handle.
+    /// @param handle   The entity handle.
+    /// @return The entity instance or nullptr for an invalid or outdated handle.
+    Entity *getEntity(EntityHandle handle) const;
+
+    /// @brief Will return the handle of an entity.
+    /// @param entity   The entity.
+    /// @return The handle, invalid if the entity is not part of the scene.
+    EntityHandle getEntityHandle(const Entity *entity) const;
+
     /// @brief Will return the number of entities in the scene.
     /// @return Number of entities.
     size_t getNumEntities() const;
@@ -76,6 +134,16 @@ public:
     /// @return A pointer showing ot the entity or nullptr, if nothing was found.
     Entity *findEntity(const String &name);
 
+    /// @brief Will search for an entity by its interned name.
+    /// @param[in] nameId  The name id to look for.
+    /// @return A pointer showing ot the entity or nullptr, if nothing was found.
+    Entity *findEntity(Common::StringId nameId) const;
+
+    /// @brief Will move an entity to its new name in the name index, called when an entity was renamed.
+    /// @param[in] entity     The renamed entity.
+    /// @param[in] oldNameId  The name the entity was indexed with.
+    void onEntityRenamed(Entity *entity, Common::StringId oldNameId);
+
     /// @brief Will set the new active camera.
     /// @param[in] camera   The new camera.
     /// @return true if successful, false in case of an error.
@@ -117,7 +185,20 @@ protected:
     void updateBoundingTrees();
 
 private:
+    void removeFromNameIndex(Entity *entity, Common::StringId nameId);
+
+private:
+    struct EntitySlot {
+        ui32 DenseIndex;    ///< The index in the entity array, InvalidIndex for a free slot.
+        ui32 Generation;    ///< Incremented each time the slot is released.
+    };
+    using EntityNameIndex = std::unordered_multimap<Common::StringId, Entity*, Common::StringId::Hash>;
+
     cppcore::TArray<Entity*> mEntities;
+    cppcore::TArray<ui32> mEntitySlotIndices;
+    cppcore::TArray<EntitySlot> mEntitySlots;
+    Common::Ids mFreeEntitySlots;
+    EntityNameIndex mEntityNames;
     CameraComponent *mActiveCamera;
     TransformComponent *mRoot;
     Common::Ids mIds;
@@ -91,12 +91,17 @@ bool TransformComponent::removeChild(const String &name, TraverseMode mode) {
         return false;
     }
 
+    const StringId nameId = StringId::find(name);
+    if (nameId.isEmpty()) {
+        return false;
+    }
+
     bool found = false;
     TransformComponent *currentNode = nullptr;
     for (ui32 i = 0; i < mChildren.size(); i++) {
         currentNode = mChildren[i];
         if (nullptr != currentNode) {
-            if (currentNode->getName() == name) {
+            if (currentNode->getNameId() == nameId) {
                 found = true;
                 mChildren.remove(i);
                 releaseTransformComponent(currentNode);
@@ -120,11 +125,19 @@ TransformComponent *TransformComponent::findChild(const String &name) const {
         return nullptr;
     }
 
+    return findChild(StringId::find(name));
+}
+
+TransformComponent *TransformComponent::findChild(StringId nameId) const {
+    if (nameId.isEmpty()) {
+        return nullptr;
+    }
+
     TransformComponent *currentNode = nullptr;
     for (ui32 i = 0; i < mChildren.size(); i++) {
         currentNode = mChildren[i];
         if (nullptr != currentNode) {
-            if (currentNode->getName() == name) {
+            if (currentNode->getNameId() == nameId) {
                 return currentNode;
             }
         }
@@ -81,6 +81,7 @@ public:
     virtual void addChild(TransformComponent *child);
     virtual bool removeChild(const String &name, TraverseMode mode);
     virtual TransformComponent *findChild(const String &name) const;
+    virtual TransformComponent *findChild(Common::StringId nameId) const;
     virtual size_t getNumChildren() const;
     virtual TransformComponent *getChildAt(size_t idx) const;
     virtual void releaseChildren();
@@ -24,11 +24,47 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/Event.h"
 #include "Common/StringUtils.h"
 
+#include <cppcore/Container/THashMap.h>
+
+#include <atomic>
+#include <mutex>
+
 namespace OSRE::Common {
 
+namespace {
+
+// Assigns the dense type ids, events are constructed during static initialization as well
+struct EventTypeRegistry {
+    std::mutex mMutex;
+    cppcore::THashMap<HashId, ui32> mTypeIds;
+    std::atomic<ui32> mNumTypes{ 0 };
+
+    static EventTypeRegistry &get() {
+        static EventTypeRegistry registry;
+        return registry;
+    }
+
+    ui32 getTypeId(HashId hash) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        ui32 typeId = 0;
+        if (mTypeIds.hasKey(hash)) {
+            mTypeIds.getValue(hash, typeId);
+            return typeId;
+        }
+        typeId = mNumTypes.load(std::memory_order_relaxed);
+        mTypeIds.insert(hash, typeId);
+        mNumTypes.store(typeId + 1, std::memory_order_release);
+
+        return typeId;
+    }
+};
+
+} // namespace
+
 Event::Event(const c8 *id) :
         mNumRefs(1),
         mHash(StringUtils::hashName(id)),
+        mTypeId(EventTypeRegistry::get().getTypeId(mHash)),
         mId(id),
         mEventData(nullptr) {
     // empty
@@ -46,6 +82,14 @@ HashId Event::getHash() const {
     return mHash;
 }
 
+ui32 Event::getTypeId() const {
+    return mTypeId;
+}
+
+ui32 Event::getNumTypes() {
+    return EventTypeRegistry::get().mNumTypes.load(std::memory_order_acquire);
+}
+
 const String Event::getId() const {
     String tmp(mId);
     return tmp;
@@ -82,15 +126,26 @@ EventTriggerer *EventData::getEventSender() const {
     return mSource;
 }
 
+void EventData::setTimestamp(d32 timestamp) {
+    mTimestamp = timestamp;
+}
+
+d32 EventData::getTimestamp() const {
+    return mTimestamp;
+}
+
 void EventData::get() {
-    ++mNumRefs;
+    mNumRefs.fetch_add(1, std::memory_order_relaxed);
 }
 
 void EventData::release() {
-    if (mNumRefs) {
-        --mNumRefs;
-        if (mNumRefs == 0) {
-            delete this;
+    ui32 numRefs = mNumRefs.load(std::memory_order_relaxed);
+    while (numRefs != 0) {
+        if (mNumRefs.compare_exchange_weak(numRefs, numRefs - 1, std::memory_order_acq_rel)) {
+            if (numRefs == 1) {
+                delete this;
+            }
+            return;
         }
     }
 }
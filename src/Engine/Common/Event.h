@@ -28,6 +28,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cppcore/Container/TArray.h>
 #include <cppcore/Container/TList.h>
 
+#include <atomic>
+
 namespace OSRE::Common {
 
 // Forward declarations ---------------------------------------------------------------------------
@@ -71,6 +73,14 @@ struct OSRE_EXPORT Event {
     /// @return The hash id.
     HashId getHash() const;
 
+    /// @brief  Returns the dense type id of the event, all events with the same id string share it.
+    /// @return The type id.
+    ui32 getTypeId() const;
+
+    /// @brief  Returns the number of registered event types, all type ids are below it.
+    /// @return The number of event types.
+    static ui32 getNumTypes();
+
     const String getId() const;
 
     ///	@brief	A reference ownership will be marked.
@@ -90,6 +100,7 @@ struct OSRE_EXPORT Event {
 
     ui32 mNumRefs;
     HashId mHash;
+    ui32 mTypeId;
     const c8 *mId;
     const EventData *mEventData;
 };
@@ -122,10 +133,19 @@ struct OSRE_EXPORT EventData {
     ///	@return	Pointer to assigned event instance.
     EventTriggerer *getEventSender() const;
 
+    ///	@brief	Will set the time the platform has received the event.
+    ///	@param	timestamp	[in] The timestamp in seconds.
+    void setTimestamp(d32 timestamp);
+
+    ///	@brief	Returns the time the platform has received the event.
+    ///	@return	The timestamp in seconds, 0 if the platform has not set one.
+    d32 getTimestamp() const;
+
     ///	@brief  Adds another reference ownership.
     void get();
 
-    ///	@brief  Releases reference ownership, if no owners are there data will be deleted..
+    ///	@brief  Releases reference ownership, if no owners are there data will be deleted.
+    ///         Both calls are thread-safe.
     void release();
 
     ///	@brief	Equal operator implementation.
@@ -142,7 +162,7 @@ private:
     const Event &mEvent;
     EventTriggerer *mSource;
     d32 mTimestamp;
-    ui32 mNumRefs;
+    std::atomic<ui32> mNumRefs;
     void *mPayload;
 };
 
@@ -25,16 +25,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Debugging/osre_debugging.h"
 #include "Common/AbstractEventHandler.h"
 
-#include <cppcore/Memory/TStackAllocator.h>
-
 namespace OSRE::Common {
 
-::cppcore::TStackAllocator<QueueEntry> QueueEntryAlloctor;
-
-static constexpr c8 Tag[] = "EventBus";
-
 EventBus::EventBus() :
-        mSuscribedHandler(), mQueueEntryArray(), mCreated(false) {
+        mHandlerTable(),
+        mQueues(),
+        mActiveQueue(0),
+        mRemoteMutex(),
+        mRemoteQueues(),
+        mActiveRemoteQueue(0),
+        mOwner(),
+        mCreated(false) {
     // empty
 }
 
@@ -43,8 +44,8 @@ bool EventBus::create() {
         return false;
     }
 
+    mOwner = std::this_thread::get_id();
     mCreated = true;
-    QueueEntryAlloctor.reserve(1000);
 
     return mCreated;
 }
@@ -58,7 +59,15 @@ bool EventBus::destroy() {
         return false;
     }
 
-    QueueEntryAlloctor.clear();
+    for (ui32 i = 0; i < 2; ++i) {
+        clearQueue(mQueues[i]);
+        std::lock_guard<std::mutex> lock(mRemoteMutex);
+        clearQueue(mRemoteQueues[i]);
+    }
+    for (ui32 i = 0; i < mHandlerTable.size(); ++i) {
+        delete mHandlerTable[i];
+    }
+    mHandlerTable.clear();
     mCreated = false;
 
     return true;
@@ -66,28 +75,20 @@ bool EventBus::destroy() {
 
 void EventBus::update() {
     osre_assert(mCreated);
-    if (mQueueEntryArray.isEmpty()) {
-        return;
+    osre_assert(std::this_thread::get_id() == mOwner);
+
+    // Swap the queues, events published by the handlers will be dispatched with the next update
+    QueueEntryArray &queue = mQueues[mActiveQueue];
+    mActiveQueue = (mActiveQueue + 1) % 2;
+    QueueEntryArray *remoteQueue = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mRemoteMutex);
+        remoteQueue = &mRemoteQueues[mActiveRemoteQueue];
+        mActiveRemoteQueue = (mActiveRemoteQueue + 1) % 2;
     }
 
-    for (ui32 i = 0; i < mQueueEntryArray.size(); ++i) {
-        const QueueEntry *entry = mQueueEntryArray[i];
-        if (nullptr == entry) {
-            continue;
-        }
-
-        const HashId id = entry->mAction.mEvent->getHash();
-        if (mSuscribedHandler.hasKey(id)) {
-            EventHandlerArray *ehArray = nullptr;
-            mSuscribedHandler.getValue(id, ehArray);
-            for (ui32 j = 0; j < ehArray->size(); ++j) {
-                AbstractEventHandler *eh = (*ehArray)[j];
-                eh->onEvent(*entry->mAction.mEvent, entry->mAction.mEventData);
-            }
-        }
-    }
-    mQueueEntryArray.resize(0);
-    QueueEntryAlloctor.reset();
+    dispatch(queue);
+    dispatch(*remoteQueue);
 }
 
 void EventBus::subscribeEventHandler(AbstractEventHandler *handler, const Event &ev) {
@@ -96,16 +97,14 @@ void EventBus::subscribeEventHandler(AbstractEventHandler *handler, const Event
         return;
     }
 
-    const HashId id = ev.getHash();
-    EventHandlerArray *ehArray = nullptr;
-    if (mSuscribedHandler.hasKey(id)) {
-        mSuscribedHandler.getValue(id, ehArray);            
-    } else {
-        ehArray = new EventHandlerArray;
-        mSuscribedHandler.insert(id, ehArray);
+    const ui32 typeId = ev.getTypeId();
+    while (mHandlerTable.size() <= typeId) {
+        mHandlerTable.add(nullptr);
     }
-    osre_assert(nullptr != ehArray);
-     ehArray->add(handler);
+    if (nullptr == mHandlerTable[typeId]) {
+        mHandlerTable[typeId] = new EventHandlerArray;
+    }
+    mHandlerTable[typeId]->add(handler);
 }
 
 void EventBus::unsubscribeEventHandler(AbstractEventHandler *handler, const Event &ev) {
@@ -114,14 +113,16 @@ void EventBus::unsubscribeEventHandler(AbstractEventHandler *handler, const Even
     if (nullptr == handler) {
         return;
     }
-    const HashId id = ev.getHash();
-    if (mSuscribedHandler.hasKey(id)) {
-        EventHandlerArray *ehArray = nullptr;
-        mSuscribedHandler.getValue(id, ehArray);
-        for (ui32 i = 0; i < ehArray->size(); ++i) {
-            if ((*ehArray)[i] == handler) {
-                ehArray->remove(i);
-            }
+    const ui32 typeId = ev.getTypeId();
+    if (typeId >= mHandlerTable.size() || nullptr == mHandlerTable[typeId]) {
+        return;
+    }
+
+    EventHandlerArray &ehArray = *mHandlerTable[typeId];
+    for (ui32 i = 0; i < ehArray.size(); ++i) {
+        if (ehArray[i] == handler) {
+            ehArray.remove(i);
+            break;
         }
     }
 }
@@ -129,16 +130,47 @@ void EventBus::unsubscribeEventHandler(AbstractEventHandler *handler, const Even
 void EventBus::publish( const Event &ev, const EventData *eventData ) {
     osre_assert(mCreated);
 
-    QueueEntry *entry = QueueEntryAlloctor.alloc(1);
-    osre_assert(entry != nullptr);
-    if (entry == nullptr) {
-        osre_fatal(Tag, "CAnnot allocate any new Queue event entried.");
+    if (nullptr != eventData) {
+        const_cast<EventData*>(eventData)->get();
+    }
+    const PendingEvent entry = { &ev, eventData };
+    if (std::this_thread::get_id() == mOwner) {
+        mQueues[mActiveQueue].add(entry);
         return;
     }
 
-    entry->mAction.mEvent = &ev;
-    entry->mAction.mEventData = eventData;
-    mQueueEntryArray.add(entry);
+    std::lock_guard<std::mutex> lock(mRemoteMutex);
+    mRemoteQueues[mActiveRemoteQueue].add(entry);
+}
+
+size_t EventBus::getNumQueuedEvents() {
+    std::lock_guard<std::mutex> lock(mRemoteMutex);
+    return mQueues[mActiveQueue].size() + mRemoteQueues[mActiveRemoteQueue].size();
+}
+
+void EventBus::dispatch(QueueEntryArray &queue) {
+    const size_t numHandlerArrays = mHandlerTable.size();
+    for (size_t i = 0; i < queue.size(); ++i) {
+        const PendingEvent &entry = queue[i];
+        const ui32 typeId = entry.mEvent->getTypeId();
+        if (typeId < numHandlerArrays && nullptr != mHandlerTable[typeId]) {
+            const EventHandlerArray &ehArray = *mHandlerTable[typeId];
+            for (size_t j = 0; j < ehArray.size(); ++j) {
+                ehArray[j]->onEvent(*entry.mEvent, entry.mEventData);
+            }
+        }
+    }
+    clearQueue(queue);
+}
+
+void EventBus::clearQueue(QueueEntryArray &queue) {
+    for (size_t i = 0; i < queue.size(); ++i) {
+        const EventData *eventData = queue[i].mEventData;
+        if (nullptr != eventData) {
+            const_cast<EventData*>(eventData)->release();
+        }
+    }
+    queue.resize(0);
 }
 
 } // namespace OSRE::Common
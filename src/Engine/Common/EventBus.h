@@ -24,8 +24,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Common/osre_common.h"
 
-#include <cppcore/Container/TQueue.h>
-#include <cppcore/Container/THashMap.h>
+#include <cppcore/Container/TArray.h>
+
+#include <mutex>
+#include <thread>
 
 namespace OSRE {
 namespace Common {
@@ -41,7 +43,7 @@ struct Action {
     const EventData *mEventData;
     i32              mRetCode;
 
-    Action() : mEvent(nullptr), mEventData(nullptr) {}
+    Action() : mEvent(nullptr), mEventData(nullptr), mRetCode(0) {}
     virtual ~Action() = default;
     i32 getReturnCode() const {return mRetCode;}
 };
@@ -63,6 +65,11 @@ struct QueueEntry {
 ///                                 -> suscribed EventHandler 2
 /// All event handlers, which has registered a suscribtion will get notified.
 /// If no event handler has registered before the event will get lost.
+///
+/// The handlers are stored per dense event type id, so dispatching an event is an array lookup.
+/// The bus is owned by the thread which created it, this thread has to subscribe and update.
+/// Events can be published from any thread, the events of other threads are collected in a
+/// separate locked queue. Events published during an update will be dispatched with the next one.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT EventBus {
 public:
@@ -72,7 +79,7 @@ public:
     ///	@brief  The class destructor.
     ~EventBus() = default;
 
-    ///	@brief  Will create the event bus, allocator will get prepared.
+    ///	@brief  Will create the event bus, the calling thread will own it.
     /// @return true if successful, false in case of an error.
     bool create();
 
@@ -97,23 +104,41 @@ public:
     /// @param[in] ev       The event type.
     void unsubscribeEventHandler(AbstractEventHandler *handler, const Event &ev);
     
-    ///	@brief  Will publish an event with its data, all subscribers will get notified.
+    ///	@brief  Will publish an event with its data, all subscribers will get notified with the 
+    ///         next update. The bus holds a reference of the event data until then.
     /// @param[in] ev           The event type
     /// @param[in] eventData    The event data
     void publish(const Event &ev, const EventData *eventData);
 
+    /// @brief  Returns the number of events waiting for the next update.
+    /// @return The number of queued events.
+    size_t getNumQueuedEvents();
+
     void registerAction();
 
     // No copying.
     EventBus &operator = (const EventBus &) = delete;
     EventBus(const EventBus &) = delete;
 
+private:
+    struct PendingEvent {
+        const Event *mEvent;
+        const EventData *mEventData;
+    };
+    using QueueEntryArray = cppcore::TArray<PendingEvent>;
+    void dispatch(QueueEntryArray &queue);
+    void clearQueue(QueueEntryArray &queue);
+
 private:
     using EventHandlerArray = cppcore::TArray<AbstractEventHandler*>;
-    using SuscribedHandler = cppcore::THashMap<HashId, EventHandlerArray*>;
-    SuscribedHandler mSuscribedHandler;
-    using QueueEntryArray = cppcore::TArray<QueueEntry*>;
-    QueueEntryArray mQueueEntryArray;
+    using EventHandlerTable = cppcore::TArray<EventHandlerArray*>;
+    EventHandlerTable mHandlerTable;
+    QueueEntryArray mQueues[2];
+    ui32 mActiveQueue;
+    std::mutex mRemoteMutex;
+    QueueEntryArray mRemoteQueues[2];
+    ui32 mActiveRemoteQueue;
+    std::thread::id mOwner;
     bool mCreated;
 };
 
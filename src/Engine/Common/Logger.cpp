@@ -20,7 +20,6 @@ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
 IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
-#include "Common/DateTime.h"
 #include "Common/Logger.h"
 #include "Debugging/Debug.h"
 
@@ -30,9 +29,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #    include "Platform/win32/Win32DbgLogStream.h"
 #endif // OSRE_WINDOWS
 
-#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <iostream>
-#include <sstream>
+#include <thread>
 
 namespace OSRE {
 namespace Common {
@@ -40,39 +44,113 @@ namespace Common {
 static constexpr c8 Line[] =
         "====================================================================================================";
 
-static void appendDomain(const String &domain, String &logMsg) {
-    if (!domain.empty()) {
-        logMsg += "(";
-        logMsg += domain;
-        logMsg += ")";
-    }
+static constexpr size_t PrefixLength = 6;
+
+static const c8 *LevelPrefixes[] = {
+    "Trace: ",
+    "Dbg:  ",
+    "Info: ",
+    "",
+    "Warn: ",
+    "Err:  ",
+    "Fatal:"
+};
+
+static const c8 *stripFilename(const c8 *filename) {
+    const c8 *pos = ::strrchr(filename, '/');
+    return pos != nullptr ? pos + 1 : filename;
 }
 
-static String stripFilename(const String &filename) {
-    if (filename.empty()) {
-        return filename;
-    }
+static ui64 getTimeStamp() {
+    return static_cast<ui64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+}
 
-    String::size_type pos = filename.find_last_of("/");
-    if (pos == String::npos) {
-        return filename;
+static void appendDateTime(ui64 timeStamp, String &logMsg) {
+    const std::time_t t = static_cast<std::time_t>(timeStamp / 1000);
+    std::tm now = {};
+#ifdef OSRE_WINDOWS
+    ::gmtime_s(&now, &t);
+#else
+    ::gmtime_r(&t, &now);
+#endif
+    c8 buffer[32];
+    ::snprintf(buffer, sizeof(buffer), "%02d.%02d.%04d %02d:%02d:%02d", now.tm_mday, now.tm_mon + 1,
+            now.tm_year + 1900, now.tm_hour, now.tm_min, now.tm_sec);
+    logMsg += buffer;
+}
+
+// A message to write, the strings are not owned.
+struct Logger::LogEntry {
+    LogLevel mLevel;
+    PrintMode mPrintMode;
+    bool mTruncated;
+    const c8 *mDomain;
+    size_t mDomainLength;
+    const c8 *mMessage;
+    size_t mMessageLength;
+    const c8 *mFile;
+    i32 mLine;
+    ui64 mTimeStamp;
+};
+
+// A message copied into the ring. The sequence tells the state of the slot: equal to the
+// position it is free for the writer, position + 1 it is ready for the reader.
+struct LogRecord {
+    std::atomic<ui64> mSequence;
+    ui64 mTimeStamp;
+    const c8 *mFile;
+    i32 mLine;
+    LogLevel mLevel;
+    Logger::PrintMode mPrintMode;
+    bool mTruncated;
+    uc8 mDomainLength;
+    ui16 mMessageLength;
+    c8 mDomain[Logger::MaxDomainLength];
+    c8 mMessage[Logger::MaxMessageLength];
+};
+
+// The bounded multi-producer single-consumer ring of the asynchronous mode.
+struct Logger::AsyncQueue {
+    std::unique_ptr<LogRecord[]> mRecords;
+    ui64 mCapacity;
+    alignas(64) std::atomic<ui64> mEnqueuePos;
+    alignas(64) std::atomic<ui64> mDequeuePos;
+    std::atomic<bool> mConsumerWaiting;
+    ui64 mNumReportedDrops;
+    bool mStop;
+    std::mutex mMutex;
+    std::condition_variable mWakeUp;
+    std::condition_variable mDrained;
+    std::thread mThread;
+
+    explicit AsyncQueue(ui64 capacity) :
+            mRecords(new LogRecord[capacity]),
+            mCapacity(capacity),
+            mEnqueuePos(0),
+            mDequeuePos(0),
+            mConsumerWaiting(false),
+            mNumReportedDrops(0),
+            mStop(false) {
+        reset();
     }
-    const String strippedName = filename.substr(pos + 1, filename.size() - pos - 1);
 
-    return strippedName;
-}
+    // Only called while no producer and no consumer uses the ring
+    void reset() {
+        for (ui64 i = 0; i < mCapacity; ++i) {
+            mRecords[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+        mEnqueuePos.store(0, std::memory_order_relaxed);
+        mDequeuePos.store(0, std::memory_order_relaxed);
+        mConsumerWaiting.store(false, std::memory_order_relaxed);
+        mNumReportedDrops = 0;
+        mStop = false;
+    }
 
-static void addTraceInfo(const String &file, int line, String &msg) {
-    if (Logger::getInstance()->getVerboseMode() == Logger::VerboseMode::Trace) {
-        msg += " (";
-        msg += stripFilename(file);
-        msg += ", ";
-        std::stringstream ss;
-        ss << line;
-        msg += ss.str();
-        msg += ")";
+    bool isReady(ui64 pos) const {
+        return mRecords[pos & (mCapacity - 1)].mSequence.load(std::memory_order_seq_cst) == pos + 1;
     }
-}
+};
 
 void AbstractLogStream::activate() {
     mIsActive = true;
@@ -112,113 +190,203 @@ void Logger::kill() {
 }
 
 void Logger::setVerboseMode(VerboseMode sev) {
-    mVerboseMode = sev;
+    mVerboseMode.store(sev, std::memory_order_relaxed);
 }
 
 Logger::VerboseMode Logger::getVerboseMode() const {
-    return mVerboseMode;
+    return mVerboseMode.load(std::memory_order_relaxed);
 }
 
-void Logger::trace(const String &domain, const String &msg) {
-    if (getVerboseMode() == VerboseMode::Trace) {
-        String logMsg;
-        logMsg += "Trace: ";
-        logMsg += msg;
-        appendDomain(domain, logMsg);
+bool Logger::isLevelEnabled(LogLevel level) const {
+    const VerboseMode mode = getVerboseMode();
+    switch (level) {
+        case LogLevel::Trace:
+            return mode == VerboseMode::Trace;
+        case LogLevel::Debug:
+            return mode == VerboseMode::Debug || mode == VerboseMode::Trace;
+        default:
+            break;
+    }
+
+    return true;
+}
 
-        print(logMsg);
+bool Logger::startAsync(ui32 capacity) {
+    if (isAsync()) {
+        return false;
     }
+
+    ui64 size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    // Producers only touch the ring after they saw the asynchronous mode, wait for the ones
+    // still leaving a former run before the ring is reused or replaced
+    waitForProducers();
+    if (mAsyncQueue != nullptr && mAsyncQueue->mCapacity == size) {
+        mAsyncQueue->reset();
+    } else {
+        mAsyncQueue = std::make_unique<AsyncQueue>(size);
+    }
+    mNumDropped.store(0, std::memory_order_relaxed);
+    mAsyncQueue->mThread = std::thread([this]() {
+        drainQueue();
+    });
+    mAsync.store(true, std::memory_order_release);
+
+    return true;
 }
 
-void Logger::debug(const String &domain, const String &msg) {
-    if (getVerboseMode() == VerboseMode::Debug || getVerboseMode() == VerboseMode::Trace) {
-        String logMsg;
-        logMsg += "Dbg:  ";
-        logMsg += msg;
-        appendDomain(domain, logMsg);
+void Logger::stopAsync() {
+    if (!isAsync()) {
+        return;
+    }
 
-        print(logMsg);
+    // Records of producers which saw the asynchronous mode before it ended must be written
+    // by the final drain
+    mAsync.store(false, std::memory_order_seq_cst);
+    waitForProducers();
+    {
+        std::lock_guard<std::mutex> lock(mAsyncQueue->mMutex);
+        mAsyncQueue->mStop = true;
     }
+    mAsyncQueue->mWakeUp.notify_one();
+    mAsyncQueue->mThread.join();
 }
 
-void Logger::info(const String &domain, const String &msg) {
-    if (getVerboseMode() == VerboseMode::Normal || getVerboseMode() == VerboseMode::Verbose || getVerboseMode() == VerboseMode::Debug || getVerboseMode() == VerboseMode::Trace) {
-        String logMsg;
+bool Logger::isAsync() const {
+    return mAsync.load(std::memory_order_acquire);
+}
 
-        logMsg += "Info: ";
-        logMsg += msg;
+bool Logger::beginProducer() {
+    // Sequentially consistent, so either stopAsync sees the producer or the producer sees
+    // the synchronous mode
+    mNumProducers.fetch_add(1, std::memory_order_seq_cst);
+    if (mAsync.load(std::memory_order_seq_cst)) {
+        return true;
+    }
+    endProducer();
 
-        appendDomain(domain, logMsg);
+    return false;
+}
 
-        print(logMsg);
+void Logger::endProducer() {
+    mNumProducers.fetch_sub(1, std::memory_order_release);
+}
+
+void Logger::waitForProducers() const {
+    while (mNumProducers.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
     }
 }
 
-void Logger::print(const String &msg, PrintMode mode) {
-    if (msg.empty()) {
+void Logger::flush() {
+    if (!beginProducer()) {
         return;
     }
 
-    if (msg.size() > 8) {
-        if (msg[6] == '<' && msg[7] == '=') {
-            mIntention -= 2;
-        }
+    AsyncQueue &queue = *mAsyncQueue;
+    const ui64 target = queue.mEnqueuePos.load(std::memory_order_acquire);
+    {
+        std::unique_lock<std::mutex> lock(queue.mMutex);
+        queue.mWakeUp.notify_one();
+        queue.mDrained.wait(lock, [&queue, target]() {
+            return queue.mDequeuePos.load(std::memory_order_acquire) >= target;
+        });
     }
+    endProducer();
+}
 
-    String logMsg;
-    if (0 != mIntention) {
-        for (ui32 i = 0; i < mIntention; i++) {
-            logMsg += " ";
-        }
+ui64 Logger::getNumDroppedMessages() const {
+    return mNumDropped.load(std::memory_order_relaxed);
+}
+
+void Logger::log(LogLevel level, const String &domain, const String &msg, const c8 *file, int line) {
+    if (!isLevelEnabled(level)) {
+        return;
     }
 
-    logMsg += msg;
-    if (PrintMode::WithDateTime == mode) {
-        logMsg += " (";
-        logMsg += this->getDateTime();
-        logMsg += ")";
+    LogEntry entry;
+    entry.mLevel = level;
+    entry.mPrintMode = PrintMode::WhithoutDateTime;
+    entry.mTruncated = false;
+    entry.mDomain = domain.c_str();
+    entry.mDomainLength = domain.size();
+    entry.mMessage = msg.c_str();
+    entry.mMessageLength = msg.size();
+    entry.mFile = file != nullptr && getVerboseMode() == VerboseMode::Trace ? file : nullptr;
+    entry.mLine = line;
+    entry.mTimeStamp = getTimeStamp();
+    dispatch(entry);
+}
+
+void Logger::logFormatted(LogLevel level, const c8 *domain, const c8 *file, int line, const c8 *format, va_list args) {
+    if (!isLevelEnabled(level)) {
+        return;
     }
 
-    logMsg += " \n";
-    for (ui32 i = 0; i < mLogStreams.size(); ++i) {
-        AbstractLogStream *stream = mLogStreams[i];
-        if (stream != nullptr) {
-            stream->write(logMsg);
-        }
+    c8 buffer[MaxMessageLength + 1];
+    const int length = ::vsnprintf(buffer, sizeof(buffer), format, args);
+    if (length < 0) {
+        return;
     }
 
-    if (msg.size() > 8) {
-        if (msg[6] == '=' && msg[7] == '>') {
-            mIntention += 2;
-        }
+    LogEntry entry;
+    entry.mLevel = level;
+    entry.mPrintMode = PrintMode::WhithoutDateTime;
+    entry.mTruncated = static_cast<size_t>(length) > MaxMessageLength;
+    entry.mDomain = domain != nullptr ? domain : "";
+    entry.mDomainLength = ::strlen(entry.mDomain);
+    entry.mMessage = buffer;
+    entry.mMessageLength = std::min(static_cast<size_t>(length), MaxMessageLength);
+    entry.mFile = file != nullptr && getVerboseMode() == VerboseMode::Trace ? file : nullptr;
+    entry.mLine = line;
+    entry.mTimeStamp = getTimeStamp();
+    dispatch(entry);
+}
+
+void Logger::trace(const String &domain, const String &msg) {
+    log(LogLevel::Trace, domain, msg);
+}
+
+void Logger::debug(const String &domain, const String &msg) {
+    log(LogLevel::Debug, domain, msg);
+}
+
+void Logger::info(const String &domain, const String &msg) {
+    log(LogLevel::Info, domain, msg);
+}
+
+void Logger::print(const String &msg, PrintMode mode) {
+    if (msg.empty()) {
+        return;
     }
+
+    LogEntry entry;
+    entry.mLevel = LogLevel::Print;
+    entry.mPrintMode = mode;
+    entry.mTruncated = false;
+    entry.mDomain = nullptr;
+    entry.mDomainLength = 0;
+    entry.mMessage = msg.c_str();
+    entry.mMessageLength = msg.size();
+    entry.mFile = nullptr;
+    entry.mLine = 0;
+    entry.mTimeStamp = getTimeStamp();
+    dispatch(entry);
 }
 
 void Logger::warn(const String &domain, const String &msg) {
-    String logMsg;
-    logMsg += "Warn: ";
-    logMsg += msg;
-    appendDomain(domain, logMsg);
-
-    print(logMsg);
+    log(LogLevel::Warn, domain, msg);
 }
 
 void Logger::error(const String &domain, const String &msg) {
-    String logMsg;
-    logMsg += "Err:  ";
-    logMsg += msg;
-    appendDomain(domain, logMsg);
-
-    print(logMsg);
+    log(LogLevel::Error, domain, msg);
 }
 
 void Logger::fatal(const String &domain, const String &msg) {
-    String logMsg;
-    logMsg += "Fatal:";
-    logMsg += msg;
-    appendDomain(domain, logMsg);
-
-    print(logMsg);
+    log(LogLevel::Fatal, domain, msg);
 }
 
 void Logger::registerLogStream(AbstractLogStream *pLogStream) {
@@ -226,26 +394,190 @@ void Logger::registerLogStream(AbstractLogStream *pLogStream) {
         return;
     }
 
+    std::lock_guard<std::mutex> lock(mStreamMutex);
     mLogStreams.add(pLogStream);
 }
 
 void Logger::unregisterLogStream(AbstractLogStream *logStream) {
-    if (nullptr != logStream) {
+    if (nullptr == logStream) {
         return;
     }
 
+    std::lock_guard<std::mutex> lock(mStreamMutex);
     for (ui32 i = 0; i < mLogStreams.size(); ++i) {
         if (mLogStreams[i] == logStream) {
-            delete mLogStreams[i];
             mLogStreams.remove(i);
+            break;
         }
     }
 }
 
+void Logger::write(const LogEntry &entry) {
+    std::lock_guard<std::mutex> lock(mStreamMutex);
+
+    // The prefixed message, a leading "<=" or "=>" changes the intention
+    const c8 *prefix = LevelPrefixes[static_cast<size_t>(entry.mLevel)];
+    const size_t prefixLength = ::strlen(prefix);
+    auto charAt = [&](size_t index) -> c8 {
+        return index < prefixLength ? prefix[index] : entry.mMessage[index - prefixLength];
+    };
+    const bool hasMarker = prefixLength + entry.mMessageLength > PrefixLength + 2;
+    if (hasMarker && charAt(PrefixLength) == '<' && charAt(PrefixLength + 1) == '=') {
+        mIntention -= 2;
+    }
+
+    mLine.clear();
+    mLine.append(mIntention, ' ');
+    mLine.append(prefix, prefixLength);
+    mLine.append(entry.mMessage, entry.mMessageLength);
+    if (entry.mTruncated) {
+        mLine += "...";
+    }
+    if (entry.mFile != nullptr) {
+        c8 buffer[16];
+        ::snprintf(buffer, sizeof(buffer), ", %d)", entry.mLine);
+        mLine += " (";
+        mLine += stripFilename(entry.mFile);
+        mLine += buffer;
+    }
+    if (entry.mDomainLength != 0) {
+        mLine += "(";
+        mLine.append(entry.mDomain, entry.mDomainLength);
+        mLine += ")";
+    }
+    if (PrintMode::WithDateTime == entry.mPrintMode) {
+        mLine += " (";
+        appendDateTime(entry.mTimeStamp, mLine);
+        mLine += ")";
+    }
+    mLine += " \n";
+
+    for (ui32 i = 0; i < mLogStreams.size(); ++i) {
+        AbstractLogStream *stream = mLogStreams[i];
+        if (stream != nullptr) {
+            stream->write(mLine);
+        }
+    }
+
+    if (hasMarker && charAt(PrefixLength) == '=' && charAt(PrefixLength + 1) == '>') {
+        mIntention += 2;
+    }
+}
+
+void Logger::enqueue(const LogEntry &entry) {
+    AsyncQueue &queue = *mAsyncQueue;
+    const ui64 mask = queue.mCapacity - 1;
+    ui64 pos = queue.mEnqueuePos.load(std::memory_order_relaxed);
+    LogRecord *record = nullptr;
+    for (;;) {
+        record = &queue.mRecords[pos & mask];
+        const ui64 sequence = record->mSequence.load(std::memory_order_acquire);
+        const i64 diff = static_cast<i64>(sequence - pos);
+        if (diff == 0) {
+            if (queue.mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The ring is full
+            mNumDropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = queue.mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->mTimeStamp = entry.mTimeStamp;
+    record->mFile = entry.mFile;
+    record->mLine = entry.mLine;
+    record->mLevel = entry.mLevel;
+    record->mPrintMode = entry.mPrintMode;
+    record->mDomainLength = static_cast<uc8>(std::min(entry.mDomainLength, MaxDomainLength));
+    ::memcpy(record->mDomain, entry.mDomain, record->mDomainLength);
+    record->mTruncated = entry.mTruncated || entry.mMessageLength > MaxMessageLength;
+    record->mMessageLength = static_cast<ui16>(std::min(entry.mMessageLength, MaxMessageLength));
+    ::memcpy(record->mMessage, entry.mMessage, record->mMessageLength);
+
+    // Sequentially consistent, so either the consumer sees the record or we see it waiting
+    record->mSequence.store(pos + 1, std::memory_order_seq_cst);
+    if (queue.mConsumerWaiting.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(queue.mMutex);
+        queue.mWakeUp.notify_one();
+    }
+}
+
+void Logger::dispatch(const LogEntry &entry) {
+    // Fatal errors must reach the streams before the application goes down
+    if (entry.mLevel != LogLevel::Fatal && beginProducer()) {
+        enqueue(entry);
+        endProducer();
+        return;
+    }
+    flush();
+    write(entry);
+}
+
+void Logger::drainQueue() {
+    AsyncQueue &queue = *mAsyncQueue;
+    const ui64 mask = queue.mCapacity - 1;
+    ui64 pos = queue.mDequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        while (queue.isReady(pos)) {
+            LogRecord &record = queue.mRecords[pos & mask];
+            LogEntry entry;
+            entry.mLevel = record.mLevel;
+            entry.mPrintMode = record.mPrintMode;
+            entry.mTruncated = record.mTruncated;
+            entry.mDomain = record.mDomain;
+            entry.mDomainLength = record.mDomainLength;
+            entry.mMessage = record.mMessage;
+            entry.mMessageLength = record.mMessageLength;
+            entry.mFile = record.mFile;
+            entry.mLine = record.mLine;
+            entry.mTimeStamp = record.mTimeStamp;
+            write(entry);
+
+            record.mSequence.store(pos + queue.mCapacity, std::memory_order_release);
+            ++pos;
+            queue.mDequeuePos.store(pos, std::memory_order_release);
+        }
+
+        const ui64 numDropped = mNumDropped.load(std::memory_order_relaxed);
+        if (numDropped != queue.mNumReportedDrops) {
+            c8 buffer[64];
+            ::snprintf(buffer, sizeof(buffer), "%llu log messages dropped.",
+                    static_cast<unsigned long long>(numDropped - queue.mNumReportedDrops));
+            queue.mNumReportedDrops = numDropped;
+            static constexpr c8 Domain[] = "Logger";
+            const LogEntry entry = { LogLevel::Warn, PrintMode::WhithoutDateTime, false, Domain, sizeof(Domain) - 1,
+                    buffer, ::strlen(buffer), nullptr, 0, getTimeStamp() };
+            write(entry);
+        }
+
+        std::unique_lock<std::mutex> lock(queue.mMutex);
+        queue.mDrained.notify_all();
+        queue.mConsumerWaiting.store(true, std::memory_order_seq_cst);
+        if (queue.isReady(pos)) {
+            queue.mConsumerWaiting.store(false, std::memory_order_relaxed);
+            continue;
+        }
+        if (queue.mStop) {
+            break;
+        }
+        queue.mWakeUp.wait(lock);
+        queue.mConsumerWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
 Logger::Logger() :
+        mStreamMutex(),
         mLogStreams(), 
+        mLine(),
         mVerboseMode(VerboseMode::Normal),
-        mIntention(0) {
+        mIntention(0),
+        mAsync(false),
+        mNumProducers(0),
+        mNumDropped(0),
+        mAsyncQueue() {
     mLogStreams.add(new StdLogStream);
 
 #ifdef OSRE_WINDOWS
@@ -258,6 +590,8 @@ Logger::Logger() :
 }
 
 Logger::~Logger() {
+    stopAsync();
+
     print(Line, PrintMode::WhithoutDateTime);
     print("OSRE run ended.");
     print(Line, PrintMode::WhithoutDateTime);
@@ -267,65 +601,46 @@ Logger::~Logger() {
     }
 }
 
-String Logger::getDateTime() {
-    static const ui32 Space = 2;
-    DateTime currentDateTime = DateTime::getCurrentUTCTime();
-    std::stringstream stream;
-    stream.fill('0');
-    stream << std::setw(Space) << currentDateTime.getCurrentDay() << "."
-           << std::setw(Space) << currentDateTime.getCurrentMonth() << "."
-           << std::setw(Space * 2) << currentDateTime.getCurrentYear() << " "
-           << std::setw(Space) << currentDateTime.getCurrentHour() << ":"
-           << std::setw(Space) << currentDateTime.getCurrentMinute() << ":"
-           << std::setw(Space) << currentDateTime.getCurrentSeconds();
-
-    return stream.str();
-}
-
 void Logger::StdLogStream::write(const String &msg) {
     std::cout << msg;
 }
  
-void tracePrint(const String &domain, const String &file, int line, const String &msg) {
-    String message;
-    message += msg;
-    addTraceInfo(file, line, message);
-    Logger::getInstance()->trace(domain, message);
+void tracePrint(const String &domain, const c8 *file, int line, const String &msg) {
+    Logger::getInstance()->log(LogLevel::Trace, domain, msg, file, line);
+}
+
+void debugPrint(const String &domain, const c8 *file, int line, const String &msg) {
+    Logger::getInstance()->log(LogLevel::Debug, domain, msg, file, line);
+}
+
+void infoPrint(const String &domain, const c8 *file, int line, const String &msg) {
+    Logger::getInstance()->log(LogLevel::Info, domain, msg, file, line);
 }
 
-void debugPrint(const String &domain, const String &file, int line, const String &msg) {
-    String message;
-    message += msg;
-    addTraceInfo(file, line, message);
-    Logger::getInstance()->debug(domain, message);
+void warnPrint(const String &domain, const c8 *file, int line, const String &message) {
+    Logger::getInstance()->log(LogLevel::Warn, domain, message, file, line);
 }
 
-void infoPrint(const String &domain, const String &file, int line, const String &msg) {
-    String message;
-    message += msg;
-    addTraceInfo(file, line, message);
-    Logger::getInstance()->info(domain, message);
+void errorPrint(const String &domain, const c8 *file, int line, const String &message) {
+    Logger::getInstance()->log(LogLevel::Error, domain, message, file, line);
 }
 
-void warnPrint(const String &domain, const String &file, int line, const String &message) {
-    String msg;
-    msg += message;
-    addTraceInfo(file, line, msg);
-    Logger::getInstance()->warn(domain, msg);
+void fatalPrint(const String &domain, const c8 *file, int line, const String &message) {
+    Logger::getInstance()->log(LogLevel::Fatal, domain, message, file, line);
 }
 
-void errorPrint(const String &domain, const String &file, int line, const String &message) {
-    String msg;
-    msg += message;
-    addTraceInfo(file, line, msg);
-    Logger::getInstance()->error(domain, msg);
+void logPrintf(LogLevel level, const c8 *domain, const c8 *file, int line, const c8 *format, ...) {
+    va_list args;
+    va_start(args, format);
+    Logger::getInstance()->logFormatted(level, domain, file, line, format, args);
+    va_end(args);
 }
 
-void fatalPrint(const String &domain, const String &file, int line, const String &message) {
-    String msg;
-    msg += message;
-    addTraceInfo(file, line, msg);
-    Logger::getInstance()->fatal(domain, msg);
+void logPrintf(LogLevel level, const String &domain, const c8 *file, int line, const c8 *format, ...) {
+    va_list args;
+    va_start(args, format);
+    Logger::getInstance()->logFormatted(level, domain.c_str(), file, line, format, args);
+    va_end(args);
 }
 
 } // Namespace Common
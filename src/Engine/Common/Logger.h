@@ -26,6 +26,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/Container/TArray.h>
 
+#include <atomic>
+#include <cstdarg>
+#include <memory>
+#include <mutex>
+
 namespace OSRE::Common {
 
 #define DECL_OSRE_LOG_MODULE(name) static constexpr c8 Tag[] = #name;
@@ -69,6 +74,39 @@ private:
     bool mIsActive = true;
 };
 
+/// @brief  The level of a log message.
+enum class LogLevel : uc8 {
+    Trace = 0,  ///< Trace messages, logged in trace mode.
+    Debug,      ///< Debug messages, logged in debug and trace mode.
+    Info,       ///< Info messages.
+    Print,      ///< Plain prints without a prefix.
+    Warn,       ///< Warnings.
+    Error,      ///< Errors.
+    Fatal       ///< Fatal errors, always written synchronously.
+};
+
+/// @brief  The lowest level compiled into the log macros, lower levels are removed. Defaults to 
+///         Info for builds with NDEBUG, define it to the value of a LogLevel to override it. NDEBUG
+///         is set by the build configuration for all targets alike, unlike the private _DEBUG of
+///         the engine target.
+#ifndef OSRE_LOG_MIN_LEVEL
+#    ifdef NDEBUG
+#        define OSRE_LOG_MIN_LEVEL 2
+#    else
+#        define OSRE_LOG_MIN_LEVEL 0
+#    endif
+#endif
+
+/// @brief  The lowest level compiled into the log macros as a LogLevel.
+static constexpr LogLevel LogMinLevel = static_cast<LogLevel>(OSRE_LOG_MIN_LEVEL);
+
+/// @brief  Lets the compiler check the format arguments of a printf-style function.
+#if defined(__GNUC__) || defined(__clang__)
+#    define OSRE_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+#    define OSRE_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
+
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
@@ -80,6 +118,10 @@ private:
 ///	The granularity of the logged messages can be controlled by the severity of the logger. The 
 ///	supported modes are normal ( no debug and info messages ), verbose ( all messages will be
 ///	logged ) and debug ( the debug messages will be logged as well, be careful with this option ).
+///
+///	In the asynchronous mode the messages are copied into fixed size records of a bounded ring 
+///	and a background thread writes them to the log streams. Logging does not allocate or lock 
+///	then, messages are dropped and counted when the ring is full and long messages are cut.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT Logger final {
 public:
@@ -97,6 +139,13 @@ public:
         WhithoutDateTime	///< No DateTime will be there.
     };
 
+    /// @brief  The default number of records of the asynchronous mode.
+    static constexpr ui32 DefaultAsyncCapacity = 2048;
+    /// @brief  The maximal length of the domain of a record in the asynchronous mode.
+    static constexpr size_t MaxDomainLength = 31;
+    /// @brief  The maximal length of the message of a record in the asynchronous mode.
+    static constexpr size_t MaxMessageLength = 400;
+
 public:
     ///	@brief	Creates the unique logger instance and returns a pointer showing to it.
     ///	@return	The singleton pointer of the logger.
@@ -118,6 +167,50 @@ public:
     ///	@return	The current severity.
     VerboseMode getVerboseMode() const;
 
+    /// @brief  Returns true, if messages of the level will be logged in the current severity.
+    /// @param[in] level   The level.
+    /// @return true, if enabled.
+    bool isLevelEnabled(LogLevel level) const;
+
+    /// @brief  Will start the asynchronous mode. Other threads may log meanwhile, but the mode
+    ///         must only be started and stopped by one thread.
+    /// @param[in] capacity    The number of records, will be rounded up to a power of two.
+    /// @return true, if the mode was started.
+    bool startAsync(ui32 capacity = DefaultAsyncCapacity);
+
+    /// @brief  Will write all pending messages and return to the synchronous mode. Messages
+    ///         logged meanwhile are written synchronously.
+    void stopAsync();
+
+    /// @brief  Returns true, if the asynchronous mode is active.
+    /// @return true, if active.
+    bool isAsync() const;
+
+    /// @brief  Will wait until all messages logged before are written to the streams.
+    void flush();
+
+    /// @brief  Returns the number of messages dropped in the asynchronous mode.
+    /// @return The number of dropped messages.
+    ui64 getNumDroppedMessages() const;
+
+    /// @brief  Logs a message.
+    /// @param[in] level   The level.
+    /// @param[in] domain  The domain.
+    ///	@param[in] msg     The message to log.
+    /// @param[in] file    The source file, only used in trace mode, must be a literal.
+    /// @param[in] line    The source line.
+    void log(LogLevel level, const String &domain, const String &msg, const c8 *file = nullptr, int line = 0);
+
+    /// @brief  Logs a printf-style formatted message without allocating, the message is cut 
+    ///         after MaxMessageLength characters.
+    /// @param[in] level   The level.
+    /// @param[in] domain  The domain.
+    /// @param[in] file    The source file, only used in trace mode, must be a literal.
+    /// @param[in] line    The source line.
+    /// @param[in] format  The format string.
+    /// @param[in] args    The format arguments.
+    void logFormatted(LogLevel level, const c8 *domain, const c8 *file, int line, const c8 *format, va_list args);
+
     /// @brief  Logs a trace message.
     /// @param[in] domain  The domain.
     ///	@param[in] msg     The message to log.
@@ -153,18 +246,28 @@ public:
     ///	@param[in] msg     The message to log.
     void fatal(const String &domain, const String &msg);
 
-    ///	@brief	Registers a new log stream.
+    ///	@brief	Registers a new log stream, the logger will take the ownership.
     ///	@param[in] pLogStream    A pointer showing to the log stream.
     void registerLogStream(AbstractLogStream *pLogStream);
 
-    ///	@brief	Unregisters a registered log stream.
+    ///	@brief	Unregisters a registered log stream, the caller gets the ownership back.
     ///	@param[in] pLogStream    A pointer showing to the log stream.
     void unregisterLogStream(AbstractLogStream *pLogStream);
 
 private:
     Logger();
     ~Logger();
-    String getDateTime();
+
+    struct LogEntry;
+    struct AsyncQueue;
+
+    void write(const LogEntry &entry);
+    void enqueue(const LogEntry &entry);
+    void drainQueue();
+    void dispatch(const LogEntry &entry);
+    bool beginProducer();
+    void endProducer();
+    void waitForProducers() const;
 
 private:
     //  @brief  The Standard log stream.
@@ -184,28 +287,64 @@ private:
     static Logger *sLogger;
 
     using LogStreamArray = cppcore::TArray<AbstractLogStream*>;
+    std::mutex mStreamMutex;
     LogStreamArray mLogStreams;
-    VerboseMode mVerboseMode;
+    String mLine;
+    std::atomic<VerboseMode> mVerboseMode;
     ui32 mIntention;
+    std::atomic<bool> mAsync;
+    std::atomic<ui32> mNumProducers;
+    std::atomic<ui64> mNumDropped;
+    std::unique_ptr<AsyncQueue> mAsyncQueue;
 };
 
 // Logger helper function prototypes
-void OSRE_EXPORT tracePrint(const String &domain, const String &file, int line, const String &msg);
-void OSRE_EXPORT debugPrint(const String &domain, const String &file, int line, const String &msg);
-void OSRE_EXPORT infoPrint( const String &domain, const String &file, int line, const String &msg );
-void OSRE_EXPORT warnPrint( const String &domain, const String &file, int line, const String &msg );
-void OSRE_EXPORT errorPrint( const String &domain, const String &file, int line, const String &msg );
-void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line, const String &msg );
+void OSRE_EXPORT tracePrint(const String &domain, const c8 *file, int line, const String &msg);
+void OSRE_EXPORT debugPrint(const String &domain, const c8 *file, int line, const String &msg);
+void OSRE_EXPORT infoPrint( const String &domain, const c8 *file, int line, const String &msg );
+void OSRE_EXPORT warnPrint( const String &domain, const c8 *file, int line, const String &msg );
+void OSRE_EXPORT errorPrint( const String &domain, const c8 *file, int line, const String &msg );
+void OSRE_EXPORT fatalPrint( const String &domain, const c8 *file, int line, const String &msg );
+void OSRE_EXPORT logPrintf(LogLevel level, const c8 *domain, const c8 *file, int line, const c8 *format, ...) OSRE_PRINTF_FORMAT(5, 6);
+void OSRE_EXPORT logPrintf(LogLevel level, const String &domain, const c8 *file, int line, const c8 *format, ...) OSRE_PRINTF_FORMAT(5, 6);
+
+/// @brief  Returns true, if messages of the level pass the verbose mode filter. The compile-time 
+///         filter is applied by the log macros only.
+/// @param[in] level   The level.
+/// @return true, if enabled.
+inline bool isLogEnabled(LogLevel level) {
+    if (level > LogLevel::Debug) {
+        return true;
+    }
+
+    return Logger::getInstance()->isLevelEnabled(level);
+}
 
 } // Namespace Common
 
+//-------------------------------------------------------------------------------------------------
+///	@fn		OSRE_LOG_IF_ENABLED
+///	@brief	Evaluates the statement only, when the level is enabled. Levels below OSRE_LOG_MIN_LEVEL
+///         are removed at compile time.
+/// @param  level       The LogLevel value.
+///	@param	statement   The statement to evaluate.
+//-------------------------------------------------------------------------------------------------
+#define OSRE_LOG_IF_ENABLED(level, statement)                                                     \
+    do {                                                                                          \
+        if constexpr (::OSRE::Common::LogLevel::level >= ::OSRE::Common::LogMinLevel) {           \
+            if (::OSRE::Common::isLogEnabled(::OSRE::Common::LogLevel::level)) {                  \
+                statement;                                                                        \
+            }                                                                                     \
+        }                                                                                         \
+    } while (false)
+
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_trace
 ///	@brief	This helper macro will write the trace message into the logger.
 /// @param  domain      The domain to log for.
 ///	@param	message		The message to log.
 //-------------------------------------------------------------------------------------------------
-#define osre_trace(domain, msg) ::OSRE::Common::tracePrint(domain, __FILE__, __LINE__, msg)
+#define osre_trace(domain, msg) OSRE_LOG_IF_ENABLED(Trace, ::OSRE::Common::tracePrint(domain, __FILE__, __LINE__, msg))
 
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_debug
@@ -213,7 +352,7 @@ void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line,
 /// @param  domain      The domain to log for.
 ///	@param	message		The message to log.
 //-------------------------------------------------------------------------------------------------
-#define osre_debug(domain, msg) ::OSRE::Common::debugPrint( domain, __FILE__, __LINE__, msg)
+#define osre_debug(domain, msg) OSRE_LOG_IF_ENABLED(Debug, ::OSRE::Common::debugPrint(domain, __FILE__, __LINE__, msg))
 
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_log
@@ -221,7 +360,7 @@ void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line,
 /// @param  domain      The domain to log for.
 ///	@param	message		The message to log.
 //-------------------------------------------------------------------------------------------------
-#define osre_info(domain, msg)  ::OSRE::Common::infoPrint(  domain,  __FILE__, __LINE__, msg)
+#define osre_info(domain, msg)  OSRE_LOG_IF_ENABLED(Info, ::OSRE::Common::infoPrint(domain, __FILE__, __LINE__, msg))
 
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_warn
@@ -229,7 +368,7 @@ void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line,
 /// @param  domain      The domain to log for.
 ///	@param	message		The warning to writhe into the log.
 //-------------------------------------------------------------------------------------------------
-#define osre_warn(domain, message)  ::OSRE::Common::warnPrint(  domain, __FILE__, __LINE__, message)
+#define osre_warn(domain, message)  OSRE_LOG_IF_ENABLED(Warn, ::OSRE::Common::warnPrint(domain, __FILE__, __LINE__, message))
 
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_error
@@ -237,7 +376,7 @@ void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line,
 /// @param  domain      The domain to log for.
 ///	@param	message		The warning to writhe into the log.
 //-------------------------------------------------------------------------------------------------
-#define osre_error(domain, message) ::OSRE::Common::errorPrint( domain, __FILE__, __LINE__, message)
+#define osre_error(domain, message) OSRE_LOG_IF_ENABLED(Error, ::OSRE::Common::errorPrint(domain, __FILE__, __LINE__, message))
 
 //-------------------------------------------------------------------------------------------------
 ///	@fn		osre_fatal
@@ -245,6 +384,20 @@ void OSRE_EXPORT fatalPrint( const String &domain, const String &file, int line,
 /// @param  domain      The domain to log for.
 ///	@param	message		The warning to writhe into the log.
 //-------------------------------------------------------------------------------------------------
-#define osre_fatal( domain, message ) ::OSRE::Common::fatalPrint( domain,__FILE__, __LINE__, message)
+#define osre_fatal(domain, message) OSRE_LOG_IF_ENABLED(Fatal, ::OSRE::Common::fatalPrint(domain, __FILE__, __LINE__, message))
+
+//-------------------------------------------------------------------------------------------------
+///	@fn		osre_tracef, osre_debugf, osre_infof, osre_warnf, osre_errorf, osre_fatalf
+///	@brief	These helper macros will write a printf-style formatted message into the logger. The 
+///         arguments are only evaluated, when the level is enabled.
+/// @param  domain      The domain to log for.
+///	@param	format      The format string, followed by the arguments.
+//-------------------------------------------------------------------------------------------------
+#define osre_tracef(domain, ...) OSRE_LOG_IF_ENABLED(Trace, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Trace, domain, __FILE__, __LINE__, __VA_ARGS__))
+#define osre_debugf(domain, ...) OSRE_LOG_IF_ENABLED(Debug, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Debug, domain, __FILE__, __LINE__, __VA_ARGS__))
+#define osre_infof(domain, ...)  OSRE_LOG_IF_ENABLED(Info, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Info, domain, __FILE__, __LINE__, __VA_ARGS__))
+#define osre_warnf(domain, ...)  OSRE_LOG_IF_ENABLED(Warn, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Warn, domain, __FILE__, __LINE__, __VA_ARGS__))
+#define osre_errorf(domain, ...) OSRE_LOG_IF_ENABLED(Error, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Error, domain, __FILE__, __LINE__, __VA_ARGS__))
+#define osre_fatalf(domain, ...) OSRE_LOG_IF_ENABLED(Fatal, ::OSRE::Common::logPrintf(::OSRE::Common::LogLevel::Fatal, domain, __FILE__, __LINE__, __VA_ARGS__))
 
 // Namespace OSRE
@@ -30,13 +30,19 @@ Object::Object(const String &objName) : mObjectName(objName),  mId(0) {
 }
 
 void Object::setName( const String &objName ) {
-    if( mObjectName != objName ) {
-        mObjectName = objName;
+    const StringId oldNameId = mObjectName;
+    mObjectName = StringId(objName);
+    if (oldNameId != mObjectName) {
+        onNameChanged(oldNameId);
     }
 }
 
+void Object::onNameChanged(StringId) {
+    // empty
+}
+
 const String &Object::getName() const {
-    return mObjectName;
+    return mObjectName.getString();
 }
 
 void Object::setGuid(guid id) {
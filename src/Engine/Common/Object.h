@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "Common/osre_common.h"
+#include "Common/StringId.h"
 
 #include <cppcore/Container/TArray.h>
 
@@ -33,7 +34,7 @@ namespace OSRE::Common {
 ///
 ///	@brief	This base-class implements a simple reference counting. To get an ownership call get, 
 ///	to release it call release. Objects with a reference count of 0 will be destroyed.
-///	You can assign an object name to the instance. 
+///	You can assign an object name to the instance, the name is stored as an interned string id.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT Object {
 public:
@@ -48,6 +49,10 @@ public:
     ///	@return	The name of the object.
     const String &getName() const;
 
+    ///	@brief	The interned name of the object will be returned, use it for fast name compares.
+    ///	@return	The name id of the object.
+    StringId getNameId() const;
+
     /// @brief  Will assign the guid.
     /// @param[in] id   The guid.
     void setGuid(guid id);
@@ -66,9 +71,17 @@ protected:
     ///	@param	objectName  [in] The object name.
     Object(const String &objectName);
 
+    ///	@brief	Will be called after the name of the object was changed.
+    ///	@param	oldNameId   [in] The name the object had before.
+    virtual void onNameChanged(StringId oldNameId);
+
 private:
-    String mObjectName;
+    StringId mObjectName;
     guid mId;
 };
 
+inline StringId Object::getNameId() const {
+    return mObjectName;
+}
+
 } // Namespace OSRE::Common
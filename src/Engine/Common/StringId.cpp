@@ -0,0 +1,215 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "Common/StringId.h"
+#include "Common/Logger.h"
+#include "Debugging/osre_debugging.h"
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+namespace OSRE {
+namespace Common {
+
+static constexpr c8 Tag[] = "StringId";
+
+namespace {
+
+//-------------------------------------------------------------------------------------------------
+//  The global string table. The strings are stored in chunks, which are never moved, so interned
+//  strings can be read without locking. Each chunk is twice as large as the one before, so the
+//  table grows until the 32-bit index space is used up. Lookups and inserts are guarded by a
+//  reader-writer lock.
+//-------------------------------------------------------------------------------------------------
+class StringTable {
+public:
+    static constexpr ui32 FirstChunkSize = 1024;
+    // Enough chunks to address every 32-bit index
+    static constexpr ui32 MaxChunks = 23;
+
+    StringTable() :
+            mMutex(), mLookup(), mNumStrings(0) {
+        for (auto &chunk : mChunks) {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        // Index 0 is the empty string
+        insert(std::string_view());
+    }
+
+    ~StringTable() = default;
+
+    static StringTable &getInstance() {
+        // Never deleted, ids in static objects may be resolved during the shutdown
+        static StringTable *instance = new StringTable;
+        return *instance;
+    }
+
+    ui32 intern(std::string_view str) {
+        if (str.empty()) {
+            return 0;
+        }
+
+        {
+            std::shared_lock<std::shared_mutex> lock(mMutex);
+            auto it = mLookup.find(str);
+            if (it != mLookup.end()) {
+                return it->second;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mMutex);
+        auto it = mLookup.find(str);
+        if (it != mLookup.end()) {
+            return it->second;
+        }
+
+        return insert(str);
+    }
+
+    ui32 find(std::string_view str) const {
+        if (str.empty()) {
+            return 0;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(mMutex);
+        auto it = mLookup.find(str);
+        if (it == mLookup.end()) {
+            return 0;
+        }
+
+        return it->second;
+    }
+
+    const String &get(ui32 index) const {
+        ui32 chunkIndex = 0, offset = 0;
+        locate(index, chunkIndex, offset);
+        const String *chunk = mChunks[chunkIndex].load(std::memory_order_acquire);
+        return chunk[offset];
+    }
+
+    size_t size() const {
+        std::shared_lock<std::shared_mutex> lock(mMutex);
+        return mNumStrings;
+    }
+
+private:
+    static ui64 getChunkSize(ui32 chunkIndex) {
+        return static_cast<ui64>(FirstChunkSize) << chunkIndex;
+    }
+
+    // Chunk i starts at index FirstChunkSize * (2^i - 1)
+    static void locate(ui32 index, ui32 &chunkIndex, ui32 &offset) {
+        const ui64 pos = static_cast<ui64>(index) + FirstChunkSize;
+        chunkIndex = 0;
+        while (pos >= getChunkSize(chunkIndex + 1)) {
+            ++chunkIndex;
+        }
+        offset = static_cast<ui32>(pos - getChunkSize(chunkIndex));
+    }
+
+    // Expects the write lock to be held
+    ui32 insert(std::string_view str) {
+        const ui32 index = mNumStrings;
+        if (index == std::numeric_limits<ui32>::max()) {
+            osre_error(Tag, "String table is full, cannot intern " + String(str) + ".");
+            osre_assert(false);
+            return 0;
+        }
+
+        ui32 chunkIndex = 0, offset = 0;
+        locate(index, chunkIndex, offset);
+        String *chunk = mChunks[chunkIndex].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new String[getChunkSize(chunkIndex)];
+            mChunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+        String &entry = chunk[offset];
+        entry.assign(str.data(), str.size());
+        mLookup.emplace(std::string_view(entry), index);
+        ++mNumStrings;
+
+        return index;
+    }
+
+private:
+    mutable std::shared_mutex mMutex;
+    std::unordered_map<std::string_view, ui32> mLookup;
+    std::atomic<String*> mChunks[MaxChunks];
+    ui32 mNumStrings;
+};
+
+} // Namespace
+
+StringId::StringId() :
+        mIndex(0), mHash(hash(nullptr, 0)) {
+    // empty
+}
+
+StringId::StringId(const String &str) :
+        StringId(str.data(), str.size()) {
+    // empty
+}
+
+StringId::StringId(const c8 *str) :
+        StringId(str, (str != nullptr) ? strlen(str) : 0) {
+    // empty
+}
+
+StringId::StringId(const c8 *str, size_t len) :
+        mIndex(0), mHash(hash(nullptr, 0)) {
+    const std::string_view view = (str != nullptr) ? std::string_view(str, len) : std::string_view();
+    mIndex = StringTable::getInstance().intern(view);
+    if (mIndex != 0) {
+        mHash = hash(view.data(), view.size());
+    }
+}
+
+StringId::StringId(ui32 index, ui32 hash) :
+        mIndex(index), mHash(hash) {
+    // empty
+}
+
+StringId StringId::find(const String &str) {
+    const ui32 index = StringTable::getInstance().find(str);
+    if (index == 0) {
+        return StringId();
+    }
+
+    return StringId(index, hash(str.c_str(), str.size()));
+}
+
+const String &StringId::getString() const {
+    return StringTable::getInstance().get(mIndex);
+}
+
+size_t StringId::getNumStrings() {
+    return StringTable::getInstance().size();
+}
+
+} // Namespace Common
+} // Namespace OSRE
@@ -0,0 +1,149 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+#include "Common/StringUtils.h"
+
+namespace OSRE {
+namespace Common {
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements a compact id for an interned string.
+///
+/// All strings are stored once in a global, thread-safe string table, which is never shrunk. The
+/// id holds the index of the table entry and the 32-bit FNV-1a hash of the string, so two ids are
+/// equal if and only if their strings are equal. The string of an id can always be looked up for
+/// logging and debugging. The default id refers to the empty string.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT StringId {
+public:
+    /// @brief  The hash functor to use ids as keys in unordered containers.
+    struct Hash {
+        size_t operator()(StringId id) const {
+            return static_cast<size_t>(id.getHash());
+        }
+    };
+
+    /// @brief  The default class constructor, the id refers to the empty string.
+    StringId();
+
+    /// @brief  The class constructor, will intern the string.
+    /// @param[in] str  The string.
+    explicit StringId(const String &str);
+
+    /// @brief  The class constructor, will intern the string.
+    /// @param[in] str  The zero-terminated string, nullptr for the empty string.
+    explicit StringId(const c8 *str);
+
+    /// @brief  The class constructor, will intern the string, embedded zeros are kept.
+    /// @param[in] str  The string, nullptr for the empty string.
+    /// @param[in] len  The length of the string.
+    StringId(const c8 *str, size_t len);
+
+    /// @brief  The class destructor.
+    ~StringId() = default;
+
+    /// @brief  Will look for an interned string, the string table will not be changed.
+    /// @param[in] str  The string to look for.
+    /// @return The id, the empty id if the string was never interned.
+    static StringId find(const String &str);
+
+    /// @brief  Will return the interned string.
+    /// @return The string, the reference stays valid for the lifetime of the process.
+    const String &getString() const;
+
+    /// @brief  Will return the interned string as a zero-terminated string.
+    /// @return The string.
+    const c8 *c_str() const;
+
+    /// @brief  Will return the index in the string table.
+    /// @return The index, 0 for the empty string.
+    ui32 getIndex() const;
+
+    /// @brief  Will return the hash of the string.
+    /// @return The 32-bit FNV-1a hash.
+    ui32 getHash() const;
+
+    /// @brief  Will return true, if the id refers to the empty string.
+    /// @return true for the empty string.
+    bool isEmpty() const;
+
+    /// @brief  Will return the number of interned strings, including the empty string.
+    /// @return The number of strings.
+    static size_t getNumStrings();
+
+    /// @brief  Will compute the hash of a string as stored in the ids.
+    /// @param[in] str  The string.
+    /// @param[in] len  The length of the string.
+    /// @return The 32-bit FNV-1a hash.
+    static ui32 hash(const c8 *str, size_t len);
+
+    bool operator == (StringId rhs) const;
+    bool operator != (StringId rhs) const;
+    bool operator < (StringId rhs) const;
+
+private:
+    StringId(ui32 index, ui32 hash);
+
+private:
+    ui32 mIndex;
+    ui32 mHash;
+};
+
+inline ui32 StringId::getIndex() const {
+    return mIndex;
+}
+
+inline ui32 StringId::getHash() const {
+    return mHash;
+}
+
+inline bool StringId::isEmpty() const {
+    return mIndex == 0;
+}
+
+inline const c8 *StringId::c_str() const {
+    return getString().c_str();
+}
+
+inline ui32 StringId::hash(const c8 *str, size_t len) {
+    return StringUtils::fnv1a32(str, len);
+}
+
+inline bool StringId::operator == (StringId rhs) const {
+    return mIndex == rhs.mIndex;
+}
+
+inline bool StringId::operator != (StringId rhs) const {
+    return mIndex != rhs.mIndex;
+}
+
+inline bool StringId::operator < (StringId rhs) const {
+    return mIndex < rhs.mIndex;
+}
+
+} // Namespace Common
+} // Namespace OSRE
@@ -31,14 +31,56 @@ namespace Common {
 
 class OSRE_EXPORT StringUtils {
 public:
+    /// @brief  The offset basis of the 32-bit FNV-1a hash, the seed of a new hash.
+    static constexpr ui32 Fnv32Offset = 2166136261u;
+    /// @brief  The offset basis of the 64-bit FNV-1a hash, the seed of a new hash.
+    static constexpr ui64 Fnv64Offset = 14695981039346656037ull;
+
+    /// @brief  Will hash a name case-insensitive with an adler32-like checksum.
+    /// @param[in] str          The name.
+    /// @return The hash, 0 for nullptr.
     static HashId hashName(const String &str);
     static HashId hashName(char const *pIdentStr);
+
+    /// @brief  Will hash bytes with the case-sensitive 32-bit FNV-1a hash.
+    /// @param[in] data         The bytes to hash.
+    /// @param[in] size         The number of bytes.
+    /// @param[in] seed         The hash of the data before, to hash several blocks in a row.
+    /// @return The hash.
+    static ui32 fnv1a32(const void *data, size_t size, ui32 seed = Fnv32Offset);
+
+    /// @brief  Will hash bytes with the case-sensitive 64-bit FNV-1a hash.
+    /// @param[in] data         The bytes to hash.
+    /// @param[in] size         The number of bytes.
+    /// @param[in] seed         The hash of the data before, to hash several blocks in a row.
+    /// @return The hash.
+    static ui64 fnv1a64(const void *data, size_t size, ui64 seed = Fnv64Offset);
 };
 
 inline HashId StringUtils::hashName(const String &str) {
     return hashName(str.c_str());
 }
 
+inline ui32 StringUtils::fnv1a32(const void *data, size_t size, ui32 seed) {
+    const uc8 *bytes = static_cast<const uc8 *>(data);
+    ui32 hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+inline ui64 StringUtils::fnv1a64(const void *data, size_t size, ui64 seed) {
+    const uc8 *bytes = static_cast<const uc8 *>(data);
+    ui64 hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+
+    return hash;
+}
+
 inline HashId StringUtils::hashName(char const *pIdentStr) {
     // Relatively simple hash of arbitrary text string into a
     // 32-bit identifier Output value is
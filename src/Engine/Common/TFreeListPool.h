@@ -0,0 +1,142 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+#include "Debugging/osre_debugging.h"
+
+#include <cppcore/Container/TArray.h>
+
+#include <mutex>
+
+namespace OSRE::Common {
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  A thread-safe pool for objects of one type. 
+///
+/// Released blocks are kept in a free list and handed out again, new blocks are allocated in 
+/// chunks. The memory is only returned, when the pool is destroyed. Use it for the class-specific
+/// operator new and delete of often allocated types.
+//-------------------------------------------------------------------------------------------------
+template <class T>
+class TFreeListPool {
+public:
+    /// @brief  The class constructor.
+    /// @param[in] numChunkObjects  The number of objects allocated at once.
+    explicit TFreeListPool(size_t numChunkObjects = 64);
+
+    /// @brief  The class destructor, frees all chunks.
+    ~TFreeListPool();
+
+    /// @brief  Returns an uninitialized block for one object.
+    /// @return The block.
+    void *alloc();
+
+    /// @brief  Gives a block back to the pool.
+    /// @param[in] ptr      The block, nullptr is ignored.
+    void release(void *ptr);
+
+    /// @brief  Returns the number of blocks in use.
+    /// @return The number of used blocks.
+    size_t getNumUsed() const;
+
+    /// @brief  Returns the number of allocated blocks.
+    /// @return The capacity.
+    size_t getCapacity() const;
+
+    OSRE_NON_COPYABLE(TFreeListPool)
+
+private:
+    union Block {
+        Block *mNext;
+        alignas(T) uc8 mData[sizeof(T)];
+    };
+
+    mutable std::mutex mMutex;
+    Block *mFreeList;
+    cppcore::TArray<Block*> mChunks;
+    size_t mNumChunkObjects;
+    size_t mNumUsed;
+};
+
+template <class T>
+inline TFreeListPool<T>::TFreeListPool(size_t numChunkObjects) :
+        mMutex(), mFreeList(nullptr), mChunks(), mNumChunkObjects(numChunkObjects), mNumUsed(0) {
+    osre_assert(numChunkObjects != 0);
+}
+
+template <class T>
+inline TFreeListPool<T>::~TFreeListPool() {
+    osre_assert(mNumUsed == 0);
+    for (size_t i = 0; i < mChunks.size(); ++i) {
+        delete [] mChunks[i];
+    }
+}
+
+template <class T>
+inline void *TFreeListPool<T>::alloc() {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mFreeList == nullptr) {
+        Block *chunk = new Block[mNumChunkObjects];
+        for (size_t i = 0; i < mNumChunkObjects; ++i) {
+            chunk[i].mNext = i + 1 < mNumChunkObjects ? &chunk[i + 1] : nullptr;
+        }
+        mChunks.add(chunk);
+        mFreeList = chunk;
+    }
+
+    Block *block = mFreeList;
+    mFreeList = block->mNext;
+    ++mNumUsed;
+
+    return block;
+}
+
+template <class T>
+inline void TFreeListPool<T>::release(void *ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    Block *block = static_cast<Block*>(ptr);
+    block->mNext = mFreeList;
+    mFreeList = block;
+    --mNumUsed;
+}
+
+template <class T>
+inline size_t TFreeListPool<T>::getNumUsed() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mNumUsed;
+}
+
+template <class T>
+inline size_t TFreeListPool<T>::getCapacity() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mChunks.size() * mNumChunkObjects;
+}
+
+} // namespace OSRE::Common
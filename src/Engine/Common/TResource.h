@@ -26,6 +26,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/osre_common.h"
 #include "IO/Uri.h"
 
+#include <atomic>
+
 namespace OSRE::Common {
 
 struct ResourceStatistics {
@@ -40,6 +42,7 @@ struct ResourceStatistics {
 enum class ResourceState {
     Uninitialized = -1,
     Unloaded,
+    Loading,
     Loaded,
     Error,
     Count
@@ -53,6 +56,7 @@ public:
     void setUri(const IO::Uri &uri);
     const IO::Uri &getUri() const;
     ResourceState getState() const;
+    bool beginLoad();
     virtual ResourceState load(TResLoader &loader);
     virtual ResourceState unload(TResLoader &loader);
     TResType *getRes();
@@ -66,7 +70,7 @@ protected:
     virtual ResourceState onUnload(TResLoader &loader) = 0;
 
 private:
-    ResourceState mState;
+    std::atomic<ResourceState> mState;
     ResourceStatistics mStats;
     IO::Uri mUri;
     TResType *mRes;
@@ -100,6 +104,20 @@ inline ResourceState TResource<TResType, TResLoader>::getState() const {
     return mState;
 }
 
+/// @brief  Will mark the resource as loading, used when the load runs on another thread.
+/// @return false, if the resource is already loaded or loading.
+template <class TResType, class TResLoader>
+inline bool TResource<TResType, TResLoader>::beginLoad() {
+    ResourceState state = mState.load();
+    while (state == ResourceState::Uninitialized || state == ResourceState::Unloaded || state == ResourceState::Error) {
+        if (mState.compare_exchange_weak(state, ResourceState::Loading)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 template <class TResType, class TResLoader>
 inline TResType *TResource<TResType, TResLoader>::create(const String &name) {
     mRes = new TResType(name);
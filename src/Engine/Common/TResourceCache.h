@@ -23,10 +23,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 #include "Common/Logger.h"
+#include "Common/StringId.h"
 #include "Common/osre_common.h"
 #include "IO/Uri.h"
 
-#include <map>
+#include <iterator>
+#include <list>
+#include <unordered_map>
 
 namespace OSRE::Common {
 
@@ -52,27 +55,146 @@ inline TResource *TResourceFactory<TResource>::create(const String &name, const
     return res;
 }
 
+/// @brief  A handle to a cached resource. An acquired handle keeps the resource from being evicted.
+struct ResourceHandle {
+    StringId Id;        ///< The interned resource name, empty for an invalid handle.
+
+    /// @brief  Will return true, if the handle refers to a resource.
+    /// @return true for a valid handle.
+    bool isValid() const {
+        return !Id.isEmpty();
+    }
+};
+
+/// @brief  The counters of a resource cache, for monitoring.
+struct ResourceCacheStatistics {
+    ui64 Hits = 0;              ///< Lookups which found the resource.
+    ui64 Misses = 0;            ///< Lookups which did not find the resource.
+    ui64 Evictions = 0;         ///< Resources deleted to stay in the memory budget.
+    size_t Memory = 0;          ///< The bytes of all cached resources.
+    size_t NumResources = 0;    ///< The number of cached resources.
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  A cache for named resources with reference counts and a memory budget.
+///
+/// Resources are looked up by the interned string id of their name. Every resource has a
+/// reference count and a byte size. When the sizes exceed the budget, the least recently used
+/// resources without references are deleted. A budget of 0 disables the eviction. Pointers
+/// returned by find stay valid only as long as the resource is not evicted, acquire a handle
+/// to keep a resource alive.
+//-------------------------------------------------------------------------------------------------
 template <class TResourceFactory, class TResource>
 class TResourceCache {
 public:
-    TResourceCache();
+    /// @brief  The class constructor.
+    /// @param[in] budget   The memory budget in bytes, 0 for no limit.
+    explicit TResourceCache(size_t budget = 0);
+
+    /// @brief  The class destructor, deletes all resources.
     ~TResourceCache();
+
+    /// @brief  Will replace the factory.
+    /// @param[in] factory  The new factory.
+    /// @param[in] owning   true if the cache shall delete the factory.
     void registerFactory(TResourceFactory &factory, bool owning);
+
+    /// @brief  Will create a new resource, an existing resource with this name will be returned instead.
+    /// @param[in] name     The resource name.
+    /// @param[in] uri      The resource location.
+    /// @return The resource, nullptr in case of an error.
     TResource *create(const String &name, const IO::Uri &uri = IO::Uri());
+
+    /// @brief  Will store a resource, a stored resource with the same name will be deleted.
+    /// @param[in] name     The resource name.
+    /// @param[in] resource The resource, the cache takes the ownership.
     void set(const String &name, TResource *resource);
+
+    /// @brief  Will look for a resource and mark it as used.
+    /// @param[in] name     The resource name.
+    /// @return The resource, nullptr if not cached.
     TResource *find(const String &name) const;
+
+    /// @brief  Will look for a resource by its interned name and mark it as used.
+    /// @param[in] id       The interned resource name.
+    /// @return The resource, nullptr if not cached.
+    TResource *find(StringId id) const;
+
+    /// @brief  Will increment the reference count of a resource.
+    /// @param[in] name     The resource name.
+    /// @return The handle, invalid if the resource is not cached.
+    ResourceHandle acquire(const String &name);
+
+    /// @brief  Will decrement the reference count and invalidate the handle.
+    /// @param[inout] handle    The handle to release.
+    void release(ResourceHandle &handle);
+
+    /// @brief  Will return the resource of a handle.
+    /// @param[in] handle   The handle.
+    /// @return The resource, nullptr for an invalid handle.
+    TResource *get(const ResourceHandle &handle) const;
+
+    /// @brief  Will return the reference count of a resource.
+    /// @param[in] name     The resource name.
+    /// @return The reference count, 0 if not cached.
+    ui32 getRefCount(const String &name) const;
+
+    /// @brief  Will set the bytes used by a resource, for instance after loading it.
+    /// @param[in] name     The resource name.
+    /// @param[in] size     The size in bytes.
+    void setSize(const String &name, size_t size);
+
+    /// @brief  Will set the memory budget, resources will be evicted to match it.
+    /// @param[in] budget   The budget in bytes, 0 for no limit.
+    void setBudget(size_t budget);
+
+    /// @brief  Will return the memory budget.
+    /// @return The budget in bytes, 0 for no limit.
+    size_t getBudget() const;
+
+    /// @brief  Will delete all resources without references.
+    /// @return The number of deleted resources.
+    size_t evictUnused();
+
+    /// @brief  Will return the cache counters.
+    /// @return The counters.
+    const ResourceCacheStatistics &getStatistics() const;
+
+    /// @brief  Will reset the hit, miss and eviction counters.
+    void resetStatistics();
+
+    /// @brief  Will delete all resources, regardless of their references.
     void clear();
 
 private:
-    using ResourceMap = std::map<String, TResource*>;
-    ResourceMap mResourceMap;
+    using LruList = std::list<StringId>;
+
+    struct Entry {
+        TResource *Resource;
+        ui32 RefCount;
+        size_t Size;
+        typename LruList::iterator LruPos;
+    };
+    using ResourceMap = std::unordered_map<StringId, Entry, StringId::Hash>;
+
+    Entry *lookup(StringId id) const;
+    void touch(Entry &entry) const;
+    void erase(typename ResourceMap::iterator it);
+    void enforceBudget();
+
+    mutable ResourceMap mResourceMap;
+    mutable LruList mLruList;
+    mutable ResourceCacheStatistics mStatistics;
     TResourceFactory *mFactory;
     bool mOwner;
+    size_t mBudget;
 };
 
 template <class TResourceFactory, class TResource>
-inline TResourceCache<TResourceFactory, TResource>::TResourceCache() :
-        mResourceMap(), mFactory(new TResourceFactory), mOwner(true) {
+inline TResourceCache<TResourceFactory, TResource>::TResourceCache(size_t budget) :
+        mResourceMap(), mLruList(), mStatistics(), mFactory(new TResourceFactory), mOwner(true), mBudget(budget) {
     // empty
 }
 
@@ -98,11 +220,20 @@ inline void TResourceCache<TResourceFactory, TResource>::registerFactory(TResour
 
 template <class TResourceFactory, class TResource>
 inline TResource *TResourceCache<TResourceFactory, TResource>::create(const String &name, const IO::Uri &uri) {
+    const StringId id(name);
+    Entry *entry = lookup(id);
+    if (entry != nullptr) {
+        touch(*entry);
+        return entry->Resource;
+    }
+
     TResource *resource = mFactory->create(name, uri);
     if (nullptr == resource) {
         return nullptr;
     }
-    mResourceMap[name] = resource;
+    mLruList.push_front(id);
+    mResourceMap.emplace(id, Entry{ resource, 0, 0, mLruList.begin() });
+    ++mStatistics.NumResources;
 
     return resource;
 }
@@ -113,12 +244,20 @@ inline TResource *TResourceCache<TResourceFactory, TResource>::find(const String
         return nullptr;
     }
 
-    typename ResourceMap::const_iterator it = mResourceMap.find(name);
-    if (mResourceMap.end() == it) {
+    return find(StringId::find(name));
+}
+
+template <class TResourceFactory, class TResource>
+inline TResource *TResourceCache<TResourceFactory, TResource>::find(StringId id) const {
+    Entry *entry = lookup(id);
+    if (entry == nullptr) {
+        ++mStatistics.Misses;
         return nullptr;
     }
+    ++mStatistics.Hits;
+    touch(*entry);
 
-    return it->second;
+    return entry->Resource;
 }
 
 template <class TResourceFactory, class TResource>
@@ -126,20 +265,191 @@ inline void TResourceCache<TResourceFactory, TResource>::set(const String &name,
     if (name.empty()) {
         return;
     }
-    auto it = mResourceMap.find(name);
-    if (it != mResourceMap.end()) {
-        delete it->second;
+
+    const StringId id(name);
+    Entry *entry = lookup(id);
+    if (entry != nullptr) {
+        if (entry->Resource != resource) {
+            delete entry->Resource;
+        }
+        entry->Resource = resource;
+        mStatistics.Memory -= entry->Size;
+        entry->Size = 0;
+        touch(*entry);
+        return;
+    }
+
+    mLruList.push_front(id);
+    mResourceMap.emplace(id, Entry{ resource, 0, 0, mLruList.begin() });
+    ++mStatistics.NumResources;
+}
+
+template <class TResourceFactory, class TResource>
+inline ResourceHandle TResourceCache<TResourceFactory, TResource>::acquire(const String &name) {
+    ResourceHandle handle;
+    const StringId id = StringId::find(name);
+    Entry *entry = lookup(id);
+    if (entry == nullptr) {
+        ++mStatistics.Misses;
+        return handle;
     }
-    mResourceMap[name] = resource;
+
+    ++mStatistics.Hits;
+    ++entry->RefCount;
+    touch(*entry);
+    handle.Id = id;
+
+    return handle;
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::release(ResourceHandle &handle) {
+    Entry *entry = lookup(handle.Id);
+    handle.Id = StringId();
+    if (entry == nullptr || entry->RefCount == 0) {
+        osre_debug(ResTag, "Release of an invalid resource handle.");
+        return;
+    }
+
+    --entry->RefCount;
+    if (entry->RefCount == 0) {
+        enforceBudget();
+    }
+}
+
+template <class TResourceFactory, class TResource>
+inline TResource *TResourceCache<TResourceFactory, TResource>::get(const ResourceHandle &handle) const {
+    Entry *entry = lookup(handle.Id);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    return entry->Resource;
+}
+
+template <class TResourceFactory, class TResource>
+inline ui32 TResourceCache<TResourceFactory, TResource>::getRefCount(const String &name) const {
+    const Entry *entry = lookup(StringId::find(name));
+    if (entry == nullptr) {
+        return 0;
+    }
+
+    return entry->RefCount;
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::setSize(const String &name, size_t size) {
+    Entry *entry = lookup(StringId::find(name));
+    if (entry == nullptr) {
+        return;
+    }
+
+    mStatistics.Memory = mStatistics.Memory - entry->Size + size;
+    entry->Size = size;
+    touch(*entry);
+    enforceBudget();
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::setBudget(size_t budget) {
+    mBudget = budget;
+    enforceBudget();
+}
+
+template <class TResourceFactory, class TResource>
+inline size_t TResourceCache<TResourceFactory, TResource>::getBudget() const {
+    return mBudget;
+}
+
+template <class TResourceFactory, class TResource>
+inline size_t TResourceCache<TResourceFactory, TResource>::evictUnused() {
+    size_t numEvicted = 0;
+    for (auto it = mResourceMap.begin(); it != mResourceMap.end();) {
+        if (it->second.RefCount != 0) {
+            ++it;
+            continue;
+        }
+        auto next = std::next(it);
+        erase(it);
+        it = next;
+        ++mStatistics.Evictions;
+        ++numEvicted;
+    }
+
+    return numEvicted;
+}
+
+template <class TResourceFactory, class TResource>
+inline const ResourceCacheStatistics &TResourceCache<TResourceFactory, TResource>::getStatistics() const {
+    return mStatistics;
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::resetStatistics() {
+    mStatistics.Hits = 0;
+    mStatistics.Misses = 0;
+    mStatistics.Evictions = 0;
 }
 
 template <class TResourceFactory, class TResource>
 inline void TResourceCache<TResourceFactory, TResource>::clear() {
-    typename ResourceMap::iterator it(mResourceMap.begin());
-    for (; it != mResourceMap.end(); ++it) {
-        delete it->second;
+    for (auto &it : mResourceMap) {
+        if (it.second.RefCount != 0) {
+            osre_debug(ResTag, "Resource " + it.first.getString() + " is deleted while still referenced.");
+        }
+        delete it.second.Resource;
     }
     mResourceMap.clear();
+    mLruList.clear();
+    mStatistics.Memory = 0;
+    mStatistics.NumResources = 0;
+}
+
+template <class TResourceFactory, class TResource>
+inline typename TResourceCache<TResourceFactory, TResource>::Entry *TResourceCache<TResourceFactory, TResource>::lookup(StringId id) const {
+    if (id.isEmpty()) {
+        return nullptr;
+    }
+
+    auto it = mResourceMap.find(id);
+    if (it == mResourceMap.end()) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::touch(Entry &entry) const {
+    mLruList.splice(mLruList.begin(), mLruList, entry.LruPos);
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::erase(typename ResourceMap::iterator it) {
+    delete it->second.Resource;
+    mStatistics.Memory -= it->second.Size;
+    --mStatistics.NumResources;
+    mLruList.erase(it->second.LruPos);
+    mResourceMap.erase(it);
+}
+
+template <class TResourceFactory, class TResource>
+inline void TResourceCache<TResourceFactory, TResource>::enforceBudget() {
+    if (mBudget == 0 || mStatistics.Memory <= mBudget || mLruList.empty()) {
+        return;
+    }
+
+    // Walk from the least recently used entry, the most recently used one is kept in any case
+    auto lruIt = std::prev(mLruList.end());
+    while (mStatistics.Memory > mBudget && lruIt != mLruList.begin()) {
+        auto current = lruIt--;
+        auto it = mResourceMap.find(*current);
+        if (it->second.RefCount != 0) {
+            continue;
+        }
+        erase(it);
+        ++mStatistics.Evictions;
+    }
 }
 
 } // Namespace OSRE::Common
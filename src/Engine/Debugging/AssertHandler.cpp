@@ -28,7 +28,7 @@ namespace OSRE {
 namespace Debugging {
         
 void handleFatal( const String &file, int line, const OSRE::String &msg ) {
-    Common::fatalPrint( "Assertion", file, line, msg );
+    Common::fatalPrint( "Assertion", file.c_str(), line, msg );
 }
 
 void handleAssert( const String &file, int line, const char *msg ) {
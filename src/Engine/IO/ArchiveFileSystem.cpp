@@ -0,0 +1,138 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/ArchiveFileSystem.h"
+#include "IO/AssetArchive.h"
+#include "IO/MemoryStream.h"
+#include "Common/Logger.h"
+
+namespace OSRE::IO {
+
+DECL_OSRE_LOG_MODULE(ArchiveFileSystem)
+
+ArchiveFileSystem::~ArchiveFileSystem() {
+    for (size_t i = 0; i < mArchives.size(); ++i) {
+        delete mArchives[i];
+    }
+    mArchives.clear();
+}
+
+bool ArchiveFileSystem::addArchive(const String &archivePath) {
+    AssetArchive *archive = new AssetArchive;
+    if (!archive->open(archivePath)) {
+        delete archive;
+        return false;
+    }
+    mArchives.add(archive);
+    osre_debug(Tag, "Added archive " + archivePath + " with " + std::to_string(archive->getNumEntries()) + " entries.");
+
+    return true;
+}
+
+size_t ArchiveFileSystem::getNumArchives() const {
+    return mArchives.size();
+}
+
+Stream *ArchiveFileSystem::open(const Uri &file, Stream::AccessMode mode) {
+    if (mode != Stream::AccessMode::ReadAccess && mode != Stream::AccessMode::ReadAccessBinary &&
+            mode != Stream::AccessMode::MappedReadAccess) {
+        osre_error(Tag, "Archives are read-only.");
+        return nullptr;
+    }
+
+    const AssetArchive *archive = nullptr;
+    const AssetArchiveEntry *entry = findEntry(file, &archive);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    const Uri uri(Uri::schemeEnumToStr(Uri::ArchiveScheme) + entry->mName);
+    Stream *stream = nullptr;
+    if (const uc8 *view = archive->getView(*entry); view != nullptr) {
+        stream = new MemoryStream(uri, view, static_cast<size_t>(entry->mSize), false);
+    } else {
+        uc8 *data = new uc8[static_cast<size_t>(entry->mSize)];
+        if (!archive->extract(*entry, data)) {
+            delete[] data;
+            return nullptr;
+        }
+        stream = new MemoryStream(uri, data, static_cast<size_t>(entry->mSize), true);
+    }
+    stream->open();
+
+    return stream;
+}
+
+void ArchiveFileSystem::close(Stream **file) {
+    if (file == nullptr || *file == nullptr) {
+        return;
+    }
+
+    (*file)->close();
+    delete *file;
+    *file = nullptr;
+}
+
+bool ArchiveFileSystem::fileExist(const Uri &file) {
+    return findEntry(file, nullptr) != nullptr;
+}
+
+Stream *ArchiveFileSystem::find(const Uri &file, Stream::AccessMode mode, StringArray *searchPaths) {
+    if (searchPaths == nullptr) {
+        return nullptr;
+    }
+
+    for (const auto &path : *searchPaths) {
+        Stream *stream = open(Uri(Uri::schemeEnumToStr(Uri::ArchiveScheme) + path + file.getResource()), mode);
+        if (stream != nullptr) {
+            return stream;
+        }
+    }
+
+    return nullptr;
+}
+
+const c8 *ArchiveFileSystem::getSchema() const {
+    return Schema;
+}
+
+String ArchiveFileSystem::getWorkingDirectory() {
+    return String();
+}
+
+const AssetArchiveEntry *ArchiveFileSystem::findEntry(const Uri &file, const AssetArchive **archive) const {
+    // The archive added last overrides the entries of the ones before
+    const String &name = file.getAbsPath();
+    for (size_t i = mArchives.size(); i-- > 0;) {
+        const AssetArchiveEntry *entry = mArchives[i]->find(name);
+        if (entry != nullptr) {
+            if (archive != nullptr) {
+                *archive = mArchives[i];
+            }
+            return entry;
+        }
+    }
+
+    return nullptr;
+}
+
+} // Namespace OSRE::IO
@@ -0,0 +1,74 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "IO/AbstractFileSystem.h"
+
+namespace OSRE::IO {
+
+class AssetArchive;
+struct AssetArchiveEntry;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements a file system on top of asset archives.
+///
+/// Mount it with IOService::mountFileSystem using its schema. Entries can be opened by an 
+/// archive:// uri, the IOService will also prefer archive entries over loose files for file:// 
+/// uris with the same path. When several archives contain the same entry, the one added last wins.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT ArchiveFileSystem final : public AbstractFileSystem {
+public:
+    /// The schema of the file system.
+    static constexpr c8 Schema[] = "archive";
+
+    /// The default class constructor.
+    ArchiveFileSystem() = default;
+    /// The class destructor, will close all archives.
+    ~ArchiveFileSystem() override;
+    /// Will open an archive and add its entries.
+    bool addArchive(const String &archivePath);
+    /// Returns the number of added archives.
+    size_t getNumArchives() const;
+    /// Opens a read-only stream onto an entry, uncompressed entries are not copied.
+    Stream *open(const Uri &file, Stream::AccessMode mode) override;
+    /// The stream will be closed and released.
+    void close(Stream **file) override;
+    /// Returns true, if an archive contains the entry.
+    bool fileExist(const Uri &file) override;
+    /// Looks for an entry in the search paths.
+    Stream *find(const Uri &file, Stream::AccessMode mode, StringArray *searchPaths) override;
+    /// Returns the schema description of the file system.
+    const c8 *getSchema() const override;
+    /// Archives have no working directory, returns an empty string.
+    String getWorkingDirectory() override;
+
+private:
+    const AssetArchiveEntry *findEntry(const Uri &file, const AssetArchive **archive) const;
+
+private:
+    cppcore::TArray<AssetArchive*> mArchives;
+};
+
+} // Namespace OSRE::IO
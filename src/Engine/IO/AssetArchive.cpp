@@ -0,0 +1,379 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/AssetArchive.h"
+#include "IO/FileStream.h"
+#include "IO/Lz4Codec.h"
+#include "IO/MappedFileStream.h"
+#include "Common/Logger.h"
+#include "Common/StringUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace OSRE::IO {
+
+DECL_OSRE_LOG_MODULE(AssetArchive)
+
+static constexpr c8 Extension[] = "osar";
+static constexpr c8 Magic[4] = { 'O', 'S', 'A', 'R' };
+
+/// Entries smaller than this will not be compressed.
+static constexpr size_t MinCompressSize = 64;
+
+/// The file header.
+struct ArchiveHeader {
+    c8 mMagic[4];
+    ui32 mVersion;
+    ui32 mNumEntries;
+    ui32 mAlignment;
+    ui64 mTocOffset;
+    ui64 mTocSize;
+};
+
+/// One record of the table of contents, followed by the names.
+struct TocRecord {
+    ui64 mHash;
+    ui64 mOffset;
+    ui64 mStoredSize;
+    ui64 mSize;
+    ui32 mNameOffset;
+    ui32 mNameLen;
+    ui32 mCodec;
+    ui32 mReserved;
+};
+
+AssetArchive::AssetArchive() :
+        mPath(), mStream(nullptr), mEntries() {
+    // empty
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const String &archivePath) {
+    if (isOpen()) {
+        osre_error(Tag, "Archive " + mPath + " is already open.");
+        return false;
+    }
+
+    mStream = new MappedFileStream(Uri("file://" + archivePath), Stream::AccessMode::MappedReadAccess);
+    if (!mStream->open()) {
+        osre_error(Tag, "Cannot open archive " + archivePath + ".");
+        close();
+        return false;
+    }
+    mPath = archivePath;
+
+    const ui64 fileSize = mStream->getSize();
+    ArchiveHeader header = {};
+    if (mStream->read(&header, sizeof(header)) != sizeof(header) ||
+            0 != ::memcmp(header.mMagic, Magic, sizeof(Magic)) || header.mVersion != Version) {
+        osre_error(Tag, "Archive " + archivePath + " has an unsupported format.");
+        close();
+        return false;
+    }
+
+    const ui64 recordsSize = static_cast<ui64>(header.mNumEntries) * sizeof(TocRecord);
+    const uc8 *toc = mStream->map(header.mTocOffset, header.mTocSize);
+    if (toc == nullptr || recordsSize > header.mTocSize) {
+        osre_error(Tag, "Archive " + archivePath + " is broken.");
+        close();
+        return false;
+    }
+
+    const c8 *names = reinterpret_cast<const c8 *>(toc + recordsSize);
+    const ui64 namesSize = header.mTocSize - recordsSize;
+    mEntries.resize(header.mNumEntries);
+    for (ui32 i = 0; i < header.mNumEntries; ++i) {
+        TocRecord record;
+        ::memcpy(&record, toc + i * sizeof(TocRecord), sizeof(TocRecord));
+        if (static_cast<ui64>(record.mNameOffset) + record.mNameLen > namesSize ||
+                record.mOffset > fileSize || record.mStoredSize > fileSize - record.mOffset ||
+                record.mCodec > static_cast<ui32>(ArchiveCodec::Lz4)) {
+            osre_error(Tag, "Archive " + archivePath + " contains a broken entry.");
+            close();
+            return false;
+        }
+
+        AssetArchiveEntry &entry = mEntries[i];
+        entry.mName.assign(names + record.mNameOffset, record.mNameLen);
+        entry.mHash = record.mHash;
+        entry.mOffset = record.mOffset;
+        entry.mStoredSize = record.mStoredSize;
+        entry.mSize = record.mSize;
+        entry.mCodec = static_cast<ArchiveCodec>(record.mCodec);
+    }
+
+    return true;
+}
+
+void AssetArchive::close() {
+    if (mStream != nullptr) {
+        mStream->close();
+        delete mStream;
+        mStream = nullptr;
+    }
+    mEntries.clear();
+    mPath.clear();
+}
+
+bool AssetArchive::isOpen() const {
+    return mStream != nullptr;
+}
+
+const String &AssetArchive::getPath() const {
+    return mPath;
+}
+
+size_t AssetArchive::getNumEntries() const {
+    return mEntries.size();
+}
+
+const AssetArchiveEntry &AssetArchive::getEntryAt(size_t index) const {
+    return mEntries[index];
+}
+
+const AssetArchiveEntry *AssetArchive::find(const String &name) const {
+    if (mEntries.isEmpty()) {
+        return nullptr;
+    }
+
+    const String normalized = normalizeName(name);
+    const HashId hash = hashName(normalized);
+
+    // Lower bound of the hash, the entries are sorted by it
+    size_t first = 0, count = mEntries.size();
+    while (count > 0) {
+        const size_t step = count / 2;
+        if (mEntries[first + step].mHash < hash) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+
+    for (size_t i = first; i < mEntries.size() && mEntries[i].mHash == hash; ++i) {
+        if (mEntries[i].mName == normalized) {
+            return &mEntries[i];
+        }
+    }
+
+    return nullptr;
+}
+
+const uc8 *AssetArchive::getView(const AssetArchiveEntry &entry) const {
+    if (mStream == nullptr || entry.mCodec != ArchiveCodec::Stored) {
+        return nullptr;
+    }
+
+    return mStream->map(entry.mOffset, entry.mStoredSize);
+}
+
+bool AssetArchive::extract(const AssetArchiveEntry &entry, uc8 *buffer) const {
+    if (mStream == nullptr || (buffer == nullptr && entry.mSize != 0)) {
+        return false;
+    }
+
+    const uc8 *data = mStream->map(entry.mOffset, entry.mStoredSize);
+    if (data == nullptr) {
+        return false;
+    }
+
+    if (entry.mCodec == ArchiveCodec::Stored) {
+        if (entry.mStoredSize != entry.mSize) {
+            return false;
+        }
+        if (entry.mSize > 0) {
+            ::memcpy(buffer, data, static_cast<size_t>(entry.mSize));
+        }
+        return true;
+    }
+
+    if (!Lz4Codec::decompress(data, static_cast<size_t>(entry.mStoredSize), buffer, static_cast<size_t>(entry.mSize))) {
+        osre_error(Tag, "Cannot decompress " + entry.mName + " from archive " + mPath + ".");
+        return false;
+    }
+
+    return true;
+}
+
+static bool readFile(const String &path, std::vector<uc8> &data) {
+    FileStream stream(Uri("file://" + path), Stream::AccessMode::ReadAccessBinary);
+    if (!stream.open()) {
+        return false;
+    }
+
+    data.resize(static_cast<size_t>(stream.getSize()));
+    const bool ok = data.empty() || stream.read(data.data(), data.size()) == data.size();
+    stream.close();
+
+    return ok;
+}
+
+static bool writePadding(FileStream &stream, ui64 &pos, ui32 alignment) {
+    static constexpr uc8 Zeros[256] = {};
+    const ui64 padding = (alignment - (pos & (alignment - 1))) & (alignment - 1);
+    for (ui64 written = 0; written < padding;) {
+        const size_t chunk = static_cast<size_t>(std::min<ui64>(padding - written, sizeof(Zeros)));
+        if (stream.write(Zeros, chunk) != chunk) {
+            return false;
+        }
+        written += chunk;
+    }
+    pos += padding;
+
+    return true;
+}
+
+bool AssetArchive::create(const String &archivePath, const AssetArchiveSourceArray &sources, bool compress, ui32 alignment) {
+    if (archivePath.empty() || alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        osre_error(Tag, "Invalid archive parameters.");
+        return false;
+    }
+
+    FileStream stream(Uri("file://" + archivePath), Stream::AccessMode::WriteAccessBinary);
+    if (!stream.open()) {
+        osre_error(Tag, "Cannot open archive " + archivePath + " for writing.");
+        return false;
+    }
+
+    // The header is written last, until then the file has no valid magic
+    ArchiveHeader header = {};
+    bool ok = stream.write(&header, sizeof(header)) == sizeof(header);
+    ui64 pos = sizeof(header);
+
+    std::vector<AssetArchiveEntry> entries;
+    std::vector<uc8> data, packed;
+    for (size_t i = 0; ok && i < sources.size(); ++i) {
+        const AssetArchiveSource &source = sources[i];
+        AssetArchiveEntry entry;
+        entry.mName = normalizeName(source.mName);
+        entry.mHash = hashName(entry.mName);
+        const bool duplicate = std::any_of(entries.begin(), entries.end(), [&entry](const AssetArchiveEntry &other) {
+            return other.mHash == entry.mHash && other.mName == entry.mName;
+        });
+        if (duplicate) {
+            osre_warn(Tag, "Skipping duplicated archive entry " + entry.mName + ".");
+            continue;
+        }
+        if (!readFile(source.mPath, data)) {
+            osre_error(Tag, "Cannot read " + source.mPath + ".");
+            ok = false;
+            break;
+        }
+
+        // Keep the compressed data only when it saves at least one eighth
+        const uc8 *blob = data.data();
+        size_t blobSize = data.size();
+        entry.mCodec = ArchiveCodec::Stored;
+        if (compress && data.size() >= MinCompressSize) {
+            packed.resize(Lz4Codec::compressBound(data.size()));
+            const size_t packedSize = Lz4Codec::compress(data.data(), data.size(), packed.data(), packed.size());
+            if (packedSize != 0 && packedSize < data.size() - data.size() / 8) {
+                blob = packed.data();
+                blobSize = packedSize;
+                entry.mCodec = ArchiveCodec::Lz4;
+            }
+        }
+
+        ok = writePadding(stream, pos, alignment);
+        entry.mOffset = pos;
+        entry.mStoredSize = blobSize;
+        entry.mSize = data.size();
+        if (ok && blobSize > 0) {
+            ok = stream.write(blob, blobSize) == blobSize;
+        }
+        pos += blobSize;
+        entries.push_back(entry);
+    }
+
+    // The table of contents: the records sorted by the name hash, followed by the names
+    std::sort(entries.begin(), entries.end(), [](const AssetArchiveEntry &lhs, const AssetArchiveEntry &rhs) {
+        return lhs.mHash < rhs.mHash;
+    });
+    std::vector<TocRecord> records;
+    String names;
+    for (const AssetArchiveEntry &entry : entries) {
+        TocRecord record = {};
+        record.mHash = entry.mHash;
+        record.mOffset = entry.mOffset;
+        record.mStoredSize = entry.mStoredSize;
+        record.mSize = entry.mSize;
+        record.mNameOffset = static_cast<ui32>(names.size());
+        record.mNameLen = static_cast<ui32>(entry.mName.size());
+        record.mCodec = static_cast<ui32>(entry.mCodec);
+        records.push_back(record);
+        names += entry.mName;
+    }
+
+    if (ok) {
+        ok = writePadding(stream, pos, alignof(TocRecord));
+    }
+    ::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mAlignment = alignment;
+    header.mNumEntries = static_cast<ui32>(records.size());
+    header.mTocOffset = pos;
+    header.mTocSize = records.size() * sizeof(TocRecord) + names.size();
+    if (ok && !records.empty()) {
+        ok = stream.write(records.data(), records.size() * sizeof(TocRecord)) == records.size() * sizeof(TocRecord);
+    }
+    if (ok && !names.empty()) {
+        ok = stream.write(names.data(), names.size()) == names.size();
+    }
+
+    if (ok) {
+        stream.seek(0, Stream::Origin::Begin);
+        ok = stream.write(&header, sizeof(header)) == sizeof(header);
+    }
+    stream.close();
+    if (!ok) {
+        osre_error(Tag, "Error while writing archive " + archivePath + ".");
+        ::remove(archivePath.c_str());
+    }
+
+    return ok;
+}
+
+const c8 *AssetArchive::getExtension() {
+    return Extension;
+}
+
+String AssetArchive::normalizeName(const String &name) {
+    String normalized = name;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    while (normalized.compare(0, 2, "./") == 0) {
+        normalized.erase(0, 2);
+    }
+
+    return normalized;
+}
+
+HashId AssetArchive::hashName(const String &name) {
+    return Common::StringUtils::fnv1a64(name.c_str(), name.size());
+}
+
+} // Namespace OSRE::IO
@@ -0,0 +1,155 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+
+#include <cppcore/Container/TArray.h>
+
+namespace OSRE::IO {
+
+class MappedFileStream;
+
+/// @brief  The codec used to store an archive entry.
+enum class ArchiveCodec : ui32 {
+    Stored = 0,     ///< Uncompressed, can be accessed without a copy.
+    Lz4             ///< LZ4 block.
+};
+
+/// @brief  One entry of the table of contents.
+struct AssetArchiveEntry {
+    String mName;                               ///< The normalized name.
+    HashId mHash = 0;                           ///< The hash of the name.
+    ui64 mOffset = 0;                           ///< The offset of the stored data in the archive.
+    ui64 mStoredSize = 0;                       ///< The size of the stored data.
+    ui64 mSize = 0;                             ///< The uncompressed size.
+    ArchiveCodec mCodec = ArchiveCodec::Stored; ///< The codec.
+};
+
+/// @brief  A file to put into an archive.
+struct AssetArchiveSource {
+    String mName;   ///< The name inside the archive, usually the path used in the asset uris.
+    String mPath;   ///< The path of the file to read.
+};
+
+using AssetArchiveSourceArray = cppcore::TArray<AssetArchiveSource>;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements the engine-native asset archive.
+///
+/// An archive is a single file containing many assets. The table of contents is stored at the end 
+/// of the file and sorted by the hash of the entry names, so a lookup is a binary search. Each 
+/// entry is stored either uncompressed or as an LZ4 block, whatever is smaller. The entries are 
+/// aligned, so uncompressed entries can be used directly from the memory-mapped archive.
+///
+/// Opening an archive maps the file once and reads the table of contents, the entries will be 
+/// read on demand.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT AssetArchive {
+public:
+    /// @brief  The current version of the file format.
+    static constexpr ui32 Version = 1;
+    /// @brief  The default alignment of the entries.
+    static constexpr ui32 DefaultAlignment = 16;
+
+    /// @brief  The default class constructor.
+    AssetArchive();
+
+    /// @brief  The class destructor.
+    ~AssetArchive();
+
+    /// @brief  Will open an archive.
+    /// @param[in] archivePath  The path of the archive.
+    /// @return true if successful, false if the file is missing or broken.
+    bool open(const String &archivePath);
+
+    /// @brief  Will close the archive, all views get invalid.
+    void close();
+
+    /// @brief  Returns true, if the archive is open.
+    /// @return true if open.
+    bool isOpen() const;
+
+    /// @brief  Returns the path of the archive.
+    /// @return The path.
+    const String &getPath() const;
+
+    /// @brief  Returns the number of entries.
+    /// @return The number of entries.
+    size_t getNumEntries() const;
+
+    /// @brief  Returns an entry.
+    /// @param[in] index    The entry index.
+    /// @return The entry.
+    const AssetArchiveEntry &getEntryAt(size_t index) const;
+
+    /// @brief  Will look for an entry.
+    /// @param[in] name     The entry name.
+    /// @return The entry or nullptr, if the archive does not contain the name.
+    const AssetArchiveEntry *find(const String &name) const;
+
+    /// @brief  Returns a view onto the data of an uncompressed entry.
+    /// @param[in] entry    The entry.
+    /// @return The view or nullptr, if the entry is compressed.
+    const uc8 *getView(const AssetArchiveEntry &entry) const;
+
+    /// @brief  Will copy the uncompressed data of an entry into a buffer.
+    /// @param[in]  entry   The entry.
+    /// @param[out] buffer  The buffer, must hold at least entry.mSize bytes.
+    /// @return true if successful, false if the data is broken.
+    bool extract(const AssetArchiveEntry &entry, uc8 *buffer) const;
+
+    /// @brief  Will write a new archive.
+    /// @param[in] archivePath  The path of the archive to write.
+    /// @param[in] sources      The files to pack.
+    /// @param[in] compress     true to compress the entries.
+    /// @param[in] alignment    The alignment of the entries, must be a power of two.
+    /// @return true if successful, false in case of an error.
+    static bool create(const String &archivePath, const AssetArchiveSourceArray &sources, bool compress, 
+        ui32 alignment = DefaultAlignment);
+
+    /// @brief  Returns the file extension of archives.
+    /// @return The extension.
+    static const c8 *getExtension();
+
+    /// @brief  Will normalize an entry name, backslashes will be replaced and a leading "./" removed.
+    /// @param[in] name     The name.
+    /// @return The normalized name.
+    static String normalizeName(const String &name);
+
+    /// @brief  Will calculate the hash of a normalized entry name.
+    /// @param[in] name     The name.
+    /// @return The hash.
+    static HashId hashName(const String &name);
+
+    OSRE_NON_COPYABLE(AssetArchive)
+
+private:
+    String mPath;
+    MappedFileStream *mStream;
+    cppcore::TArray<AssetArchiveEntry> mEntries;
+};
+
+} // Namespace OSRE::IO
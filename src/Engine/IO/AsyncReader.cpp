@@ -0,0 +1,379 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/AsyncReader.h"
+#include "Common/Logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef OSRE_WINDOWS
+#   include "Platform/Windows/MinWindows.h"
+#else
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace OSRE::IO {
+
+DECL_OSRE_LOG_MODULE(AsyncReader)
+
+using ReadBuffer = std::vector<uc8>;
+
+/// One enqueued read request.
+struct ReadRequest {
+    Uri mUri;
+    String mPath;
+    ui64 mOffset;
+    ui64 mSize;
+    AsyncReadCallback mCallback;
+};
+
+/// A finished read, merged requests share the buffer.
+struct CompletedRead {
+    ReadRequest mRequest;
+    std::shared_ptr<ReadBuffer> mBuffer;
+    size_t mStart;
+    size_t mSize;
+    bool mSuccess;
+};
+
+using ReadBatch = std::vector<ReadRequest>;
+
+struct AsyncReaderImpl {
+    mutable std::mutex mLock;
+    std::condition_variable mWakeup;
+    std::condition_variable mIdle;
+    std::deque<ReadRequest> mPending[static_cast<size_t>(IOPriority::Count)];
+    std::vector<CompletedRead> mCompleted;
+    std::vector<std::thread> mWorkers;
+    bool mRunning = false;
+    size_t mInFlight = 0;
+    std::atomic<ui64> mNumFileReads{ 0 };
+
+    bool hasPending() const {
+        for (const auto &queue : mPending) {
+            if (!queue.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool takeBatch(ReadBatch &batch, ui64 &begin, ui64 &end);
+    void execute(ReadBatch &batch, ui64 begin, ui64 end);
+    void workerLoop();
+};
+
+/// Reads a range of a file with a positioned read, size 0 reads until the end of the file.
+static bool readRange(const String &path, ui64 offset, ui64 size, ReadBuffer &buffer) {
+    buffer.clear();
+#ifdef OSRE_WINDOWS
+    HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    if (size == 0) {
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || static_cast<ui64>(fileSize.QuadPart) < offset) {
+            ::CloseHandle(file);
+            return false;
+        }
+        size = static_cast<ui64>(fileSize.QuadPart) - offset;
+    }
+    buffer.resize(static_cast<size_t>(size));
+    size_t numRead = 0;
+    while (numRead < buffer.size()) {
+        const ui64 pos = offset + numRead;
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(pos & 0xFFFFFFFF);
+        overlapped.OffsetHigh = static_cast<DWORD>(pos >> 32);
+        const DWORD chunk = static_cast<DWORD>(std::min<size_t>(buffer.size() - numRead, 0x40000000));
+        DWORD bytes = 0;
+        if (!::ReadFile(file, buffer.data() + numRead, chunk, &bytes, &overlapped) || bytes == 0) {
+            break;
+        }
+        numRead += bytes;
+    }
+    ::CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    if (size == 0) {
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || static_cast<ui64>(fileStat.st_size) < offset) {
+            ::close(fd);
+            return false;
+        }
+        size = static_cast<ui64>(fileStat.st_size) - offset;
+    }
+    buffer.resize(static_cast<size_t>(size));
+    size_t numRead = 0;
+    while (numRead < buffer.size()) {
+        const ssize_t bytes = ::pread(fd, buffer.data() + numRead, buffer.size() - numRead, static_cast<off_t>(offset + numRead));
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes <= 0) {
+            break;
+        }
+        numRead += static_cast<size_t>(bytes);
+    }
+    ::close(fd);
+#endif
+    buffer.resize(numRead);
+
+    return true;
+}
+
+bool AsyncReaderImpl::takeBatch(ReadBatch &batch, ui64 &begin, ui64 &end) {
+    batch.clear();
+    for (size_t prio = static_cast<size_t>(IOPriority::Count); prio-- > 0;) {
+        if (mPending[prio].empty()) {
+            continue;
+        }
+        batch.push_back(std::move(mPending[prio].front()));
+        mPending[prio].pop_front();
+        break;
+    }
+    if (batch.empty()) {
+        return false;
+    }
+
+    begin = batch.front().mOffset;
+    end = begin + batch.front().mSize;
+    if (batch.front().mSize == 0) {
+        return true;
+    }
+
+    // Merge all pending ranges of the same file touching the batch range, regardless of their priority
+    const String path = batch.front().mPath;
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (auto &queue : mPending) {
+            for (auto it = queue.begin(); it != queue.end();) {
+                const ui64 reqBegin = it->mOffset;
+                const ui64 reqEnd = it->mOffset + it->mSize;
+                const ui64 newBegin = std::min(begin, reqBegin);
+                const ui64 newEnd = std::max(end, reqEnd);
+                if (it->mSize == 0 || it->mPath != path || reqBegin > end + AsyncReader::MaxCoalesceGap ||
+                        reqEnd + AsyncReader::MaxCoalesceGap < begin || newEnd - newBegin > AsyncReader::MaxCoalescedSize) {
+                    ++it;
+                    continue;
+                }
+                begin = newBegin;
+                end = newEnd;
+                batch.push_back(std::move(*it));
+                it = queue.erase(it);
+                merged = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+void AsyncReaderImpl::execute(ReadBatch &batch, ui64 begin, ui64 end) {
+    auto buffer = std::make_shared<ReadBuffer>();
+    const String &path = batch.front().mPath;
+    const bool ok = readRange(path, begin, end - begin, *buffer);
+    ++mNumFileReads;
+    if (!ok) {
+        osre_warn(Tag, "Cannot read from " + path + ".");
+    }
+
+    std::vector<CompletedRead> completed;
+    completed.reserve(batch.size());
+    for (auto &request : batch) {
+        const size_t start = static_cast<size_t>(request.mOffset - begin);
+        size_t size = 0;
+        if (buffer->size() > start) {
+            const size_t available = buffer->size() - start;
+            size = request.mSize == 0 ? available : static_cast<size_t>(std::min<ui64>(request.mSize, available));
+        }
+        const bool success = ok && (request.mSize == 0 || size == request.mSize);
+        completed.push_back({ std::move(request), buffer, start, size, success });
+    }
+
+    std::lock_guard<std::mutex> guard(mLock);
+    for (auto &read : completed) {
+        mCompleted.push_back(std::move(read));
+    }
+    mInFlight -= batch.size();
+    if (mInFlight == 0 && !hasPending()) {
+        mIdle.notify_all();
+    }
+}
+
+void AsyncReaderImpl::workerLoop() {
+    ReadBatch batch;
+    for (;;) {
+        ui64 begin = 0, end = 0;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mWakeup.wait(lock, [this]() { return !mRunning || hasPending(); });
+            if (!mRunning) {
+                return;
+            }
+            takeBatch(batch, begin, end);
+            mInFlight += batch.size();
+        }
+        execute(batch, begin, end);
+    }
+}
+
+AsyncReader::AsyncReader() :
+        mImpl(new AsyncReaderImpl) {
+    // empty
+}
+
+AsyncReader::~AsyncReader() {
+    stop();
+    delete mImpl;
+}
+
+bool AsyncReader::start(ui32 numThreads) {
+    if (numThreads == 0) {
+        osre_error(Tag, "At least one I/O thread is required.");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    if (mImpl->mRunning) {
+        osre_debug(Tag, "I/O threads already running.");
+        return false;
+    }
+
+    mImpl->mRunning = true;
+    for (ui32 i = 0; i < numThreads; ++i) {
+        mImpl->mWorkers.emplace_back(&AsyncReaderImpl::workerLoop, mImpl);
+    }
+
+    return true;
+}
+
+void AsyncReader::stop() {
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        if (!mImpl->mRunning) {
+            return;
+        }
+        mImpl->mRunning = false;
+    }
+    mImpl->mWakeup.notify_all();
+    for (auto &worker : mImpl->mWorkers) {
+        worker.join();
+    }
+    mImpl->mWorkers.clear();
+    mImpl->mIdle.notify_all();
+}
+
+bool AsyncReader::isRunning() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    return mImpl->mRunning;
+}
+
+bool AsyncReader::read(const Uri &uri, ui64 offset, ui64 size, const AsyncReadCallback &callback, IOPriority priority) {
+    if (uri.isEmpty() || priority == IOPriority::Count) {
+        osre_error(Tag, "Invalid read request.");
+        return false;
+    }
+
+    ReadRequest request = { uri, uri.getAbsPath(), offset, size, callback };
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        mImpl->mPending[static_cast<size_t>(priority)].push_back(std::move(request));
+    }
+    mImpl->mWakeup.notify_one();
+
+    return true;
+}
+
+size_t AsyncReader::dispatchCompleted() {
+    std::vector<CompletedRead> completed;
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        completed.swap(mImpl->mCompleted);
+    }
+
+    for (const auto &read : completed) {
+        if (!read.mRequest.mCallback) {
+            continue;
+        }
+        AsyncReadResult result;
+        result.mUri = read.mRequest.mUri;
+        result.mOffset = read.mRequest.mOffset;
+        result.mData = read.mSize > 0 ? read.mBuffer->data() + read.mStart : nullptr;
+        result.mSize = read.mSize;
+        result.mSuccess = read.mSuccess;
+        read.mRequest.mCallback(result);
+    }
+
+    return completed.size();
+}
+
+void AsyncReader::waitIdle() {
+    std::unique_lock<std::mutex> lock(mImpl->mLock);
+    if (mImpl->mRunning) {
+        mImpl->mIdle.wait(lock, [this]() { 
+            return !mImpl->mRunning || (mImpl->mInFlight == 0 && !mImpl->hasPending()); 
+        });
+        return;
+    }
+
+    // No I/O threads, so do the work here
+    ReadBatch batch;
+    ui64 begin = 0, end = 0;
+    while (mImpl->takeBatch(batch, begin, end)) {
+        mImpl->mInFlight += batch.size();
+        lock.unlock();
+        mImpl->execute(batch, begin, end);
+        lock.lock();
+    }
+}
+
+size_t AsyncReader::getNumPending() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    size_t numPending = mImpl->mInFlight;
+    for (const auto &queue : mImpl->mPending) {
+        numPending += queue.size();
+    }
+
+    return numPending;
+}
+
+ui64 AsyncReader::getNumFileReads() const {
+    return mImpl->mNumFileReads;
+}
+
+} // Namespace OSRE::IO
@@ -0,0 +1,120 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "IO/Uri.h"
+
+#include <functional>
+
+namespace OSRE::IO {
+
+/// @brief  The priority of an asynchronous read request.
+enum class IOPriority {
+    Low = 0,    ///< Background streaming, will be served last.
+    Normal,     ///< Default priority.
+    High,       ///< Data needed for the next frames.
+    Count       ///< Number of priorities, not a valid priority.
+};
+
+/// @brief  The result of an asynchronous read, handed to the completion callback.
+struct AsyncReadResult {
+    Uri mUri;                   ///< The file which was read.
+    ui64 mOffset = 0;           ///< The requested offset.
+    const uc8 *mData = nullptr; ///< The data, only valid during the callback.
+    size_t mSize = 0;           ///< The number of bytes read.
+    bool mSuccess = false;      ///< true, if all requested bytes were read.
+};
+
+/// @brief  The completion callback type.
+using AsyncReadCallback = std::function<void(const AsyncReadResult &result)>;
+
+struct AsyncReaderImpl;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements asynchronous reads of file ranges on a pool of I/O threads.
+///
+/// Requests are served by priority, in submit order within one priority. When a worker picks up 
+/// a request it merges all pending requests for the same file whose ranges are adjacent to it 
+/// into one positioned read. The completion callbacks are not called on the I/O threads, they 
+/// will be called by dispatchCompleted() on the thread which owns the reader.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT AsyncReader {
+public:
+    /// @brief  Ranges with a gap up to this size will be merged into one read.
+    static constexpr ui64 MaxCoalesceGap = 4096;
+    /// @brief  Merged reads will not grow beyond this size.
+    static constexpr ui64 MaxCoalescedSize = 8 * 1024 * 1024;
+
+    /// @brief  The default class constructor.
+    AsyncReader();
+
+    /// @brief  The class destructor, will stop the workers.
+    ~AsyncReader();
+
+    /// @brief  Will start the I/O threads.
+    /// @param  numThreads  [in] The number of I/O threads.
+    /// @return true, if successful.
+    bool start(ui32 numThreads);
+
+    /// @brief  Will stop the I/O threads, pending requests are kept.
+    void stop();
+
+    /// @brief  Returns true, if the I/O threads are running.
+    /// @return true if running.
+    bool isRunning() const;
+
+    /// @brief  Will enqueue an asynchronous read.
+    /// @param  uri         [in] The file to read from.
+    /// @param  offset      [in] The offset of the first byte.
+    /// @param  size        [in] The number of bytes to read, 0 reads until the end of the file.
+    /// @param  callback    [in] The callback to call once the data is available.
+    /// @param  priority    [in] The priority of the request.
+    /// @return true, if the request was enqueued.
+    bool read(const Uri &uri, ui64 offset, ui64 size, const AsyncReadCallback &callback, 
+        IOPriority priority = IOPriority::Normal);
+
+    /// @brief  Will call the callbacks of all finished reads on the calling thread.
+    /// @return The number of called callbacks.
+    size_t dispatchCompleted();
+
+    /// @brief  Will block until all enqueued reads are finished. When no I/O thread is running 
+    ///         the reads will be done on the calling thread.
+    void waitIdle();
+
+    /// @brief  Returns the number of requests not finished yet.
+    /// @return The number of pending requests.
+    size_t getNumPending() const;
+
+    /// @brief  Returns the number of file reads issued, merged requests share one read.
+    /// @return The number of file reads.
+    ui64 getNumFileReads() const;
+
+    OSRE_NON_COPYABLE(AsyncReader)
+
+private:
+    AsyncReaderImpl *mImpl;
+};
+
+} // Namespace OSRE::IO
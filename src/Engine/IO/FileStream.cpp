@@ -59,7 +59,7 @@ bool FileStream::open() {
     const String &abspath = mUri.getAbsPath();
     String modestr;
     AccessMode mode = getAccessMode();
-    if (AccessMode::ReadAccessBinary == mode) {
+    if (AccessMode::ReadAccessBinary == mode || AccessMode::MappedReadAccess == mode) {
         modestr = "rb";
     } else if (AccessMode::WriteAccessBinary == mode) {
         modestr = "wb";
@@ -95,7 +95,7 @@ bool FileStream::close() {
     return true;
 }
 
-size_t FileStream::getSize() const {
+ui64 FileStream::getSize() const {
     osre_assert(!mUri.getAbsPath().empty());
 
     const String &abspath(mUri.getAbsPath());
@@ -107,7 +107,7 @@ size_t FileStream::getSize() const {
         return 0;
     }
 
-    return (static_cast<ui32>(fileStat.st_size));
+    return static_cast<ui64>(fileStat.st_size);
 #else
     // For unix
     struct stat fileStat;
@@ -115,7 +115,7 @@ size_t FileStream::getSize() const {
     if (0 != err) {
         return 0;
     }
-    return static_cast<ui32>(fileStat.st_size);
+    return static_cast<ui64>(fileStat.st_size);
 #endif
 }
 
@@ -172,25 +172,38 @@ size_t FileStream::writeUI32(ui32 value) {
 }
 
 FileStream::Position FileStream::seek(Offset offset, Origin origin) {
-    i32 originValue(0);
+    if (!isOpen()) {
+        return 0;
+    }
+
+    i32 originValue(SEEK_SET);
     if (origin == Stream::Origin::Current) {
         originValue = SEEK_CUR;
-    } else {
-        originValue = SEEK_SET;
-    }
-    if (isOpen()) {
-        return ::fseek(mFile, offset, originValue);
+    } else if (origin == Stream::Origin::End) {
+        originValue = SEEK_END;
     }
 
-    return 0;
+#ifdef OSRE_WINDOWS
+    ::_fseeki64(mFile, offset, originValue);
+#else
+    ::fseeko(mFile, static_cast<off_t>(offset), originValue);
+#endif
+
+    return tell();
 }
 
 FileStream::Position FileStream::tell() {
-    if (isOpen()) {
-        return (::ftell(mFile));
+    if (!isOpen()) {
+        return 0;
     }
 
-    return 0;
+#ifdef OSRE_WINDOWS
+    const i64 pos = ::_ftelli64(mFile);
+#else
+    const i64 pos = static_cast<i64>(::ftello(mFile));
+#endif
+
+    return pos < 0 ? 0 : static_cast<Position>(pos);
 }
 
 bool FileStream::isOpen() const {
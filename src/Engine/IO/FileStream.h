@@ -52,7 +52,7 @@ public:
     /// Close the file.
     bool close() override;
     /// Returns file size.
-    size_t getSize() const override;
+    ui64 getSize() const override;
     /// Reads from file.
     size_t read(void *pBuffer, size_t size) override;
     /// Writes into file.
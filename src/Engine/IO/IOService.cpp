@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IO/IOService.h"
 #include "Common/Tokenizer.h"
 #include "Common/Logger.h"
+#include "IO/ArchiveFileSystem.h"
 #include "IO/LocaleFileSystem.h"
 
 IMPLEMENT_SINGLETON(::OSRE::IO::IOService)
@@ -33,7 +34,25 @@ using namespace OSRE::Common;
 
 static constexpr c8 Tag[] = "IOService";
 
-IOService::IOService() : AbstractService("io/ioserver"), mMountedMap() {
+static constexpr ui32 NumIOThreads = 2;
+
+/// File systems are mounted by their schema, which is the scheme without the "://".
+static String getSchemaName(Uri::SchemeType scheme) {
+    String name = Uri::schemeEnumToStr(scheme);
+    const String::size_type pos = name.find("://");
+    if (pos != String::npos) {
+        name.resize(pos);
+    }
+
+    return name;
+}
+
+static bool isReadAccess(Stream::AccessMode mode) {
+    return mode == Stream::AccessMode::ReadAccess || mode == Stream::AccessMode::ReadAccessBinary || 
+        mode == Stream::AccessMode::MappedReadAccess;
+}
+
+IOService::IOService() : AbstractService("io/ioserver"), mMountedMap(), mAsyncReader() {
     CREATE_SINGLETON( IOService );
 }
 
@@ -47,10 +66,13 @@ bool IOService::onOpen() {
     pFileSystem = new LocaleFileSystem;
     mountFileSystem( pFileSystem->getSchema(), pFileSystem );
 
-    return true;
+    return mAsyncReader.start(NumIOThreads);
 }
 
 bool IOService::onClose() {
+    mAsyncReader.stop();
+    mAsyncReader.dispatchCompleted();
+
     if (mMountedMap.empty()) {
         return true;
     }
@@ -64,6 +86,8 @@ bool IOService::onClose() {
 }
 
 bool IOService::onUpdate() {
+    mAsyncReader.dispatchCompleted();
+
     return true;
 }
 
@@ -82,13 +106,28 @@ void IOService::umountFileSystem(const String &mountPoint, AbstractFileSystem *f
 }
 
 Stream *IOService::openStream(const Uri &file, Stream::AccessMode mode) {
-    if (auto *fs = getFileSystem(Uri::schemeEnumToStr(file.getScheme())); fs != nullptr) {
+    // Files packed into a mounted archive are preferred over the loose files
+    if (file.getScheme() == Uri::FileScheme && isReadAccess(mode)) {
+        if (auto *archiveFs = getFileSystem(ArchiveFileSystem::Schema); archiveFs != nullptr && archiveFs->fileExist(file)) {
+            return archiveFs->open(file, mode);
+        }
+    }
+
+    if (auto *fs = getFileSystem(getSchemaName(file.getScheme())); fs != nullptr) {
         return fs->open( file, mode );
     }
 
     return nullptr;
 }
 
+bool IOService::readAsync(const Uri &file, ui64 offset, ui64 size, const AsyncReadCallback &callback, IOPriority priority) {
+    return mAsyncReader.read(file, offset, size, callback, priority);
+}
+
+AsyncReader &IOService::getAsyncReader() {
+    return mAsyncReader;
+}
+
 void IOService::closeStream( Stream **ppStream ) {
     if (nullptr == ppStream) {
         osre_error(Tag, "Invalid pointer to stream.");
@@ -100,7 +139,7 @@ void IOService::closeStream( Stream **ppStream ) {
         return;
     }
     
-    const String &schema = Uri::schemeEnumToStr((*ppStream)->getUri().getScheme());
+    const String schema = getSchemaName((*ppStream)->getUri().getScheme());
     if (auto *fs = getFileSystem(schema); fs != nullptr) {
         fs->close( ppStream );
     }
@@ -120,10 +159,15 @@ AbstractFileSystem *IOService::getFileSystem( const String &schema ) const {
 
 bool IOService::fileExists( const Uri &file ) const {
     bool exists = false;
-    AbstractFileSystem *fs = this->getFileSystem(Uri::schemeEnumToStr(file.getScheme()));
+    AbstractFileSystem *fs = this->getFileSystem(getSchemaName(file.getScheme()));
     if (fs != nullptr) {
         exists = fs->fileExist(file);
     }
+    if (!exists && file.getScheme() == Uri::FileScheme) {
+        if (auto *archiveFs = getFileSystem(ArchiveFileSystem::Schema); archiveFs != nullptr) {
+            exists = archiveFs->fileExist(file);
+        }
+    }
 
     return exists;
 }
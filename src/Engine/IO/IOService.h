@@ -24,6 +24,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Common/AbstractService.h"
 #include "IO/AbstractFileSystem.h"
+#include "IO/AsyncReader.h"
 #include "IO/Stream.h"
 
 #include <map>
@@ -58,10 +59,24 @@ public:
 
     /// @brief  A new stream will be opened, the corresponding file system will be used.
     /// @param  file        [in] The file name as an Uri.
-    /// @param  mode        [in] The access mode.
+    /// @param  mode        [in] The access mode, use MappedReadAccess to get a memory-mapped stream.
     /// @return A pointer showing to the stream or nullptr in case of an error.
     Stream *openStream(const Uri &file, Stream::AccessMode mode);
     
+    /// @brief  Will read a range of a file on the I/O threads, adjacent requests will be merged.
+    /// @param  file        [in] The file name as an Uri.
+    /// @param  offset      [in] The offset of the first byte.
+    /// @param  size        [in] The number of bytes, 0 reads until the end of the file.
+    /// @param  callback    [in] Will be called from update() once the data is available.
+    /// @param  priority    [in] The priority of the request.
+    /// @return true, if the request was enqueued.
+    bool readAsync(const Uri &file, ui64 offset, ui64 size, const AsyncReadCallback &callback, 
+        IOPriority priority = IOPriority::Normal);
+
+    /// @brief  Returns the asynchronous reader.
+    /// @return The reader.
+    AsyncReader &getAsyncReader();
+
     /// @brief  Will close a opened stream.
     /// @param  stream      [in] The pointer to the stream pointer, will be nullptr afterwards.
     void closeStream(Stream **stream);
@@ -96,6 +111,7 @@ protected:
 private:
     using MountedMap = std::map<String, AbstractFileSystem*> ;
     MountedMap mMountedMap;
+    AsyncReader mAsyncReader;
 };
 
 } // Namespace OSRE::IO
@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "LocaleFileSystem.h"
 #include "FileStream.h"
+#include "MappedFileStream.h"
 #include "IO/File.h"
 #include "Common/Logger.h"
 #include <cassert>
@@ -60,7 +61,11 @@ Stream *LocaleFileSystem::open( const Uri &file, Stream::AccessMode mode ) {
     Stream *pFileStream( nullptr );
     String::size_type pos = file.getResource().rfind( "xml" );
     if ( String::npos == pos ) {
-        pFileStream = new FileStream( file, mode );
+        if ( Stream::AccessMode::MappedReadAccess == mode ) {
+            pFileStream = new MappedFileStream( file, mode );
+        } else {
+            pFileStream = new FileStream( file, mode );
+        }
     }
 
     if ( nullptr == pFileStream ) {
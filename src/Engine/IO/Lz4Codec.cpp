@@ -0,0 +1,207 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/Lz4Codec.h"
+
+#include <cstring>
+#include <vector>
+
+namespace OSRE::IO {
+
+static constexpr size_t MinMatch = 4;
+static constexpr size_t LastLiterals = 5;
+static constexpr size_t MatchFindLimit = 12;
+static constexpr size_t MaxOffset = 65535;
+static constexpr ui32 HashLog = 16;
+
+static ui32 read32(const uc8 *ptr) {
+    ui32 value;
+    ::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+static ui32 hashSequence(ui32 sequence) {
+    return (sequence * 2654435761u) >> (32 - HashLog);
+}
+
+static uc8 *writeLength(uc8 *op, size_t length) {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uc8>(length);
+
+    return op;
+}
+
+static size_t encodedLengthSize(size_t length) {
+    return length >= 15 ? 1 + (length - 15) / 255 : 0;
+}
+
+size_t Lz4Codec::compressBound(size_t srcSize) {
+    return srcSize + srcSize / 255 + 16;
+}
+
+size_t Lz4Codec::compress(const uc8 *src, size_t srcSize, uc8 *dst, size_t dstCapacity) {
+    if ((src == nullptr && srcSize != 0) || dst == nullptr) {
+        return 0;
+    }
+
+    uc8 *op = dst;
+    uc8 *const opEnd = dst + dstCapacity;
+    size_t anchor = 0;
+    if (srcSize > MatchFindLimit) {
+        std::vector<ui32> table(static_cast<size_t>(1) << HashLog, 0);
+        const size_t limit = srcSize - MatchFindLimit;
+        const size_t matchLimit = srcSize - LastLiterals;
+        size_t ip = 0;
+        while (ip < limit) {
+            const ui32 sequence = read32(src + ip);
+            const ui32 hash = hashSequence(sequence);
+            const size_t ref = table[hash];
+            table[hash] = static_cast<ui32>(ip);
+            if (ref >= ip || ip - ref > MaxOffset || read32(src + ref) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            size_t matchLength = MinMatch;
+            while (ip + matchLength < matchLimit && src[ref + matchLength] == src[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            const size_t literalLength = ip - anchor;
+            const size_t required = 1 + encodedLengthSize(literalLength) + literalLength + 2 +
+                encodedLengthSize(matchLength - MinMatch);
+            if (static_cast<size_t>(opEnd - op) < required) {
+                return 0;
+            }
+
+            uc8 *token = op++;
+            *token = static_cast<uc8>((literalLength < 15 ? literalLength : 15) << 4);
+            if (literalLength >= 15) {
+                op = writeLength(op, literalLength - 15);
+            }
+            ::memcpy(op, src + anchor, literalLength);
+            op += literalLength;
+
+            const size_t offset = ip - ref;
+            *op++ = static_cast<uc8>(offset & 0xFF);
+            *op++ = static_cast<uc8>(offset >> 8);
+
+            const size_t matchCode = matchLength - MinMatch;
+            *token |= static_cast<uc8>(matchCode < 15 ? matchCode : 15);
+            if (matchCode >= 15) {
+                op = writeLength(op, matchCode - 15);
+            }
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    // The last sequence consists of literals only
+    const size_t literalLength = srcSize - anchor;
+    if (static_cast<size_t>(opEnd - op) < 1 + encodedLengthSize(literalLength) + literalLength) {
+        return 0;
+    }
+    *op++ = static_cast<uc8>((literalLength < 15 ? literalLength : 15) << 4);
+    if (literalLength >= 15) {
+        op = writeLength(op, literalLength - 15);
+    }
+    if (literalLength > 0) {
+        ::memcpy(op, src + anchor, literalLength);
+        op += literalLength;
+    }
+
+    return static_cast<size_t>(op - dst);
+}
+
+static bool readLength(const uc8 *&ip, const uc8 *ipEnd, size_t &length) {
+    uc8 value = 255;
+    while (value == 255) {
+        if (ip >= ipEnd) {
+            return false;
+        }
+        value = *ip++;
+        length += value;
+    }
+
+    return true;
+}
+
+bool Lz4Codec::decompress(const uc8 *src, size_t srcSize, uc8 *dst, size_t dstSize) {
+    if (src == nullptr || (dst == nullptr && dstSize != 0)) {
+        return false;
+    }
+
+    const uc8 *ip = src;
+    const uc8 *const ipEnd = src + srcSize;
+    size_t op = 0;
+    while (ip < ipEnd) {
+        const uc8 token = *ip++;
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, ipEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > dstSize - op) {
+            return false;
+        }
+        if (literalLength > 0) {
+            ::memcpy(dst + op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+        }
+        if (ip == ipEnd) {
+            break;
+        }
+
+        if (ipEnd - ip < 2) {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(ip, ipEnd, matchLength)) {
+            return false;
+        }
+        matchLength += MinMatch;
+        if (matchLength > dstSize - op) {
+            return false;
+        }
+
+        // The ranges may overlap, so copy byte-wise to repeat short patterns
+        const uc8 *match = dst + op - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            dst[op + i] = match[i];
+        }
+        op += matchLength;
+    }
+
+    return op == dstSize;
+}
+
+} // Namespace OSRE::IO
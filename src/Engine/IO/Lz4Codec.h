@@ -0,0 +1,64 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+
+namespace OSRE::IO {
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements a compressor and a decompressor for the LZ4 block format.
+///
+/// The compressor is a greedy single-pass implementation, it is fast but does not reach the 
+/// ratio of the high-compression modes. The produced blocks can be decoded with any LZ4 decoder.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT Lz4Codec {
+public:
+    /// @brief  Returns the worst case size of a compressed block.
+    /// @param[in] srcSize  The size of the uncompressed data.
+    /// @return The maximal compressed size.
+    static size_t compressBound(size_t srcSize);
+
+    /// @brief  Will compress a block.
+    /// @param[in]  src         The data to compress.
+    /// @param[in]  srcSize     The size of the data.
+    /// @param[out] dst         The output buffer.
+    /// @param[in]  dstCapacity The size of the output buffer, compressBound() is always enough.
+    /// @return The size of the compressed block, 0 if the output buffer was too small.
+    static size_t compress(const uc8 *src, size_t srcSize, uc8 *dst, size_t dstCapacity);
+
+    /// @brief  Will decompress a block.
+    /// @param[in]  src         The compressed block.
+    /// @param[in]  srcSize     The size of the compressed block.
+    /// @param[out] dst         The output buffer.
+    /// @param[in]  dstSize     The exact size of the uncompressed data.
+    /// @return true if successful, false if the block is broken.
+    static bool decompress(const uc8 *src, size_t srcSize, uc8 *dst, size_t dstSize);
+
+private:
+    Lz4Codec() = delete;
+};
+
+} // Namespace OSRE::IO
@@ -0,0 +1,260 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/MappedFileStream.h"
+#include "Common/Logger.h"
+
+#include <cstring>
+#include <limits>
+
+#ifdef OSRE_WINDOWS
+#   include "Platform/Windows/MinWindows.h"
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace OSRE::IO {
+
+DECL_OSRE_LOG_MODULE(MappedFileStream)
+
+MappedFileStream::MappedFileStream(const Uri &uri, AccessMode requestedAccess) : Stream(uri, requestedAccess) {
+    // empty
+}
+
+MappedFileStream::~MappedFileStream() {
+    if (isOpen()) {
+        MappedFileStream::close();
+    }
+}
+
+bool MappedFileStream::canRead() const {
+    return true;
+}
+
+bool MappedFileStream::canWrite() const {
+    return false;
+}
+
+bool MappedFileStream::canSeek() const {
+    return true;
+}
+
+bool MappedFileStream::canBeMapped() const {
+    return true;
+}
+
+bool MappedFileStream::open() {
+    if (isOpen()) {
+        return false;
+    }
+
+    const String &abspath = mUri.getAbsPath();
+    if (abspath.empty()) {
+        return false;
+    }
+
+#ifdef OSRE_WINDOWS
+    HANDLE file = ::CreateFileA(abspath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    mFile = file;
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+        close();
+        return false;
+    }
+    mSize = static_cast<ui64>(size.QuadPart);
+#else
+    mFd = ::open(abspath.c_str(), O_RDONLY);
+    if (mFd == -1) {
+        return false;
+    }
+    struct stat fileStat;
+    if (::fstat(mFd, &fileStat) != 0) {
+        close();
+        return false;
+    }
+    mSize = static_cast<ui64>(fileStat.st_size);
+#endif
+    mPos = 0;
+
+    // Empty files cannot be mapped, the stream is open but all reads will return nothing
+    if (mSize == 0) {
+        return true;
+    }
+
+    if (mSize > static_cast<ui64>(std::numeric_limits<size_t>::max())) {
+        osre_error(Tag, "File " + abspath + " is too large to be mapped on this platform.");
+        close();
+        return false;
+    }
+
+#ifdef OSRE_WINDOWS
+    mMapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping != nullptr) {
+        mData = static_cast<const uc8 *>(::MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    void *ptr = ::mmap(nullptr, static_cast<size_t>(mSize), PROT_READ, MAP_PRIVATE, mFd, 0);
+    if (ptr != MAP_FAILED) {
+        mData = static_cast<const uc8 *>(ptr);
+    }
+#endif
+    if (mData == nullptr) {
+        osre_error(Tag, "Cannot map file " + abspath + ".");
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+bool MappedFileStream::close() {
+    if (!isOpen()) {
+        return false;
+    }
+
+#ifdef OSRE_WINDOWS
+    if (mData != nullptr) {
+        ::UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr) {
+        ::CloseHandle(mMapping);
+    }
+    ::CloseHandle(mFile);
+    mMapping = nullptr;
+    mFile = nullptr;
+#else
+    if (mData != nullptr) {
+        ::munmap(const_cast<uc8 *>(mData), static_cast<size_t>(mSize));
+    }
+    ::close(mFd);
+    mFd = -1;
+#endif
+    mData = nullptr;
+    mSize = 0;
+    mPos = 0;
+
+    return true;
+}
+
+ui64 MappedFileStream::getSize() const {
+    return mSize;
+}
+
+size_t MappedFileStream::read(void *buffer, size_t size) {
+    if (buffer == nullptr || size == 0 || mData == nullptr || mPos >= mSize) {
+        return 0;
+    }
+
+    const ui64 available = mSize - mPos;
+    const size_t numBytes = available < size ? static_cast<size_t>(available) : size;
+    ::memcpy(buffer, mData + mPos, numBytes);
+    mPos += numBytes;
+
+    return numBytes;
+}
+
+template<class T>
+size_t MappedFileStream::readValue(T &value) {
+    if (mData == nullptr || mPos > mSize || mSize - mPos < sizeof(T)) {
+        return 0;
+    }
+
+    ::memcpy(&value, mData + mPos, sizeof(T));
+    mPos += sizeof(T);
+
+    return 1;
+}
+
+size_t MappedFileStream::readI32(i32 &value) {
+    return readValue(value);
+}
+
+size_t MappedFileStream::readUI32(ui32 &value) {
+    return readValue(value);
+}
+
+size_t MappedFileStream::readF32(f32 &value) {
+    return readValue(value);
+}
+
+size_t MappedFileStream::readD32(d32 &value) {
+    return readValue(value);
+}
+
+MappedFileStream::Position MappedFileStream::seek(Offset offset, Origin origin) {
+    if (!isOpen()) {
+        return 0;
+    }
+
+    i64 base = 0;
+    if (origin == Origin::Current) {
+        base = static_cast<i64>(mPos);
+    } else if (origin == Origin::End) {
+        base = static_cast<i64>(mSize);
+    }
+
+    const i64 pos = base + offset;
+    if (pos < 0) {
+        mPos = 0;
+    } else if (static_cast<ui64>(pos) > mSize) {
+        mPos = mSize;
+    } else {
+        mPos = static_cast<Position>(pos);
+    }
+
+    return mPos;
+}
+
+MappedFileStream::Position MappedFileStream::tell() {
+    return mPos;
+}
+
+const uc8 *MappedFileStream::map(Position offset, ui64 size) {
+    if (mData == nullptr || offset > mSize || size > mSize - offset) {
+        return nullptr;
+    }
+
+#ifndef OSRE_WINDOWS
+    // Let the kernel start to read ahead the pages of the view
+    static const size_t PageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t pageStart = static_cast<size_t>(offset) & ~(PageSize - 1);
+    ::madvise(const_cast<uc8 *>(mData) + pageStart, static_cast<size_t>(offset + size) - pageStart, MADV_WILLNEED);
+#endif
+
+    return mData + offset;
+}
+
+bool MappedFileStream::isOpen() const {
+#ifdef OSRE_WINDOWS
+    return mFile != nullptr;
+#else
+    return mFd != -1;
+#endif
+}
+
+} // Namespace OSRE::IO
@@ -0,0 +1,101 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "IO/Stream.h"
+
+namespace OSRE::IO {
+
+//--------------------------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements a read-only file stream, which maps the whole file into the address space.
+///
+/// Reading from the stream is a plain memcpy from the mapping, the system loads the pages on demand. Use map() 
+/// to get a zero-copy view onto a range of the file. Views stay valid until the stream gets closed. Positions 
+/// and sizes are 64 bit, so files larger than 4 GB are supported on 64 bit platforms.
+//--------------------------------------------------------------------------------------------------------------------
+class OSRE_EXPORT MappedFileStream final : public Stream {
+public:
+    /// The default class constructor.
+    MappedFileStream() = default;
+    /// The class constructor with URI and access mode.
+    MappedFileStream(const Uri &uri, AccessMode requestedAccess);
+    /// The class destructor.
+    ~MappedFileStream() override;
+    /// true, the mapping is readable.
+    bool canRead() const override;
+    /// Always false, the mapping is read-only.
+    bool canWrite() const override;
+    /// true, the position can be moved.
+    bool canSeek() const override;
+    /// true, views can be mapped.
+    bool canBeMapped() const override;
+    /// Opens the file and maps it.
+    bool open() override;
+    /// Unmaps and closes the file.
+    bool close() override;
+    /// Returns file size.
+    ui64 getSize() const override;
+    /// Copies from the mapping.
+    size_t read(void *buffer, size_t size) override;
+    /// Reads a single integer value.
+    size_t readI32(i32 &value) override;
+    /// Reads a single unsigned integer value.
+    size_t readUI32(ui32 &value) override;
+    /// Reads a single float value.
+    size_t readF32(f32 &value) override;
+    /// Reads a single double value.
+    size_t readD32(d32 &value) override;
+    /// Moves to given position, will be clamped to the file size.
+    Position seek(Offset offset, Origin origin) override;
+    /// Position in the file.
+    Position tell() override;
+    /// Returns a view onto the mapped file.
+    const uc8 *map(Position offset, ui64 size) override;
+    /// Returns true, when the file is open.
+    bool isOpen() const override;
+    /// Returns the start of the mapping, nullptr for empty or closed files.
+    const uc8 *getData() const;
+
+private:
+    template<class T>
+    size_t readValue(T &value);
+
+private:
+#ifdef OSRE_WINDOWS
+    void *mFile = nullptr;
+    void *mMapping = nullptr;
+#else
+    int mFd = -1;
+#endif
+    const uc8 *mData = nullptr;
+    ui64 mSize = 0;
+    Position mPos = 0;
+};
+
+inline const uc8 *MappedFileStream::getData() const {
+    return mData;
+}
+
+} // Namespace OSRE::IO
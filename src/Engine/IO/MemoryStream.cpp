@@ -0,0 +1,146 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "IO/MemoryStream.h"
+
+#include <cstring>
+
+namespace OSRE::IO {
+
+MemoryStream::MemoryStream(const Uri &uri, const uc8 *data, size_t size, bool takeOwnership) :
+        Stream(uri, AccessMode::ReadAccessBinary), 
+        mData(data), 
+        mSize(data != nullptr ? size : 0), 
+        mOwning(takeOwnership), 
+        mOpen(false), 
+        mPos(0) {
+    // empty
+}
+
+MemoryStream::~MemoryStream() {
+    if (mOwning) {
+        delete[] mData;
+    }
+}
+
+bool MemoryStream::canRead() const {
+    return true;
+}
+
+bool MemoryStream::canSeek() const {
+    return true;
+}
+
+bool MemoryStream::canBeMapped() const {
+    return true;
+}
+
+bool MemoryStream::open() {
+    if (mOpen) {
+        return false;
+    }
+
+    mOpen = true;
+    mPos = 0;
+
+    return true;
+}
+
+bool MemoryStream::close() {
+    if (!mOpen) {
+        return false;
+    }
+    mOpen = false;
+
+    return true;
+}
+
+ui64 MemoryStream::getSize() const {
+    return mSize;
+}
+
+size_t MemoryStream::read(void *buffer, size_t size) {
+    if (!mOpen || buffer == nullptr || size == 0 || mPos >= mSize) {
+        return 0;
+    }
+
+    const size_t available = mSize - static_cast<size_t>(mPos);
+    const size_t numBytes = available < size ? available : size;
+    ::memcpy(buffer, mData + mPos, numBytes);
+    mPos += numBytes;
+
+    return numBytes;
+}
+
+size_t MemoryStream::readI32(i32 &value) {
+    return read(&value, sizeof(value)) == sizeof(value) ? 1 : 0;
+}
+
+size_t MemoryStream::readUI32(ui32 &value) {
+    return read(&value, sizeof(value)) == sizeof(value) ? 1 : 0;
+}
+
+size_t MemoryStream::readF32(f32 &value) {
+    return read(&value, sizeof(value)) == sizeof(value) ? 1 : 0;
+}
+
+size_t MemoryStream::readD32(d32 &value) {
+    return read(&value, sizeof(value)) == sizeof(value) ? 1 : 0;
+}
+
+MemoryStream::Position MemoryStream::seek(Offset offset, Origin origin) {
+    i64 base = 0;
+    if (origin == Origin::Current) {
+        base = static_cast<i64>(mPos);
+    } else if (origin == Origin::End) {
+        base = static_cast<i64>(mSize);
+    }
+
+    const i64 pos = base + offset;
+    if (pos < 0) {
+        mPos = 0;
+    } else if (static_cast<ui64>(pos) > mSize) {
+        mPos = mSize;
+    } else {
+        mPos = static_cast<Position>(pos);
+    }
+
+    return mPos;
+}
+
+MemoryStream::Position MemoryStream::tell() {
+    return mPos;
+}
+
+const uc8 *MemoryStream::map(Position offset, ui64 size) {
+    if (mData == nullptr || offset > mSize || size > mSize - offset) {
+        return nullptr;
+    }
+
+    return mData + offset;
+}
+
+bool MemoryStream::isOpen() const {
+    return mOpen;
+}
+
+} // Namespace OSRE::IO
@@ -0,0 +1,84 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "IO/Stream.h"
+
+namespace OSRE::IO {
+
+//--------------------------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class implements a read-only stream over a block of memory.
+///
+/// The stream either references memory owned by someone else, like a view into a mapped archive, or takes over a 
+/// buffer allocated with new[].
+//--------------------------------------------------------------------------------------------------------------------
+class OSRE_EXPORT MemoryStream final : public Stream {
+public:
+    /// The class constructor with the URI and the memory block.
+    MemoryStream(const Uri &uri, const uc8 *data, size_t size, bool takeOwnership);
+    /// The class destructor, will release the memory when owned.
+    ~MemoryStream() override;
+    /// true.
+    bool canRead() const override;
+    /// true.
+    bool canSeek() const override;
+    /// true, the memory can be accessed directly.
+    bool canBeMapped() const override;
+    /// Opens the stream.
+    bool open() override;
+    /// Closes the stream.
+    bool close() override;
+    /// Returns the size of the memory block.
+    ui64 getSize() const override;
+    /// Copies from the memory block.
+    size_t read(void *buffer, size_t size) override;
+    /// Reads a single integer value.
+    size_t readI32(i32 &value) override;
+    /// Reads a single unsigned integer value.
+    size_t readUI32(ui32 &value) override;
+    /// Reads a single float value.
+    size_t readF32(f32 &value) override;
+    /// Reads a single double value.
+    size_t readD32(d32 &value) override;
+    /// Moves to given position, will be clamped to the block size.
+    Position seek(Offset offset, Origin origin) override;
+    /// The current position.
+    Position tell() override;
+    /// Returns a view onto the memory block.
+    const uc8 *map(Position offset, ui64 size) override;
+    /// Returns true, when the stream is open.
+    bool isOpen() const override;
+
+    OSRE_NON_COPYABLE(MemoryStream)
+
+private:
+    const uc8 *mData;
+    size_t mSize;
+    bool mOwning;
+    bool mOpen;
+    Position mPos;
+};
+
+} // Namespace OSRE::IO
@@ -66,7 +66,7 @@ Stream::AccessMode Stream::getAccessMode() const {
     return mAccessMode;
 }
 
-size_t Stream::getSize() const {
+ui64 Stream::getSize() const {
     return 0;
 }
 
@@ -118,6 +118,10 @@ Stream::Position Stream::tell() {
     return 0;
 }
 
+const uc8 *Stream::map(Position, ui64) {
+    return nullptr;
+}
+
 bool Stream::isOpen() const {
     return false;
 }
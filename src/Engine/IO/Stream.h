@@ -37,8 +37,8 @@ namespace OSRE::IO {
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT Stream {
 public:
-    typedef ui32 Position;      ///< The current position.
-    typedef ui32 Offset;        ///< The offset from the current position.
+    typedef ui64 Position;      ///< The current position, 64 bit to support files larger than 4 GB.
+    typedef i64 Offset;         ///< The offset from the seek origin, can be negative.
     
     /// @brief  Enumerates the type of access.
     enum class AccessMode	{
@@ -47,7 +47,8 @@ public:
         ReadAccessBinary,       ///< Read-access in binary mode.
         WriteAccessBinary,      ///< Write-access in binary mode.
         ReadWriteAccess,        ///< Read/Write-access.
-        AppendAccess            ///< Append-access, stuff will be attached and the file end.
+        AppendAccess,           ///< Append-access, stuff will be attached and the file end.
+        MappedReadAccess        ///< Read-only access via a memory-mapping of the whole file.
     };
 
     /// @brief  Enumerates the requested file position
@@ -111,7 +112,7 @@ public:
     
     /// @brief  Returns the file size.
     /// @return The file size.
-    virtual size_t getSize() const;
+    virtual ui64 getSize() const;
     
     /// @brief  Reads a given number of bytes from the stream.
     /// @param  buffer          [in] The buffer to read in.
@@ -174,6 +175,13 @@ public:
     /// @brief  Returns the current position.
     /// @return The current position.
     virtual Position tell();
+
+    /// @brief  Returns a read-only view onto the stream content without copying it.
+    /// @param  offset          [in] The start of the view.
+    /// @param  size            [in] The size of the view in bytes.
+    /// @return Pointer to the first byte of the view, nullptr if the stream cannot be mapped or 
+    ///         the range is out of bounds. The view is valid until the stream gets closed.
+    virtual const uc8 *map(Position offset, ui64 size);
     
     ///	@brief	Returns true, if the stream is open.
     ///	@return true, if file is open.
@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace OSRE::IO {
 
 static constexpr c8 FileSchemeAsStr[] = "file://";
+static constexpr c8 ArchiveSchemeAsStr[] = "archive://";
 
 static bool isWindowsRootFolder(const String &filename) {
     if (filename.empty()) {
@@ -77,6 +78,8 @@ String Uri::schemeEnumToStr(SchemeType type) {
     switch (type) {
         case FileScheme:
             return FileSchemeAsStr;
+        case ArchiveScheme:
+            return ArchiveSchemeAsStr;
         default:
             break;
     }
@@ -153,6 +156,10 @@ Uri::SchemeType schemeStrToEnum(const String &schemeStr) {
         return Uri::FileScheme;
     }
 
+    if (schemeStr == ArchiveSchemeAsStr) {
+        return Uri::ArchiveScheme;
+    }
+
     return Uri::Invalid;
 }
  
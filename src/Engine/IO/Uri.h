@@ -45,6 +45,7 @@ public:
     enum SchemeType {
         Invalid = -1,   ///< Invalid scheme
         FileScheme,     ///< File scheme
+        ArchiveScheme,  ///< Entry in a mounted asset archive
         Count           ///< Number of supported schemes
     };
 
@@ -22,15 +22,69 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 
 #include "Platform/AbstractPlatformEventQueue.h"
+#include "Platform/PlatformInterface.h"
 #include "Common/EventBus.h"
+#include "Common/TFreeListPool.h"
 
 namespace OSRE::Platform {
 
 using namespace OSRE::Common;
 
+template <class T>
+static TFreeListPool<T> &getEventDataPool() {
+    // Never destroyed, event data may still be released during the static destruction
+    static auto *pool = new TFreeListPool<T>;
+    return *pool;
+}
+
+template <class T>
+static void *allocEventData(size_t size) {
+    // Derived types have another size and are not pooled
+    if (size != sizeof(T)) {
+        return ::operator new(size);
+    }
+
+    return getEventDataPool<T>().alloc();
+}
+
+template <class T>
+static void releaseEventData(void *ptr, size_t size) {
+    if (size != sizeof(T)) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    getEventDataPool<T>().release(ptr);
+}
+
+void *KeyboardButtonEventData::operator new(size_t size) {
+    return allocEventData<KeyboardButtonEventData>(size);
+}
+
+void KeyboardButtonEventData::operator delete(void *ptr, size_t size) {
+    releaseEventData<KeyboardButtonEventData>(ptr, size);
+}
+
+void *MouseButtonEventData::operator new(size_t size) {
+    return allocEventData<MouseButtonEventData>(size);
+}
+
+void MouseButtonEventData::operator delete(void *ptr, size_t size) {
+    releaseEventData<MouseButtonEventData>(ptr, size);
+}
+
+void *MouseMoveEventData::operator new(size_t size) {
+    return allocEventData<MouseMoveEventData>(size);
+}
+
+void MouseMoveEventData::operator delete(void *ptr, size_t size) {
+    releaseEventData<MouseMoveEventData>(ptr, size);
+}
+
 AbstractPlatformEventQueue::AbstractPlatformEventQueue() :
     Object("Platform/AbstractPlatformEventQueue"),
     mActiveList(0),
+    mInputPumpMode(InputPumpMode::FramePaced),
     mRenderBackendSrv(nullptr),
     mEventBus(nullptr) {
     mEventBus = new Common::EventBus;
@@ -80,6 +134,15 @@ void AbstractPlatformEventQueue::switchEventDataList() {
     mActiveList = (mActiveList + 1) % numEventQueues;
 }
 
+void AbstractPlatformEventQueue::setInputPumpMode(InputPumpMode mode) {
+    if (mode >= InputPumpMode::Count) {
+        osre_assert(false);
+        return;
+    }
+
+    mInputPumpMode = mode;
+}
+
 void AbstractPlatformEventQueue::setRenderBackendService(RenderBackend::RenderBackendService *rbSrv) {
     mRenderBackendSrv = rbSrv;
 }
@@ -88,6 +151,21 @@ RenderBackend::RenderBackendService *AbstractPlatformEventQueue::getRenderBacken
     return mRenderBackendSrv;
 }
 
+MouseMoveEventData *AbstractPlatformEventQueue::getMouseMoveEventData(EventTriggerer *triggerer) {
+    EventDataList *activeList = getActiveEventDataList();
+    if (!activeList->isEmpty()) {
+        EventData *last = activeList->back();
+        if (nullptr != last && last->getEvent() == MouseMoveEvent) {
+            return static_cast<MouseMoveEventData*>(last);
+        }
+    }
+
+    MouseMoveEventData *data = new MouseMoveEventData(triggerer);
+    activeList->addBack(data);
+
+    return data;
+}
+
 void AbstractPlatformEventQueue::enqueueEvent(const Common::Event &ev, Common::EventData *data) {
     osre_assert(nullptr != data);
 
@@ -42,9 +42,18 @@ namespace RenderBackend {
 
 namespace Platform {
 
+class MouseMoveEventData;
+
 /// @brief
 using MenuFunctor = Common::Functor<void, ui32, void *>;
 
+/// @brief  Describes how pending input events are pumped in polling mode.
+enum class InputPumpMode : i32 {
+    SingleEvent = 0,    ///< One pending event is handled per update.
+    FramePaced,         ///< All pending events are drained in one batch per update.
+    Count               ///< The number of pump modes.
+};
+
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
@@ -84,6 +93,14 @@ public:
     /// @return The active polling state.
     virtual bool isPolling() const = 0;
 
+    /// @brief  Will set the pump mode used in polling mode.
+    /// @param  mode        [in] The new pump mode.
+    virtual void setInputPumpMode(InputPumpMode mode);
+
+    /// @brief  Returns the pump mode used in polling mode.
+    /// @return The active pump mode.
+    InputPumpMode getInputPumpMode() const;
+
     /// @brief  Will perform an update.
     /// @return Returns false in case of an error.
     virtual bool update() = 0;
@@ -126,14 +143,25 @@ protected:
     ///	@brief  Toggles between the active and pending list.
     void switchEventDataList();
 
+    /// @brief  Returns the mouse-move data to store a new mouse position in. Consecutive mouse 
+    ///         moves in the active list are coalesced into one event.
+    /// @param[in] triggerer  The event trigger.
+    /// @return The mouse-move data, owned by the active list.
+    MouseMoveEventData *getMouseMoveEventData(Common::EventTriggerer *triggerer);
+
 private:
     static const size_t numEventQueues = 2;
     Common::EventDataList m_eventQueues[numEventQueues];
     ui32 mActiveList;
+    InputPumpMode mInputPumpMode;
     RenderBackend::RenderBackendService *mRenderBackendSrv;
     Common::EventBus *mEventBus;
 };
 
+inline InputPumpMode AbstractPlatformEventQueue::getInputPumpMode() const {
+    return mInputPumpMode;
+}
+
 inline Common::EventBus *AbstractPlatformEventQueue::getEventBus() const {
     return mEventBus;
 }
@@ -266,6 +266,12 @@ bool PlatformInterface::setupGfx(WindowsProperties *props, bool polls) {
         return false;
     }
     mContext->m_oseventHandler->enablePolling(polls);
+    const i32 pumpMode = mContext->mSettings->getInt(Settings::InputPumpMode);
+    if (pumpMode >= 0 && pumpMode < static_cast<i32>(InputPumpMode::Count)) {
+        mContext->m_oseventHandler->setInputPumpMode(static_cast<InputPumpMode>(pumpMode));
+    } else {
+        osre_warn(Tag, "Invalid input pump mode, using the frame-paced pump.");
+    }
     mContext->mTimer = PlatformPluginFactory::createTimer();
 
     // setup the render context
@@ -108,6 +108,10 @@ public:
     ///	@param	c		[in] The event trigger sender.
     KeyboardButtonEventData(bool down, Common::EventTriggerer *c) :  Common::EventData(down ? KeyboardButtonDownEvent : KeyboardButtonUpEvent, c), m_key(KEY_UNKNOWN), m_unicode(0) {}
 
+    /// @brief  The instances are allocated from a free-list pool.
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     Key m_key; ///< Key code for the pressed/released keyboard button
     ui16 m_unicode; ///< The Unicode character for the pressed/released key
 };
@@ -139,6 +143,10 @@ public:
         // empty
     }
 
+    /// @brief  The instances are allocated from a free-list pool.
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     ui32 m_Button; ///< pressed button (0=left, 1=middle, 2=right )
     i32 m_AbsX; ///< absolute X-position of the mouse cursor
     i32 m_AbsY; ///< absolute Y-position of the mouse cursor
@@ -159,6 +167,10 @@ public:
         // empty
     }
 
+    /// @brief  The instances are allocated from a free-list pool.
+    static void *operator new(size_t size);
+    static void operator delete(void *ptr, size_t size);
+
     i32 m_absX; ///< The absolute X-position of the mouse cursor
     i32 m_absY; ///< The absolute Y-position of the mouse cursor
 };
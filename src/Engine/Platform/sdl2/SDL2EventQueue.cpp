@@ -41,6 +41,9 @@ using namespace ::cppcore;
 
 static constexpr c8 Tag[] = "SDL2EventHandler";
 
+// The number of events fetched from the SDL queue in one batch.
+static constexpr i32 MaxEventsPerBatch = 64;
+
 //-------------------------------------------------------------------------------------------------
 /// @brief  The abstract interface for sdl2-based event updates.
 //-------------------------------------------------------------------------------------------------
@@ -48,9 +51,11 @@ struct AbstractSDL2InputUpdate {
     /// @brief  The virtual destructor.
     virtual ~AbstractSDL2InputUpdate() = default;
 
-    /// @brief Will perform the update.
-    /// @param[out] ev   The next event or a nullptr, if none.
-    virtual bool update(SDL_Event *ev) = 0;
+    /// @brief Will fetch the next pending events.
+    /// @param[out] events      The array to store the events in.
+    /// @param[in]  maxEvents   The capacity of the array.
+    /// @return The number of fetched events, 0 if none.
+    virtual i32 update(SDL_Event *events, i32 maxEvents) = 0;
 };
 
 //-------------------------------------------------------------------------------------------------
@@ -64,13 +69,14 @@ struct SDL2GetInputUpdate final : public AbstractSDL2InputUpdate {
     ~SDL2GetInputUpdate() override = default;
 
     //  Update implemented as a wait operation, will get the next upcoming event.
-    bool update(SDL_Event *ev) override {
-        const i32 ret = SDL_WaitEvent(ev);
+    i32 update(SDL_Event *events, i32) override {
+        const i32 ret = ::SDL_WaitEvent(events);
         if (0 == ret) {
-            return false;
+            osre_error(Tag, "Error while waiting for events: " + String(::SDL_GetError()));
+            return 0;
         }
 
-        return false;
+        return 1;
     }
 };
 
@@ -85,16 +91,56 @@ struct SDL2PeekInputUpdate final : public AbstractSDL2InputUpdate {
     ~SDL2PeekInputUpdate() override = default;
 
     //  Update implemented as a poll operation, will check for a new event.
-    bool update(SDL_Event *ev) override {
-        const i32 ret = ::SDL_PollEvent(ev);
+    i32 update(SDL_Event *events, i32) override {
+        const i32 ret = ::SDL_PollEvent(events);
         if (ret == 0) {
-            return false;
+            return 0;
         }
 
-        return true;
+        return 1;
+    }
+};
+
+//-------------------------------------------------------------------------------------------------
+//  Implements a frame-paced update, drains the pending events in batches.
+//-------------------------------------------------------------------------------------------------
+struct SDL2FramePacedInputUpdate final : public AbstractSDL2InputUpdate {
+    //  The default constructor.
+    SDL2FramePacedInputUpdate() = default;
+
+    //  The destructor.
+    ~SDL2FramePacedInputUpdate() override = default;
+
+    //  Update implemented as a peep operation, will copy all pending events up to the capacity.
+    i32 update(SDL_Event *events, i32 maxEvents) override {
+        ::SDL_PumpEvents();
+        const i32 ret = ::SDL_PeepEvents(events, maxEvents, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+        if (ret < 0) {
+            osre_error(Tag, "Error while fetching events: " + String(::SDL_GetError()));
+            return 0;
+        }
+
+        return ret;
     }
 };
 
+static AbstractSDL2InputUpdate *createInputUpdate(bool polling, InputPumpMode mode) {
+    if (!polling) {
+        return new SDL2GetInputUpdate;
+    }
+
+    if (mode == InputPumpMode::SingleEvent) {
+        return new SDL2PeekInputUpdate;
+    }
+
+    return new SDL2FramePacedInputUpdate;
+}
+
+// SDL stamps its events in milliseconds since the library was initialized.
+static inline d32 getTimestamp(const SDL_Event &ev) {
+    return static_cast<d32>(ev.common.timestamp) / 1000.0;
+}
+
 std::map<SDL_Window *, SDL2EventHandler *> SDL2EventHandler::s_windowsServerMap;
 
 SDL2EventHandler::SDL2EventHandler(AbstractWindow *window) :
@@ -108,7 +154,7 @@ SDL2EventHandler::SDL2EventHandler(AbstractWindow *window) :
     mWindow = (SDL2Surface *)window;
     osre_assert(nullptr != mWindow);
 
-    m_inputUpdate = new SDL2GetInputUpdate;
+    m_inputUpdate = createInputUpdate(m_isPolling, getInputPumpMode());
     m_eventTriggerer = new EventTriggerer;
     m_eventTriggerer->addTriggerableEvent(KeyboardButtonDownEvent);
     m_eventTriggerer->addTriggerableEvent(KeyboardButtonUpEvent);
@@ -140,77 +186,91 @@ static inline bool isLowerCaseKey(Uint16 mod) {
 }
 
 bool SDL2EventHandler::update() {
+    if (mShutdownRequested) {
+        return false;
+    }
+
     EventDataList *activeEventQueue(getActiveEventDataList());
     if (nullptr == activeEventQueue) {
         OSRE_CHECK_NOENTRY2("Active event queue is nullptr.");
         return false;
     }
 
-    SDL_Event ev;
-    if (!mShutdownRequested && m_inputUpdate->update(&ev)) {
-        const Uint32 windowID = SDL_GetWindowID(mWindow->getSDLSurface());
-
-        switch (ev.type) {
-            case SDL_KEYDOWN:
-            case SDL_KEYUP: {
-                KeyboardButtonEventData *data = new KeyboardButtonEventData(SDL_KEYDOWN == ev.type, m_eventTriggerer);
-                const char *c = SDL_GetKeyName(ev.key.keysym.sym);
-                if (!isLowerCaseKey(ev.key.keysym.mod)) {
-                    const char l = tolower(*c);
-                    data->m_key = (Key) l;
-                } else {
-                    data->m_key = (Key) *c;
-                }
-                activeEventQueue->addBack(data);
-            } break;
-
-            case SDL_MOUSEMOTION: {
-                MouseMoveEventData *data = new MouseMoveEventData(m_eventTriggerer);
-                int x, y;
-                SDL_GetMouseState(&x, &y);
-                data->m_absX = x;
-                data->m_absY = y;
-                activeEventQueue->addBack(data);
-            } break;
-
-            case SDL_MOUSEBUTTONDOWN:
-            case SDL_MOUSEBUTTONUP: {
-                MouseButtonEventData *data = new MouseButtonEventData(ev.type == SDL_MOUSEBUTTONDOWN, m_eventTriggerer);
-                activeEventQueue->addBack(data);
-            } break;
-
-            case SDL_QUIT: {
-                mShutdownRequested = true;
-            } break;
-
-            case SDL_WINDOWEVENT: {
-                if (ev.window.windowID == windowID) {
-                    switch (ev.window.event) {
-                        case SDL_WINDOWEVENT_EXPOSED: {
-                            const auto &rect = mWindow->getProperties()->mRect;
-                            getRenderBackendService()->resize(mWindow->getId(), rect.getX1(), rect.getY1(), rect.width, rect.height);
-                        } break;
-                        
-                        case SDL_WINDOWEVENT_SHOWN:
-                        case SDL_WINDOWEVENT_SIZE_CHANGED: {
-                            const ui32 w = static_cast<ui32>(ev.window.data1);
-                            const ui32 h = static_cast<ui32>(ev.window.data2);
-                            getRenderBackendService()->resize(mWindow->getId(), 0, 0, w, h);
-                        } break;
-                    }
-                }
-            } break;
-
-            default:
-                break;
+    const Uint32 windowID = SDL_GetWindowID(mWindow->getSDLSurface());
+    SDL_Event events[MaxEventsPerBatch];
+    i32 numEvents(0), numHandled(0);
+    do {
+        numEvents = m_inputUpdate->update(events, MaxEventsPerBatch);
+        for (i32 i = 0; i < numEvents; ++i) {
+            handleEvent(events[i], windowID, activeEventQueue);
         }
+        numHandled += numEvents;
+    } while (numEvents == MaxEventsPerBatch);
 
+    if (numHandled > 0) {
         processEvents(m_eventTriggerer);
     }
 
     return !mShutdownRequested;
 }
 
+void SDL2EventHandler::handleEvent(const SDL_Event &ev, ui32 windowID, EventDataList *activeEventQueue) {
+    switch (ev.type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP: {
+            KeyboardButtonEventData *data = new KeyboardButtonEventData(SDL_KEYDOWN == ev.type, m_eventTriggerer);
+            const char *c = SDL_GetKeyName(ev.key.keysym.sym);
+            if (!isLowerCaseKey(ev.key.keysym.mod)) {
+                const char l = tolower(*c);
+                data->m_key = (Key) l;
+            } else {
+                data->m_key = (Key) *c;
+            }
+            data->setTimestamp(getTimestamp(ev));
+            activeEventQueue->addBack(data);
+        } break;
+
+        case SDL_MOUSEMOTION: {
+            MouseMoveEventData *data = getMouseMoveEventData(m_eventTriggerer);
+            data->m_absX = ev.motion.x;
+            data->m_absY = ev.motion.y;
+            data->setTimestamp(getTimestamp(ev));
+        } break;
+
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP: {
+            MouseButtonEventData *data = new MouseButtonEventData(ev.type == SDL_MOUSEBUTTONDOWN, m_eventTriggerer);
+            data->setTimestamp(getTimestamp(ev));
+            activeEventQueue->addBack(data);
+        } break;
+
+        case SDL_QUIT: {
+            mShutdownRequested = true;
+        } break;
+
+        case SDL_WINDOWEVENT: {
+            if (ev.window.windowID == windowID) {
+                switch (ev.window.event) {
+                    case SDL_WINDOWEVENT_EXPOSED: {
+                        const auto &rect = mWindow->getProperties()->mRect;
+                        getRenderBackendService()->resize(mWindow->getId(), rect.getX1(), rect.getY1(), rect.width, rect.height);
+                    } break;
+                    
+                    case SDL_WINDOWEVENT_SHOWN:
+                    case SDL_WINDOWEVENT_SIZE_CHANGED: {
+                        const ui32 w = static_cast<ui32>(ev.window.data1);
+                        const ui32 h = static_cast<ui32>(ev.window.data2);
+                        getRenderBackendService()->resize(mWindow->getId(), 0, 0, w, h);
+                    } break;
+                }
+            }
+        } break;
+
+        default:
+            break;
+    }
+}
+
 void SDL2EventHandler::registerEventListener(const EventArray &events, OSEventListener *listener) {
     if (nullptr == m_eventTriggerer) {
         osre_error(Tag, "Pointer to event-triggerer is nullptr.");
@@ -260,14 +320,20 @@ void SDL2EventHandler::enablePolling(bool enabled) {
     }
 
     delete m_inputUpdate;
-    if (enabled) {
-        m_inputUpdate = new SDL2PeekInputUpdate;
-    } else {
-        m_inputUpdate = new SDL2GetInputUpdate;
-    }
+    m_inputUpdate = createInputUpdate(enabled, getInputPumpMode());
     m_isPolling = enabled;
 }
 
+void SDL2EventHandler::setInputPumpMode(InputPumpMode mode) {
+    if (mode == getInputPumpMode()) {
+        return;
+    }
+
+    AbstractPlatformEventQueue::setInputPumpMode(mode);
+    delete m_inputUpdate;
+    m_inputUpdate = createInputUpdate(m_isPolling, getInputPumpMode());
+}
+
 bool SDL2EventHandler::isPolling() const {
     return m_isPolling;
 }
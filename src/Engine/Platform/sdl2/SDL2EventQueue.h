@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 // Forward declarations ---------------------------------------------------------------------------
 struct SDL_Window;
+union SDL_Event;
 
 namespace OSRE {
 namespace Platform {
@@ -88,9 +89,16 @@ public:
     /// @return The polling state, true for polling.
     bool isPolling() const override;
 
+    /// @brief Set the pump mode used in polling mode.
+    /// @param mode     The new pump mode.
+    void setInputPumpMode(InputPumpMode mode) override;
+
 protected:
     void onQuit() override {}
 
+private:
+    void handleEvent(const SDL_Event &ev, ui32 windowID, Common::EventDataList *activeEventQueue);
+
 private:
     static std::map<SDL_Window*, SDL2EventHandler*> s_windowsServerMap;
     bool m_isPolling;
@@ -74,14 +74,14 @@ Thread::Thread( const String &name, ui32 stacksize ) :
 
 Thread::~Thread( ) {
     if ( ThreadState::Running == Thread::getCurrentState() ) {
-        osre_debug( Tag, "Thread " + getName() + " is still running." );
+        osre_debugf( Tag, "Thread %s is still running.", getName().c_str() );
         Thread::stop( );
     }
 }
 
 bool Thread::start( void *data ) {
     if ( ThreadState::Running == Thread::getCurrentState() ) {
-        osre_debug( Tag, "Thread " + getName() + " is already running." );
+        osre_debugf( Tag, "Thread %s is already running.", getName().c_str() );
         return false;
     }
     if ( nullptr == data ) {
@@ -103,7 +103,7 @@ bool Thread::start( void *data ) {
 
 bool Thread::stop( ) {
     if ( ThreadState::Running != Thread::getCurrentState()) {
-        osre_debug( Tag, "Thread " + getName() + " is not running." );
+        osre_debugf( Tag, "Thread %s is not running.", getName().c_str() );
         return false;
     }
 
@@ -123,7 +123,7 @@ bool Thread::stop( ) {
 bool Thread::suspend( ) {
     // check for a valid thread state
     if ( ThreadState::Running == Thread::getCurrentState() ) {
-        osre_debug( Tag, "Thread " + getName() + " is not running." );
+        osre_debugf( Tag, "Thread %s is not running.", getName().c_str() );
         return false;
     }
 
@@ -136,7 +136,7 @@ bool Thread::suspend( ) {
 bool Thread::resume( ) {
     // check for a valid thread state
     if ( ThreadState::Waiting != Thread::getCurrentState()) {
-        osre_debug( Tag, "Thread " + getName() + " is not suspended." );
+        osre_debugf( Tag, "Thread %s is not suspended.", getName().c_str() );
         return false;
     }
 
@@ -113,14 +113,14 @@ Thread::Thread(const String &name, ui32 stacksize) :
 
 Thread::~Thread() {
     if (ThreadState::Running == m_threadState) {
-        osre_debug(Tag, "Thread " + getName() + " is still running.");
+        osre_debugf(Tag, "Thread %s is still running.", getName().c_str());
         Thread::stop();
     }
 }
 
 bool Thread::start(void *pData) {
     if (ThreadState::Running == m_threadState || m_ThreadHandle) {
-        osre_debug(Tag, "Thread " + getName() + " is already running.");
+        osre_debugf(Tag, "Thread %s is already running.", getName().c_str());
         return false;
     }
 
@@ -146,7 +146,7 @@ bool Thread::start(void *pData) {
 
 bool Thread::stop() {
     if (ThreadState::Running != m_threadState) {
-        osre_debug(Tag, "Thread " + getName() + " is not running.");
+        osre_debugf(Tag, "Thread %s is not running.", getName().c_str());
         return false;
     }
 
@@ -169,7 +169,7 @@ bool Thread::stop() {
 bool Thread::suspend() {
     // check for a valid thread state
     if (!m_ThreadHandle || ThreadState::Running == m_threadState) {
-        osre_debug(Tag, "Thread " + getName() + " is not running.");
+        osre_debugf(Tag, "Thread %s is not running.", getName().c_str());
         return false;
     }
 
@@ -187,7 +187,7 @@ bool Thread::suspend() {
 bool Thread::resume() {
     // check for a valid thread state
     if (!m_ThreadHandle || ThreadState::Waiting != m_threadState || ThreadState::New != m_threadState) {
-        osre_debug(Tag, "Thread " + getName() + " is not suspended.");
+        osre_debugf(Tag, "Thread %s is not suspended.", getName().c_str());
         return false;
     }
 
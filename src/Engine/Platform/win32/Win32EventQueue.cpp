@@ -181,9 +181,8 @@ bool Win32EventQueue::update() {
             } break;
 
             case WM_MOUSEMOVE: {
-                MouseMoveEventData *data = new MouseMoveEventData(m_eventTriggerer);
+                MouseMoveEventData *data = getMouseMoveEventData(m_eventTriggerer);
                 getXYPosFromLParam(Program.lParam, data->m_absX, data->m_absY);
-                activeEventQueue->addBack(data);
             } break;
 
             case WM_KEYDOWN:
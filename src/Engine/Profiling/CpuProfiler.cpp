@@ -0,0 +1,265 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "Profiling/CpuProfiler.h"
+#include "Common/Logger.h"
+#include "IO/FileStream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OSRE {
+namespace Profiling {
+
+using namespace ::OSRE::IO;
+
+DECL_OSRE_LOG_MODULE(CpuProfiler)
+
+std::atomic<bool> CpuProfiler::sEnabled(false);
+
+namespace {
+
+    static_assert((CpuProfiler::BufferSize & (CpuProfiler::BufferSize - 1)) == 0, "BufferSize must be a power of two.");
+
+    using Clock = std::chrono::steady_clock;
+
+    const Clock::time_point StartTime = Clock::now();
+
+    // The fields are atomics so a concurrent export reads torn slots without a data race, 
+    // the export drops all slots which may have been overwritten while copying.
+    struct ProfileEvent {
+        std::atomic<const c8 *> mName;
+        std::atomic<ui64> mBegin;
+        std::atomic<ui64> mEnd;
+    };
+
+    struct RecordedEvent {
+        const c8 *mName;
+        ui64 mBegin;
+        ui64 mEnd;
+    };
+
+    // mStarted and mHead are written by the owning thread only. mStarted counts the slot writes 
+    // which have begun, mHead the ones which are complete. mClearedHead is guarded by the registry 
+    // mutex, the slots below it were dropped by a clear. The slots are allocated with the first 
+    // recorded scope, so naming a thread while the profiler is disabled costs no ring.
+    struct ThreadBuffer {
+        std::atomic<ui64> mStarted;
+        std::atomic<ui64> mHead;
+        ui64 mClearedHead;
+        ui32 mThreadId;
+        String mThreadName;
+        std::atomic<ProfileEvent *> mEvents;
+
+        explicit ThreadBuffer(ui32 threadId) :
+                mStarted(0), mHead(0), mClearedHead(0), mThreadId(threadId), mThreadName(), mEvents(nullptr) {
+            // empty
+        }
+
+        ~ThreadBuffer() {
+            delete[] mEvents.load(std::memory_order_relaxed);
+        }
+
+        ProfileEvent *getEvents() {
+            ProfileEvent *events = mEvents.load(std::memory_order_relaxed);
+            if (events == nullptr) {
+                events = new ProfileEvent[CpuProfiler::BufferSize];
+                mEvents.store(events, std::memory_order_release);
+            }
+
+            return events;
+        }
+    };
+
+    // The buffers are owned by the registry, so the scopes of finished threads can still be exported.
+    struct BufferRegistry {
+        std::mutex mMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+    };
+
+    BufferRegistry &getRegistry() {
+        static BufferRegistry registry;
+        return registry;
+    }
+
+    thread_local ThreadBuffer *tThreadBuffer = nullptr;
+
+    ThreadBuffer *getThreadBuffer() {
+        if (tThreadBuffer == nullptr) {
+            BufferRegistry &registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mMutex);
+            registry.mBuffers.emplace_back(new ThreadBuffer(static_cast<ui32>(registry.mBuffers.size())));
+            tThreadBuffer = registry.mBuffers.back().get();
+        }
+
+        return tThreadBuffer;
+    }
+
+    void copyEvents(const ThreadBuffer &buffer, std::vector<RecordedEvent> &events) {
+        constexpr ui64 Mask = CpuProfiler::BufferSize - 1;
+        const ui64 head = buffer.mHead.load(std::memory_order_acquire);
+        const ui64 first = std::max(head > CpuProfiler::BufferSize ? head - CpuProfiler::BufferSize : 0, buffer.mClearedHead);
+        events.clear();
+        const ProfileEvent *slots = buffer.mEvents.load(std::memory_order_acquire);
+        if (slots == nullptr) {
+            return;
+        }
+        for (ui64 i = first; i < head; ++i) {
+            const ProfileEvent &event = slots[i & Mask];
+            events.push_back({ event.mName.load(std::memory_order_acquire),
+                    event.mBegin.load(std::memory_order_acquire),
+                    event.mEnd.load(std::memory_order_acquire) });
+        }
+
+        // The slot of index i is reused by index i + BufferSize, so drop everything the writer 
+        // may have started to overwrite in the meantime. Reading a newer slot value makes the 
+        // matching start visible.
+        const ui64 started = buffer.mStarted.load(std::memory_order_relaxed);
+        if (started > first + CpuProfiler::BufferSize) {
+            const size_t numStale = static_cast<size_t>(started - CpuProfiler::BufferSize - first);
+            events.erase(events.begin(), events.begin() + std::min(numStale, events.size()));
+        }
+    }
+
+    void appendEscaped(String &json, const c8 *str) {
+        for (const c8 *c = str; *c != '\0'; ++c) {
+            switch (*c) {
+                case '"': json += "\\\""; break;
+                case '\\': json += "\\\\"; break;
+                case '\n': json += "\\n"; break;
+                case '\t': json += "\\t"; break;
+                default:
+                    if (static_cast<uc8>(*c) < 0x20) {
+                        c8 buffer[8];
+                        ::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<ui32>(static_cast<uc8>(*c)));
+                        json += buffer;
+                    } else {
+                        json += *c;
+                    }
+                    break;
+            }
+        }
+    }
+
+} // Anonymous namespace
+
+void CpuProfiler::setEnabled(bool enabled) {
+    sEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+ui64 CpuProfiler::now() {
+    return static_cast<ui64>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - StartTime).count());
+}
+
+void CpuProfiler::record(const c8 *name, ui64 begin, ui64 end) {
+    if (name == nullptr) {
+        return;
+    }
+
+    ThreadBuffer *buffer = getThreadBuffer();
+    const ui64 head = buffer->mHead.load(std::memory_order_relaxed);
+    buffer->mStarted.store(head + 1, std::memory_order_relaxed);
+    ProfileEvent &event = buffer->getEvents()[head & (BufferSize - 1)];
+    event.mName.store(name, std::memory_order_release);
+    event.mBegin.store(begin, std::memory_order_release);
+    event.mEnd.store(end, std::memory_order_release);
+    buffer->mHead.store(head + 1, std::memory_order_release);
+}
+
+void CpuProfiler::setThreadName(const String &name) {
+    ThreadBuffer *buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(getRegistry().mMutex);
+    buffer->mThreadName = name;
+}
+
+String CpuProfiler::getChromeTrace() {
+    BufferRegistry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mMutex);
+
+    String json = "{\"traceEvents\":[";
+    bool first = true;
+    c8 entry[128];
+    std::vector<RecordedEvent> events;
+    for (const std::unique_ptr<ThreadBuffer> &buffer : registry.mBuffers) {
+        if (!buffer->mThreadName.empty()) {
+            json += first ? "\n" : ",\n";
+            first = false;
+            ::snprintf(entry, sizeof(entry), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"", buffer->mThreadId);
+            json += entry;
+            appendEscaped(json, buffer->mThreadName.c_str());
+            json += "\"}}";
+        }
+
+        copyEvents(*buffer, events);
+        for (const RecordedEvent &event : events) {
+            json += first ? "\n" : ",\n";
+            first = false;
+            json += "{\"name\":\"";
+            appendEscaped(json, event.mName);
+            const ui64 duration = event.mEnd > event.mBegin ? event.mEnd - event.mBegin : 0;
+            ::snprintf(entry, sizeof(entry), "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                    buffer->mThreadId, static_cast<double>(event.mBegin) / 1000.0, static_cast<double>(duration) / 1000.0);
+            json += entry;
+        }
+    }
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return json;
+}
+
+bool CpuProfiler::exportChromeTrace(const String &filename) {
+    if (filename.empty()) {
+        osre_error(Tag, "Cannot export the profile trace, no file name given.");
+        return false;
+    }
+
+    const String json = getChromeTrace();
+    FileStream stream(Uri("file://" + filename), Stream::AccessMode::WriteAccess);
+    if (!stream.open()) {
+        osre_error(Tag, "Cannot open " + filename + " to export the profile trace.");
+        return false;
+    }
+    const bool ok = stream.write(json.c_str(), json.size()) == json.size();
+    stream.close();
+    if (!ok) {
+        osre_error(Tag, "Error while writing the profile trace " + filename + ".");
+        return false;
+    }
+    osre_info(Tag, "Profile trace exported to " + filename + ".");
+
+    return true;
+}
+
+void CpuProfiler::clear() {
+    BufferRegistry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mMutex);
+    for (const std::unique_ptr<ThreadBuffer> &buffer : registry.mBuffers) {
+        buffer->mClearedHead = buffer->mHead.load(std::memory_order_acquire);
+    }
+}
+
+} // Namespace Profiling
+} // Namespace OSRE
@@ -0,0 +1,138 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Profiling/ProfilingCommon.h"
+
+#include <atomic>
+
+namespace OSRE {
+namespace Profiling {
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements a low overhead CPU profiler for timing scopes.
+///
+/// Each thread writes its finished scopes into its own ring buffer, so recording needs no lock. 
+/// When the buffer is full the oldest scopes will be overwritten. The recorded timeline can be 
+/// exported as a Chrome trace, open it with chrome://tracing or https://ui.perfetto.dev. 
+/// When the profiler is disabled a scope costs one predictable branch.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT CpuProfiler {
+public:
+    /// @brief  The number of scopes kept per thread, must be a power of two.
+    static constexpr size_t BufferSize = 1u << 16;
+
+    /// @brief  Will enable or disable the recording.
+    /// @param  enabled     [in] true to record the scopes.
+    static void setEnabled(bool enabled);
+
+    /// @brief  Returns true, if the scopes are recorded.
+    /// @return true if enabled.
+    static bool isEnabled();
+
+    /// @brief  Returns the current time of the profiler clock.
+    /// @return The time in nanoseconds since the profiler clock was started.
+    static ui64 now();
+
+    /// @brief  Will record a finished scope of the calling thread.
+    /// @param  name        [in] The scope name, must stay valid until the trace is exported.
+    /// @param  begin       [in] The begin time.
+    /// @param  end         [in] The end time.
+    static void record(const c8 *name, ui64 begin, ui64 end);
+
+    /// @brief  Will set the name of the calling thread shown in the trace.
+    /// @param  name        [in] The thread name.
+    static void setThreadName(const String &name);
+
+    /// @brief  Will return the recorded scopes of all threads as a Chrome trace.
+    /// @return The trace as JSON.
+    static String getChromeTrace();
+
+    /// @brief  Will write the recorded scopes of all threads as a Chrome trace.
+    /// @param  filename    [in] The file to write.
+    /// @return true if successful.
+    static bool exportChromeTrace(const String &filename);
+
+    /// @brief  Will drop all recorded scopes, other threads may keep recording.
+    static void clear();
+
+    CpuProfiler() = delete;
+
+private:
+    static std::atomic<bool> sEnabled;
+};
+
+inline bool CpuProfiler::isEnabled() {
+    return sEnabled.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class records the lifetime of a scope, use OSRE_PROFILE_SCOPE to declare one.
+//-------------------------------------------------------------------------------------------------
+class ProfileScope {
+public:
+    /// @brief  The class constructor, will take the begin time.
+    /// @param  name        [in] The scope name, must be a string literal.
+    explicit ProfileScope(const c8 *name) :
+            mName(nullptr), mBegin(0) {
+        if (CpuProfiler::isEnabled()) {
+            mName = name;
+            mBegin = CpuProfiler::now();
+        }
+    }
+
+    /// @brief  The class destructor, will record the scope.
+    ~ProfileScope() {
+        if (mName != nullptr) {
+            CpuProfiler::record(mName, mBegin, CpuProfiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+private:
+    const c8 *mName;
+    ui64 mBegin;
+};
+
+} // Namespace Profiling
+} // Namespace OSRE
+
+#define OSRE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OSRE_PROFILE_CONCAT(a, b) OSRE_PROFILE_CONCAT_IMPL(a, b)
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  Will time the enclosing scope, compiled out when OSRE_PROFILING is not defined.
+//-------------------------------------------------------------------------------------------------
+#ifdef OSRE_PROFILING
+#   define OSRE_PROFILE_SCOPE(name) ::OSRE::Profiling::ProfileScope OSRE_PROFILE_CONCAT(osreProfileScope, __LINE__)(name)
+#else
+#   define OSRE_PROFILE_SCOPE(name)
+#endif // OSRE_PROFILING
@@ -0,0 +1,256 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "Profiling/FrameStatistics.h"
+#include "Profiling/CpuProfiler.h"
+#include "Common/Logger.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace OSRE {
+namespace Profiling {
+
+DECL_OSRE_LOG_MODULE(FrameStatistics)
+
+FrameStatistics *FrameStatistics::sInstance = nullptr;
+
+static const c8 *FrameTimeCounterNames[static_cast<size_t>(FrameThread::Count)] = {
+    "frametime.main",
+    "frametime.render"
+};
+
+static constexpr double NanoSecondsPerSecond = 1.0e9;
+static constexpr double NanoSecondsPerMilliSecond = 1.0e6;
+
+FrameStatistics::FrameStatistics(ui32 windowSize) :
+        mThreads(),
+        mHitchFactor(DefaultHitchFactor),
+        mMinHitchTime(DefaultMinHitchTime),
+        mCallbackMutex(),
+        mHitchCallback(),
+        mHitchCounter(PerformanceCounterRegistry::createCounter("hitches", CounterKind::Monotonic)),
+        mFpsCounter(PerformanceCounterRegistry::createCounter("fps", CounterKind::Gauge)) {
+    for (size_t i = 0; i < static_cast<size_t>(FrameThread::Count); ++i) {
+        mThreads[i].mSamples.resize(windowSize);
+        mThreads[i].mCounter = PerformanceCounterRegistry::createCounter(FrameTimeCounterNames[i], CounterKind::Histogram);
+    }
+}
+
+bool FrameStatistics::create(ui32 windowSize) {
+    if (nullptr != sInstance) {
+        return false;
+    }
+
+    sInstance = new FrameStatistics(windowSize > 0 ? windowSize : DefaultWindowSize);
+
+    return true;
+}
+
+bool FrameStatistics::destroy() {
+    if (nullptr == sInstance) {
+        return false;
+    }
+
+    delete sInstance;
+    sInstance = nullptr;
+
+    return true;
+}
+
+FrameStatistics *FrameStatistics::getInstance() {
+    return sInstance;
+}
+
+void FrameStatistics::setWindowSize(ui32 windowSize) {
+    if (windowSize == 0) {
+        osre_error(Tag, "Invalid window size for the frame statistics.");
+        return;
+    }
+
+    for (ThreadFrames &frames : mThreads) {
+        std::lock_guard<std::mutex> lock(frames.mMutex);
+        frames.mSamples.assign(windowSize, FrameSample{ 0, 0 });
+        frames.mNext = 0;
+        frames.mNumSamples = 0;
+        frames.mNumIntervals = 0;
+        frames.mTimeSum = 0;
+        frames.mIntervalSum = 0;
+    }
+}
+
+ui32 FrameStatistics::getWindowSize() const {
+    const ThreadFrames &frames = mThreads[static_cast<size_t>(FrameThread::Main)];
+    std::lock_guard<std::mutex> lock(frames.mMutex);
+
+    return static_cast<ui32>(frames.mSamples.size());
+}
+
+void FrameStatistics::setHitchThreshold(f32 factor, ui64 minFrameTime) {
+    std::lock_guard<std::mutex> mainLock(mThreads[static_cast<size_t>(FrameThread::Main)].mMutex);
+    std::lock_guard<std::mutex> renderLock(mThreads[static_cast<size_t>(FrameThread::Render)].mMutex);
+    mHitchFactor = factor;
+    mMinHitchTime = minFrameTime;
+}
+
+void FrameStatistics::setHitchCallback(const HitchCallback &callback) {
+    std::lock_guard<std::mutex> lock(mCallbackMutex);
+    mHitchCallback = callback;
+}
+
+void FrameStatistics::beginFrame(FrameThread thread) {
+    ThreadFrames &frames = mThreads[static_cast<size_t>(thread)];
+    const ui64 now = CpuProfiler::now();
+    frames.mInterval = frames.mBegin != 0 ? now - frames.mBegin : 0;
+    frames.mBegin = now;
+    frames.mInFrame = true;
+}
+
+void FrameStatistics::endFrame(FrameThread thread) {
+    ThreadFrames &frames = mThreads[static_cast<size_t>(thread)];
+    if (!frames.mInFrame) {
+        return;
+    }
+
+    frames.mInFrame = false;
+    addFrame(thread, CpuProfiler::now() - frames.mBegin, frames.mInterval);
+}
+
+void FrameStatistics::addFrame(FrameThread thread, ui64 frameTime, ui64 frameInterval) {
+    ThreadFrames &frames = mThreads[static_cast<size_t>(thread)];
+    bool hitch = false;
+    ui64 average = 0;
+    ui64 fps = 0;
+    {
+        std::lock_guard<std::mutex> lock(frames.mMutex);
+        if (frames.mNumSamples >= MinFramesForHitch) {
+            average = frames.mTimeSum / frames.mNumSamples;
+            hitch = frameTime >= mMinHitchTime && static_cast<double>(frameTime) > static_cast<double>(average) * mHitchFactor;
+        }
+
+        // Replace the oldest frame when the window is full
+        FrameSample &sample = frames.mSamples[frames.mNext];
+        if (frames.mNumSamples == frames.mSamples.size()) {
+            frames.mTimeSum -= sample.mTime;
+            if (sample.mInterval != 0) {
+                frames.mIntervalSum -= sample.mInterval;
+                --frames.mNumIntervals;
+            }
+        } else {
+            ++frames.mNumSamples;
+        }
+        sample.mTime = frameTime;
+        sample.mInterval = frameInterval;
+        frames.mTimeSum += frameTime;
+        if (frameInterval != 0) {
+            frames.mIntervalSum += frameInterval;
+            ++frames.mNumIntervals;
+        }
+        frames.mNext = (frames.mNext + 1) % static_cast<ui32>(frames.mSamples.size());
+        if (hitch) {
+            ++frames.mNumHitches;
+        }
+        if (frames.mIntervalSum != 0) {
+            fps = static_cast<ui64>(frames.mNumIntervals * NanoSecondsPerSecond / frames.mIntervalSum + 0.5);
+        }
+    }
+
+    PerformanceCounterRegistry::recordValue(frames.mCounter, frameTime);
+    if (thread == FrameThread::Render) {
+        PerformanceCounterRegistry::setCounter(mFpsCounter, fps);
+    }
+
+    if (hitch) {
+        PerformanceCounterRegistry::addValueToCounter(mHitchCounter, 1);
+        HitchCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(mCallbackMutex);
+            callback = mHitchCallback;
+        }
+        if (callback) {
+            callback(thread, frameTime, average);
+        }
+    }
+}
+
+FrameStatistics::Summary FrameStatistics::getSummary(FrameThread thread) const {
+    const ThreadFrames &frames = mThreads[static_cast<size_t>(thread)];
+    Summary summary;
+    std::vector<ui64> times;
+    {
+        std::lock_guard<std::mutex> lock(frames.mMutex);
+        summary.mNumFrames = frames.mNumSamples;
+        if (summary.mNumFrames == 0) {
+            return summary;
+        }
+        summary.mAvg = frames.mTimeSum / frames.mNumSamples;
+        if (frames.mIntervalSum != 0) {
+            summary.mFps = static_cast<f32>(frames.mNumIntervals * NanoSecondsPerSecond / frames.mIntervalSum);
+        }
+        times.reserve(frames.mNumSamples);
+        for (ui32 i = 0; i < frames.mNumSamples; ++i) {
+            times.push_back(frames.mSamples[i].mTime);
+        }
+    }
+
+    std::sort(times.begin(), times.end());
+    const size_t numFrames = times.size();
+    summary.mMin = times.front();
+    summary.mMax = times.back();
+    summary.mP95 = times[(numFrames * 95 + 99) / 100 - 1];
+    summary.mP99 = times[(numFrames * 99 + 99) / 100 - 1];
+
+    return summary;
+}
+
+ui64 FrameStatistics::getNumHitches(FrameThread thread) const {
+    const ThreadFrames &frames = mThreads[static_cast<size_t>(thread)];
+    std::lock_guard<std::mutex> lock(frames.mMutex);
+
+    return frames.mNumHitches;
+}
+
+String FrameStatistics::getSummaryText() const {
+    static const c8 *ThreadNames[static_cast<size_t>(FrameThread::Count)] = { "main", "render" };
+
+    String text;
+    c8 buffer[160];
+    for (size_t i = 0; i < static_cast<size_t>(FrameThread::Count); ++i) {
+        const Summary summary = getSummary(static_cast<FrameThread>(i));
+        ::snprintf(buffer, sizeof(buffer), "%s%s avg %.2f p95 %.2f p99 %.2f max %.2f ms",
+                text.empty() ? "" : " | ",
+                ThreadNames[i],
+                summary.mAvg / NanoSecondsPerMilliSecond,
+                summary.mP95 / NanoSecondsPerMilliSecond,
+                summary.mP99 / NanoSecondsPerMilliSecond,
+                summary.mMax / NanoSecondsPerMilliSecond);
+        text += buffer;
+    }
+    const Summary render = getSummary(FrameThread::Render);
+    ::snprintf(buffer, sizeof(buffer), " | %.0f fps", render.mFps);
+    text += buffer;
+
+    return text;
+}
+
+} // Namespace Profiling
+} // Namespace OSRE
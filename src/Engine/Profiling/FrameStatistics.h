@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Profiling/PerformanceCounterRegistry.h"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace OSRE {
+namespace Profiling {
+
+/// @brief  The threads with measured frames.
+enum class FrameThread : ui32 {
+    Main = 0,   ///< The application thread.
+    Render,     ///< The render thread.
+    Count       ///< The number of measured threads.
+};
+
+/// @brief  Will be called for a hitch with the thread, the frame time and the average frame time 
+///         in nanoseconds. It is called from the thread which finished the frame.
+using HitchCallback = std::function<void(FrameThread thread, ui64 frameTime, ui64 averageFrameTime)>;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class collects the CPU time per frame of the main and the render thread.
+///
+/// Each thread brackets its frame work with beginFrame and endFrame. The statistics are rolling 
+/// over the last frames of the window. A frame taking longer than the hitch factor times the 
+/// average frame time is reported as a hitch. The frame times are recorded in the histogram 
+/// counters "frametime.main" and "frametime.render", the hitches in "hitches" and the frame rate 
+/// of the render thread in "fps" of the PerformanceCounterRegistry.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT FrameStatistics {
+public:
+    /// @brief  The default number of frames in the window.
+    static constexpr ui32 DefaultWindowSize = 120;
+    /// @brief  The default factor of the average frame time to detect a hitch.
+    static constexpr f32 DefaultHitchFactor = 2.0f;
+    /// @brief  The default minimal frame time for a hitch in nanoseconds.
+    static constexpr ui64 DefaultMinHitchTime = 4000000;
+    /// @brief  The number of frames needed in the window before hitches are detected.
+    static constexpr ui32 MinFramesForHitch = 10;
+
+    /// @brief  The rolling statistics of a thread, all times are in nanoseconds.
+    struct Summary {
+        ui32 mNumFrames = 0;
+        ui64 mMin = 0;
+        ui64 mAvg = 0;
+        ui64 mP95 = 0;
+        ui64 mP99 = 0;
+        ui64 mMax = 0;
+        f32 mFps = 0.0f;
+    };
+
+    /// @brief  Will create the instance, the counters are registered when the registry exists.
+    /// @param  windowSize  [in] The number of frames in the window.
+    /// @return true if successful, false if already created.
+    static bool create(ui32 windowSize = DefaultWindowSize);
+
+    /// @brief  Will destroy the instance.
+    /// @return true if successful, false if not created.
+    static bool destroy();
+
+    /// @brief  Will return the instance.
+    /// @return The instance or nullptr if not created.
+    static FrameStatistics *getInstance();
+
+    /// @brief  Will set the number of frames in the window, the collected frames are dropped.
+    /// @param  windowSize  [in] The number of frames, must be greater than zero.
+    void setWindowSize(ui32 windowSize);
+
+    /// @brief  Will return the number of frames in the window.
+    /// @return The number of frames.
+    ui32 getWindowSize() const;
+
+    /// @brief  Will set the hitch detection thresholds.
+    /// @param  factor      [in] The factor of the average frame time.
+    /// @param  minFrameTime [in] The minimal frame time of a hitch in nanoseconds.
+    void setHitchThreshold(f32 factor, ui64 minFrameTime);
+
+    /// @brief  Will set the callback for detected hitches.
+    /// @param  callback    [in] The callback, an empty one disables it.
+    void setHitchCallback(const HitchCallback &callback);
+
+    /// @brief  Will mark the begin of the frame work of the calling thread.
+    /// @param  thread      [in] The thread.
+    void beginFrame(FrameThread thread);
+
+    /// @brief  Will mark the end of the frame work of the calling thread.
+    /// @param  thread      [in] The thread.
+    void endFrame(FrameThread thread);
+
+    /// @brief  Will add a measured frame.
+    /// @param  thread      [in] The thread.
+    /// @param  frameTime   [in] The CPU time of the frame.
+    /// @param  frameInterval [in] The time since the begin of the previous frame, 0 if unknown.
+    void addFrame(FrameThread thread, ui64 frameTime, ui64 frameInterval);
+
+    /// @brief  Will return the rolling statistics of a thread.
+    /// @param  thread      [in] The thread.
+    /// @return The statistics.
+    Summary getSummary(FrameThread thread) const;
+
+    /// @brief  Will return the number of detected hitches of a thread.
+    /// @param  thread      [in] The thread.
+    /// @return The number of hitches.
+    ui64 getNumHitches(FrameThread thread) const;
+
+    /// @brief  Will return the statistics of all threads as text in milliseconds.
+    /// @return The text.
+    String getSummaryText() const;
+
+    OSRE_NON_COPYABLE(FrameStatistics)
+
+private:
+    explicit FrameStatistics(ui32 windowSize);
+    ~FrameStatistics() = default;
+
+    struct FrameSample {
+        ui64 mTime;
+        ui64 mInterval;
+    };
+
+    // The window is guarded by the mutex, the frame begin is touched by the owning thread only.
+    struct ThreadFrames {
+        mutable std::mutex mMutex;
+        std::vector<FrameSample> mSamples;
+        ui32 mNext = 0;
+        ui32 mNumSamples = 0;
+        ui32 mNumIntervals = 0;
+        ui64 mTimeSum = 0;
+        ui64 mIntervalSum = 0;
+        ui64 mNumHitches = 0;
+        bool mInFrame = false;
+        ui64 mBegin = 0;
+        ui64 mInterval = 0;
+        CounterHandle mCounter = InvalidCounterHandle;
+    };
+
+private:
+    static FrameStatistics *sInstance;
+    ThreadFrames mThreads[static_cast<size_t>(FrameThread::Count)];
+    // The thresholds are changed with all thread mutexes locked
+    f32 mHitchFactor;
+    ui64 mMinHitchTime;
+    std::mutex mCallbackMutex;
+    HitchCallback mHitchCallback;
+    CounterHandle mHitchCounter;
+    CounterHandle mFpsCounter;
+};
+
+} // Namespace Profiling
+} // Namespace OSRE
@@ -21,16 +21,145 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "Profiling/PerformanceCounterRegistry.h"
+#include "Common/Logger.h"
 #include "Common/StringUtils.h"
 
+#include <algorithm>
+#include <limits>
+
+#ifdef _MSC_VER
+#   include <intrin.h>
+#endif
+
 namespace OSRE {
 namespace Profiling {
 
 using namespace ::OSRE::Common;
 
+DECL_OSRE_LOG_MODULE(PerformanceCounterRegistry)
+
+static constexpr ui64 MaxValue = std::numeric_limits<ui64>::max();
+
+static ui32 getHighestBit(ui64 value) {
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    return static_cast<ui32>(index);
+#else
+    return 63u - static_cast<ui32>(__builtin_clzll(value));
+#endif
+}
+
+LatencyHistogram::LatencyHistogram() :
+        mBuckets(new std::atomic<ui64>[BucketCount]),
+        mSum(0),
+        mMin(MaxValue),
+        mMax(0) {
+    for (ui32 i = 0; i < BucketCount; ++i) {
+        mBuckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::record(ui64 value) {
+    mBuckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(value, std::memory_order_relaxed);
+
+    ui64 current = mMin.load(std::memory_order_relaxed);
+    while (value < current && !mMin.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        // retry
+    }
+    current = mMax.load(std::memory_order_relaxed);
+    while (value > current && !mMax.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        // retry
+    }
+}
+
+LatencyHistogram::Stats LatencyHistogram::getStats(bool reset) {
+    // Samples recorded while reading may be split between two measurements, which is fine for 
+    // statistics.
+    std::vector<ui64> buckets(BucketCount);
+    Stats stats;
+    for (ui32 i = 0; i < BucketCount; ++i) {
+        buckets[i] = reset ? mBuckets[i].exchange(0, std::memory_order_relaxed) : mBuckets[i].load(std::memory_order_relaxed);
+        stats.mCount += buckets[i];
+    }
+    const ui64 sum = reset ? mSum.exchange(0, std::memory_order_relaxed) : mSum.load(std::memory_order_relaxed);
+    const ui64 minValue = reset ? mMin.exchange(MaxValue, std::memory_order_relaxed) : mMin.load(std::memory_order_relaxed);
+    const ui64 maxValue = reset ? mMax.exchange(0, std::memory_order_relaxed) : mMax.load(std::memory_order_relaxed);
+    if (stats.mCount == 0) {
+        return stats;
+    }
+
+    stats.mMin = minValue;
+    stats.mMax = maxValue;
+    stats.mMean = sum / stats.mCount;
+
+    // Report the highest value of the bucket which contains the requested rank
+    const ui64 ranks[3] = { (stats.mCount * 50 + 99) / 100, (stats.mCount * 90 + 99) / 100, (stats.mCount * 99 + 99) / 100 };
+    ui64 *percentiles[3] = { &stats.mP50, &stats.mP90, &stats.mP99 };
+    ui64 cumulated = 0;
+    ui32 next = 0;
+    for (ui32 i = 0; i < BucketCount && next < 3; ++i) {
+        cumulated += buckets[i];
+        while (next < 3 && cumulated >= ranks[next]) {
+            *percentiles[next] = std::min(getBucketUpperBound(i), maxValue);
+            ++next;
+        }
+    }
+
+    return stats;
+}
+
+ui32 LatencyHistogram::getBucketIndex(ui64 value) {
+    if (value < SubBucketCount) {
+        return static_cast<ui32>(value);
+    }
+
+    const ui32 shift = getHighestBit(value) - SubBucketBits;
+    return SubBucketCount + shift * SubBucketCount + static_cast<ui32>((value >> shift) - SubBucketCount);
+}
+
+ui64 LatencyHistogram::getBucketUpperBound(ui32 index) {
+    if (index < SubBucketCount) {
+        return index;
+    }
+
+    const ui32 shift = index / SubBucketCount - 1;
+    const ui64 lower = static_cast<ui64>(SubBucketCount + index % SubBucketCount) << shift;
+
+    return lower + ((static_cast<ui64>(1) << shift) - 1);
+}
+
+struct PerformanceCounterRegistry::Counter {
+    String mName;
+    CounterKind mKind;
+    std::atomic<bool> mActive;
+    std::atomic<ui64> mValue;
+    ui64 mLastValue;
+    std::unique_ptr<LatencyHistogram> mHistogram;
+
+    Counter(const String &name, CounterKind kind) :
+            mName(name),
+            mKind(kind),
+            mActive(true),
+            mValue(0),
+            mLastValue(0),
+            mHistogram(kind == CounterKind::Histogram ? new LatencyHistogram : nullptr) {
+        // empty
+    }
+};
+
 PerformanceCounterRegistry *PerformanceCounterRegistry::sInstance = nullptr;
 
-PerformanceCounterRegistry::PerformanceCounterRegistry() : mCounters() {
+PerformanceCounterRegistry::PerformanceCounterRegistry() :
+        mMutex(),
+        mCounters(),
+        mSlots(),
+        mNumSlots(0) {
+    // empty
+}
+
+PerformanceCounterRegistry::~PerformanceCounterRegistry() {
     // empty
 }
 
@@ -55,100 +184,208 @@ bool PerformanceCounterRegistry::destroy() {
     return true;
 }
 
-bool PerformanceCounterRegistry::registerCounter(const String &name) {
-    if ( nullptr == sInstance ) {
-        return false;
+CounterHandle PerformanceCounterRegistry::createCounter(const String &name, CounterKind kind) {
+    if (nullptr == sInstance) {
+        return InvalidCounterHandle;
     }
 
+    std::lock_guard<std::mutex> lock(sInstance->mMutex);
     const HashId hash = StringUtils::hashName(name.c_str());
     if (sInstance->mCounters.hasKey(hash)) {
-        return false;
+        CounterHandle handle = InvalidCounterHandle;
+        sInstance->mCounters.getValue(hash, handle);
+        Counter *counter = sInstance->mSlots[handle].get();
+        if (counter->mName != name || counter->mKind != kind) {
+            osre_error(Tag, "Counter " + name + " is already registered with a different name or kind.");
+            return InvalidCounterHandle;
+        }
+        if (!counter->mActive.load(std::memory_order_relaxed)) {
+            counter->mValue.store(0, std::memory_order_relaxed);
+            counter->mLastValue = 0;
+            if (counter->mHistogram != nullptr) {
+                counter->mHistogram->getStats(true);
+            }
+            counter->mActive.store(true, std::memory_order_release);
+        }
+        return handle;
     }
-    CounterMeasure *cm = new CounterMeasure;
-    sInstance->mCounters.insert(hash, cm);
 
-    return true;
+    const CounterHandle handle = sInstance->mNumSlots.load(std::memory_order_relaxed);
+    if (handle >= MaxCounters) {
+        osre_error(Tag, "Cannot register counter " + name + ", too many counters.");
+        return InvalidCounterHandle;
+    }
+    sInstance->mSlots[handle].reset(new Counter(name, kind));
+    sInstance->mCounters.insert(hash, handle);
+    sInstance->mNumSlots.store(handle + 1, std::memory_order_release);
+
+    return handle;
 }
-    
-bool PerformanceCounterRegistry::unregisterCounter(const String &name) {
+
+CounterHandle PerformanceCounterRegistry::getCounter(const String &name) {
     if (nullptr == sInstance) {
-        return false;
+        return InvalidCounterHandle;
     }
 
+    std::lock_guard<std::mutex> lock(sInstance->mMutex);
     const HashId hash = StringUtils::hashName(name.c_str());
     if (!sInstance->mCounters.hasKey(hash)) {
+        return InvalidCounterHandle;
+    }
+
+    CounterHandle handle = InvalidCounterHandle;
+    sInstance->mCounters.getValue(hash, handle);
+    const Counter *counter = sInstance->mSlots[handle].get();
+    if (counter->mName != name || !counter->mActive.load(std::memory_order_relaxed)) {
+        return InvalidCounterHandle;
+    }
+
+    return handle;
+}
+
+PerformanceCounterRegistry::Counter *PerformanceCounterRegistry::getActiveCounter(CounterHandle handle) {
+    if (nullptr == sInstance || handle >= sInstance->mNumSlots.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    Counter *counter = sInstance->mSlots[handle].get();
+    if (!counter->mActive.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    return counter;
+}
+
+bool PerformanceCounterRegistry::setCounter(CounterHandle handle, ui64 value) {
+    Counter *counter = getActiveCounter(handle);
+    if (nullptr == counter || counter->mKind != CounterKind::Gauge) {
         return false;
     }
+    counter->mValue.store(value, std::memory_order_relaxed);
 
-    CounterMeasure *cm = nullptr; 
-    sInstance->mCounters.getValue( hash, cm );
+    return true;
+}
 
-    if ( nullptr == cm ) {
+bool PerformanceCounterRegistry::addValueToCounter(CounterHandle handle, ui64 value) {
+    Counter *counter = getActiveCounter(handle);
+    if (nullptr == counter || counter->mKind == CounterKind::Histogram) {
         return false;
-    } 
-    delete cm;
+    }
+    counter->mValue.fetch_add(value, std::memory_order_relaxed);
 
-    return sInstance->mCounters.remove(hash);
+    return true;
 }
 
-bool PerformanceCounterRegistry::setCounter(const String &name, ui32 value) {
-    if ( nullptr == sInstance ) {
+bool PerformanceCounterRegistry::recordValue(CounterHandle handle, ui64 value) {
+    Counter *counter = getActiveCounter(handle);
+    if (nullptr == counter || counter->mKind != CounterKind::Histogram) {
         return false;
     }
+    counter->mHistogram->record(value);
+    counter->mValue.fetch_add(1, std::memory_order_relaxed);
 
-    const HashId hash = StringUtils::hashName(name.c_str());
-    if (!sInstance->mCounters.hasKey(hash)) {
+    return true;
+}
+
+bool PerformanceCounterRegistry::queryCounter(CounterHandle handle, ui64 &value) {
+    const Counter *counter = getActiveCounter(handle);
+    if (nullptr == counter) {
         return false;
     }
-    CounterMeasure *cm = nullptr;
-    sInstance->mCounters.getValue(hash, cm);
-    cm->count = value;
+    value = counter->mValue.load(std::memory_order_relaxed);
 
     return true;
 }
 
-bool PerformanceCounterRegistry::resetCounter( const String &name ) {
-    return setCounter( name, 0 );
+bool PerformanceCounterRegistry::takeSnapshot(CounterSnapshotArray &snapshot, bool reset) {
+    snapshot.clear();
+    if (nullptr == sInstance) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(sInstance->mMutex);
+    const ui32 numSlots = sInstance->mNumSlots.load(std::memory_order_relaxed);
+    for (ui32 i = 0; i < numSlots; ++i) {
+        Counter *counter = sInstance->mSlots[i].get();
+        if (!counter->mActive.load(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        CounterSnapshot entry;
+        entry.mName = counter->mName;
+        entry.mKind = counter->mKind;
+        entry.mValue = counter->mValue.load(std::memory_order_relaxed);
+        entry.mDelta = 0;
+        if (counter->mKind == CounterKind::Histogram) {
+            entry.mStats = counter->mHistogram->getStats(reset);
+            entry.mDelta = entry.mStats.mCount;
+        } else if (counter->mKind == CounterKind::Monotonic) {
+            entry.mDelta = entry.mValue - counter->mLastValue;
+            if (reset) {
+                counter->mLastValue = entry.mValue;
+            }
+        }
+        snapshot.push_back(entry);
+    }
+
+    return true;
 }
 
-bool PerformanceCounterRegistry::addValueToCounter( const String &name, ui32 value ) {
+bool PerformanceCounterRegistry::registerCounter(const String &name) {
     if ( nullptr == sInstance ) {
         return false;
     }
 
-    const HashId hash = StringUtils::hashName(name.c_str());
-    if ( !sInstance->mCounters.hasKey(hash)) {
+    if (InvalidCounterHandle != getCounter(name)) {
         return false;
     }
 
-    CounterMeasure *cm = nullptr;
-    sInstance->mCounters.getValue( hash, cm );
-    if ( nullptr == cm ) {
+    return InvalidCounterHandle != createCounter(name, CounterKind::Gauge);
+}
+
+bool PerformanceCounterRegistry::unregisterCounter(const String &name) {
+    const CounterHandle handle = getCounter(name);
+    if (InvalidCounterHandle == handle) {
         return false;
     }
 
-    cm->count += value;
+    std::lock_guard<std::mutex> lock(sInstance->mMutex);
+    sInstance->mSlots[handle]->mActive.store(false, std::memory_order_release);
 
     return true;
 }
 
-bool PerformanceCounterRegistry::queryCounter( const String &name, ui32 &counterValue ) {
-    if (nullptr == sInstance) {
+bool PerformanceCounterRegistry::setCounter(const String &name, ui32 value) {
+    return setCounter(getCounter(name), static_cast<ui64>(value));
+}
+
+bool PerformanceCounterRegistry::resetCounter( const String &name ) {
+    const CounterHandle handle = getCounter(name);
+    if (InvalidCounterHandle == handle) {
         return false;
     }
 
-    const HashId hash = StringUtils::hashName(name.c_str());
-    if ( !sInstance->mCounters.hasKey(hash) ) {
-        return false;
+    std::lock_guard<std::mutex> lock(sInstance->mMutex);
+    Counter *counter = sInstance->mSlots[handle].get();
+    counter->mValue.store(0, std::memory_order_relaxed);
+    counter->mLastValue = 0;
+    if (counter->mHistogram != nullptr) {
+        counter->mHistogram->getStats(true);
     }
 
-    CounterMeasure *cm = nullptr;
-    sInstance->mCounters.getValue( hash, cm );
-    if ( nullptr == cm ) {
+    return true;
+}
+
+bool PerformanceCounterRegistry::addValueToCounter( const String &name, ui32 value ) {
+    return addValueToCounter(getCounter(name), static_cast<ui64>(value));
+}
+
+bool PerformanceCounterRegistry::queryCounter( const String &name, ui32 &counterValue ) {
+    ui64 value = 0;
+    if (!queryCounter(getCounter(name), value)) {
         return false;
     }
-
-    counterValue = cm->count;
+    counterValue = static_cast<ui32>(value);
 
     return true;
 }
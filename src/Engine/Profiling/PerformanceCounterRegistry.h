@@ -26,51 +26,198 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include <cppcore/Container/THashMap.h>
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace OSRE {
 namespace Profiling {
-        
+
+/// @brief  The handle of a registered performance counter.
+using CounterHandle = ui32;
+
+/// @brief  Marks an invalid counter handle.
+static constexpr CounterHandle InvalidCounterHandle = 0xffffffffu;
+
+/// @brief  The kind of a performance counter.
+enum class CounterKind {
+    Gauge = 0,      ///< Holds the last set value, can be set and incremented.
+    Monotonic,      ///< Can be incremented only, snapshots report the increase per frame.
+    Histogram       ///< Records samples like latencies, snapshots report percentiles.
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements a log-linear histogram for latencies with lock-free recording.
+///
+/// Values below 32 are counted exactly, larger values are counted in 32 sub-buckets per power of 
+/// two, which keeps the relative error of the reported percentiles below 3.2 percent.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT LatencyHistogram {
+public:
+    /// @brief  The number of sub-buckets per power of two.
+    static constexpr ui32 SubBucketBits = 5;
+    static constexpr ui32 SubBucketCount = 1u << SubBucketBits;
+    /// @brief  The number of buckets to cover all 64-bit values.
+    static constexpr ui32 BucketCount = SubBucketCount + (64 - SubBucketBits) * SubBucketCount;
+
+    /// @brief  The statistics of the recorded samples.
+    struct Stats {
+        ui64 mCount = 0;
+        ui64 mMin = 0;
+        ui64 mMax = 0;
+        ui64 mMean = 0;
+        ui64 mP50 = 0;
+        ui64 mP90 = 0;
+        ui64 mP99 = 0;
+    };
+
+    /// @brief  The class constructor.
+    LatencyHistogram();
+
+    /// @brief  The class destructor.
+    ~LatencyHistogram() = default;
+
+    /// @brief  Will record a sample, can be called from any thread.
+    /// @param  value       [in] The sample value.
+    void record(ui64 value);
+
+    /// @brief  Will compute the statistics of all samples recorded since the last reset.
+    /// @param  reset       [in] true to start a new measurement.
+    /// @return The statistics.
+    Stats getStats(bool reset);
+
+    /// @brief  Will return the bucket index for a value.
+    /// @param  value       [in] The value.
+    /// @return The bucket index.
+    static ui32 getBucketIndex(ui64 value);
+
+    /// @brief  Will return the highest value counted in a bucket.
+    /// @param  index       [in] The bucket index.
+    /// @return The highest value.
+    static ui64 getBucketUpperBound(ui32 index);
+
+    OSRE_NON_COPYABLE(LatencyHistogram)
+
+private:
+    std::unique_ptr<std::atomic<ui64>[]> mBuckets;
+    std::atomic<ui64> mSum;
+    std::atomic<ui64> mMin;
+    std::atomic<ui64> mMax;
+};
+
+/// @brief  The values of one counter taken by PerformanceCounterRegistry::takeSnapshot.
+struct CounterSnapshot {
+    String mName;                       ///< The counter name.
+    CounterKind mKind;                  ///< The counter kind.
+    ui64 mValue;                        ///< The counter value, the number of samples for histograms.
+    ui64 mDelta;                        ///< The increase since the last snapshot.
+    LatencyHistogram::Stats mStats;     ///< The sample statistics for histograms.
+};
+
+using CounterSnapshotArray = std::vector<CounterSnapshot>;
+
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
 ///	@brief  This class is used to set performance counters like FPS. You can register your own 
 /// counters as well.
+///
+/// Register a counter once and keep its handle, updates by handle are lock-free and can be done 
+/// from any thread. The name based accessors look up the handle on each call.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT PerformanceCounterRegistry {
 public:
-    /// @brief  
+    /// @brief  The maximal number of counters.
+    static constexpr ui32 MaxCounters = 256;
+
+    /// @brief  Will create the registry instance.
+    /// @return true if successful, false if the registry was already created.
     static bool create();
 
-    /// @brief  
+    /// @brief  Will destroy the registry instance, no counter must be updated concurrently.
+    /// @return true if successful, false if there was no registry.
     static bool destroy();
 
-    /// @brief  
+    /// @brief  Will register a new counter.
+    /// @param  name        [in] The counter name.
+    /// @param  kind        [in] The counter kind.
+    /// @return The handle, the handle of the existing counter when the name was registered 
+    ///         with the same kind before, InvalidCounterHandle in case of an error.
+    static CounterHandle createCounter(const String &name, CounterKind kind);
+
+    /// @brief  Will look up a counter.
+    /// @param  name        [in] The counter name.
+    /// @return The handle or InvalidCounterHandle if not registered.
+    static CounterHandle getCounter(const String &name);
+
+    /// @brief  Will set a gauge counter.
+    /// @param  handle      [in] The counter handle.
+    /// @param  value       [in] The new value.
+    /// @return true if successful.
+    static bool setCounter(CounterHandle handle, ui64 value);
+
+    /// @brief  Will increment a gauge or monotonic counter.
+    /// @param  handle      [in] The counter handle.
+    /// @param  value       [in] The increment.
+    /// @return true if successful.
+    static bool addValueToCounter(CounterHandle handle, ui64 value);
+
+    /// @brief  Will record a sample in a histogram counter.
+    /// @param  handle      [in] The counter handle.
+    /// @param  value       [in] The sample.
+    /// @return true if successful.
+    static bool recordValue(CounterHandle handle, ui64 value);
+
+    /// @brief  Will return the value of a counter, the number of samples for histograms.
+    /// @param  handle      [in] The counter handle.
+    /// @param  value       [out] The value.
+    /// @return true if successful.
+    static bool queryCounter(CounterHandle handle, ui64 &value);
+
+    /// @brief  Will take a snapshot of all counters, call it once per frame.
+    /// @param  snapshot    [out] The counter values.
+    /// @param  reset       [in] true to reset the histograms and the monotonic deltas.
+    /// @return true if successful.
+    static bool takeSnapshot(CounterSnapshotArray &snapshot, bool reset = true);
+
+    /// @brief  Will register a new gauge counter.
+    /// @param  name        [in] The counter name.
+    /// @return true if successful, false if already registered.
     static bool registerCounter( const String &name );
 
-    /// @brief  
+    /// @brief  Will unregister a counter, the handle stays reserved for the name.
+    /// @param  name        [in] The counter name.
+    /// @return true if successful.
     static bool unregisterCounter( const String &name );
 
-    /// @brief  
+    /// @brief  Will set a gauge counter by name.
     static bool setCounter( const String &name, ui32 value );
 
-    /// @brief  
+    /// @brief  Will reset a counter by name.
     static bool resetCounter( const String &name );
 
-    /// @brief  
+    /// @brief  Will increment a counter by name.
     static bool addValueToCounter( const String &name, ui32 value );
 
-    /// @brief  
+    /// @brief  Will return the lower 32 bits of a counter value by name.
     static bool queryCounter( const String &name, ui32 &counterValue );
 
 private:
     PerformanceCounterRegistry();
-    ~PerformanceCounterRegistry() = default;
+    ~PerformanceCounterRegistry();
+
+    struct Counter;
+    static Counter *getActiveCounter(CounterHandle handle);
 
 private:
-    struct CounterMeasure {
-        ui32 count = 0;
-    };
     static PerformanceCounterRegistry *sInstance;
-    cppcore::THashMap<HashId, CounterMeasure*> mCounters;
+    std::mutex mMutex;
+    cppcore::THashMap<HashId, CounterHandle> mCounters;
+    std::unique_ptr<Counter> mSlots[MaxCounters];
+    std::atomic<ui32> mNumSlots;
 };
 
 } // Namespace Profiling
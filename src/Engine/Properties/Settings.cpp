@@ -58,7 +58,13 @@ static const c8 *ConfigKeyStringTable[Settings::MaxKonfigKey] = {
     "PollingMode",
     "DefaultFont",
     "RenderMode",
-    "PluginDllName"
+    "PluginDllName",
+    "TextureCompression",
+    "CpuProfiling",
+    "ProfileTraceFile",
+    "ShowFrameStatistics",
+    "AsyncLogging",
+    "InputPumpMode"
 };
 
 Settings::Settings() :
@@ -231,6 +237,20 @@ void Settings::initDefaults() {
 
     value.setInt( 1 );
     mPropertyMap->setProperty( RenderMode, ConfigKeyStringTable[ RenderMode], value );
+
+    value.setBool( false );
+    mPropertyMap->setProperty( TextureCompression, ConfigKeyStringTable[ TextureCompression ], value );
+
+    value.setBool( false );
+    mPropertyMap->setProperty( CpuProfiling, ConfigKeyStringTable[ CpuProfiling ], value );
+    value.setStdString( "osre_profile.json" );
+    mPropertyMap->setProperty( ProfileTraceFile, ConfigKeyStringTable[ ProfileTraceFile ], value );
+    value.setBool( false );
+    mPropertyMap->setProperty( ShowFrameStatistics, ConfigKeyStringTable[ ShowFrameStatistics ], value );
+    value.setBool( false );
+    mPropertyMap->setProperty( AsyncLogging, ConfigKeyStringTable[ AsyncLogging ], value );
+    value.setInt( 1 );
+    mPropertyMap->setProperty( InputPumpMode, ConfigKeyStringTable[ InputPumpMode ], value );
 }
 
 } // Namespace Properties
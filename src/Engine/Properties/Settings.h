@@ -70,6 +70,12 @@ public:
         DefaultFont,            ///< The default font for rendering.
         RenderMode,             ///< The requested render mode (2D or 3D, default 3D).
         PluginDllName,          ///< The name for the child application.
+        TextureCompression,     ///< Textures are lossily block compressed and cached next to the source, default false.
+        CpuProfiling,           ///< The CPU profiler records the profile scopes, default false.
+        ProfileTraceFile,       ///< The Chrome trace file written at shutdown when CpuProfiling is set.
+        ShowFrameStatistics,    ///< The frame time statistics are drawn as debug text, default false.
+        AsyncLogging,           ///< The log messages are written by a background thread, default false.
+        InputPumpMode,          ///< The input pump used in polling mode, 0 for one event per update, 1 for all pending events per frame (default).
         MaxKonfigKey			///< The upper limit.
     };
 
@@ -21,6 +21,7 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "CanvasRenderer.h"
+#include "RenderBackend/2D/TextureAtlas.h"
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/RenderBackendService.h"
 #include "RenderBackend/MaterialBuilder.h"
@@ -37,6 +38,9 @@ using namespace cppcore;
 
 DECL_OSRE_LOG_MODULE(CanvasRenderer)
 
+static constexpr ui32 AtlasSize = 512;
+static constexpr c8 SolidRegion[] = "$solid";
+
 // will rescale coordinates from absolute coordinates into model space coordinates
 inline void mapCoordinates(const Rect2i &resolution, i32 x, i32 y, f32 &xOut, f32 &yOut) {
     xOut = (2.0f * static_cast<f32>(x)  / static_cast<f32>(resolution.width)) - 1.0f;
@@ -64,7 +68,8 @@ inline void clip(const Rect2i &resolution, i32 x, i32 y, i32 &x_out, i32 &y_out)
     }
 }
 
-static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const Rect2i &resolution, i32 x, i32 y, i32 w, i32 h, i32 layer) {
+static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const Rect2i &resolution, i32 x, i32 y, i32 w, i32 h, i32 layer,
+        const AtlasRegion &region) {
     i32 x_clipped{0}, y_clipped{0};
     f32 x_model{0.f}, y_model{0.f};
 
@@ -78,6 +83,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[0].position.x = x_model;
     drawCmd->Vertices[0].position.y = y_model;
     drawCmd->Vertices[0].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[0].tex0 = glm::vec2(region.UV0.x, region.UV1.y);
 
     clip(resolution, x+w, y, x_clipped, y_clipped);
     mapCoordinates(resolution, x_clipped, y_clipped, x_model, y_model);
@@ -85,6 +91,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[1].position.x = x_model;
     drawCmd->Vertices[1].position.y = y_model;
     drawCmd->Vertices[1].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[1].tex0 = glm::vec2(region.UV1.x, region.UV1.y);
 
     clip(resolution, x+w, y+h, x_clipped, y_clipped);
     mapCoordinates(resolution, x_clipped, y_clipped, x_model, y_model);
@@ -92,6 +99,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[2].position.x = x_model;
     drawCmd->Vertices[2].position.y = y_model;
     drawCmd->Vertices[2].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[2].tex0 = glm::vec2(region.UV1.x, region.UV0.y);
 
     clip(resolution, x+w, y+h, x_clipped, y_clipped);
     mapCoordinates(resolution, x_clipped, y_clipped, x_model, y_model);
@@ -99,6 +107,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[3].position.x = x_model;
     drawCmd->Vertices[3].position.y = y_model;
     drawCmd->Vertices[3].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[3].tex0 = glm::vec2(region.UV1.x, region.UV0.y);
 
     clip(resolution, x, y+h, x_clipped, y_clipped);
     mapCoordinates(resolution, x_clipped, y_clipped, x_model, y_model);
@@ -106,6 +115,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[4].position.x = x_model;
     drawCmd->Vertices[4].position.y = y_model;
     drawCmd->Vertices[4].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[4].tex0 = glm::vec2(region.UV0.x, region.UV0.y);
 
     clip(resolution, x, y, x_clipped, y_clipped);
     mapCoordinates(resolution, x_clipped, y_clipped, x_model, y_model);
@@ -113,6 +123,7 @@ static void createRectVertices(DrawCmd *drawCmd, const Color4 &penColor, const R
     drawCmd->Vertices[5].position.x = x_model;
     drawCmd->Vertices[5].position.y = y_model;
     drawCmd->Vertices[5].position.z = static_cast<f32>(-layer);
+    drawCmd->Vertices[5].tex0 = glm::vec2(region.UV0.x, region.UV1.y);
 
     drawCmd->NumIndices = 6;
     drawCmd->Indices = new ui16[drawCmd->NumIndices];
@@ -150,10 +161,16 @@ CanvasRenderer::CanvasRenderer(i32 numLayers, i32 x, i32 y, i32 w, i32 h) :
         mPenColor(1, 1, 1, 0),
         mActiveLayer(0),
         mNumLayers(numLayers),
+        mAtlas(nullptr),
+        mSolid(nullptr),
         mFont(nullptr),
-        mMesh(nullptr),
-        mText(nullptr) {
+        mMesh(nullptr) {
     setResolution(x, y, w, h);
+
+    // Each canvas owns its atlas, the name keeps the materials apart
+    static ui32 sAtlasId = 0;
+    mAtlas = new TextureAtlas("canvas_atlas_" + std::to_string(sAtlasId++), AtlasSize, AtlasSize);
+    mSolid = mAtlas->addSolid(SolidRegion, 4, 4, Color4(1, 1, 1, 1));
 }
 
 CanvasRenderer::~CanvasRenderer() {
@@ -161,6 +178,7 @@ CanvasRenderer::~CanvasRenderer() {
         auto &dc = *mDrawCmdArray[i];
         dealloc(&dc);
     }
+    delete mAtlas;
 }
 
 void CanvasRenderer::preRender(RenderBackendService *rbSrv) {
@@ -183,10 +201,11 @@ void CanvasRenderer::render(RenderBackendService *rbSrv) {
         return;
     }
     
-    // Create not textured geometry
+    // Shapes, text and images share the atlas material
     if (mMesh == nullptr) {
         mMesh = new Mesh("2d", VertexType::RenderVertex, IndexType::UnsignedShort);
-        Material *mat2D = MaterialBuilder::create2DMaterial();
+        Texture *atlasTexture = mAtlas->getTexture();
+        Material *mat2D = MaterialBuilder::createTextureAtlasMaterial(atlasTexture->TextureName + ".mat", atlasTexture);
         if (mat2D == nullptr) {
             osre_debug(Tag, "Invalid material instance detected.");
             return;
@@ -194,14 +213,10 @@ void CanvasRenderer::render(RenderBackendService *rbSrv) {
         mMesh->setMaterial(mat2D);
     }
 
-    if (mText == nullptr) {
-        mText = new Mesh("text_2d", VertexType::RenderVertex, IndexType::UnsignedShort);
-        Material *matText = MaterialBuilder::createTextMaterial(mFont->Name);
-        if (matText == nullptr) {
-            osre_debug(Tag, "Invalid material instance detected.");
-            return;
-        }
-        mText->setMaterial(matText);
+    // Upload the atlas again after new images or glyph sheets were added
+    if (mAtlas->isDirty()) {
+        rbSrv->updateTexture(mAtlas->getTexture());
+        mAtlas->setClean();
     }
 
     PrimitiveType prim = PrimitiveType::TriangleList;
@@ -228,29 +243,6 @@ void CanvasRenderer::render(RenderBackendService *rbSrv) {
     rbSrv->addMesh(mMesh, 0);
     
     mDrawCmdArray.resize(0);
-    
-    numVertices = 0;
-    numIndices = 0;
-    for (size_t i = 0; i < mFontCmdArray.size(); ++i) {
-        const auto &dc = *mFontCmdArray[i];
-        if (dc.Vertices == nullptr) {
-            osre_debug(Tag, "Invalid draw command detecetd.");
-            continue;
-        }
-
-        const ui32 lastIndex = mText->getLastIndex();
-        renumberIndices(dc, numVertices);
-
-        mText->attachVertices(dc.Vertices, dc.NumVertices * sizeof(RenderVert));
-        mText->attachIndices(dc.Indices, dc.NumIndices * sizeof(ui16));
-        prim = dc.PrimType;
-        mText->setLastIndex(lastIndex + static_cast<ui16>(dc.NumIndices));
-        numVertices += dc.NumVertices;
-        numIndices += dc.NumIndices;
-    }
-    mText->addPrimitiveGroup(numIndices, prim, 0);
-    rbSrv->addMesh(mText, 0);
-    mFontCmdArray.resize(0);
 
     setClean();
 }
@@ -317,6 +309,8 @@ void CanvasRenderer::drawline(i32 x1, i32 y1, i32 x2, i32 y2) {
     dc->Vertices[1].position.y = (f32)y_clipped;
     dc->Vertices[1].position.z = static_cast<f32>(-mActiveLayer);
 
+    dc->Vertices[0].tex0 = dc->Vertices[1].tex0 = mSolid->map(glm::vec2(0.5f));
+
     dc->NumIndices = 2;
     dc->Indices = new ui16[dc->NumIndices];
     dc->Indices[0] = 0;
@@ -354,7 +348,10 @@ void CanvasRenderer::drawTriangle(i32 x1, i32 y1, i32 x2, i32 y2, i32 x3, i32 y3
     dc->Vertices[2].position.x = (f32)x_clipped;
     dc->Vertices[2].position.y = (f32)y_clipped;
     dc->Vertices[2].position.z = static_cast<f32>(-mActiveLayer);
-    
+    for (size_t i = 0; i < dc->NumVertices; ++i) {
+        dc->Vertices[i].tex0 = mSolid->map(glm::vec2(0.5f));
+    }
+
     if (filled) {
         dc->NumIndices = 3;
         dc->Indices = new ui16[dc->NumIndices];
@@ -389,26 +386,26 @@ void CanvasRenderer::drawRect(i32 x, i32 y, i32 w, i32 h, bool filled) {
     DrawCmd *drawCmd = nullptr;
     if (filled) {
         drawCmd = alloc();
-        createRectVertices(drawCmd, mPenColor, mResolution, x, y, w, h, mActiveLayer);
+        createRectVertices(drawCmd, mPenColor, mResolution, x, y, w, h, mActiveLayer, *mSolid);
         mDrawCmdArray.add(drawCmd);
         return;
     }
 
     const ui32 thickness = 2;
     drawCmd = alloc();
-    createRectVertices(drawCmd, mPenColor, mResolution, x, y, w, thickness, mActiveLayer);
+    createRectVertices(drawCmd, mPenColor, mResolution, x, y, w, thickness, mActiveLayer, *mSolid);
     mDrawCmdArray.add(drawCmd);
 
     drawCmd = alloc();
-    createRectVertices(drawCmd, mPenColor, mResolution, x, y + h, w, thickness, mActiveLayer);
+    createRectVertices(drawCmd, mPenColor, mResolution, x, y + h, w, thickness, mActiveLayer, *mSolid);
     mDrawCmdArray.add(drawCmd);
 
     drawCmd = alloc();
-    createRectVertices(drawCmd, mPenColor, mResolution, x, y, thickness, h, mActiveLayer);
+    createRectVertices(drawCmd, mPenColor, mResolution, x, y, thickness, h, mActiveLayer, *mSolid);
     mDrawCmdArray.add(drawCmd);
 
     drawCmd = alloc();
-    createRectVertices(drawCmd, mPenColor, mResolution, x+w, y, thickness, h, mActiveLayer);
+    createRectVertices(drawCmd, mPenColor, mResolution, x+w, y, thickness, h, mActiveLayer, *mSolid);
     mDrawCmdArray.add(drawCmd);
 }
 
@@ -427,6 +424,12 @@ void CanvasRenderer::drawText(i32 x, i32 y, i32 size, const String &text) {
         return;
     }
 
+    // The glyph sheet becomes a region of the atlas
+    const AtlasRegion *glyphs = findOrLoadImage(mFont->Name);
+    if (glyphs == nullptr) {
+        return;
+    }
+
     i32 usedSize = size;
     if (usedSize == -1) {
         usedSize = mFont->Size;
@@ -456,19 +459,48 @@ void CanvasRenderer::drawText(i32 x, i32 y, i32 size, const String &text) {
         drawCmd->Vertices[posIndex].position.x = positions[posIndex].x;
         drawCmd->Vertices[posIndex].position.y = positions[posIndex].y;
         drawCmd->Vertices[posIndex].position.z = static_cast<f32>(-mActiveLayer);
-        drawCmd->Vertices[posIndex].tex0.x = tex0[posIndex].x;
-        drawCmd->Vertices[posIndex].tex0.y = tex0[posIndex].y;
+        drawCmd->Vertices[posIndex].tex0 = glyphs->map(tex0[posIndex]);
     }
 
     for (size_t idxIndex = 0; idxIndex < numIndices; ++idxIndex) {
         drawCmd->Indices[idxIndex] = indices[idxIndex];
     }
 
-    mFontCmdArray.add(drawCmd);
+    mDrawCmdArray.add(drawCmd);
+
+    setDirty();
+}
+
+void CanvasRenderer::drawImage(i32 x, i32 y, i32 w, i32 h, const String &name) {
+    const AtlasRegion *region = findOrLoadImage(name);
+    if (region == nullptr) {
+        return;
+    }
+
+    DrawCmd *drawCmd = alloc();
+    createRectVertices(drawCmd, Color4(1, 1, 1, 1), mResolution, x, y, w, h, mActiveLayer, *region);
+    mDrawCmdArray.add(drawCmd);
 
     setDirty();
 }
 
+const AtlasRegion *CanvasRenderer::findOrLoadImage(const String &name) {
+    const AtlasRegion *region = mAtlas->find(name);
+    if (region != nullptr) {
+        return region;
+    }
+
+    // Images for the canvas stay uncompressed, they are copied into the atlas
+    Texture image(name);
+    TextureLoader loader;
+    if (loader.load(IO::Uri(name), &image) == 0) {
+        osre_debug(Tag, "Cannot load image " + name + ".");
+        return nullptr;
+    }
+
+    return mAtlas->add(name, image);
+}
+
 bool CanvasRenderer::onCreate() {
     mFont = FontService::getDefaultFont();
 
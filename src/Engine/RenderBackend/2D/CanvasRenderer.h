@@ -30,13 +30,18 @@ namespace OSRE::RenderBackend {
 // Forward declarations ---------------------------------------------------------------------------
 class RenderBackendService;
 class Mesh;
+class TextureAtlas;
 
+struct AtlasRegion;
 struct DrawCmd;
 
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
 ///	@brief This class implements the 2D canvas renderer.
+///
+/// Shapes, glyphs and images are packed into one texture atlas, so the whole canvas is drawn
+/// with one mesh, one material and one texture binding.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT CanvasRenderer : public IRenderPath {
 public:
@@ -142,6 +147,18 @@ public:
     /// @param[in] text The text to draw.
     void drawText(i32 x, i32 y, i32 size, const String &text);
 
+    /// @brief Will draw an image, the image will be added to the texture atlas on first use.
+    /// @param[in] x        The x position of the image.
+    /// @param[in] y        The y position of the image.
+    /// @param[in] w        The width of the image.
+    /// @param[in] h        The height of the image.
+    /// @param[in] name     The uri of the image.
+    void drawImage(i32 x, i32 y, i32 w, i32 h, const String &name);
+
+    /// @brief Will return the texture atlas used by the canvas.
+    /// @return The texture atlas.
+    TextureAtlas *getTextureAtlas() const;
+
     /// @brief Will set the dirty flag.
     void setDirty();
 
@@ -155,23 +172,30 @@ public:
 protected:
     bool onCreate() override;
 
+private:
+    const AtlasRegion *findOrLoadImage(const String &name);
+
 private:
     bool mDirty;
     DrawCmdArray mDrawCmdArray;
-    DrawCmdArray mFontCmdArray;
+    TextureAtlas *mAtlas;
+    const AtlasRegion *mSolid;
     Color4 mPenColor;
     Rect2i mResolution;
     i32 mActiveLayer;
     i32 mNumLayers;
     Font *mFont;
     Mesh *mMesh;
-    Mesh *mText;
 };
 
 inline Font* CanvasRenderer::getActiveFont() const {
     return mFont;
 }
 
+inline TextureAtlas *CanvasRenderer::getTextureAtlas() const {
+    return mAtlas;
+}
+
 inline void CanvasRenderer::setDirty() {
     mDirty = true;
 }
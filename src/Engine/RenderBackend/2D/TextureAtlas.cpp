@@ -0,0 +1,304 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/2D/TextureAtlas.h"
+#include "Common/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace OSRE::RenderBackend {
+
+DECL_OSRE_LOG_MODULE(TextureAtlas)
+
+static constexpr ui32 AtlasChannels = 4;
+
+SkylinePacker::SkylinePacker(ui32 width, ui32 height) :
+        mWidth(width), mHeight(height), mUsedArea(0), mSkyline() {
+    reset();
+}
+
+void SkylinePacker::reset() {
+    mSkyline.clear();
+    mSkyline.push_back({ 0, 0, mWidth });
+    mUsedArea = 0;
+}
+
+bool SkylinePacker::fits(size_t index, ui32 width, ui32 height, ui32 &y) const {
+    if (mSkyline[index].X + width > mWidth) {
+        return false;
+    }
+
+    // The rectangle rests on the highest segment below its span
+    y = 0;
+    ui32 widthLeft = width;
+    for (size_t i = index; i < mSkyline.size(); ++i) {
+        y = std::max(y, mSkyline[i].Y);
+        if (y + height > mHeight) {
+            return false;
+        }
+        if (mSkyline[i].Width >= widthLeft) {
+            return true;
+        }
+        widthLeft -= mSkyline[i].Width;
+    }
+
+    return false;
+}
+
+bool SkylinePacker::insert(ui32 width, ui32 height, ui32 &x, ui32 &y) {
+    if (width == 0 || height == 0 || width > mWidth || height > mHeight) {
+        return false;
+    }
+
+    size_t bestIndex = mSkyline.size();
+    ui32 bestTop = std::numeric_limits<ui32>::max();
+    ui32 bestWidth = std::numeric_limits<ui32>::max();
+    ui32 bestY = 0;
+    for (size_t i = 0; i < mSkyline.size(); ++i) {
+        ui32 fitY = 0;
+        if (!fits(i, width, height, fitY)) {
+            continue;
+        }
+        const ui32 top = fitY + height;
+        if (top < bestTop || (top == bestTop && mSkyline[i].Width < bestWidth)) {
+            bestIndex = i;
+            bestTop = top;
+            bestWidth = mSkyline[i].Width;
+            bestY = fitY;
+        }
+    }
+    if (bestIndex == mSkyline.size()) {
+        return false;
+    }
+
+    x = mSkyline[bestIndex].X;
+    y = bestY;
+    mSkyline.insert(mSkyline.begin() + bestIndex, { x, bestTop, width });
+
+    // Cut the segments covered by the new one
+    const ui32 right = x + width;
+    size_t i = bestIndex + 1;
+    while (i < mSkyline.size() && mSkyline[i].X < right) {
+        const ui32 segmentRight = mSkyline[i].X + mSkyline[i].Width;
+        if (segmentRight <= right) {
+            mSkyline.erase(mSkyline.begin() + i);
+            continue;
+        }
+        mSkyline[i].Width = segmentRight - right;
+        mSkyline[i].X = right;
+        break;
+    }
+
+    // Merge neighbours on the same level
+    for (i = 0; i + 1 < mSkyline.size();) {
+        if (mSkyline[i].Y == mSkyline[i + 1].Y) {
+            mSkyline[i].Width += mSkyline[i + 1].Width;
+            mSkyline.erase(mSkyline.begin() + i + 1);
+        } else {
+            ++i;
+        }
+    }
+    mUsedArea += static_cast<ui64>(width) * height;
+
+    return true;
+}
+
+ui32 SkylinePacker::getUsedHeight() const {
+    ui32 usedHeight = 0;
+    for (const Segment &segment : mSkyline) {
+        usedHeight = std::max(usedHeight, segment.Y);
+    }
+
+    return usedHeight;
+}
+
+ui64 SkylinePacker::getUsedArea() const {
+    return mUsedArea;
+}
+
+f32 SkylinePacker::getEfficiency() const {
+    const ui32 usedHeight = getUsedHeight();
+    if (usedHeight == 0) {
+        return 0.0f;
+    }
+
+    return static_cast<f32>(static_cast<d32>(mUsedArea) / (static_cast<d32>(mWidth) * usedHeight));
+}
+
+TextureAtlas::TextureAtlas(const String &name, ui32 width, ui32 height, ui32 padding) :
+        mTexture(name),
+        mPacker(width, height),
+        mPadding(padding),
+        mImageTexels(0),
+        mRegions(),
+        mDirty(true) {
+    mTexture.PixelFormat = PixelFormatType::R8G8B8A8;
+    mTexture.Width = width;
+    mTexture.Height = height;
+    mTexture.Channels = AtlasChannels;
+    mTexture.NumMips = 1;
+    mTexture.Size = width * height * AtlasChannels;
+    mTexture.Data = new uc8[mTexture.Size];
+    ::memset(mTexture.Data, 0, mTexture.Size);
+    mTexture.State = TextureState::Ready;
+}
+
+const AtlasRegion *TextureAtlas::add(const String &name, const Texture &image) {
+    const AtlasRegion *found = find(name);
+    if (found != nullptr) {
+        return found;
+    }
+
+    if (image.Data == nullptr || image.Width == 0 || image.Height == 0) {
+        osre_debug(Tag, "Image " + name + " has no data.");
+        return nullptr;
+    }
+    if (image.PixelFormat != PixelFormatType::R8G8B8 && image.PixelFormat != PixelFormatType::R8G8B8A8) {
+        osre_debug(Tag, "Image " + name + " is not uncompressed RGB or RGBA.");
+        return nullptr;
+    }
+
+    AtlasRegion *region = allocate(name, image.Width, image.Height);
+    if (region == nullptr) {
+        return nullptr;
+    }
+
+    const ui32 channels = image.PixelFormat == PixelFormatType::R8G8B8A8 ? 4 : 3;
+    for (ui32 y = 0; y < image.Height; ++y) {
+        const uc8 *src = image.Data + static_cast<size_t>(y) * image.Width * channels;
+        uc8 *dst = mTexture.Data + (static_cast<size_t>(region->Y + y) * mTexture.Width + region->X) * AtlasChannels;
+        if (channels == AtlasChannels) {
+            ::memcpy(dst, src, static_cast<size_t>(image.Width) * AtlasChannels);
+            continue;
+        }
+        for (ui32 x = 0; x < image.Width; ++x, src += channels, dst += AtlasChannels) {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 255;
+        }
+    }
+    extrudeBorder(*region);
+
+    return region;
+}
+
+const AtlasRegion *TextureAtlas::addSolid(const String &name, ui32 width, ui32 height, const Color4 &color) {
+    const AtlasRegion *found = find(name);
+    if (found != nullptr) {
+        return found;
+    }
+
+    AtlasRegion *region = allocate(name, width, height);
+    if (region == nullptr) {
+        return nullptr;
+    }
+
+    uc8 texel[AtlasChannels];
+    for (ui32 i = 0; i < AtlasChannels; ++i) {
+        texel[i] = static_cast<uc8>(std::clamp(color[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+    for (ui32 y = 0; y < height; ++y) {
+        uc8 *dst = mTexture.Data + (static_cast<size_t>(region->Y + y) * mTexture.Width + region->X) * AtlasChannels;
+        for (ui32 x = 0; x < width; ++x, dst += AtlasChannels) {
+            ::memcpy(dst, texel, AtlasChannels);
+        }
+    }
+    extrudeBorder(*region);
+
+    return region;
+}
+
+const AtlasRegion *TextureAtlas::find(const String &name) const {
+    auto it = mRegions.find(name);
+    if (it == mRegions.end()) {
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+f32 TextureAtlas::getEfficiency() const {
+    const ui32 usedHeight = mPacker.getUsedHeight();
+    if (usedHeight == 0) {
+        return 0.0f;
+    }
+
+    return static_cast<f32>(static_cast<d32>(mImageTexels) / (static_cast<d32>(mTexture.Width) * usedHeight));
+}
+
+AtlasRegion *TextureAtlas::allocate(const String &name, ui32 width, ui32 height) {
+    if (name.empty() || width == 0 || height == 0) {
+        return nullptr;
+    }
+
+    ui32 x = 0, y = 0;
+    if (!mPacker.insert(width + 2 * mPadding, height + 2 * mPadding, x, y)) {
+        osre_debug(Tag, "Atlas " + mTexture.TextureName + " is full, cannot add " + name + ".");
+        return nullptr;
+    }
+
+    AtlasRegion &region = mRegions[name];
+    region.X = x + mPadding;
+    region.Y = y + mPadding;
+    region.Width = width;
+    region.Height = height;
+    const f32 invWidth = 1.0f / static_cast<f32>(mTexture.Width);
+    const f32 invHeight = 1.0f / static_cast<f32>(mTexture.Height);
+    region.UV0 = glm::vec2(region.X * invWidth, region.Y * invHeight);
+    region.UV1 = glm::vec2((region.X + width) * invWidth, (region.Y + height) * invHeight);
+    mImageTexels += static_cast<ui64>(width) * height;
+    mDirty = true;
+
+    return &region;
+}
+
+void TextureAtlas::extrudeBorder(const AtlasRegion &region) {
+    if (mPadding == 0) {
+        return;
+    }
+
+    // Repeat the edge columns first, then the edge rows including the corners
+    const size_t stride = static_cast<size_t>(mTexture.Width) * AtlasChannels;
+    const size_t left = static_cast<size_t>(region.X) * AtlasChannels;
+    const size_t right = static_cast<size_t>(region.X + region.Width - 1) * AtlasChannels;
+    for (ui32 y = region.Y; y < region.Y + region.Height; ++y) {
+        uc8 *row = mTexture.Data + y * stride;
+        for (ui32 i = 1; i <= mPadding; ++i) {
+            ::memcpy(row + left - i * AtlasChannels, row + left, AtlasChannels);
+            ::memcpy(row + right + i * AtlasChannels, row + right, AtlasChannels);
+        }
+    }
+
+    const size_t start = left - static_cast<size_t>(mPadding) * AtlasChannels;
+    const size_t span = static_cast<size_t>(region.Width + 2 * mPadding) * AtlasChannels;
+    const uc8 *first = mTexture.Data + region.Y * stride + start;
+    const uc8 *last = mTexture.Data + (region.Y + region.Height - 1) * stride + start;
+    for (ui32 i = 1; i <= mPadding; ++i) {
+        ::memcpy(mTexture.Data + (region.Y - i) * stride + start, first, span);
+        ::memcpy(mTexture.Data + (region.Y + region.Height - 1 + i) * stride + start, last, span);
+    }
+}
+
+} // namespace OSRE::RenderBackend
@@ -0,0 +1,198 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+#include "RenderBackend/RenderCommon.h"
+
+#include <map>
+#include <vector>
+
+namespace OSRE::RenderBackend {
+
+/// @brief  Describes one image packed into a texture atlas.
+struct AtlasRegion {
+    ui32 X = 0;                     ///< The x position in texels, padding excluded.
+    ui32 Y = 0;                     ///< The y position in texels, padding excluded.
+    ui32 Width = 0;                 ///< The width in texels.
+    ui32 Height = 0;                ///< The height in texels.
+    glm::vec2 UV0 = glm::vec2(0);   ///< The lower texture coordinate.
+    glm::vec2 UV1 = glm::vec2(0);   ///< The upper texture coordinate.
+
+    /// @brief  Will map a texture coordinate of the source image into the atlas.
+    /// @param[in] uv   The texture coordinate of the source image.
+    /// @return The texture coordinate in the atlas.
+    glm::vec2 map(const glm::vec2 &uv) const {
+        return UV0 + uv * (UV1 - UV0);
+    }
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  A skyline bottom-left rectangle packer.
+///
+/// The packer keeps the upper outline of all placed rectangles as a list of horizontal segments.
+/// A new rectangle is placed on the segment where its top edge ends lowest, ties are broken by
+/// the narrower segment.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT SkylinePacker {
+public:
+    /// @brief  The class constructor.
+    /// @param[in] width    The width of the packing area.
+    /// @param[in] height   The height of the packing area.
+    SkylinePacker(ui32 width, ui32 height);
+
+    /// @brief  The class destructor.
+    ~SkylinePacker() = default;
+
+    /// @brief  Will remove all placed rectangles.
+    void reset();
+
+    /// @brief  Will place a rectangle.
+    /// @param[in]  width   The width of the rectangle.
+    /// @param[in]  height  The height of the rectangle.
+    /// @param[out] x       The x position of the placed rectangle.
+    /// @param[out] y       The y position of the placed rectangle.
+    /// @return true if the rectangle was placed, false if it does not fit anymore.
+    bool insert(ui32 width, ui32 height, ui32 &x, ui32 &y);
+
+    /// @brief  Will return the highest point of the skyline.
+    /// @return The used height.
+    ui32 getUsedHeight() const;
+
+    /// @brief  Will return the area of all placed rectangles.
+    /// @return The used area.
+    ui64 getUsedArea() const;
+
+    /// @brief  Will return the placed area divided by the area below the highest point of the skyline.
+    /// @return The packing efficiency between 0 and 1.
+    f32 getEfficiency() const;
+
+private:
+    struct Segment {
+        ui32 X;
+        ui32 Y;
+        ui32 Width;
+    };
+
+    bool fits(size_t index, ui32 width, ui32 height, ui32 &y) const;
+
+    ui32 mWidth;
+    ui32 mHeight;
+    ui64 mUsedArea;
+    std::vector<Segment> mSkyline;
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class merges small images into one RGBA texture.
+///
+/// Every image is stored with a border of extruded edge texels, so bilinear filtering at the
+/// region edges does not pick up texels of the neighbour. Callers remap the texture coordinates
+/// of their geometry with AtlasRegion::map. The atlas texture is marked dirty on every change
+/// and has to be uploaded again before it is used for rendering.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT TextureAtlas {
+public:
+    /// @brief  The class constructor.
+    /// @param[in] name     The name of the atlas texture.
+    /// @param[in] width    The width of the atlas texture.
+    /// @param[in] height   The height of the atlas texture.
+    /// @param[in] padding  The border around every image in texels.
+    TextureAtlas(const String &name, ui32 width, ui32 height, ui32 padding = 1);
+
+    /// @brief  The class destructor.
+    ~TextureAtlas() = default;
+
+    /// @brief  Will copy the first mip level of an uncompressed RGB or RGBA image into the atlas.
+    /// @param[in] name     The name to look up the region.
+    /// @param[in] image    The image.
+    /// @return The region, nullptr if the image is not supported or the atlas is full.
+    const AtlasRegion *add(const String &name, const Texture &image);
+
+    /// @brief  Will add a region filled with one color.
+    /// @param[in] name     The name to look up the region.
+    /// @param[in] width    The width of the region.
+    /// @param[in] height   The height of the region.
+    /// @param[in] color    The fill color.
+    /// @return The region, nullptr if the atlas is full.
+    const AtlasRegion *addSolid(const String &name, ui32 width, ui32 height, const Color4 &color);
+
+    /// @brief  Will look for a region.
+    /// @param[in] name     The name of the region.
+    /// @return The region, nullptr if there is no region with this name.
+    const AtlasRegion *find(const String &name) const;
+
+    /// @brief  Will return the number of regions.
+    /// @return The number of regions.
+    size_t getNumRegions() const;
+
+    /// @brief  Will return the atlas texture.
+    /// @return The atlas texture.
+    Texture *getTexture();
+
+    /// @brief  Will return the image texels divided by the texels below the highest packed row.
+    /// @return The packing efficiency between 0 and 1.
+    f32 getEfficiency() const;
+
+    /// @brief  Will return true, if the texture was changed since the last call of setClean.
+    /// @return The dirty flag.
+    bool isDirty() const;
+
+    /// @brief  Will clear the dirty flag, call this after uploading the texture.
+    void setClean();
+
+private:
+    AtlasRegion *allocate(const String &name, ui32 width, ui32 height);
+    void extrudeBorder(const AtlasRegion &region);
+
+    OSRE_NON_COPYABLE(TextureAtlas)
+
+private:
+    Texture mTexture;
+    SkylinePacker mPacker;
+    ui32 mPadding;
+    ui64 mImageTexels;
+    std::map<String, AtlasRegion> mRegions;
+    bool mDirty;
+};
+
+inline size_t TextureAtlas::getNumRegions() const {
+    return mRegions.size();
+}
+
+inline Texture *TextureAtlas::getTexture() {
+    return &mTexture;
+}
+
+inline bool TextureAtlas::isDirty() const {
+    return mDirty;
+}
+
+inline void TextureAtlas::setClean() {
+    mDirty = false;
+}
+
+} // namespace OSRE::RenderBackend
@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "Debugging/osre_debugging.h"
 #include "Common/BaseMath.h"
+#include "Profiling/FrameStatistics.h"
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/Pipeline.h"
 #include "RenderBackend/RenderBackendService.h"
@@ -108,6 +109,17 @@ void DbgRenderer::renderDbgText(ui32 x, ui32 y, guid id, const String &text) {
     mRbSrv->endPass();
 }
 
+void DbgRenderer::renderFrameStatistics(ui32 x, ui32 y) {
+    static constexpr guid FrameStatisticsTextId = 0xf5a7f5a7u;
+
+    const Profiling::FrameStatistics *frameStatistics = Profiling::FrameStatistics::getInstance();
+    if (frameStatistics == nullptr) {
+        return;
+    }
+
+    renderDbgText(x, y, FrameStatisticsTextId, frameStatistics->getSummaryText());
+}
+
 static constexpr size_t NumIndices = 24;
 
 static ui16 indices[NumIndices] = {
@@ -42,6 +42,7 @@ class OSRE_EXPORT DbgRenderer {
 public:
     void render();
     void renderDbgText(ui32 x, ui32 y, guid id, const String &text);
+    void renderFrameStatistics(ui32 x, ui32 y);
     void renderAABB(const glm::mat4 &transform, const Common::AABB &aabb);
     void clear();
     void addLine(const RenderBackend::ColorVert &v0, const RenderBackend::ColorVert &v1);
@@ -52,6 +52,46 @@ static void addMaterialParameter(Material *mat) {
 
 static constexpr c8 Render2DMat[] = "2d_mat";
 
+// The texture is modulated by the vertex color, used for text and the 2D texture atlas
+static void addTexturedColorShader(Material *mat) {
+    const String vertex_2d =
+            getDefaultGLSLVersion() +
+            getGLSLRenderVertexLayout() +
+            "out vec3 v_color0;\n"
+            "out vec2 v_texindex;\n"
+            "uniform mat4 Model;\n"
+            "uniform mat4 View;\n"
+            "uniform mat4 Projection;\n"
+            "void main() {\n"
+            "    v_color0 = color0;\n"
+            "    mat4 mvp = Projection * View * Model;\n"
+            "    gl_Position = mvp * vec4(position, 1.0);\n"
+            "    v_texindex = texcoord0;\n"
+            "}\n";
+
+    const String fragment_2d =
+            getDefaultGLSLVersion() +
+            "in vec3 v_color0;\n"
+            "in vec2 v_texindex;\n"
+            "out vec4 frag_color;\n"
+            "uniform sampler2D u_texture;\n"
+            "void main() {\n"
+            "    frag_color = texture(u_texture, v_texindex) * vec4(v_color0, 1.0);\n"
+            "}\n";
+
+    ShaderSourceArray shArray;
+    shArray[static_cast<size_t>(ShaderType::SH_VertexShaderType)] = vertex_2d;
+    shArray[static_cast<size_t>(ShaderType::SH_FragmentShaderType)] = fragment_2d;
+    mat->createShader("textshader", shArray);
+
+    // Setup shader attributes and variables
+    if (mat->hasShader()) {
+        Shader *shader = mat->getShader();
+        shader->addVertexAttributes(RenderVert::getAttributes(), RenderVert::getNumAttributes());
+        addMaterialParameter(mat);
+    }
+}
+
 Material *MaterialBuilder::create2DMaterial() {
     MaterialCache *materialCache = sData->mMaterialCache;
     Material *mat = materialCache->find(Render2DMat);
@@ -120,6 +160,7 @@ Material *MaterialBuilder::createTextMaterial(const String &fontName) {
     mat = materialCache->create(fontMatName);
     TextureResource *texRes = new TextureResource(fontName, IO::Uri(fontName));
 
+    // Glyph sheets stay uncompressed, block compression would blur the glyph edges
     TextureLoader loader;
     auto state = texRes->load(loader);
     if (state == Common::ResourceState::Loaded) {
@@ -127,43 +168,27 @@ Material *MaterialBuilder::createTextMaterial(const String &fontName) {
         mat->setTextureStage(0, texRes->getRes());
     }
 
-    const String vertex_2d =
-            getDefaultGLSLVersion() +
-            getGLSLRenderVertexLayout() +
-            "out vec3 v_color0;\n"
-            "out vec2 v_texindex;\n"
-            "uniform mat4 Model;\n"
-            "uniform mat4 View;\n"
-            "uniform mat4 Projection;\n"
-            "void main() {\n"
-            "    v_color0 = color0;\n"
-            "    mat4 mvp = Projection * View * Model;\n"
-            "    gl_Position = mvp * vec4(position, 1.0);\n"
-            "    v_texindex = texcoord0;\n"
-            "}\n";
+    addTexturedColorShader(mat);
 
-    const String fragment_2d =
-            getDefaultGLSLVersion() +
-            "in vec3 v_color0;\n"
-            "in vec2 v_texindex;\n"
-            "out vec4 frag_color;\n"
-            "uniform sampler2D u_texture;\n"
-            "void main() {\n"
-            "    frag_color = texture(u_texture, v_texindex) * vec4(v_color0, 1.0);\n"
-            "}\n";
+    return mat;
+}
 
-    ShaderSourceArray shArray;
-    shArray[static_cast<size_t>(ShaderType::SH_VertexShaderType)] = vertex_2d;
-    shArray[static_cast<size_t>(ShaderType::SH_FragmentShaderType)] = fragment_2d;
-    mat->createShader("textshader", shArray);
+Material *MaterialBuilder::createTextureAtlasMaterial(const String &matName, Texture *atlasTexture) {
+    if (matName.empty() || atlasTexture == nullptr) {
+        return nullptr;
+    }
 
-    // Setup shader attributes and variables
-    if (mat->hasShader()) {
-        Shader *shader = mat->getShader();
-        shader->addVertexAttributes(RenderVert::getAttributes(), RenderVert::getNumAttributes());
-        addMaterialParameter(mat);
+    MaterialCache *materialCache = sData->mMaterialCache;
+    Material *mat = materialCache->find(matName);
+    if (nullptr != mat) {
+        return mat;
     }
 
+    mat = materialCache->create(matName);
+    mat->createTextures(1);
+    mat->setTextureStage(0, atlasTexture);
+    addTexturedColorShader(mat);
+
     return mat;
 }
 
@@ -200,9 +225,10 @@ const String GLSLFsSrc =
         "    vFragColor = vSmoothColor;\n"
         "}\n";
 
-const String GLSLVertexShaderSrcRV =
-        getDefaultGLSLVersion() +
-        "\n" + getGLSLRenderVertexLayout() +
+// The vertex layout declares the inputs, the normal expression decodes the object space normal
+static String getGLSLRenderVertexShaderSrc(const String &vertexLayout, const String &normal) {
+    return getDefaultGLSLVersion() +
+        "\n" + vertexLayout +
         getNewLine() +
         "out vec3 position_eye, normal_eye;\n"
         "// output from the vertex shader\n"
@@ -225,7 +251,7 @@ const String GLSLVertexShaderSrcRV =
         "void main()\n"
         "{\n"
         "    position_eye = vec3(View * Model * vec4(position, 1.0));\n"
-        "    normal_eye = vec3(View * Model * vec4(normal, 0.0));\n"
+        "    normal_eye = vec3(View * Model * vec4(" + normal + ", 0.0));\n"
         "    vec3 Ia = La * Ka;\n"
         "    // get the clip space position by multiplying the combined MVP matrix with the object space\n"
         "    vec3 light_position_eye = vec3(View * vec4(light_pos, 1.0));\n"
@@ -250,6 +276,12 @@ const String GLSLVertexShaderSrcRV =
         "    vSmoothColor = vec4(Is + Id + Ia, 1.0) * intensity;\n"
         "    vUV = texcoord0;\n"
         "}\n";
+}
+
+const String GLSLVertexShaderSrcRV = getGLSLRenderVertexShaderSrc(getGLSLRenderVertexLayout(), "normal");
+
+const String GLSLVertexShaderSrcCompressedRV =
+        getGLSLRenderVertexShaderSrc(getGLSLCompressedRenderVertexLayout(), "decodeOctNormal(normal)");
 
 const String GLSLFragmentShaderSrcRV =
         getDefaultGLSLVersion() +
@@ -272,12 +304,13 @@ const String GLSLFragmentShaderSrcRV =
         "        frag_color = vSmoothColor;\n"
         "}\n";
 
-void MaterialBuilder::create(GLSLVersion glslVersion) {
+void MaterialBuilder::create(GLSLVersion glslVersion, TextureDecoder *decoder) {
     if (nullptr == sData) {
         sData = new Data;
         sData->mMaterialCache = new MaterialCache;
         sData->mVersion = glslVersion;
         sData->mShaderCache = new ShaderCache;
+        sData->mTextureDecoder = decoder;
     }
 }
 
@@ -308,9 +341,10 @@ Material *MaterialBuilder::createBuildinMaterial(const String &matName, const Te
         if (texRes == nullptr) {
             continue;
         }
-        TextureLoader loader;
+        TextureLoader loader(sData->mTextureDecoder);
+        // A texture still decoding is bound, the render back-end uses the default texture meanwhile
         Common::ResourceState state = texRes->load(loader);
-        if (state != Common::ResourceState::Loaded) {
+        if (state != Common::ResourceState::Loaded && state != Common::ResourceState::Loading) {
             osre_error(Tag, "Cannot load texture: " + texRes->getUri().getResource());
             mat->setTextureStage(i, nullptr);
         } else {
@@ -327,6 +361,10 @@ Material *MaterialBuilder::createBuildinMaterial(const String &matName, const Te
         vs = GLSLVertexShaderSrcRV;
         fs = GLSLFragmentShaderSrcRV;
         shaderName = "buildinShaderRenderVert.sh";
+    } else if (type == VertexType::CompressedRenderVertex) {
+        vs = GLSLVertexShaderSrcCompressedRV;
+        fs = GLSLFragmentShaderSrcRV;
+        shaderName = "buildinShaderCompressedRenderVert.sh";
     }
 
     if (vs.empty() || fs.empty()) {
@@ -355,7 +393,7 @@ Material *MaterialBuilder::createBuildinMaterial(const String &matName, const Te
         Shader *shader = mat->getShader();
         if (type == VertexType::ColorVertex) {
             shader->addVertexAttributes(ColorVert::getAttributes(), ColorVert::getNumAttributes());
-        } else if (type == VertexType::RenderVertex) {
+        } else if (type == VertexType::RenderVertex || type == VertexType::CompressedRenderVertex) {
             shader->addVertexAttributes(RenderVert::getAttributes(), RenderVert::getNumAttributes());
         }
 
@@ -42,7 +42,8 @@ public:
 
     /// @brief Will create the material builder instance.
     /// @param[in] glslVersion      The requested glsl version.
-    static void create(GLSLVersion glslVersion);
+    /// @param[in] decoder          The decoder to load textures in the background, nullptr to load synchronously.
+    static void create(GLSLVersion glslVersion, TextureDecoder *decoder = nullptr);
 
     /// @brief Will destroy the material builder instance.
     static void destroy();
@@ -61,6 +62,12 @@ public:
     /// @return The instance of the material.
     static Material *createTextMaterial(const String &fontName);
 
+    /// @brief  Will create the material for a 2D texture atlas, the atlas is modulated by the vertex color.
+    /// @param[in] matName          The name of the material.
+    /// @param[in] atlasTexture     The atlas texture, owned by the caller.
+    /// @return The instance of the material.
+    static Material *createTextureAtlasMaterial(const String &matName, Texture *atlasTexture);
+
 private:
     /// @brief The default class constructor.
     MaterialBuilder() = default;
@@ -73,8 +80,9 @@ private:
         GLSLVersion mVersion;
         MaterialCache *mMaterialCache;
         ShaderCache *mShaderCache;
+        TextureDecoder *mTextureDecoder;
 
-        Data() : mVersion(GLSLVersion::GLSL_400), mMaterialCache(nullptr), mShaderCache(nullptr) {
+        Data() : mVersion(GLSLVersion::GLSL_400), mMaterialCache(nullptr), mShaderCache(nullptr), mTextureDecoder(nullptr) {
             // empty
         }
 
@@ -41,18 +41,43 @@ Mesh::Mesh(const String &name, VertexType vertexType, IndexType indextype) :
         mModel(1.0f),
         mMaterial(nullptr),
         mVertexType(vertexType),
+        mVertexLayout(nullptr),
+        mHasDequantMatrix(false),
+        mDequant(1.0f),
         mVertexBuffer(nullptr),
         mIndexType(indextype),
         mIndexBuffer(nullptr),
         mId(99999999),
-        mLastIndex(0) {
+        mLastIndex(0),
+        mLods(),
+        mActiveLod(0) {
     mId = s_Ids.getUniqueId();
 }
 
 Mesh::~Mesh() {
+    for (size_t i = 0; i < mLods.size(); ++i) {
+        delete mLods[i];
+    }
+    if (mVertexLayout != nullptr) {
+        mVertexLayout->clear();
+        delete mVertexLayout;
+    }
     s_Ids.releaseId(mId);
 }
 
+// The mesh takes the ownership of the layout
+void Mesh::setVertexLayout(VertexLayout *layout) {
+    if (layout == mVertexLayout) {
+        return;
+    }
+
+    if (mVertexLayout != nullptr) {
+        mVertexLayout->clear();
+        delete mVertexLayout;
+    }
+    mVertexLayout = layout;
+}
+
 void *Mesh::mapVertexBuffer(size_t vbSize, BufferAccessType accessType) {
     mVertexBuffer = BufferData::alloc(BufferType::VertexBuffer, vbSize, accessType);
     return mVertexBuffer->getData();
@@ -121,6 +146,28 @@ size_t Mesh::getVertexSize(VertexType vertextype) {
     return vertexSize;
 }
 
+size_t Mesh::getIndexSize(IndexType indextype) {
+    size_t indexSize = 0;
+    switch (indextype) {
+        case IndexType::UnsignedByte:
+            indexSize = sizeof(uc8);
+            break;
+
+        case IndexType::UnsignedShort:
+            indexSize = sizeof(ui16);
+            break;
+
+        case IndexType::UnsignedInt:
+            indexSize = sizeof(ui32);
+            break;
+
+        default:
+            break;
+    }
+
+    return indexSize;
+}
+
 void Mesh::addPrimitiveGroups(size_t numPrimGroups, size_t *numIndices, PrimitiveType *primTypes, ui32 *startIndices) {
     if (0 == numPrimGroups || nullptr == numIndices || nullptr == primTypes || nullptr == startIndices) {
         return;
@@ -158,4 +205,39 @@ void Mesh::addPrimitiveGroup(PrimitiveGroup *group) {
     mPrimGroups.add(group);
 }
 
+void Mesh::clearPrimitiveGroups() {
+    for (size_t i = 0; i < mPrimGroups.size(); ++i) {
+        delete mPrimGroups[i];
+    }
+    mPrimGroups.clear();
+}
+
+// The mesh takes the ownership of the level
+void Mesh::addLod(MeshLod *lod) {
+    if (lod == nullptr) {
+        return;
+    }
+
+    if (lod->mPrimGroups.size() != mPrimGroups.size()) {
+        osre_error(Tag, "Number of primitive groups of the LOD does not match in mesh " + mName);
+        delete lod;
+        return;
+    }
+
+    mLods.add(lod);
+}
+
+size_t Mesh::selectLod(f32 screenSize) const {
+    // The levels are sorted from the highest to the lowest detail
+    size_t lod = 0;
+    for (size_t i = 0; i < mLods.size(); ++i) {
+        if (screenSize >= mLods[i]->mScreenSize) {
+            break;
+        }
+        lod = i + 1;
+    }
+
+    return lod;
+}
+
 } // namespace OSRE::RenderBackend
\ No newline at end of file
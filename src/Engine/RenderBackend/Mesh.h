@@ -33,6 +33,29 @@ namespace RenderBackend {
 // Forward declarations ---------------------------------------------------------------------------
 class Material;
 
+///	@brief  A simplified level of detail of a mesh. It stores one primitive group for each group 
+/// of the full detail level, the indices are stored in the index buffer of the mesh.
+struct MeshLod {
+    f32 mError;                                     ///< The geometric error, relative to the mesh extent.
+    f32 mScreenSize;                                ///< The projected size below which this level is used.
+    ::cppcore::TArray<PrimitiveGroup *> mPrimGroups; ///< The primitive groups of this level.
+
+    /// @brief  The default class constructor.
+    MeshLod() :
+            mError(0.0f), mScreenSize(0.0f), mPrimGroups() {
+        // empty
+    }
+
+    /// @brief  The class destructor.
+    ~MeshLod() {
+        for (size_t i = 0; i < mPrimGroups.size(); ++i) {
+            delete mPrimGroups[i];
+        }
+    }
+
+    OSRE_NON_COPYABLE(MeshLod)
+};
+
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
@@ -43,9 +66,17 @@ public:
     Mesh(const String &name, VertexType vertextype, IndexType indextype);
     ~Mesh();
     static size_t getVertexSize(VertexType vertextype);
+    static size_t getIndexSize(IndexType indextype);
     void setMaterial(Material *mat);
     Material *getMaterial() const;
     VertexType getVertexType() const;
+    void setVertexType(VertexType vertexType);
+    void setVertexLayout(VertexLayout *layout);
+    VertexLayout *getVertexLayout() const;
+    size_t getVertexStride() const;
+    void setDequantMatrix(const glm::mat4 &dequant);
+    bool hasDequantMatrix() const;
+    const glm::mat4 &getDequantMatrix() const;
     IndexType getIndexType() const;
     const String &getName() const;
     void *mapVertexBuffer(size_t vbSize, BufferAccessType accessType);
@@ -86,19 +117,30 @@ public:
     void addPrimitiveGroups(size_t numPrimGroups, size_t *numIndices, PrimitiveType *primTypes, ui32 *startIndices);
     void addPrimitiveGroup(size_t numIndices, PrimitiveType primTypes, ui32 startIndex);
     void addPrimitiveGroup(PrimitiveGroup *group);
+    void clearPrimitiveGroups();
     void setLastIndex(ui32 lastIndex);
     ui32 getLastIndex() const;
+    void addLod(MeshLod *lod);
+    size_t getNumberOfLods() const;
+    const MeshLod *getLodAt(size_t index) const;
+    size_t selectLod(f32 screenSize) const;
+    void setActiveLod(size_t index);
+    size_t getActiveLod() const;
 
     OSRE_NON_COPYABLE(Mesh)
 
 private:
     using PrimGroupArray = ::cppcore::TArray<PrimitiveGroup*>;
+    using LodArray = ::cppcore::TArray<MeshLod*>;
 
     String mName;
     bool mLocalModelMatrix;
     glm::mat4 mModel;
     Material *mMaterial;
     VertexType mVertexType;
+    VertexLayout *mVertexLayout;
+    bool mHasDequantMatrix;
+    glm::mat4 mDequant;
     BufferData *mVertexBuffer;
     IndexType mIndexType;
     BufferData *mIndexBuffer;
@@ -107,6 +149,8 @@ private:
     MemoryBuffer mVertexData;
     MemoryBuffer mIndexData;
     ui32 mLastIndex;
+    LodArray mLods;
+    size_t mActiveLod;
 };
 
 inline void Mesh::setMaterial(Material *mat) {
@@ -121,6 +165,35 @@ inline VertexType Mesh::getVertexType() const {
     return mVertexType;
 }
 
+inline void Mesh::setVertexType(VertexType vertexType) {
+    mVertexType = vertexType;
+}
+
+inline VertexLayout *Mesh::getVertexLayout() const {
+    return mVertexLayout;
+}
+
+inline size_t Mesh::getVertexStride() const {
+    if (mVertexLayout != nullptr) {
+        return mVertexLayout->sizeInBytes();
+    }
+
+    return getVertexSize(mVertexType);
+}
+
+inline void Mesh::setDequantMatrix(const glm::mat4 &dequant) {
+    mHasDequantMatrix = true;
+    mDequant = dequant;
+}
+
+inline bool Mesh::hasDequantMatrix() const {
+    return mHasDequantMatrix;
+}
+
+inline const glm::mat4 &Mesh::getDequantMatrix() const {
+    return mDequant;
+}
+
 inline IndexType Mesh::getIndexType() const {
     return mIndexType;
 }
@@ -171,6 +244,26 @@ inline void Mesh::setLastIndex(ui32 lastIndex) {
     mLastIndex = lastIndex;
 }
 
+inline size_t Mesh::getNumberOfLods() const {
+    return mLods.size() + 1;
+}
+
+inline const MeshLod *Mesh::getLodAt(size_t index) const {
+    if (index == 0 || index > mLods.size()) {
+        return nullptr;
+    }
+
+    return mLods[index - 1];
+}
+
+inline void Mesh::setActiveLod(size_t index) {
+    mActiveLod = index < getNumberOfLods() ? index : 0;
+}
+
+inline size_t Mesh::getActiveLod() const {
+    return mActiveLod;
+}
+
 inline ui32 Mesh::getLastIndex() const {
     return mLastIndex;
 }
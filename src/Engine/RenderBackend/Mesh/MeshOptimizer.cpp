@@ -0,0 +1,446 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/Mesh/MeshOptimizer.h"
+#include "Common/StringUtils.h"
+#include "Debugging/osre_debugging.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace OSRE {
+namespace RenderBackend {
+
+static constexpr ui32 InvalidIndex = 0xffffffff;
+static constexpr i64 NoVertex = -1;
+
+static bool validateIndices(const ui32 *indices, size_t numIndices, size_t numVertices) {
+    if (indices == nullptr) {
+        return false;
+    }
+
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (indices[i] >= numVertices) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static glm::vec3 getPosition(const uc8 *vertices, size_t stride, ui32 index) {
+    glm::vec3 pos;
+    ::memcpy(&pos.x, &vertices[index * stride], sizeof(glm::vec3));
+    return pos;
+}
+
+IndexType MeshOptimizer::selectIndexType(size_t numVertices) {
+    return numVertices <= MaxShortIndexVertices ? IndexType::UnsignedShort : IndexType::UnsignedInt;
+}
+
+void MeshOptimizer::readIndices(const c8 *data, size_t numIndices, IndexType type, ui32 *indices) {
+    for (size_t i = 0; i < numIndices; ++i) {
+        switch (type) {
+            case IndexType::UnsignedByte:
+                indices[i] = static_cast<uc8>(data[i]);
+                break;
+            case IndexType::UnsignedShort: {
+                ui16 index = 0;
+                ::memcpy(&index, &data[i * sizeof(ui16)], sizeof(ui16));
+                indices[i] = index;
+            } break;
+            default:
+                ::memcpy(&indices[i], &data[i * sizeof(ui32)], sizeof(ui32));
+                break;
+        }
+    }
+}
+
+void MeshOptimizer::writeIndices(const ui32 *indices, size_t numIndices, IndexType type, c8 *data) {
+    for (size_t i = 0; i < numIndices; ++i) {
+        switch (type) {
+            case IndexType::UnsignedByte:
+                data[i] = static_cast<c8>(indices[i]);
+                break;
+            case IndexType::UnsignedShort: {
+                const ui16 index = static_cast<ui16>(indices[i]);
+                ::memcpy(&data[i * sizeof(ui16)], &index, sizeof(ui16));
+            } break;
+            default:
+                ::memcpy(&data[i * sizeof(ui32)], &indices[i], sizeof(ui32));
+                break;
+        }
+    }
+}
+
+VertexCacheStatistics MeshOptimizer::analyzeVertexCache(const ui32 *indices, size_t numIndices, size_t numVertices,
+        ui32 cacheSize) {
+    VertexCacheStatistics stats;
+    if (!validateIndices(indices, numIndices, numVertices) || cacheSize == 0) {
+        return stats;
+    }
+
+    // The cache time stamps start at zero, so every vertex is a miss on its first use
+    std::vector<ui32> cacheTime(numVertices, 0);
+    std::vector<bool> referenced(numVertices, false);
+    ui32 timeStamp = cacheSize + 1;
+    for (size_t i = 0; i < numIndices; ++i) {
+        const ui32 index = indices[i];
+        if (timeStamp - cacheTime[index] > cacheSize) {
+            cacheTime[index] = timeStamp++;
+            ++stats.mNumCacheMisses;
+        }
+        if (!referenced[index]) {
+            referenced[index] = true;
+            ++stats.mNumVertices;
+        }
+    }
+    stats.mNumTriangles = static_cast<ui32>(numIndices / 3);
+
+    return stats;
+}
+
+namespace {
+
+/// The working state of the Tipsify algorithm, see Sander, Nehab, Barczak: 
+/// "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw".
+struct TipsifyState {
+    std::vector<ui32> mLiveTriangles;
+    std::vector<ui32> mCacheTime;
+    std::vector<ui32> mDeadEnd;
+    std::vector<ui32> mCandidates;
+    ui32 mTimeStamp;
+    ui32 mCacheSize;
+    size_t mCursor;
+
+    i64 skipDeadEnd() {
+        while (!mDeadEnd.empty()) {
+            const ui32 vertex = mDeadEnd.back();
+            mDeadEnd.pop_back();
+            if (mLiveTriangles[vertex] > 0) {
+                return vertex;
+            }
+        }
+
+        while (mCursor < mLiveTriangles.size()) {
+            if (mLiveTriangles[mCursor] > 0) {
+                return static_cast<i64>(mCursor);
+            }
+            ++mCursor;
+        }
+
+        return NoVertex;
+    }
+
+    i64 getNextVertex() {
+        i64 best = NoVertex;
+        i64 bestPriority = -1;
+        for (ui32 vertex : mCandidates) {
+            if (mLiveTriangles[vertex] == 0) {
+                continue;
+            }
+
+            // Prefer the oldest vertex which will still be in the cache after emitting its triangles
+            i64 priority = 0;
+            const i64 age = static_cast<i64>(mTimeStamp - mCacheTime[vertex]);
+            if (age + 2 * static_cast<i64>(mLiveTriangles[vertex]) <= static_cast<i64>(mCacheSize)) {
+                priority = age;
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = vertex;
+            }
+        }
+
+        if (best == NoVertex) {
+            best = skipDeadEnd();
+        }
+
+        return best;
+    }
+};
+
+} // namespace
+
+bool MeshOptimizer::optimizeVertexCache(ui32 *indices, size_t numIndices, size_t numVertices, ui32 cacheSize) {
+    if (numIndices % 3 != 0 || cacheSize < 3 || !validateIndices(indices, numIndices, numVertices)) {
+        return false;
+    }
+
+    const size_t numTriangles = numIndices / 3;
+    TipsifyState state;
+    state.mLiveTriangles.resize(numVertices, 0);
+    state.mCacheTime.resize(numVertices, 0);
+    state.mDeadEnd.reserve(numIndices);
+    state.mTimeStamp = cacheSize + 1;
+    state.mCacheSize = cacheSize;
+    state.mCursor = 0;
+
+    // Build the vertex to triangle adjacency
+    for (size_t i = 0; i < numIndices; ++i) {
+        ++state.mLiveTriangles[indices[i]];
+    }
+    std::vector<size_t> offsets(numVertices + 1, 0);
+    for (size_t i = 0; i < numVertices; ++i) {
+        offsets[i + 1] = offsets[i] + state.mLiveTriangles[i];
+    }
+    std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+    std::vector<ui32> adjacency(numIndices);
+    for (size_t i = 0; i < numIndices; ++i) {
+        adjacency[fill[indices[i]]++] = static_cast<ui32>(i / 3);
+    }
+
+    std::vector<bool> emitted(numTriangles, false);
+    std::vector<ui32> output;
+    output.reserve(numIndices);
+    i64 current = state.skipDeadEnd();
+    while (current != NoVertex) {
+        state.mCandidates.clear();
+        for (size_t i = offsets[current]; i < offsets[current + 1]; ++i) {
+            const ui32 triangle = adjacency[i];
+            if (emitted[triangle]) {
+                continue;
+            }
+
+            for (size_t j = 0; j < 3; ++j) {
+                const ui32 vertex = indices[triangle * 3 + j];
+                output.push_back(vertex);
+                state.mDeadEnd.push_back(vertex);
+                state.mCandidates.push_back(vertex);
+                --state.mLiveTriangles[vertex];
+                if (state.mTimeStamp - state.mCacheTime[vertex] > cacheSize) {
+                    state.mCacheTime[vertex] = state.mTimeStamp++;
+                }
+            }
+            emitted[triangle] = true;
+        }
+        current = state.getNextVertex();
+    }
+    osre_assert(output.size() == numIndices);
+
+    ::memcpy(indices, output.data(), sizeof(ui32) * numIndices);
+
+    return true;
+}
+
+bool MeshOptimizer::optimizeOverdraw(ui32 *indices, size_t numIndices, const uc8 *vertices, size_t numVertices,
+        size_t stride, ui32 cacheSize) {
+    if (vertices == nullptr || stride < sizeof(glm::vec3) || numIndices % 3 != 0 || cacheSize == 0 ||
+            !validateIndices(indices, numIndices, numVertices)) {
+        return false;
+    }
+
+    // Split the triangles into clusters, a new cluster starts when a triangle misses the cache
+    // for all three vertices. Reordering these clusters does not change the cache efficiency much.
+    const size_t numTriangles = numIndices / 3;
+    std::vector<size_t> clusterStart;
+    std::vector<ui32> cacheTime(numVertices, 0);
+    ui32 timeStamp = cacheSize + 1;
+    for (size_t i = 0; i < numTriangles; ++i) {
+        ui32 misses = 0;
+        for (size_t j = 0; j < 3; ++j) {
+            const ui32 index = indices[i * 3 + j];
+            if (timeStamp - cacheTime[index] > cacheSize) {
+                cacheTime[index] = timeStamp++;
+                ++misses;
+            }
+        }
+        if (i == 0 || misses == 3) {
+            clusterStart.push_back(i);
+        }
+    }
+    if (clusterStart.size() < 2) {
+        return true;
+    }
+    clusterStart.push_back(numTriangles);
+
+    glm::vec3 meshCenter(0.0f);
+    for (size_t i = 0; i < numIndices; ++i) {
+        meshCenter += getPosition(vertices, stride, indices[i]);
+    }
+    meshCenter /= static_cast<f32>(numIndices);
+
+    // Sort the clusters by the distance of the cluster plane to the mesh center, outer clusters first
+    const size_t numClusters = clusterStart.size() - 1;
+    std::vector<f32> sortKeys(numClusters, 0.0f);
+    for (size_t cluster = 0; cluster < numClusters; ++cluster) {
+        glm::vec3 center(0.0f), normal(0.0f);
+        f32 area = 0.0f;
+        for (size_t i = clusterStart[cluster]; i < clusterStart[cluster + 1]; ++i) {
+            const glm::vec3 p0 = getPosition(vertices, stride, indices[i * 3]);
+            const glm::vec3 p1 = getPosition(vertices, stride, indices[i * 3 + 1]);
+            const glm::vec3 p2 = getPosition(vertices, stride, indices[i * 3 + 2]);
+            const glm::vec3 n = glm::cross(p1 - p0, p2 - p0);
+            const f32 triArea = glm::length(n);
+            center += (p0 + p1 + p2) * (triArea / 3.0f);
+            normal += n;
+            area += triArea;
+        }
+        const f32 normalLength = glm::length(normal);
+        if (area > 0.0f && normalLength > 0.0f) {
+            center /= area;
+            sortKeys[cluster] = glm::dot(center - meshCenter, normal / normalLength);
+        }
+    }
+
+    std::vector<size_t> order(numClusters);
+    for (size_t i = 0; i < numClusters; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](size_t lhs, size_t rhs) {
+        return sortKeys[lhs] > sortKeys[rhs];
+    });
+
+    std::vector<ui32> output;
+    output.reserve(numIndices);
+    for (size_t cluster : order) {
+        output.insert(output.end(), indices + clusterStart[cluster] * 3, indices + clusterStart[cluster + 1] * 3);
+    }
+    ::memcpy(indices, output.data(), sizeof(ui32) * numIndices);
+
+    return true;
+}
+
+size_t MeshOptimizer::optimizeVertexFetch(uc8 *vertices, size_t numVertices, size_t stride, ui32 *indices,
+        size_t numIndices) {
+    if (vertices == nullptr || stride == 0 || !validateIndices(indices, numIndices, numVertices)) {
+        return 0;
+    }
+
+    std::vector<ui32> remap(numVertices, InvalidIndex);
+    ui32 nextVertex = 0;
+    for (size_t i = 0; i < numIndices; ++i) {
+        ui32 &index = indices[i];
+        if (remap[index] == InvalidIndex) {
+            remap[index] = nextVertex++;
+        }
+        index = remap[index];
+    }
+    const size_t numReferenced = nextVertex;
+
+    // Keep the unreferenced vertices, other users of the buffer may still need them
+    for (size_t i = 0; i < numVertices; ++i) {
+        if (remap[i] == InvalidIndex) {
+            remap[i] = nextVertex++;
+        }
+    }
+
+    std::vector<uc8> source(vertices, vertices + numVertices * stride);
+    for (size_t i = 0; i < numVertices; ++i) {
+        ::memcpy(&vertices[remap[i] * stride], &source[i * stride], stride);
+    }
+
+    return numReferenced;
+}
+
+// FNV-1a over the raw vertex data
+static ui64 hashVertex(const uc8 *vertex, size_t stride) {
+    return Common::StringUtils::fnv1a64(vertex, stride);
+}
+
+size_t MeshOptimizer::weldVertices(uc8 *vertices, size_t numVertices, size_t stride, ui32 *indices, size_t numIndices) {
+    if (vertices == nullptr || stride == 0 || !validateIndices(indices, numIndices, numVertices)) {
+        return 0;
+    }
+
+    // Open addressing table with the unique vertex index per slot
+    size_t tableSize = 1;
+    while (tableSize < numVertices * 2) {
+        tableSize <<= 1;
+    }
+    std::vector<ui32> table(tableSize, InvalidIndex);
+    std::vector<ui32> remap(numVertices, InvalidIndex);
+    ui32 numUnique = 0;
+    for (size_t i = 0; i < numVertices; ++i) {
+        const uc8 *vertex = &vertices[i * stride];
+        size_t slot = static_cast<size_t>(hashVertex(vertex, stride)) & (tableSize - 1);
+        while (table[slot] != InvalidIndex && ::memcmp(&vertices[table[slot] * stride], vertex, stride) != 0) {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (table[slot] == InvalidIndex) {
+            // Unique vertices are only moved towards the front, so the source is never overwritten
+            if (numUnique != i) {
+                ::memcpy(&vertices[numUnique * stride], vertex, stride);
+            }
+            table[slot] = numUnique++;
+        }
+        remap[i] = table[slot];
+    }
+
+    for (size_t i = 0; i < numIndices; ++i) {
+        indices[i] = remap[indices[i]];
+    }
+
+    return numUnique;
+}
+
+bool MeshOptimizer::splitIndexRanges(const ui32 *indices, size_t numIndices, ui32 primitiveSize, size_t maxVertices,
+        cppcore::TArray<ui32> &vertexRemap, ui32 *rangeIndices, cppcore::TArray<IndexRange> &ranges) {
+    if (indices == nullptr || rangeIndices == nullptr || primitiveSize == 0 || maxVertices < primitiveSize ||
+            numIndices % primitiveSize != 0) {
+        return false;
+    }
+
+    std::unordered_map<ui32, ui32> localIndices;
+    IndexRange range;
+    range.mBaseVertex = vertexRemap.size();
+    for (size_t i = 0; i < numIndices; i += primitiveSize) {
+        size_t numNew = 0;
+        for (ui32 j = 0; j < primitiveSize; ++j) {
+            if (localIndices.find(indices[i + j]) == localIndices.end()) {
+                ++numNew;
+            }
+        }
+
+        // Start a new range, when the primitive does not fit into the current one
+        if (localIndices.size() + numNew > maxVertices) {
+            ranges.add(range);
+            localIndices.clear();
+            range.mStartIndex = i;
+            range.mNumIndices = 0;
+            range.mBaseVertex = vertexRemap.size();
+        }
+
+        for (ui32 j = 0; j < primitiveSize; ++j) {
+            const ui32 index = indices[i + j];
+            auto it = localIndices.find(index);
+            if (it == localIndices.end()) {
+                it = localIndices.emplace(index, static_cast<ui32>(localIndices.size())).first;
+                vertexRemap.add(index);
+            }
+            rangeIndices[i + j] = it->second;
+        }
+        range.mNumIndices += primitiveSize;
+    }
+
+    if (range.mNumIndices > 0) {
+        ranges.add(range);
+    }
+
+    return true;
+}
+
+} // namespace RenderBackend
+} // namespace OSRE
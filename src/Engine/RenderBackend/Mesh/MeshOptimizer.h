@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+#include "RenderBackend/RenderCommon.h"
+
+#include <cppcore/Container/TArray.h>
+
+namespace OSRE {
+namespace RenderBackend {
+
+/// @brief  The vertex cache statistics of an index buffer.
+struct VertexCacheStatistics {
+    ui32 mNumTriangles;     ///< The number of triangles.
+    ui32 mNumVertices;      ///< The number of referenced vertices.
+    ui32 mNumCacheMisses;   ///< The number of simulated cache misses.
+
+    /// @brief  The default class constructor.
+    VertexCacheStatistics() :
+            mNumTriangles(0), mNumVertices(0), mNumCacheMisses(0) {
+        // empty
+    }
+
+    /// @brief  Will return the average cache miss ratio, cache misses per triangle.
+    /// @return The ACMR, 0.5 is the best possible value for a regular grid.
+    f32 getACMR() const {
+        return mNumTriangles == 0 ? 0.0f : static_cast<f32>(mNumCacheMisses) / static_cast<f32>(mNumTriangles);
+    }
+
+    /// @brief  Will return the average transformed vertex ratio, cache misses per vertex.
+    /// @return The ATVR, 1.0 is the best possible value.
+    f32 getATVR() const {
+        return mNumVertices == 0 ? 0.0f : static_cast<f32>(mNumCacheMisses) / static_cast<f32>(mNumVertices);
+    }
+};
+
+/// @brief  A range of indices, which can be addressed by 16-bit indices relative to a base vertex.
+struct IndexRange {
+    size_t mStartIndex;     ///< The first index of the range.
+    size_t mNumIndices;     ///< The number of indices in the range.
+    size_t mBaseVertex;     ///< The vertex added to each index of the range.
+
+    /// @brief  The default class constructor.
+    IndexRange() :
+            mStartIndex(0), mNumIndices(0), mBaseVertex(0) {
+        // empty
+    }
+};
+
+///-----------------------------------------------------------------
+/// @class MeshOptimizer
+///
+/// @brief This class provides the optimization algorithms for indexed
+///        triangle lists: post-transform vertex cache ordering (Tipsify),
+///        overdraw reduction by cluster sorting and vertex fetch ordering.
+///        Identical vertices can be welded and large meshes can be split
+///        into ranges addressable by 16-bit indices.
+///        All algorithms work on 32-bit indices.
+///-----------------------------------------------------------------
+class MeshOptimizer {
+public:
+    /// @brief The default size of the simulated FIFO vertex cache.
+    static constexpr ui32 DefaultCacheSize = 16;
+
+    /// @brief The maximal number of vertices, which can be addressed by 16-bit indices.
+    static constexpr size_t MaxShortIndexVertices = 65536;
+
+    /// @brief Will return the smallest index type which can address all vertices.
+    /// @param[in] numVertices  The number of vertices.
+    /// @return UnsignedShort for up to MaxShortIndexVertices vertices, UnsignedInt else.
+    static IndexType selectIndexType(size_t numVertices);
+
+    /// @brief Will convert typed index data into 32-bit indices.
+    /// @param[in]  data        The index data.
+    /// @param[in]  numIndices  The number of indices.
+    /// @param[in]  type        The index type of the data.
+    /// @param[out] indices     The converted indices.
+    static void readIndices(const c8 *data, size_t numIndices, IndexType type, ui32 *indices);
+
+    /// @brief Will convert 32-bit indices into typed index data.
+    /// @param[in]  indices     The indices.
+    /// @param[in]  numIndices  The number of indices.
+    /// @param[in]  type        The index type of the data.
+    /// @param[out] data        The index data.
+    static void writeIndices(const ui32 *indices, size_t numIndices, IndexType type, c8 *data);
+
+    /// @brief Will simulate a FIFO vertex cache for a triangle list.
+    /// @param[in] indices      The triangle list indices.
+    /// @param[in] numIndices   The number of indices.
+    /// @param[in] numVertices  The number of vertices.
+    /// @param[in] cacheSize    The size of the simulated cache.
+    /// @return The statistics.
+    static VertexCacheStatistics analyzeVertexCache(const ui32 *indices, size_t numIndices, size_t numVertices,
+            ui32 cacheSize = DefaultCacheSize);
+
+    /// @brief Will reorder the triangles for the post-transform vertex cache.
+    /// @param[inout] indices   The triangle list indices.
+    /// @param[in] numIndices   The number of indices.
+    /// @param[in] numVertices  The number of vertices.
+    /// @param[in] cacheSize    The size of the cache to optimize for.
+    /// @return true if successful, false in case of invalid indices.
+    static bool optimizeVertexCache(ui32 *indices, size_t numIndices, size_t numVertices,
+            ui32 cacheSize = DefaultCacheSize);
+
+    /// @brief Will reorder clusters of triangles from outside to inside to reduce overdraw.
+    /// The indices must be optimized for the vertex cache before, clusters are split at
+    /// the points where the cache order is not continuous, so the cache efficiency is kept.
+    /// @param[inout] indices   The triangle list indices.
+    /// @param[in] numIndices   The number of indices.
+    /// @param[in] vertices     The vertex data, the position must be the first component.
+    /// @param[in] numVertices  The number of vertices.
+    /// @param[in] stride       The vertex stride in bytes.
+    /// @param[in] cacheSize    The size of the simulated cache.
+    /// @return true if successful, false in case of invalid indices.
+    static bool optimizeOverdraw(ui32 *indices, size_t numIndices, const uc8 *vertices, size_t numVertices,
+            size_t stride, ui32 cacheSize = DefaultCacheSize);
+
+    /// @brief Will reorder the vertices in the order of the first use by the indices.
+    /// Unreferenced vertices are moved to the end of the buffer.
+    /// @param[inout] vertices  The vertex data.
+    /// @param[in] numVertices  The number of vertices.
+    /// @param[in] stride       The vertex stride in bytes.
+    /// @param[inout] indices   The indices, will be remapped.
+    /// @param[in] numIndices   The number of indices.
+    /// @return The number of referenced vertices, 0 in case of invalid indices.
+    static size_t optimizeVertexFetch(uc8 *vertices, size_t numVertices, size_t stride, ui32 *indices,
+            size_t numIndices);
+
+    /// @brief Will weld vertices with identical data. The unique vertices are moved to the front
+    /// of the buffer in the order of their first occurrence.
+    /// @param[inout] vertices  The vertex data.
+    /// @param[in] numVertices  The number of vertices.
+    /// @param[in] stride       The vertex stride in bytes.
+    /// @param[inout] indices   The indices, will be remapped.
+    /// @param[in] numIndices   The number of indices.
+    /// @return The number of unique vertices, 0 in case of invalid indices.
+    static size_t weldVertices(uc8 *vertices, size_t numVertices, size_t stride, ui32 *indices, size_t numIndices);
+
+    /// @brief Will split a list of primitives into ranges, which reference at most maxVertices
+    /// vertices each. The vertices of each range are stored contiguously, vertices shared between
+    /// ranges are duplicated.
+    /// @param[in]  indices         The indices.
+    /// @param[in]  numIndices      The number of indices.
+    /// @param[in]  primitiveSize   The number of indices per primitive, 1 for points, 2 for lines, 3 for triangles.
+    /// @param[in]  maxVertices     The maximal number of vertices per range.
+    /// @param[inout] vertexRemap   The source vertex for each new vertex, new vertices are appended.
+    /// @param[out] rangeIndices    The indices relative to the base vertex of their range, must hold numIndices entries.
+    /// @param[inout] ranges        The ranges, new ranges are appended. The start index is relative to indices.
+    /// @return true if successful, false in case of invalid parameters.
+    static bool splitIndexRanges(const ui32 *indices, size_t numIndices, ui32 primitiveSize, size_t maxVertices,
+            cppcore::TArray<ui32> &vertexRemap, ui32 *rangeIndices, cppcore::TArray<IndexRange> &ranges);
+};
+
+} // namespace RenderBackend
+} // namespace OSRE
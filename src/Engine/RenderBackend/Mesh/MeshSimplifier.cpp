@@ -0,0 +1,372 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/Mesh/MeshSimplifier.h"
+#include "RenderBackend/Mesh/MeshOptimizer.h"
+#include "RenderBackend/Mesh.h"
+#include "Common/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace OSRE {
+namespace RenderBackend {
+
+DECL_OSRE_LOG_MODULE(MeshSimplifier)
+
+// A level must have less than this ratio of the indices of the previous level
+static constexpr f32 MinReduction = 0.9f;
+
+namespace {
+
+/// The symmetric 4x4 matrix of the summed squared distances to a set of planes.
+struct Quadric {
+    double a00, a01, a02, a03, a11, a12, a13, a22, a23, a33;
+
+    Quadric() :
+            a00(0), a01(0), a02(0), a03(0), a11(0), a12(0), a13(0), a22(0), a23(0), a33(0) {
+        // empty
+    }
+
+    void addPlane(double a, double b, double c, double d) {
+        a00 += a * a; a01 += a * b; a02 += a * c; a03 += a * d;
+        a11 += b * b; a12 += b * c; a13 += b * d;
+        a22 += c * c; a23 += c * d;
+        a33 += d * d;
+    }
+
+    void add(const Quadric &q) {
+        a00 += q.a00; a01 += q.a01; a02 += q.a02; a03 += q.a03;
+        a11 += q.a11; a12 += q.a12; a13 += q.a13;
+        a22 += q.a22; a23 += q.a23;
+        a33 += q.a33;
+    }
+
+    double evaluate(const glm::vec3 &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        const double error = a00 * x * x + 2 * a01 * x * y + 2 * a02 * x * z + 2 * a03 * x +
+                a11 * y * y + 2 * a12 * y * z + 2 * a13 * y +
+                a22 * z * z + 2 * a23 * z + a33;
+        return error > 0.0 ? error : 0.0;
+    }
+};
+
+/// A candidate for a half edge collapse, the source vertex will be moved onto the target vertex.
+struct Collapse {
+    ui32 mSource;
+    ui32 mTarget;
+    double mCost;
+};
+
+ui64 getEdgeKey(ui32 v0, ui32 v1) {
+    return v0 < v1 ? (static_cast<ui64>(v0) << 32) | v1 : (static_cast<ui64>(v1) << 32) | v0;
+}
+
+bool isDegenerated(const ui32 *tri) {
+    return tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2];
+}
+
+// Checks if moving source onto target will flip one of the remaining triangles around the source.
+bool isFlipping(const Collapse &collapse, const std::vector<glm::vec3> &positions, const ui32 *indices,
+        const std::vector<size_t> &offsets, const std::vector<ui32> &adjacency) {
+    for (size_t i = offsets[collapse.mSource]; i < offsets[collapse.mSource + 1]; ++i) {
+        const ui32 *tri = &indices[adjacency[i] * 3];
+        if (isDegenerated(tri) || tri[0] == collapse.mTarget || tri[1] == collapse.mTarget || tri[2] == collapse.mTarget) {
+            continue;
+        }
+
+        glm::vec3 p[3], q[3];
+        for (size_t j = 0; j < 3; ++j) {
+            p[j] = positions[tri[j]];
+            q[j] = tri[j] == collapse.mSource ? positions[collapse.mTarget] : p[j];
+        }
+        const glm::vec3 before = glm::cross(p[1] - p[0], p[2] - p[0]);
+        const glm::vec3 after = glm::cross(q[1] - q[0], q[2] - q[0]);
+        if (glm::dot(before, after) <= 0.0f) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+size_t MeshSimplifier::simplify(const ui32 *indices, size_t numIndices, const uc8 *vertices, size_t numVertices,
+        size_t stride, size_t targetNumIndices, f32 maxError, ui32 *result, f32 *resultError) {
+    if (indices == nullptr || vertices == nullptr || result == nullptr || numIndices % 3 != 0 || stride < sizeof(glm::vec3)) {
+        return 0;
+    }
+    for (size_t i = 0; i < numIndices; ++i) {
+        if (indices[i] >= numVertices) {
+            return 0;
+        }
+    }
+
+    ::memcpy(result, indices, sizeof(ui32) * numIndices);
+    if (resultError != nullptr) {
+        *resultError = 0.0f;
+    }
+
+    // Normalize the positions, so the error is relative to the mesh extent
+    std::vector<glm::vec3> positions(numVertices);
+    glm::vec3 minPos(0.0f), maxPos(0.0f);
+    for (size_t i = 0; i < numVertices; ++i) {
+        ::memcpy(&positions[i].x, &vertices[i * stride], sizeof(glm::vec3));
+        minPos = i == 0 ? positions[i] : glm::min(minPos, positions[i]);
+        maxPos = i == 0 ? positions[i] : glm::max(maxPos, positions[i]);
+    }
+    const glm::vec3 extent = maxPos - minPos;
+    const f32 maxExtent = std::max(extent.x, std::max(extent.y, extent.z));
+    const f32 scale = maxExtent > 0.0f ? 1.0f / maxExtent : 1.0f;
+    for (glm::vec3 &pos : positions) {
+        pos = (pos - minPos) * scale;
+    }
+
+    // Lock the vertices of border edges, these are open edges or texture seams
+    std::vector<bool> locked(numVertices, false);
+    std::unordered_map<ui64, ui32> edgeCount;
+    edgeCount.reserve(numIndices);
+    for (size_t i = 0; i < numIndices; i += 3) {
+        for (size_t j = 0; j < 3; ++j) {
+            ++edgeCount[getEdgeKey(indices[i + j], indices[i + (j + 1) % 3])];
+        }
+    }
+    for (const auto &edge : edgeCount) {
+        if (edge.second != 2) {
+            locked[static_cast<ui32>(edge.first >> 32)] = true;
+            locked[static_cast<ui32>(edge.first & 0xffffffff)] = true;
+        }
+    }
+
+    std::vector<Quadric> quadrics(numVertices);
+    for (size_t i = 0; i < numIndices; i += 3) {
+        const glm::vec3 &p0 = positions[indices[i]];
+        const glm::vec3 n = glm::cross(positions[indices[i + 1]] - p0, positions[indices[i + 2]] - p0);
+        const f32 length = glm::length(n);
+        if (length <= 0.0f) {
+            continue;
+        }
+        const glm::vec3 normal = n / length;
+        const double d = -glm::dot(normal, p0);
+        for (size_t j = 0; j < 3; ++j) {
+            quadrics[indices[i + j]].addPlane(normal.x, normal.y, normal.z, d);
+        }
+    }
+
+    const double maxCost = static_cast<double>(maxError) * static_cast<double>(maxError);
+    double reachedCost = 0.0;
+    size_t numResult = numIndices;
+    std::vector<Collapse> collapses;
+    std::vector<size_t> offsets(numVertices + 1);
+    std::vector<ui32> adjacency;
+    std::vector<bool> touched(numVertices);
+    while (numResult > targetNumIndices) {
+        // Collect the cheapest direction for each edge
+        collapses.clear();
+        for (size_t i = 0; i < numResult; i += 3) {
+            for (size_t j = 0; j < 3; ++j) {
+                const ui32 v0 = result[i + j], v1 = result[i + (j + 1) % 3];
+                const double cost0 = locked[v0] ? -1.0 : quadrics[v0].evaluate(positions[v1]);
+                const double cost1 = locked[v1] ? -1.0 : quadrics[v1].evaluate(positions[v0]);
+                if (cost0 >= 0.0 && (cost1 < 0.0 || cost0 <= cost1)) {
+                    collapses.push_back({ v0, v1, cost0 });
+                } else if (cost1 >= 0.0) {
+                    collapses.push_back({ v1, v0, cost1 });
+                }
+            }
+        }
+        std::stable_sort(collapses.begin(), collapses.end(), [](const Collapse &lhs, const Collapse &rhs) {
+            return lhs.mCost < rhs.mCost;
+        });
+
+        // Build the vertex to triangle adjacency for the flip test
+        std::fill(offsets.begin(), offsets.end(), 0);
+        for (size_t i = 0; i < numResult; ++i) {
+            ++offsets[result[i] + 1];
+        }
+        for (size_t i = 0; i < numVertices; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+        adjacency.resize(numResult);
+        std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < numResult; ++i) {
+            adjacency[fill[result[i]]++] = static_cast<ui32>(i / 3);
+        }
+
+        // Each collapse removes two triangles of a closed fan
+        const size_t trianglesToRemove = (numResult - targetNumIndices) / 3;
+        size_t removed = 0;
+        std::fill(touched.begin(), touched.end(), false);
+        for (const Collapse &collapse : collapses) {
+            if (collapse.mCost > maxCost || removed >= trianglesToRemove) {
+                break;
+            }
+            if (touched[collapse.mSource] || touched[collapse.mTarget]) {
+                continue;
+            }
+            if (isFlipping(collapse, positions, result, offsets, adjacency)) {
+                continue;
+            }
+
+            for (size_t i = offsets[collapse.mSource]; i < offsets[collapse.mSource + 1]; ++i) {
+                ui32 *tri = &result[adjacency[i] * 3];
+                for (size_t j = 0; j < 3; ++j) {
+                    if (tri[j] == collapse.mSource) {
+                        tri[j] = collapse.mTarget;
+                    }
+                }
+            }
+            quadrics[collapse.mTarget].add(quadrics[collapse.mSource]);
+            touched[collapse.mSource] = touched[collapse.mTarget] = true;
+            reachedCost = std::max(reachedCost, collapse.mCost);
+            removed += 2;
+        }
+
+        if (removed == 0) {
+            break;
+        }
+
+        // Remove the collapsed triangles
+        size_t writeIndex = 0;
+        for (size_t i = 0; i < numResult; i += 3) {
+            if (!isDegenerated(&result[i])) {
+                ::memmove(&result[writeIndex], &result[i], sizeof(ui32) * 3);
+                writeIndex += 3;
+            }
+        }
+        numResult = writeIndex;
+    }
+
+    if (resultError != nullptr) {
+        *resultError = static_cast<f32>(std::sqrt(reachedCost));
+    }
+
+    return numResult;
+}
+
+size_t MeshSimplifier::generateLodChain(Mesh *mesh, const LodChainConfig &config) {
+    if (mesh == nullptr || config.mNumLevels == 0 || config.mReduction <= 0.0f || config.mReduction >= 1.0f) {
+        return 0;
+    }
+
+    BufferData *vb = mesh->getVertexBuffer();
+    BufferData *ib = mesh->getIndexBuffer();
+    const size_t stride = Mesh::getVertexSize(mesh->getVertexType());
+    const size_t indexSize = Mesh::getIndexSize(mesh->getIndexType());
+    const size_t numGroups = mesh->getNumberOfPrimitiveGroups();
+    if (vb == nullptr || ib == nullptr || stride == 0 || indexSize == 0 || numGroups == 0) {
+        return 0;
+    }
+    if (mesh->getNumberOfLods() > 1) {
+        osre_debug(Tag, "LOD chain already generated for mesh " + mesh->getName());
+        return 0;
+    }
+
+    const size_t numVertices = vb->getSize() / stride;
+    const size_t numIndicesInBuffer = ib->getSize() / indexSize;
+    std::vector<ui32> indices(numIndicesInBuffer);
+    MeshOptimizer::readIndices(ib->getData(), numIndicesInBuffer, mesh->getIndexType(), indices.data());
+
+    // Each level is simplified from the full detail level, so the error is relative to it
+    std::vector<std::vector<ui32>> groupIndices(numGroups);
+    size_t previousIndices = 0;
+    for (size_t i = 0; i < numGroups; ++i) {
+        const PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+        if (grp->m_startIndex + grp->m_numIndices > numIndicesInBuffer) {
+            osre_error(Tag, "Invalid primitive group in mesh " + mesh->getName());
+            return 0;
+        }
+        groupIndices[i].assign(indices.begin() + grp->m_startIndex, indices.begin() + grp->m_startIndex + grp->m_numIndices);
+        previousIndices += grp->m_numIndices;
+    }
+
+    const uc8 *vertices = reinterpret_cast<const uc8 *>(vb->getData());
+    std::vector<ui32> lodIndices;
+    std::vector<c8> lodData;
+    size_t numLevels = 0;
+    f32 ratio = 1.0f, screenSize = config.mScreenSize;
+    for (ui32 level = 0; level < config.mNumLevels; ++level) {
+        ratio *= config.mReduction;
+        size_t levelIndices = 0;
+        f32 levelError = 0.0f;
+        MeshLod *lod = new MeshLod;
+        lod->mScreenSize = screenSize;
+        for (size_t i = 0; i < numGroups; ++i) {
+            const PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+            const std::vector<ui32> &base = groupIndices[i];
+            const ui32 *levelData = base.data();
+            size_t numResult = base.size();
+            if (grp->m_primitive == PrimitiveType::TriangleList && !base.empty() && grp->m_baseVertex < numVertices) {
+                const size_t target = static_cast<size_t>(static_cast<f32>(base.size() / 3) * ratio) * 3;
+                f32 error = 0.0f;
+                lodIndices.resize(base.size());
+                // The indices of 16-bit ranges are relative to the base vertex of the group
+                const size_t numSimplified = simplify(base.data(), base.size(), vertices + grp->m_baseVertex * stride,
+                        numVertices - grp->m_baseVertex, stride, target, config.mMaxError, lodIndices.data(), &error);
+                if (numSimplified != 0) {
+                    levelData = lodIndices.data();
+                    numResult = numSimplified;
+                    levelError = std::max(levelError, error);
+                }
+            }
+
+            auto *lodGrp = new PrimitiveGroup;
+            lodGrp->m_primitive = grp->m_primitive;
+            lodGrp->m_indexType = grp->m_indexType;
+            lodGrp->m_baseVertex = grp->m_baseVertex;
+            lodGrp->m_startIndex = numIndicesInBuffer + lodData.size() / indexSize;
+            lodGrp->m_numIndices = numResult;
+            lod->mPrimGroups.add(lodGrp);
+
+            const size_t offset = lodData.size();
+            lodData.resize(offset + numResult * indexSize);
+            MeshOptimizer::writeIndices(levelData, numResult, mesh->getIndexType(), &lodData[offset]);
+            levelIndices += numResult;
+        }
+
+        // Stop the chain when the simplification does not reduce the mesh any more
+        if (levelIndices == 0 || static_cast<f32>(levelIndices) > static_cast<f32>(previousIndices) * MinReduction) {
+            lodData.resize(lodData.size() - levelIndices * indexSize);
+            delete lod;
+            break;
+        }
+
+        lod->mError = levelError;
+        mesh->addLod(lod);
+        screenSize *= config.mReduction;
+        previousIndices = levelIndices;
+        ++numLevels;
+    }
+
+    if (!lodData.empty()) {
+        ib->attach(lodData.data(), lodData.size());
+    }
+
+    return numLevels;
+}
+
+} // namespace RenderBackend
+} // namespace OSRE
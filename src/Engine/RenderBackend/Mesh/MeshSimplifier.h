@@ -0,0 +1,81 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+
+namespace OSRE {
+namespace RenderBackend {
+
+// Forward declarations ---------------------------------------------------------------------------
+class Mesh;
+
+/// @brief  The description of a level of detail chain.
+struct LodChainConfig {
+    ui32 mNumLevels;    ///< The maximal number of simplified levels.
+    f32 mReduction;     ///< The triangle ratio of a level relative to the previous one.
+    f32 mMaxError;      ///< The maximal geometric error, relative to the mesh extent.
+    f32 mScreenSize;    ///< The projected size below which the first simplified level is used.
+
+    /// @brief  The default class constructor.
+    LodChainConfig() :
+            mNumLevels(3), mReduction(0.5f), mMaxError(0.02f), mScreenSize(0.5f) {
+        // empty
+    }
+};
+
+///-----------------------------------------------------------------
+/// @class MeshSimplifier
+///
+/// @brief This class implements a mesh simplifier based on quadric
+///        error metrics (Garland, Heckbert). Edges are collapsed onto
+///        existing vertices, so all levels of detail can share the
+///        vertex buffer of the original mesh. Border vertices are kept
+///        to avoid holes at open edges and texture seams.
+///-----------------------------------------------------------------
+class MeshSimplifier {
+public:
+    /// @brief Will simplify a triangle list.
+    /// @param[in]  indices             The triangle list indices.
+    /// @param[in]  numIndices          The number of indices.
+    /// @param[in]  vertices            The vertex data, the position must be the first component.
+    /// @param[in]  numVertices         The number of vertices.
+    /// @param[in]  stride              The vertex stride in bytes.
+    /// @param[in]  targetNumIndices    The requested number of indices.
+    /// @param[in]  maxError            The maximal error, relative to the mesh extent.
+    /// @param[out] result              The simplified indices, must hold numIndices entries.
+    /// @param[out] resultError         The reached error, relative to the mesh extent, optional.
+    /// @return The number of simplified indices, 0 in case of an error.
+    static size_t simplify(const ui32 *indices, size_t numIndices, const uc8 *vertices, size_t numVertices,
+            size_t stride, size_t targetNumIndices, f32 maxError, ui32 *result, f32 *resultError = nullptr);
+
+    /// @brief Will generate the level of detail chain for a mesh. The simplified indices will be
+    /// appended to the index buffer, the levels are stored in the mesh.
+    /// @param[in] mesh     The mesh, must not be uploaded to the render backend yet.
+    /// @param[in] config   The chain description.
+    /// @return The number of generated levels.
+    static size_t generateLodChain(Mesh *mesh, const LodChainConfig &config);
+};
+
+} // namespace RenderBackend
+} // namespace OSRE
@@ -0,0 +1,252 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/Mesh/VertexCompressor.h"
+#include "RenderBackend/Mesh.h"
+#include "Common/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace OSRE {
+namespace RenderBackend {
+
+DECL_OSRE_LOG_MODULE(VertexCompressor)
+
+static constexpr f32 MaxUNorm16 = 65535.0f;
+static constexpr f32 MaxSNorm16 = 32767.0f;
+static constexpr f32 MaxUNorm8 = 255.0f;
+
+static ui16 toUNorm16(f32 value) {
+    return static_cast<ui16>(std::lround(std::clamp(value, 0.0f, 1.0f) * MaxUNorm16));
+}
+
+static i16 toSNorm16(f32 value) {
+    return static_cast<i16>(std::lround(std::clamp(value, -1.0f, 1.0f) * MaxSNorm16));
+}
+
+static uc8 toUNorm8(f32 value) {
+    return static_cast<uc8>(std::lround(std::clamp(value, 0.0f, 1.0f) * MaxUNorm8));
+}
+
+static f32 signNotZero(f32 value) {
+    return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+ui16 VertexCompressor::encodeHalf(f32 value) {
+    ui32 bits = 0;
+    ::memcpy(&bits, &value, sizeof(f32));
+
+    const ui32 sign = (bits >> 16) & 0x8000u;
+    const i32 floatExponent = static_cast<i32>((bits >> 23) & 0xffu);
+    ui32 mantissa = bits & 0x7fffffu;
+
+    // Infinity and NaN
+    if (floatExponent == 0xff) {
+        return static_cast<ui16>(sign | 0x7c00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+
+    const i32 exponent = floatExponent - 127 + 15;
+    if (exponent >= 31) {
+        return static_cast<ui16>(sign | 0x7c00u);
+    }
+
+    // Subnormal half floats
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return static_cast<ui16>(sign);
+        }
+        mantissa |= 0x800000u;
+        const ui32 shift = static_cast<ui32>(14 - exponent);
+        ui32 half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1u) {
+            ++half;
+        }
+        return static_cast<ui16>(sign | half);
+    }
+
+    // A carry of the rounding moves into the exponent, which is the correct result
+    ui32 half = sign | (static_cast<ui32>(exponent) << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000u) {
+        ++half;
+    }
+
+    return static_cast<ui16>(half);
+}
+
+f32 VertexCompressor::decodeHalf(ui16 value) {
+    const ui32 sign = (static_cast<ui32>(value) & 0x8000u) << 16;
+    const ui32 exponent = (value >> 10) & 0x1fu;
+    const ui32 mantissa = value & 0x3ffu;
+
+    if (exponent == 0) {
+        const f32 result = std::ldexp(static_cast<f32>(mantissa), -24);
+        return sign != 0 ? -result : result;
+    }
+
+    ui32 bits = 0;
+    if (exponent == 31) {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+
+    f32 result = 0.0f;
+    ::memcpy(&result, &bits, sizeof(f32));
+
+    return result;
+}
+
+void VertexCompressor::encodeOctNormal(const glm::vec3 &normal, i16 &x, i16 &y) {
+    const f32 l1 = std::fabs(normal.x) + std::fabs(normal.y) + std::fabs(normal.z);
+    if (l1 <= 0.0f) {
+        x = 0;
+        y = 0;
+        return;
+    }
+
+    f32 px = normal.x / l1;
+    f32 py = normal.y / l1;
+    if (normal.z < 0.0f) {
+        const f32 fx = (1.0f - std::fabs(py)) * signNotZero(px);
+        const f32 fy = (1.0f - std::fabs(px)) * signNotZero(py);
+        px = fx;
+        py = fy;
+    }
+
+    x = toSNorm16(px);
+    y = toSNorm16(py);
+}
+
+glm::vec3 VertexCompressor::decodeOctNormal(i16 x, i16 y) {
+    glm::vec3 n(std::max(x / MaxSNorm16, -1.0f), std::max(y / MaxSNorm16, -1.0f), 0.0f);
+    n.z = 1.0f - std::fabs(n.x) - std::fabs(n.y);
+    const f32 t = std::max(-n.z, 0.0f);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+
+    const f32 len = glm::length(n);
+    if (len > 0.0f) {
+        n = n / len;
+    }
+
+    return n;
+}
+
+bool VertexCompressor::compress(Mesh *mesh, const VertexCompressionConfig &config, VertexCompressionReport *report) {
+    if (mesh == nullptr) {
+        return false;
+    }
+
+    if (mesh->getVertexType() != VertexType::RenderVertex) {
+        osre_debug(Tag, "Only render vertices can be compressed, skipping mesh " + mesh->getName());
+        return false;
+    }
+
+    BufferData *vb = mesh->getVertexBuffer();
+    if (vb == nullptr || vb->getSize() < sizeof(RenderVert)) {
+        return false;
+    }
+
+    const size_t numVertices = vb->getSize() / sizeof(RenderVert);
+    const RenderVert *vertices = reinterpret_cast<const RenderVert *>(vb->getData());
+
+    glm::vec3 minPos = vertices[0].position, maxPos = vertices[0].position;
+    bool normalizedTexCoords = true;
+    for (size_t i = 0; i < numVertices; ++i) {
+        const RenderVert &v = vertices[i];
+        minPos = glm::min(minPos, v.position);
+        maxPos = glm::max(maxPos, v.position);
+        normalizedTexCoords &= v.tex0.x >= 0.0f && v.tex0.x <= 1.0f && v.tex0.y >= 0.0f && v.tex0.y <= 1.0f;
+    }
+
+    // A uniform scale keeps the normals valid when the dequant matrix is part of the model matrix
+    const glm::vec3 size = maxPos - minPos;
+    const f32 extent = std::max(std::max(size.x, size.y), size.z);
+    const bool quantizePositions = config.mQuantizePositions && extent > 0.0f;
+    const bool unormTexCoords = config.mUNormTexCoords && normalizedTexCoords;
+
+    VertexLayout *layout = new VertexLayout;
+    layout->add(new VertComponent(VertexAttribute::Position, quantizePositions ? VertexFormat::UShort4Norm : VertexFormat::Float3))
+            .add(new VertComponent(VertexAttribute::Normal, VertexFormat::Short2Norm))
+            .add(new VertComponent(VertexAttribute::Color0, VertexFormat::UByte4Norm))
+            .add(new VertComponent(VertexAttribute::TexCoord0, unormTexCoords ? VertexFormat::UShort2Norm : VertexFormat::Half2));
+
+    const size_t stride = layout->sizeInBytes();
+    std::vector<uc8> compressed(numVertices * stride);
+    for (size_t i = 0; i < numVertices; ++i) {
+        const RenderVert &v = vertices[i];
+        uc8 *dest = &compressed[i * stride];
+
+        uc8 *pos = dest + layout->m_offsets[0];
+        if (quantizePositions) {
+            const glm::vec3 p = (v.position - minPos) / extent;
+            const ui16 q[4] = { toUNorm16(p.x), toUNorm16(p.y), toUNorm16(p.z), 0xffff };
+            ::memcpy(pos, q, sizeof(q));
+        } else {
+            ::memcpy(pos, &v.position, sizeof(glm::vec3));
+        }
+
+        i16 n[2] = {};
+        encodeOctNormal(v.normal, n[0], n[1]);
+        ::memcpy(dest + layout->m_offsets[1], n, sizeof(n));
+
+        const uc8 col[4] = { toUNorm8(v.color0.r), toUNorm8(v.color0.g), toUNorm8(v.color0.b), 0xff };
+        ::memcpy(dest + layout->m_offsets[2], col, sizeof(col));
+
+        ui16 uv[2] = {};
+        if (unormTexCoords) {
+            uv[0] = toUNorm16(v.tex0.x);
+            uv[1] = toUNorm16(v.tex0.y);
+        } else {
+            uv[0] = encodeHalf(v.tex0.x);
+            uv[1] = encodeHalf(v.tex0.y);
+        }
+        ::memcpy(dest + layout->m_offsets[3], uv, sizeof(uv));
+    }
+
+    const size_t sizeBefore = vb->getSize();
+    mesh->resizeVertexBuffer(compressed.size());
+    ::memcpy(vb->getData(), compressed.data(), compressed.size());
+    mesh->setVertexType(VertexType::CompressedRenderVertex);
+    mesh->setVertexLayout(layout);
+    if (quantizePositions) {
+        glm::mat4 dequant(1.0f);
+        dequant[0][0] = dequant[1][1] = dequant[2][2] = extent;
+        dequant[3] = glm::vec4(minPos, 1.0f);
+        mesh->setDequantMatrix(dequant);
+    }
+
+    if (report != nullptr) {
+        report->mNumMeshes++;
+        report->mNumVertices += numVertices;
+        report->mSizeBefore += sizeBefore;
+        report->mSizeAfter += compressed.size();
+    }
+
+    return true;
+}
+
+} // namespace RenderBackend
+} // namespace OSRE
@@ -0,0 +1,115 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+#include "Common/glm_common.h"
+
+namespace OSRE {
+namespace RenderBackend {
+
+// Forward declarations ---------------------------------------------------------------------------
+class Mesh;
+
+/// @brief  The description of the vertex compression.
+struct VertexCompressionConfig {
+    bool mEnabled;              ///< true to compress the vertices of imported meshes.
+    bool mQuantizePositions;    ///< true to store positions as unorm16 values restored by a dequant matrix.
+    bool mUNormTexCoords;       ///< true to store texture coordinates in 0..1 as unorm16 instead of half floats.
+
+    /// @brief  The default class constructor.
+    VertexCompressionConfig() :
+            mEnabled(false), mQuantizePositions(true), mUNormTexCoords(true) {
+        // empty
+    }
+};
+
+/// @brief  The memory statistics of compressed vertex data.
+struct VertexCompressionReport {
+    size_t mNumMeshes;      ///< The number of compressed meshes.
+    size_t mNumVertices;    ///< The number of compressed vertices.
+    size_t mSizeBefore;     ///< The vertex buffer size before the compression in bytes.
+    size_t mSizeAfter;      ///< The vertex buffer size after the compression in bytes.
+
+    /// @brief  The default class constructor.
+    VertexCompressionReport() :
+            mNumMeshes(0), mNumVertices(0), mSizeBefore(0), mSizeAfter(0) {
+        // empty
+    }
+
+    /// @brief  Will return the saved memory in bytes.
+    size_t getSavedBytes() const {
+        return mSizeBefore > mSizeAfter ? mSizeBefore - mSizeAfter : 0;
+    }
+
+    /// @brief  Will return the saved ratio of the vertex memory, between 0 and 1.
+    f32 getSavedRatio() const {
+        return mSizeBefore == 0 ? 0.0f : static_cast<f32>(getSavedBytes()) / static_cast<f32>(mSizeBefore);
+    }
+};
+
+///-----------------------------------------------------------------
+/// @class VertexCompressor
+///
+/// @brief This class converts render vertices into a compressed
+///        vertex layout. Normals are octahedral encoded into two
+///        snorm16 values, colors are stored as rgba8, texture
+///        coordinates as half floats or unorm16 values. Positions
+///        can be quantized to unorm16 values in the bounding box of
+///        the mesh, the dequant matrix is stored in the mesh.
+///-----------------------------------------------------------------
+class VertexCompressor {
+public:
+    /// @brief Will convert a float into a half float.
+    /// @param[in] value    The float value.
+    /// @return The half float bits, rounded to the nearest value.
+    static ui16 encodeHalf(f32 value);
+
+    /// @brief Will convert a half float into a float.
+    /// @param[in] value    The half float bits.
+    /// @return The float value.
+    static f32 decodeHalf(ui16 value);
+
+    /// @brief Will encode a unit vector into octahedral snorm16 coordinates.
+    /// @param[in]  normal  The normal, does not need to be normalized.
+    /// @param[out] x       The first encoded coordinate.
+    /// @param[out] y       The second encoded coordinate.
+    static void encodeOctNormal(const glm::vec3 &normal, i16 &x, i16 &y);
+
+    /// @brief Will decode octahedral snorm16 coordinates into a unit vector.
+    /// @param[in] x    The first encoded coordinate.
+    /// @param[in] y    The second encoded coordinate.
+    /// @return The decoded normal.
+    static glm::vec3 decodeOctNormal(i16 x, i16 y);
+
+    /// @brief Will compress the vertices of a render vertex mesh. The mesh gets the compressed
+    /// vertex type and a vertex layout, which describes the new vertex data.
+    /// @param[in]  mesh    The mesh, must not be uploaded to the render backend yet.
+    /// @param[in]  config  The compression description.
+    /// @param[out] report  The report to add the memory statistics to, optional.
+    /// @return true, if the mesh was compressed.
+    static bool compress(Mesh *mesh, const VertexCompressionConfig &config, VertexCompressionReport *report = nullptr);
+};
+
+} // namespace RenderBackend
+} // namespace OSRE
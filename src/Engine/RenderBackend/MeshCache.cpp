@@ -0,0 +1,517 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/MeshCache.h"
+#include "RenderBackend/Mesh.h"
+#include "Common/Logger.h"
+#include "Common/StringUtils.h"
+#include "IO/FileStream.h"
+#include "IO/MappedFileStream.h"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+namespace OSRE::RenderBackend {
+
+using namespace ::OSRE::Common;
+using namespace ::OSRE::IO;
+
+DECL_OSRE_LOG_MODULE(MeshCache)
+
+static constexpr c8 Extension[] = "osmc";
+static constexpr c8 Magic[4] = { 'O', 'S', 'M', 'C' };
+static constexpr size_t BlobAlignment = 16;
+
+/// The file header.
+struct CacheHeader {
+    c8 mMagic[4];
+    ui32 mVersion;
+    ui64 mSourceHash;
+    ui32 mNumMaterials;
+    ui32 mNumMeshes;
+    ui64 mFileSize;
+};
+
+/// The material record, followed by the name and the texture path.
+struct MaterialRecord {
+    ui32 mNameLen;
+    ui32 mTextureLen;
+    f32 mColors[MaxMatColorType][4];
+    f32 mShininess;
+    f32 mShininessStrength;
+};
+
+/// The mesh record, followed by the name, the vertex layout, the primitive groups and the blobs.
+struct MeshRecord {
+    ui32 mNameLen;
+    i32 mVertexType;
+    i32 mIndexType;
+    i32 mMaterialIndex;
+    ui32 mNumComponents;
+    ui32 mNumPrimGroups;
+    ui32 mIsLocal;
+    ui32 mReserved;
+    f32 mAabb[6];
+    f32 mModel[16];
+    ui64 mVertexOffset;
+    ui64 mVertexSize;
+    ui64 mIndexOffset;
+    ui64 mIndexSize;
+};
+
+/// One vertex component of the layout descriptor.
+struct ComponentRecord {
+    i32 mAttrib;
+    i32 mFormat;
+};
+
+/// One primitive group.
+struct PrimGroupRecord {
+    i32 mPrimitive;
+    i32 mIndexType;
+    ui64 mStartIndex;
+    ui64 mNumIndices;
+    ui64 mBaseVertex;
+};
+
+static size_t alignTo(size_t offset, size_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+/// Bounds-checked cursor over the mapped file.
+//-------------------------------------------------------------------------------------------------
+class CacheReader {
+public:
+    CacheReader(const uc8 *data, size_t size) :
+            mData(data), mSize(size), mPos(0) {
+        // empty
+    }
+
+    template <class T>
+    bool read(T &value) {
+        if (mPos + sizeof(T) > mSize) {
+            return false;
+        }
+        ::memcpy(&value, mData + mPos, sizeof(T));
+        mPos += sizeof(T);
+        return true;
+    }
+
+    bool readString(ui32 len, String &str) {
+        if (mPos + len > mSize) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const c8 *>(mData + mPos), len);
+        mPos += len;
+        return true;
+    }
+
+    const uc8 *blob(ui64 offset, ui64 size) const {
+        if (offset + size > mSize || offset + size < offset) {
+            return nullptr;
+        }
+        return mData + offset;
+    }
+
+    void seek(size_t pos) {
+        mPos = pos;
+    }
+
+    void align(size_t alignment) {
+        mPos = alignTo(mPos, alignment);
+    }
+
+    size_t pos() const {
+        return mPos;
+    }
+
+private:
+    const uc8 *mData;
+    size_t mSize;
+    size_t mPos;
+};
+
+//-------------------------------------------------------------------------------------------------
+/// Writes into a file stream and keeps track of the written bytes.
+//-------------------------------------------------------------------------------------------------
+class CacheWriter {
+public:
+    explicit CacheWriter(Stream &stream) :
+            mStream(stream), mPos(0), mOk(true) {
+        // empty
+    }
+
+    void write(const void *data, size_t size) {
+        if (size == 0 || !mOk) {
+            return;
+        }
+        mOk = mStream.write(data, size) == size;
+        mPos += size;
+    }
+
+    template <class T>
+    void write(const T &value) {
+        write(&value, sizeof(T));
+    }
+
+    void pad(size_t alignment) {
+        static constexpr c8 Zeros[BlobAlignment] = {};
+        const size_t numBytes = alignTo(mPos, alignment) - mPos;
+        write(Zeros, numBytes);
+    }
+
+    size_t pos() const {
+        return mPos;
+    }
+
+    bool isOk() const {
+        return mOk;
+    }
+
+private:
+    Stream &mStream;
+    size_t mPos;
+    bool mOk;
+};
+
+const c8 *MeshCache::getExtension() {
+    return Extension;
+}
+
+HashId MeshCache::computeSourceHash(const String &sourcePath, ui64 options) {
+    if (sourcePath.empty()) {
+        return 0;
+    }
+
+#ifdef OSRE_WINDOWS
+    struct __stat64 fileStat;
+    if (0 != _stat64(sourcePath.c_str(), &fileStat)) {
+        return 0;
+    }
+#else
+    struct stat fileStat;
+    if (0 != stat(sourcePath.c_str(), &fileStat)) {
+        return 0;
+    }
+#endif
+
+    // FNV-1a over the path, the file size, the modification time and the import options
+    const ui64 fileSize = static_cast<ui64>(fileStat.st_size);
+    const i64 modTime = static_cast<i64>(fileStat.st_mtime);
+    ui64 hash = StringUtils::fnv1a64(sourcePath.c_str(), sourcePath.size());
+    hash = StringUtils::fnv1a64(&fileSize, sizeof(fileSize), hash);
+    hash = StringUtils::fnv1a64(&modTime, sizeof(modTime), hash);
+    hash = StringUtils::fnv1a64(&options, sizeof(options), hash);
+
+    return StringUtils::fnv1a64(&Version, sizeof(Version), hash);
+}
+
+String MeshCache::getCachePath(const String &sourcePath) {
+    return sourcePath + "." + Extension;
+}
+
+void MeshCache::getVertexLayout(VertexType type, VertexLayout &layout) {
+    layout.clear();
+    switch (type) {
+        case VertexType::ColorVertex:
+            layout.add(new VertComponent(VertexAttribute::Position, VertexFormat::Float3))
+                    .add(new VertComponent(VertexAttribute::Normal, VertexFormat::Float3))
+                    .add(new VertComponent(VertexAttribute::Color0, VertexFormat::Float3));
+            break;
+        case VertexType::RenderVertex:
+            layout.add(new VertComponent(VertexAttribute::Position, VertexFormat::Float3))
+                    .add(new VertComponent(VertexAttribute::Normal, VertexFormat::Float3))
+                    .add(new VertComponent(VertexAttribute::Color0, VertexFormat::Float3))
+                    .add(new VertComponent(VertexAttribute::TexCoord0, VertexFormat::Float2));
+            break;
+        default:
+            break;
+    }
+}
+
+static void writeMaterial(CacheWriter &writer, const MeshCacheMaterial &mat) {
+    MaterialRecord record = {};
+    record.mNameLen = static_cast<ui32>(mat.Name.size());
+    record.mTextureLen = static_cast<ui32>(mat.DiffuseTexture.size());
+    for (ui32 i = 0; i < MaxMatColorType; ++i) {
+        for (ui32 j = 0; j < 4; ++j) {
+            record.mColors[i][j] = mat.Colors[i][j];
+        }
+    }
+    record.mShininess = mat.Shininess;
+    record.mShininessStrength = mat.ShininessStrength;
+    writer.write(record);
+    writer.write(mat.Name.c_str(), mat.Name.size());
+    writer.write(mat.DiffuseTexture.c_str(), mat.DiffuseTexture.size());
+    writer.pad(sizeof(ui32));
+}
+
+static bool writeMesh(CacheWriter &writer, const MeshCacheEntry &entry) {
+    Mesh *mesh = entry.mMesh;
+    if (mesh == nullptr) {
+        return false;
+    }
+
+    VertexLayout layout;
+    MeshCache::getVertexLayout(mesh->getVertexType(), layout);
+
+    BufferData *vb = mesh->getVertexBuffer();
+    BufferData *ib = mesh->getIndexBuffer();
+    MeshRecord record = {};
+    record.mNameLen = static_cast<ui32>(mesh->getName().size());
+    record.mVertexType = static_cast<i32>(mesh->getVertexType());
+    record.mIndexType = static_cast<i32>(mesh->getIndexType());
+    record.mMaterialIndex = entry.mMaterialIndex;
+    record.mNumComponents = static_cast<ui32>(layout.numComponents());
+    record.mNumPrimGroups = static_cast<ui32>(mesh->getNumberOfPrimitiveGroups());
+    record.mIsLocal = mesh->isLocal() ? 1 : 0;
+    const glm::vec3 &aabbMin = entry.mAabb.getMin();
+    const glm::vec3 &aabbMax = entry.mAabb.getMax();
+    for (i32 i = 0; i < 3; ++i) {
+        record.mAabb[i] = aabbMin[i];
+        record.mAabb[i + 3] = aabbMax[i];
+    }
+    ::memcpy(record.mModel, glm::value_ptr(mesh->getLocalMatrix()), sizeof(record.mModel));
+    record.mVertexSize = vb != nullptr ? vb->getSize() : 0;
+    record.mIndexSize = ib != nullptr ? ib->getSize() : 0;
+
+    // The blob offsets are known up front, the meta data has a fixed size
+    size_t pos = writer.pos() + sizeof(MeshRecord) + record.mNameLen +
+        sizeof(ComponentRecord) * record.mNumComponents + sizeof(PrimGroupRecord) * record.mNumPrimGroups;
+    record.mVertexOffset = alignTo(pos, BlobAlignment);
+    record.mIndexOffset = alignTo(record.mVertexOffset + record.mVertexSize, BlobAlignment);
+
+    writer.write(record);
+    writer.write(mesh->getName().c_str(), record.mNameLen);
+    for (size_t i = 0; i < layout.numComponents(); ++i) {
+        const VertComponent &comp = layout.getAt(i);
+        ComponentRecord compRecord = { static_cast<i32>(comp.m_attrib), static_cast<i32>(comp.m_format) };
+        writer.write(compRecord);
+    }
+    for (size_t i = 0; i < mesh->getNumberOfPrimitiveGroups(); ++i) {
+        const PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+        PrimGroupRecord grpRecord = { static_cast<i32>(grp->m_primitive), static_cast<i32>(grp->m_indexType),
+            static_cast<ui64>(grp->m_startIndex), static_cast<ui64>(grp->m_numIndices), static_cast<ui64>(grp->m_baseVertex) };
+        writer.write(grpRecord);
+    }
+    writer.pad(BlobAlignment);
+    if (record.mVertexSize > 0) {
+        writer.write(vb->getData(), record.mVertexSize);
+    }
+    writer.pad(BlobAlignment);
+    if (record.mIndexSize > 0) {
+        writer.write(ib->getData(), record.mIndexSize);
+    }
+    writer.pad(BlobAlignment);
+
+    return writer.isOk();
+}
+
+bool MeshCache::write(const String &cachePath, HashId sourceHash, const MeshCacheEntryArray &entries,
+        const MeshCacheMaterialArray &materials) {
+    if (cachePath.empty() || entries.isEmpty()) {
+        return false;
+    }
+
+    FileStream stream(Uri("file://" + cachePath), Stream::AccessMode::WriteAccessBinary);
+    if (!stream.open()) {
+        osre_warn(Tag, "Cannot open mesh cache " + cachePath + " for writing.");
+        return false;
+    }
+
+    CacheWriter writer(stream);
+    CacheHeader header = {};
+    ::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mSourceHash = sourceHash;
+    header.mNumMaterials = static_cast<ui32>(materials.size());
+    header.mNumMeshes = static_cast<ui32>(entries.size());
+    writer.write(header);
+    for (size_t i = 0; i < materials.size(); ++i) {
+        writeMaterial(writer, materials[i]);
+    }
+    writer.pad(BlobAlignment);
+
+    bool ok = true;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        ok &= writeMesh(writer, entries[i]);
+    }
+
+    // The final size marks the file as complete, a truncated file will be rejected
+    const ui64 fileSize = writer.pos();
+    ok &= writer.isOk();
+    if (ok) {
+        stream.seek(offsetof(CacheHeader, mFileSize), Stream::Origin::Begin);
+        ok = stream.write(&fileSize, sizeof(fileSize)) == sizeof(fileSize);
+    }
+    stream.close();
+    if (!ok) {
+        osre_warn(Tag, "Error while writing mesh cache " + cachePath + ".");
+        ::remove(cachePath.c_str());
+    }
+
+    return ok;
+}
+
+static bool readMaterial(CacheReader &reader, MeshCacheMaterial &mat) {
+    MaterialRecord record = {};
+    if (!reader.read(record)) {
+        return false;
+    }
+    if (!reader.readString(record.mNameLen, mat.Name) || !reader.readString(record.mTextureLen, mat.DiffuseTexture)) {
+        return false;
+    }
+    for (ui32 i = 0; i < MaxMatColorType; ++i) {
+        mat.Colors[i] = Color4(record.mColors[i][0], record.mColors[i][1], record.mColors[i][2], record.mColors[i][3]);
+    }
+    mat.Shininess = record.mShininess;
+    mat.ShininessStrength = record.mShininessStrength;
+
+    return true;
+}
+
+static Mesh *readMesh(CacheReader &reader, size_t &pos, MeshCacheEntry &entry) {
+    reader.seek(pos);
+    MeshRecord record = {};
+    String name;
+    if (!reader.read(record) || !reader.readString(record.mNameLen, name)) {
+        return nullptr;
+    }
+
+    const VertexType vertexType = static_cast<VertexType>(record.mVertexType);
+    const IndexType indexType = static_cast<IndexType>(record.mIndexType);
+    VertexLayout expected;
+    MeshCache::getVertexLayout(vertexType, expected);
+    if (expected.numComponents() != record.mNumComponents) {
+        return nullptr;
+    }
+    for (ui32 i = 0; i < record.mNumComponents; ++i) {
+        ComponentRecord comp = {};
+        if (!reader.read(comp)) {
+            return nullptr;
+        }
+        const VertComponent &expectedComp = expected.getAt(i);
+        if (comp.mAttrib != static_cast<i32>(expectedComp.m_attrib) || comp.mFormat != static_cast<i32>(expectedComp.m_format)) {
+            return nullptr;
+        }
+    }
+
+    const uc8 *vertices = reader.blob(record.mVertexOffset, record.mVertexSize);
+    const uc8 *indices = reader.blob(record.mIndexOffset, record.mIndexSize);
+    if (vertices == nullptr || indices == nullptr) {
+        return nullptr;
+    }
+
+    Mesh *mesh = new Mesh(name, vertexType, indexType);
+    for (ui32 i = 0; i < record.mNumPrimGroups; ++i) {
+        PrimGroupRecord grpRecord = {};
+        if (!reader.read(grpRecord)) {
+            delete mesh;
+            return nullptr;
+        }
+        auto *grp = new PrimitiveGroup;
+        grp->init(static_cast<IndexType>(grpRecord.mIndexType), static_cast<size_t>(grpRecord.mNumIndices),
+            static_cast<PrimitiveType>(grpRecord.mPrimitive), static_cast<size_t>(grpRecord.mStartIndex));
+        grp->m_baseVertex = static_cast<size_t>(grpRecord.mBaseVertex);
+        mesh->addPrimitiveGroup(grp);
+    }
+
+    // One bulk copy per blob, the data is stored in its runtime layout
+    if (record.mVertexSize > 0) {
+        mesh->createVertexBuffer(const_cast<uc8 *>(vertices), record.mVertexSize, BufferAccessType::ReadOnly);
+    }
+    if (record.mIndexSize > 0) {
+        mesh->createIndexBuffer(const_cast<uc8 *>(indices), record.mIndexSize, indexType, BufferAccessType::ReadOnly);
+    }
+    glm::mat4 model(1.0f);
+    ::memcpy(glm::value_ptr(model), record.mModel, sizeof(record.mModel));
+    mesh->setModelMatrix(record.mIsLocal != 0, model);
+
+    entry.mMesh = mesh;
+    entry.mMaterialIndex = record.mMaterialIndex;
+    entry.mAabb.set(glm::vec3(record.mAabb[0], record.mAabb[1], record.mAabb[2]),
+        glm::vec3(record.mAabb[3], record.mAabb[4], record.mAabb[5]));
+    pos = alignTo(record.mIndexOffset + record.mIndexSize, BlobAlignment);
+
+    return mesh;
+}
+
+bool MeshCache::load(const String &cachePath, HashId sourceHash, MeshCacheEntryArray &entries,
+        MeshCacheMaterialArray &materials) {
+    if (cachePath.empty()) {
+        return false;
+    }
+
+    MappedFileStream file(Uri("file://" + cachePath), Stream::AccessMode::MappedReadAccess);
+    if (!file.open()) {
+        return false;
+    }
+
+    const uc8 *data = file.map(0, file.getSize());
+    if (data == nullptr) {
+        return false;
+    }
+
+    CacheReader reader(data, static_cast<size_t>(file.getSize()));
+    CacheHeader header = {};
+    if (!reader.read(header)) {
+        return false;
+    }
+    if (0 != ::memcmp(header.mMagic, Magic, sizeof(Magic)) || header.mVersion != Version) {
+        osre_debug(Tag, "Mesh cache " + cachePath + " has an unsupported format.");
+        return false;
+    }
+    if (header.mSourceHash != sourceHash || header.mFileSize != file.getSize()) {
+        osre_debug(Tag, "Mesh cache " + cachePath + " is stale.");
+        return false;
+    }
+
+    materials.resize(header.mNumMaterials);
+    for (ui32 i = 0; i < header.mNumMaterials; ++i) {
+        if (!readMaterial(reader, materials[i])) {
+            materials.clear();
+            return false;
+        }
+        reader.align(sizeof(ui32));
+    }
+    reader.align(BlobAlignment);
+
+    size_t pos = reader.pos();
+    for (ui32 i = 0; i < header.mNumMeshes; ++i) {
+        MeshCacheEntry entry;
+        if (readMesh(reader, pos, entry) == nullptr) {
+            osre_warn(Tag, "Mesh cache " + cachePath + " is broken.");
+            for (size_t j = 0; j < entries.size(); ++j) {
+                delete entries[j].mMesh;
+            }
+            entries.clear();
+            materials.clear();
+            return false;
+        }
+        entries.add(entry);
+    }
+
+    return true;
+}
+
+} // namespace OSRE::RenderBackend
@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/Material.h"
+#include "Common/TAABB.h"
+
+#include <cppcore/Container/TArray.h>
+
+namespace OSRE::RenderBackend {
+
+/// @brief The material description stored beside the meshes in a mesh cache file.
+struct MeshCacheMaterial {
+    String Name;                            ///< The material name.
+    String DiffuseTexture;                  ///< The uri of the diffuse texture, empty if none.
+    Color4 Colors[MaxMatColorType];         ///< Diffuse, specular, ambient and emission color.
+    f32 Shininess = 1.0f;                   ///< The shininess.
+    f32 ShininessStrength = 1.0f;           ///< The shininess strength.
+};
+
+/// @brief The per-mesh meta data which is not part of the mesh itself.
+struct MeshCacheEntry {
+    Mesh *mMesh = nullptr;                  ///< The mesh.
+    i32 mMaterialIndex = -1;                ///< Index into the material array, -1 for none.
+    Common::AABB mAabb;                     ///< The bounding box of the vertices.
+};
+
+using MeshCacheMaterialArray = cppcore::TArray<MeshCacheMaterial>;
+using MeshCacheEntryArray = cppcore::TArray<MeshCacheEntry>;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements the engine-native binary mesh cache format.
+///
+/// A cache file stores the imported meshes in the layout the render backend uses at runtime:
+/// a vertex layout descriptor, the raw vertex and index blobs, the primitive groups, the bounding 
+/// box and a reference into the stored material table. The blobs are 16-byte aligned, so a cache
+/// file can be memory-mapped and copied into the BufferData instances without any per-vertex 
+/// conversion.
+///
+/// Each file is keyed by a hash of its source asset. When the hash does not match the file is
+/// treated as stale and will be ignored.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT MeshCache {
+public:
+    /// @brief The current version of the file format.
+    static constexpr ui32 Version = 2;
+
+    /// @brief Will return the file extension used for cache files.
+    /// @return The extension.
+    static const c8 *getExtension();
+
+    /// @brief Will calculate the key for a source asset, based on its path, size and modification time.
+    /// @param[in] sourcePath   The absolute path of the source asset.
+    /// @param[in] options      The import settings which change the cached data, part of the key.
+    /// @return The hash, 0 if the source cannot be accessed.
+    static HashId computeSourceHash(const String &sourcePath, ui64 options = 0);
+
+    /// @brief Will return the path of the cache file for a source asset.
+    /// @param[in] sourcePath   The absolute path of the source asset.
+    /// @return The cache file path.
+    static String getCachePath(const String &sourcePath);
+
+    /// @brief Will write the meshes and materials into a cache file.
+    /// @param[in] cachePath    The path of the cache file.
+    /// @param[in] sourceHash   The hash of the source asset.
+    /// @param[in] entries      The meshes to store.
+    /// @param[in] materials    The materials referenced by the meshes.
+    /// @return true if successful, false in case of an error.
+    static bool write(const String &cachePath, HashId sourceHash, const MeshCacheEntryArray &entries,
+        const MeshCacheMaterialArray &materials);
+
+    /// @brief Will load a cache file, the meshes will be created.
+    /// @param[in]  cachePath   The path of the cache file.
+    /// @param[in]  sourceHash  The expected source hash.
+    /// @param[out] entries     The loaded meshes.
+    /// @param[out] materials   The loaded material descriptions.
+    /// @return true if successful, false if the file is missing, stale or broken.
+    static bool load(const String &cachePath, HashId sourceHash, MeshCacheEntryArray &entries,
+        MeshCacheMaterialArray &materials);
+
+    /// @brief Will fill the vertex layout description for a given build-in vertex type.
+    /// @param[in]  type        The vertex type.
+    /// @param[out] layout      The layout to fill.
+    static void getVertexLayout(VertexType type, VertexLayout &layout);
+
+private:
+    MeshCache() = default;
+    ~MeshCache() = default;
+};
+
+} // namespace OSRE::RenderBackend
@@ -24,17 +24,23 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/RenderCommon.h"
 #include "RenderBackend/MeshProcessor.h"
+#include "Common/Logger.h"
+
+#include <vector>
 
 namespace OSRE {
 namespace RenderBackend {
 
 using namespace ::OSRE::Common;
 
+DECL_OSRE_LOG_MODULE(MeshProcessor)
+
 static const i32 NeedsUpdate = 1;
 
 MeshProcessor::MeshProcessor() :
         AbstractProcessor(),
-        mDirty(0) {
+        mDirty(0),
+        mFlags(ComputeAABB) {
     // empty
 }
 
@@ -73,6 +79,22 @@ void MeshProcessor::handleMesh(Mesh *mesh) {
         return;
     }
 
+    if ((mFlags & WeldVertices) != 0) {
+        weldMesh(mesh);
+    }
+
+    if ((mFlags & OptimizeAll) != 0) {
+        optimizeMesh(mesh);
+    }
+
+    if ((mFlags & CompactIndices) != 0) {
+        compactMesh(mesh);
+    }
+
+    if ((mFlags & ComputeAABB) == 0) {
+        return;
+    }
+
     ui32 stride(0);
     switch (mesh->getVertexType()) {
         case VertexType::RenderVertex:
@@ -88,7 +110,7 @@ void MeshProcessor::handleMesh(Mesh *mesh) {
     }
 
     BufferData *data = mesh->getVertexBuffer();
-    if (nullptr == data || 0L == data->getSize()) {
+    if (nullptr == data || 0L == data->getSize() || 0 == stride) {
         return;
     }
 
@@ -103,5 +125,217 @@ void MeshProcessor::handleMesh(Mesh *mesh) {
     }
 }
 
+static void addStatistics(const VertexCacheStatistics &stats, VertexCacheStatistics &total) {
+    total.mNumTriangles += stats.mNumTriangles;
+    total.mNumVertices += stats.mNumVertices;
+    total.mNumCacheMisses += stats.mNumCacheMisses;
+}
+
+// Indices relative to a base vertex cannot be processed as one buffer
+static bool hasBaseVertex(const Mesh *mesh) {
+    for (size_t i = 0; i < mesh->getNumberOfPrimitiveGroups(); ++i) {
+        if (mesh->getPrimitiveGroupAt(i)->m_baseVertex != 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static ui32 getPrimitiveSize(PrimitiveType type) {
+    switch (type) {
+        case PrimitiveType::PointList:
+            return 1;
+        case PrimitiveType::LineList:
+            return 2;
+        case PrimitiveType::TriangleList:
+            return 3;
+        default:
+            break;
+    }
+
+    return 0;
+}
+
+void MeshProcessor::optimizeMesh(Mesh *mesh) {
+    BufferData *vb = mesh->getVertexBuffer();
+    BufferData *ib = mesh->getIndexBuffer();
+    const size_t stride = Mesh::getVertexSize(mesh->getVertexType());
+    const size_t indexSize = Mesh::getIndexSize(mesh->getIndexType());
+    if (vb == nullptr || ib == nullptr || stride == 0 || indexSize == 0 || ib->getSize() == 0 || hasBaseVertex(mesh)) {
+        return;
+    }
+
+    // Only non-overlapping triangle list groups can be reordered
+    const size_t numGroups = mesh->getNumberOfPrimitiveGroups();
+    const size_t numIndicesInBuffer = ib->getSize() / indexSize;
+    cppcore::TArray<PrimitiveGroup *> triGroups;
+    for (size_t i = 0; i < numGroups; ++i) {
+        PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+        if (grp->m_startIndex + grp->m_numIndices > numIndicesInBuffer) {
+            osre_debug(Tag, "Invalid primitive group in mesh " + mesh->getName() + ", skip optimization.");
+            return;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            PrimitiveGroup *other = mesh->getPrimitiveGroupAt(j);
+            if (grp->m_startIndex < other->m_startIndex + other->m_numIndices &&
+                    other->m_startIndex < grp->m_startIndex + grp->m_numIndices) {
+                osre_debug(Tag, "Overlapping primitive groups in mesh " + mesh->getName() + ", skip optimization.");
+                return;
+            }
+        }
+        if (grp->m_primitive == PrimitiveType::TriangleList && grp->m_numIndices % 3 == 0) {
+            triGroups.add(grp);
+        }
+    }
+
+    cppcore::TArray<ui32> indices;
+    indices.resize(numIndicesInBuffer);
+    MeshOptimizer::readIndices(ib->getData(), numIndicesInBuffer, mesh->getIndexType(), &indices[0]);
+    const size_t numVertices = vb->getSize() / stride;
+    uc8 *vertices = reinterpret_cast<uc8 *>(vb->getData());
+
+    for (PrimitiveGroup *grp : triGroups) {
+        ui32 *groupIndices = &indices[grp->m_startIndex];
+        addStatistics(MeshOptimizer::analyzeVertexCache(groupIndices, grp->m_numIndices, numVertices), mStatsBefore);
+        if ((mFlags & OptimizeVertexCache) != 0) {
+            MeshOptimizer::optimizeVertexCache(groupIndices, grp->m_numIndices, numVertices);
+        }
+        if ((mFlags & OptimizeOverdraw) != 0) {
+            MeshOptimizer::optimizeOverdraw(groupIndices, grp->m_numIndices, vertices, numVertices, stride);
+        }
+    }
+
+    // The vertex order is independent from the primitive type, so the whole buffer can be remapped
+    if ((mFlags & OptimizeVertexFetch) != 0) {
+        MeshOptimizer::optimizeVertexFetch(vertices, numVertices, stride, &indices[0], indices.size());
+    }
+
+    for (PrimitiveGroup *grp : triGroups) {
+        addStatistics(MeshOptimizer::analyzeVertexCache(&indices[grp->m_startIndex], grp->m_numIndices, numVertices), mStatsAfter);
+    }
+
+    MeshOptimizer::writeIndices(&indices[0], numIndicesInBuffer, mesh->getIndexType(), ib->getData());
+}
+
+void MeshProcessor::weldMesh(Mesh *mesh) {
+    BufferData *vb = mesh->getVertexBuffer();
+    BufferData *ib = mesh->getIndexBuffer();
+    const size_t stride = Mesh::getVertexSize(mesh->getVertexType());
+    const size_t indexSize = Mesh::getIndexSize(mesh->getIndexType());
+    if (vb == nullptr || ib == nullptr || stride == 0 || indexSize == 0 || ib->getSize() == 0 || hasBaseVertex(mesh)) {
+        return;
+    }
+
+    const size_t numIndices = ib->getSize() / indexSize;
+    const size_t numVertices = vb->getSize() / stride;
+    std::vector<ui32> indices(numIndices);
+    MeshOptimizer::readIndices(ib->getData(), numIndices, mesh->getIndexType(), indices.data());
+    const size_t numUnique = MeshOptimizer::weldVertices(reinterpret_cast<uc8 *>(vb->getData()), numVertices, stride,
+            indices.data(), numIndices);
+    if (numUnique == 0 || numUnique == numVertices) {
+        return;
+    }
+
+    mesh->resizeVertexBuffer(numUnique * stride);
+    MeshOptimizer::writeIndices(indices.data(), numIndices, mesh->getIndexType(), ib->getData());
+    osre_debug(Tag, "Welded " + std::to_string(numVertices - numUnique) + " vertices in mesh " + mesh->getName());
+}
+
+void MeshProcessor::compactMesh(Mesh *mesh) {
+    BufferData *vb = mesh->getVertexBuffer();
+    BufferData *ib = mesh->getIndexBuffer();
+    const size_t stride = mesh->getVertexStride();
+    if (mesh->getIndexType() != IndexType::UnsignedInt || vb == nullptr || ib == nullptr || stride == 0 ||
+            ib->getSize() == 0 || hasBaseVertex(mesh)) {
+        return;
+    }
+
+    const size_t numIndicesInBuffer = ib->getSize() / sizeof(ui32);
+    const size_t numVertices = vb->getSize() / stride;
+    std::vector<ui32> indices(numIndicesInBuffer);
+    MeshOptimizer::readIndices(ib->getData(), numIndicesInBuffer, IndexType::UnsignedInt, indices.data());
+
+    // All vertices are addressable, so only the index type changes
+    if (MeshOptimizer::selectIndexType(numVertices) == IndexType::UnsignedShort) {
+        std::vector<c8> data(numIndicesInBuffer * sizeof(ui16));
+        MeshOptimizer::writeIndices(indices.data(), numIndicesInBuffer, IndexType::UnsignedShort, data.data());
+        mesh->createIndexBuffer(data.data(), data.size(), IndexType::UnsignedShort, ib->getBufferAccessType());
+        for (size_t i = 0; i < mesh->getNumberOfPrimitiveGroups(); ++i) {
+            mesh->getPrimitiveGroupAt(i)->m_indexType = IndexType::UnsignedShort;
+        }
+        for (size_t lodIdx = 1; lodIdx < mesh->getNumberOfLods(); ++lodIdx) {
+            const MeshLod *lod = mesh->getLodAt(lodIdx);
+            for (size_t i = 0; i < lod->mPrimGroups.size(); ++i) {
+                lod->mPrimGroups[i]->m_indexType = IndexType::UnsignedShort;
+            }
+        }
+        return;
+    }
+
+    // The levels of detail must keep the group layout of the mesh, so they cannot be split
+    if (mesh->getNumberOfLods() > 1) {
+        osre_debug(Tag, "Mesh " + mesh->getName() + " has levels of detail, keep 32-bit indices.");
+        return;
+    }
+
+    const size_t numGroups = mesh->getNumberOfPrimitiveGroups();
+    if (numGroups == 0) {
+        return;
+    }
+    for (size_t i = 0; i < numGroups; ++i) {
+        const PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+        if (getPrimitiveSize(grp->m_primitive) == 0 || grp->m_startIndex + grp->m_numIndices > numIndicesInBuffer) {
+            osre_debug(Tag, "Mesh " + mesh->getName() + " cannot be split, keep 32-bit indices.");
+            return;
+        }
+    }
+
+    cppcore::TArray<ui32> vertexRemap;
+    cppcore::TArray<IndexRange> ranges;
+    std::vector<ui32> newIndices;
+    newIndices.reserve(numIndicesInBuffer);
+    cppcore::TArray<PrimitiveGroup *> newGroups;
+    for (size_t i = 0; i < numGroups; ++i) {
+        const PrimitiveGroup *grp = mesh->getPrimitiveGroupAt(i);
+        const size_t offset = newIndices.size();
+        const size_t firstRange = ranges.size();
+        newIndices.resize(offset + grp->m_numIndices);
+        if (!MeshOptimizer::splitIndexRanges(&indices[grp->m_startIndex], grp->m_numIndices, getPrimitiveSize(grp->m_primitive),
+                    MeshOptimizer::MaxShortIndexVertices, vertexRemap, &newIndices[offset], ranges)) {
+            for (size_t j = 0; j < newGroups.size(); ++j) {
+                delete newGroups[j];
+            }
+            osre_debug(Tag, "Invalid primitive group in mesh " + mesh->getName() + ", keep 32-bit indices.");
+            return;
+        }
+
+        for (size_t j = firstRange; j < ranges.size(); ++j) {
+            auto *newGrp = new PrimitiveGroup;
+            newGrp->init(IndexType::UnsignedShort, ranges[j].mNumIndices, grp->m_primitive, offset + ranges[j].mStartIndex);
+            newGrp->m_baseVertex = ranges[j].mBaseVertex;
+            newGroups.add(newGrp);
+        }
+    }
+
+    std::vector<uc8> newVertices(vertexRemap.size() * stride);
+    const uc8 *vertices = reinterpret_cast<const uc8 *>(vb->getData());
+    for (size_t i = 0; i < vertexRemap.size(); ++i) {
+        ::memcpy(&newVertices[i * stride], &vertices[vertexRemap[i] * stride], stride);
+    }
+    mesh->resizeVertexBuffer(newVertices.size());
+    ::memcpy(vb->getData(), newVertices.data(), newVertices.size());
+
+    std::vector<c8> data(newIndices.size() * sizeof(ui16));
+    MeshOptimizer::writeIndices(newIndices.data(), newIndices.size(), IndexType::UnsignedShort, data.data());
+    mesh->createIndexBuffer(data.data(), data.size(), IndexType::UnsignedShort, ib->getBufferAccessType());
+
+    mesh->clearPrimitiveGroups();
+    for (size_t i = 0; i < newGroups.size(); ++i) {
+        mesh->addPrimitiveGroup(newGroups[i]);
+    }
+    osre_debug(Tag, "Split mesh " + mesh->getName() + " into " + std::to_string(newGroups.size()) + " 16-bit ranges.");
+}
+
 } // namespace RenderBackend
 } // Namespace OSRE
@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "RenderBackend/RenderCommon.h"
 #include "Common/TAABB.h"
 #include "App/TransformComponent.h"
+#include "RenderBackend/Mesh/MeshOptimizer.h"
 
 #include <cppcore/Container/TArray.h>
 
@@ -35,24 +36,76 @@ namespace RenderBackend {
 //-------------------------------------------------------------------------------------------------
 ///	@ingroup	Engine
 ///
-///	@brief
+///	@brief  This class implements the mesh processing pipeline. By default only the bounding box 
+/// of all meshes will be computed. The optimization steps for triangle lists can be enabled by the 
+/// processing flags, the vertex cache statistics before and after the optimization are available 
+/// after the execution. Welding runs before and the index compaction after the optimization.
 //-------------------------------------------------------------------------------------------------
 class OSRE_EXPORT MeshProcessor : public Common::AbstractProcessor {
 public:
+    /// The processing steps, bit coded.
+    enum ProcessingFlags : ui32 {
+        ComputeAABB = 1 << 0,           ///< Compute the bounding box of all meshes.
+        OptimizeVertexCache = 1 << 1,   ///< Reorder the triangles for the post-transform vertex cache.
+        OptimizeOverdraw = 1 << 2,      ///< Reorder triangle clusters to reduce the overdraw.
+        OptimizeVertexFetch = 1 << 3,   ///< Reorder the vertices in the order of their first use.
+        WeldVertices = 1 << 4,          ///< Merge vertices with identical data.
+        CompactIndices = 1 << 5,        ///< Use 16-bit indices, large meshes are split into 16-bit ranges.
+        OptimizeAll = OptimizeVertexCache | OptimizeOverdraw | OptimizeVertexFetch
+    };
+
     MeshProcessor();
     ~MeshProcessor() = default;
     bool execute() override;
     void addMesh( RenderBackend::Mesh *geo );
     const Common::AABB &getAABB() const;
 
+    /// @brief  Will set the processing steps.
+    /// @param[in] flags    The processing flags, see ProcessingFlags.
+    void setProcessingFlags(ui32 flags);
+
+    /// @brief  Will return the processing steps.
+    /// @return The processing flags.
+    ui32 getProcessingFlags() const;
+
+    /// @brief  Will return the vertex cache statistics of all processed meshes before the optimization.
+    /// @return The statistics.
+    const VertexCacheStatistics &getStatisticsBefore() const;
+
+    /// @brief  Will return the vertex cache statistics of all processed meshes after the optimization.
+    /// @return The statistics.
+    const VertexCacheStatistics &getStatisticsAfter() const;
+
 private:
     void handleMesh( RenderBackend::Mesh *mesh );
+    void optimizeMesh( RenderBackend::Mesh *mesh );
+    void weldMesh( RenderBackend::Mesh *mesh );
+    void compactMesh( RenderBackend::Mesh *mesh );
 
 private:
     RenderBackend::MeshArray mMeshArray;
     Common::AABB mAabb;
     i32 mDirty;
+    ui32 mFlags;
+    VertexCacheStatistics mStatsBefore;
+    VertexCacheStatistics mStatsAfter;
 };
 
+inline void MeshProcessor::setProcessingFlags(ui32 flags) {
+    mFlags = flags;
+}
+
+inline ui32 MeshProcessor::getProcessingFlags() const {
+    return mFlags;
+}
+
+inline const VertexCacheStatistics &MeshProcessor::getStatisticsBefore() const {
+    return mStatsBefore;
+}
+
+inline const VertexCacheStatistics &MeshProcessor::getStatisticsAfter() const {
+    return mStatsAfter;
+}
+
 } // Namespace RenderBackend
 } // Namespace OSRE
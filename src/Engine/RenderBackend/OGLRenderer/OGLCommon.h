@@ -25,6 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <GL/glew.h>
 
 #include "Common/osre_common.h"
+#include "Common/StringId.h"
 #include "RenderBackend/RenderCommon.h"
 #include "RenderBackend/RenderStates.h"
 
@@ -54,6 +55,7 @@ void checkOGLErrorState(const c8 *file, ui32 line);
 
 static constexpr GLuint OGLNotSetId = 999999;   ///< Indicates a not inited opengl id.
 static constexpr GLint  NoneLocation = -1;      ///< Indicates a not existing location of an uniform variable.
+static constexpr ui32   NoneSlot = ~0u;         ///< Indicates a parameter without a slot.
 
 ///	@brief  This struct declares opengl-specific buffer resources.
 /// Buffer will be used to store different data like vertices, indices or binary data.
@@ -77,10 +79,11 @@ struct OGLVertexAttribute {
     const c8 *m_pAttributeName; ///< The attribute name.
     size_t m_size;              ///< The size for one attribute.
     GLenum m_type;              ///< The attribute type.
+    GLboolean m_normalized;     ///< GL_TRUE for normalized fixed point data.
     const GLvoid *m_ptr;        ///< The data pointer for the attribute.
 
     /// @brief The default class constructor.
-    OGLVertexAttribute() : m_index(999999), m_pAttributeName(nullptr), m_size(0U), m_type(), m_ptr(nullptr) {}
+    OGLVertexAttribute() : m_index(999999), m_pAttributeName(nullptr), m_size(0U), m_type(), m_normalized(GL_FALSE), m_ptr(nullptr) {}
 
     /// @brief  The class destructor, default implementation.
     ~OGLVertexAttribute() = default;
@@ -101,7 +104,7 @@ struct OGLVertexArray {
 ///	@brief  This struct represents a txture resource information.
 struct OGLTexture {
     GLuint m_textureId;     ///< The OpenGL texture id.
-    String m_name;          ///< The texture name.
+    Common::StringId m_name;    ///< The interned texture name.
     GLenum m_target;        ///< The texture target type.
     GLenum m_format;        ///< The texture format type.
     size_t m_slot;          ///< The slot id, used as an internal index.
@@ -144,14 +147,14 @@ struct OGLRenderCmd {
 
 ///	@brief This struct declares the needed data for a OpenGL parameter.
 struct OGLParameter {
-    String m_name;              ///< The parameter name.
-    GLint m_loc;                ///< The parameter location in the shader.
+    Common::StringId m_name;    ///< The interned parameter name.
+    ui32 m_slot;                ///< The parameter slot, indexes the location table of the shader.
     ParameterType m_type;       ///< The parameter type.
     UniformDataBlob *m_data;    ///< The data blob.
     size_t m_numItems;          ///< Number of items.
 
     /// @brief The default class constructor.
-    OGLParameter() :  m_name(""), m_loc(NoneLocation), m_type(ParameterType::PT_None), 
+    OGLParameter() :  m_name(), m_slot(NoneSlot), m_type(ParameterType::PT_None), 
                       m_data(nullptr), m_numItems(0) {}
 
     /// @brief  The class destructor, default implementation.
@@ -164,9 +167,10 @@ struct OGLPrimGroup {
     ui32 m_startIndex;      ///< The start index in the vertex buffer.
     size_t m_numIndices;    ///< The number of indices to render.
     GLenum m_indexType;     ///< The index data type.
+    GLint m_baseVertex;     ///< The vertex added to each index.
 
     /// @brief The default class constructor.
-    OGLPrimGroup() : m_primitive(GL_NONE), m_startIndex(0), m_numIndices(0), m_indexType(GL_NONE) {} 
+    OGLPrimGroup() : m_primitive(GL_NONE), m_startIndex(0), m_numIndices(0), m_indexType(GL_NONE), m_baseVertex(0) {} 
 
     /// @brief  The class destructor, default implementation.
     ~OGLPrimGroup() = default;
@@ -216,12 +220,14 @@ struct DrawInstancePrimitivesCmdData {
 struct DrawPrimitivesCmdData {
     bool localMatrix;                     ///< true for a local model matrix. TODO: Remove me
     glm::mat4 model;                      ///< The model matrix. TODO: Remove me
+    bool dequantize;                      ///< true for quantized vertex positions.
+    glm::mat4 dequant;                    ///< The matrix to restore quantized positions.
     OGLVertexArray *vertexArray;          ///< The vertex array to use.
     cppcore::TArray<size_t> primitives;   ///< The primitives to render.
     const char *id;                       ///< The id.
 
     /// @brief The default class constructor.
-    DrawPrimitivesCmdData() : localMatrix(false), model(), vertexArray(nullptr), primitives(), id(nullptr) {
+    DrawPrimitivesCmdData() : localMatrix(false), model(), dequantize(false), dequant(1.0f), vertexArray(nullptr), primitives(), id(nullptr) {
         // empty
     }
 
@@ -252,6 +258,7 @@ struct OGLCapabilities {
     i32 mMaxTextureCoords;      ///< The maximal number of texture coordinates.
     i32 mMaxVertexAttributes;   ///< The maximum number of vertex attributes.
     bool mInstancing;           ///< Instancing is supported.
+    bool mS3TC;                 ///< BC1 and BC3 compressed textures are supported.
     const c8 *mGLSLVersionAsStr;      ///< The GLSL version as a string
     GLSLVersion mGLSLVersion;   ///< The GLSL version as an enum
 
@@ -265,6 +272,7 @@ struct OGLCapabilities {
             mMaxTextureCoords(-1),
             mMaxVertexAttributes(-1),
             mInstancing(true),
+            mS3TC(false),
             mGLSLVersionAsStr(nullptr),
             mGLSLVersion(GLSLVersion::Invalid) {
         // empty
@@ -130,6 +130,12 @@ GLenum  OGLEnum::getGLTextureFormat(PixelFormatType texFormat) {
             return GL_RGB;
         case PixelFormatType::R8G8B8A8:
             return GL_RGBA;
+        case PixelFormatType::BC1:
+            return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case PixelFormatType::BC3:
+            return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case PixelFormatType::BC5:
+            return GL_COMPRESSED_RG_RGTC2;
         case PixelFormatType::Invalid:
         default:
             break;
@@ -168,7 +174,15 @@ GLenum OGLEnum::getOGLTypeForFormat( VertexFormat format ) {
             return GL_UNSIGNED_BYTE;
         case VertexFormat::Short2:
         case VertexFormat::Short4:
+        case VertexFormat::Short2Norm:
             return GL_SHORT;
+        case VertexFormat::Half2:
+            return GL_HALF_FLOAT;
+        case VertexFormat::UShort2Norm:
+        case VertexFormat::UShort4Norm:
+            return GL_UNSIGNED_SHORT;
+        case VertexFormat::UByte4Norm:
+            return GL_UNSIGNED_BYTE;
         case VertexFormat::Count:
         case VertexFormat::Invalid:
         default:
@@ -184,6 +198,9 @@ ui32 OGLEnum::getOGLSizeForFormat( VertexFormat format ) {
             return 1;
         case VertexFormat::Float2:
         case VertexFormat::Short2:
+        case VertexFormat::Half2:
+        case VertexFormat::Short2Norm:
+        case VertexFormat::UShort2Norm:
             return 2;
         case VertexFormat::Float3:
             return 3;
@@ -191,6 +208,8 @@ ui32 OGLEnum::getOGLSizeForFormat( VertexFormat format ) {
         case VertexFormat::UByte4:
         case VertexFormat::Float4:
         case VertexFormat::Short4:
+        case VertexFormat::UShort4Norm:
+        case VertexFormat::UByte4Norm:
             return 4;
         case VertexFormat::Count:
         case VertexFormat::Invalid:
@@ -202,6 +221,20 @@ ui32 OGLEnum::getOGLSizeForFormat( VertexFormat format ) {
     return 0;
 }
 
+GLboolean OGLEnum::isOGLNormalizedFormat( VertexFormat format ) {
+    switch ( format ) {
+        case VertexFormat::Short2Norm:
+        case VertexFormat::UShort2Norm:
+        case VertexFormat::UShort4Norm:
+        case VertexFormat::UByte4Norm:
+            return GL_TRUE;
+        default:
+            break;
+    }
+
+    return GL_FALSE;
+}
+
 GLenum OGLEnum::getOGLCullState( CullState::CullMode cullMode ) {
     switch ( cullMode ) {
         case CullState::CullMode::CW:
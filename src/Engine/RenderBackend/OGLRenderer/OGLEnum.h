@@ -55,6 +55,8 @@ public:
     static GLenum getOGLTypeForFormat( VertexFormat format );
     /// @brief  Translates the vertex format type to the corresponding size.
     static ui32 getOGLSizeForFormat( VertexFormat format );
+    /// @brief  Returns GL_TRUE, if the vertex format stores normalized fixed point values.
+    static GLboolean isOGLNormalizedFormat( VertexFormat format );
     /// @brief  Translates the cull state to the corresponding GLenum type.
     static GLenum getOGLCullState( CullState::CullMode cullMode );
     /// @brief  Translates the cull-face mode to the corresponding GLenum value.
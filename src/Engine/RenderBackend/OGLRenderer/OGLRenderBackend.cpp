@@ -29,25 +29,25 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Debugging/osre_debugging.h"
 #include "IO/Uri.h"
 #include "Platform/AbstractOGLRenderContext.h"
-#include "Profiling/PerformanceCounterRegistry.h"
 #include "RenderBackend/RenderStates.h"
 #include "RenderBackend/Shader.h"
+#include "RenderBackend/TextureProcessor.h"
 
 #include <cppcore/CPPCoreCommon.h>
 #include <cppcore/Memory/MemUtils.h>
 
-#include "stb_image.h"
-
 #include <iostream>
 
 namespace OSRE::RenderBackend {
 
+using ::OSRE::Common::StringId;
 using namespace ::OSRE::Platform;
 using namespace cppcore;
 
 DECL_OSRE_LOG_MODULE(OGLRenderBackend)
 
 static constexpr ui32 NotInitedHandle = 9999999;
+static constexpr c8 ShaderCacheFolder[] = "shadercache";
 
 OGLRenderBackend::OGLRenderBackend() :
         mClearColor(0.3f, 0.3f, 0.3f, 1.0f),
@@ -57,7 +57,9 @@ OGLRenderBackend::OGLRenderBackend() :
         mActiveVertexArray(OGLNotSetId),
         mShaderInUse(nullptr),
         mFpState(nullptr),
-        mFpsCounter(nullptr) {
+        mShaderBinaryDriver(nullptr),
+        mShaderBinaryCache(nullptr),
+        mMatrixParams{} {
     mBindedTextures.resize(static_cast<size_t>(TextureStageType::Count));
     for (size_t i = 0; i < static_cast<size_t>(TextureStageType::Count); ++i) {
         mBindedTextures[i] = nullptr;
@@ -78,6 +80,7 @@ void OGLRenderBackend::enumerateGPUCaps() {
     glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &mOglCapabilities.mMaxVertexAttributes);
     mOglCapabilities.mGLSLVersionAsStr = (const c8 *)(glGetString(GL_SHADING_LANGUAGE_VERSION));
     mOglCapabilities.mGLSLVersion = getGlslVersionFromeString(mOglCapabilities.mGLSLVersionAsStr);
+    mOglCapabilities.mS3TC = GLEW_EXT_texture_compression_s3tc != 0;
 }
 
 void OGLRenderBackend::setClearColor(const Color4 &clearColor) {
@@ -123,35 +126,16 @@ const glm::mat4 &OGLRenderBackend::getMatrix(MatrixType type) const {
 }
 
 void OGLRenderBackend::applyMatrix() {
-    OGLParameter *model = getParameter("Model");
-    if (nullptr == model) {
-        UniformDataBlob *blob = UniformDataBlob::create(ParameterType::PT_Mat4, 1);
-        ::memcpy(blob->m_data, mMatrixBlock.getModelPtr(), sizeof(glm::mat4));
-        model = createParameter("Model", ParameterType::PT_Mat4, blob, 1);
-    } else {
-        memcpy(model->m_data->m_data, mMatrixBlock.getModelPtr(), sizeof(glm::mat4));
-    }
-    setParameter(model);
-
-    OGLParameter *view = getParameter("View");
-    if (nullptr == view) {
-        UniformDataBlob *blob = UniformDataBlob::create(ParameterType::PT_Mat4, 1);
-        memcpy(blob->m_data, mMatrixBlock.getViewPtr(), sizeof(glm::mat4));
-        view = createParameter("View", ParameterType::PT_Mat4, blob, 1);
-    } else {
-        memcpy(view->m_data->m_data, mMatrixBlock.getViewPtr(), sizeof(glm::mat4));
-    }
-    setParameter(view);
-
-    OGLParameter *projection = getParameter("Projection");
-    if (nullptr == projection) {
-        UniformDataBlob *blob = UniformDataBlob::create(ParameterType::PT_Mat4, 1);
-        memcpy(blob->m_data, mMatrixBlock.getProjectionPtr(), sizeof(glm::mat4));
-        projection = createParameter("Projection", ParameterType::PT_Mat4, blob, 1);
-    } else {
-        memcpy(projection->m_data->m_data, mMatrixBlock.getProjectionPtr(), sizeof(glm::mat4));
+    // The matrix parameters are looked up once, each draw only copies the data
+    static constexpr const c8 *Names[NumMatrixParams] = { "Model", "View", "Projection" };
+    const f32 *matrices[NumMatrixParams] = { mMatrixBlock.getModelPtr(), mMatrixBlock.getViewPtr(), mMatrixBlock.getProjectionPtr() };
+    for (size_t i = 0; i < NumMatrixParams; ++i) {
+        if (nullptr == mMatrixParams[i]) {
+            mMatrixParams[i] = createParameter(Names[i], ParameterType::PT_Mat4, nullptr, 1);
+        }
+        ::memcpy(mMatrixParams[i]->m_data->getData(), matrices[i], sizeof(glm::mat4));
+        setParameter(mMatrixParams[i]);
     }
-    setParameter(projection);
 }
 
 bool OGLRenderBackend::create(AbstractOGLRenderContext *renderCtx) {
@@ -188,6 +172,18 @@ bool OGLRenderBackend::create(AbstractOGLRenderContext *renderCtx) {
     c8 *slv = (c8 *)glGetString(GL_SHADING_LANGUAGE_VERSION);
     osre_info(Tag, "Supported GLSL language " + String(slv));
 
+    // Linked programs are kept on disk, a driver update invalidates them
+    if (OGLShaderBinaryDriver::isSupported()) {
+        String driverId;
+        driverId += mOGLDriverInfo.mGLVendorString != nullptr ? mOGLDriverInfo.mGLVendorString : "";
+        driverId += "|";
+        driverId += mOGLDriverInfo.mGLRendererString != nullptr ? mOGLDriverInfo.mGLRendererString : "";
+        driverId += "|";
+        driverId += mOGLDriverInfo.mGLVersionString != nullptr ? mOGLDriverInfo.mGLVersionString : "";
+        mShaderBinaryDriver = new OGLShaderBinaryDriver(driverId);
+        mShaderBinaryCache = new ShaderBinaryCache(ShaderCacheFolder, mShaderBinaryDriver);
+    }
+
     glEnable(GL_TEXTURE_2D);
     glEnable(GL_TEXTURE_3D);
     glDisable(GL_LIGHTING);
@@ -211,18 +207,14 @@ bool OGLRenderBackend::destroy() {
     releaseAllParameters();
     releaseAllPrimitiveGroups();
 
-    delete mFpsCounter;
-    mFpsCounter = nullptr;
+    delete mShaderBinaryCache;
+    mShaderBinaryCache = nullptr;
+    delete mShaderBinaryDriver;
+    mShaderBinaryDriver = nullptr;
 
     return true;
 }
 
-void OGLRenderBackend::setTimer(AbstractTimer *timer) {
-    if (nullptr == mFpsCounter) {
-        mFpsCounter = new Profiling::FPSCounter(timer);
-    }
-}
-
 void OGLRenderBackend::setRenderContext(AbstractOGLRenderContext *renderCtx) {
     if (mRenderCtx == renderCtx) {
         return;
@@ -375,7 +367,6 @@ bool OGLRenderBackend::createVertexCompArray(const VertexLayout *layout, OGLShad
         return false;
     }
 
-    size_t index(0);
     OGLVertexAttribute *attribute(nullptr);
     for (ui32 i = 0; i < layout->numComponents(); i++) {
         VertComponent &comp(layout->getAt(i));
@@ -384,9 +375,9 @@ bool OGLRenderBackend::createVertexCompArray(const VertexLayout *layout, OGLShad
         attribute->m_index = shader->getAttributeLocation(attribute->m_pAttributeName);
         attribute->m_size = OGLEnum::getOGLSizeForFormat(comp.m_format);
         attribute->m_type = OGLEnum::getOGLTypeForFormat(comp.m_format);
-        attribute->m_ptr = (GLvoid *)index;
+        attribute->m_normalized = OGLEnum::isOGLNormalizedFormat(comp.m_format);
+        attribute->m_ptr = (const GLvoid *)layout->m_offsets[i];
         attributes.add(attribute);
-        index += attribute->m_size;
     }
 
     return true;
@@ -497,7 +488,7 @@ bool OGLRenderBackend::bindVertexLayout(OGLVertexArray *va, OGLShader *shader, s
     glEnableVertexAttribArray(loc);
     glVertexAttribPointer(loc, (GLint)attrib->m_size,
             attrib->m_type,
-            GL_FALSE,
+            attrib->m_normalized,
             (GLsizei)stride,
             attrib->m_ptr);
 
@@ -521,7 +512,7 @@ bool OGLRenderBackend::bindVertexLayout(OGLVertexArray *va, OGLShader *shader, s
             glEnableVertexAttribArray(loc);
             glVertexAttribPointer(loc, (GLint)attributes[i]->m_size,
                     attributes[i]->m_type,
-                    GL_FALSE,
+                    attributes[i]->m_normalized,
                     (GLsizei)stride,
                     attributes[i]->m_ptr);
         }
@@ -600,13 +591,23 @@ OGLShader *OGLRenderBackend::createShader(const String &name, Shader *shaderInfo
     oglShader = new OGLShader(name);
     mShaders.add(oglShader);
     if (shaderInfo) {
+        HashId key = 0;
+        if (mShaderBinaryCache != nullptr) {
+            key = mShaderBinaryCache->computeKey(*shaderInfo, String());
+            if (oglShader->createFromBinaryCache(*mShaderBinaryCache, key)) {
+                return oglShader;
+            }
+        }
+
         loadShader(shaderInfo, oglShader, ShaderType::SH_VertexShaderType);
         loadShader(shaderInfo, oglShader, ShaderType::SH_FragmentShaderType);
         loadShader(shaderInfo, oglShader, ShaderType::SH_GeometryShaderType);
 
-        bool result = oglShader->createAndLink();
+        bool result = oglShader->createAndLink(mShaderBinaryCache != nullptr);
         if (!result) {
             osre_error(Tag, "Error while linking shader");
+        } else if (mShaderBinaryCache != nullptr) {
+            oglShader->storeInBinaryCache(*mShaderBinaryCache, key);
         }
     }
 
@@ -714,13 +715,14 @@ OGLTexture *OGLRenderBackend::createEmptyTexture(const String &name, TextureTarg
         mFreeTexSlots.removeBack();
         tex = mTextures[slot];
     }
+    const StringId nameId(name);
     tex->m_slot = slot;
-    m_texLookupMap[name] = slot;
+    m_texLookupMap[nameId] = slot;
 
     GLuint textureId;
     glGenTextures(1, &textureId);
     tex->m_textureId = textureId;
-    tex->m_name = name;
+    tex->m_name = nameId;
     tex->m_width = static_cast<ui32>(width);
     tex->m_height = static_cast<ui32>(height);
     tex->m_channels = static_cast<ui32>(channels);
@@ -778,6 +780,53 @@ void OGLRenderBackend::updateTexture(OGLTexture *oglTextue, ui32 offsetX, ui32 o
             oglTextue->m_height, oglTextue->m_format, GL_UNSIGNED_BYTE, data);
 }
 
+void OGLRenderBackend::uploadTextureData(OGLTexture *glTex, const Texture *tex) {
+    osre_assert(nullptr != glTex);
+    osre_assert(nullptr != tex);
+
+    // BC5 is core since OpenGL 3.0, BC1 and BC3 need the S3TC extension
+    Texture decompressed(tex->TextureName);
+    if ((tex->PixelFormat == PixelFormatType::BC1 || tex->PixelFormat == PixelFormatType::BC3) && !mOglCapabilities.mS3TC) {
+        TextureProcessor::decompress(tex, &decompressed);
+        tex = &decompressed;
+    }
+
+    glTex->m_width = tex->Width;
+    glTex->m_height = tex->Height;
+    glTex->m_channels = tex->Channels;
+    glTex->m_format = OGLEnum::getGLTextureFormat(tex->PixelFormat);
+
+    // Mip levels are tightly packed, rows of RGB data are not 4-byte aligned
+    glBindTexture(glTex->m_target, glTex->m_textureId);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    const bool compressed = TextureProcessor::isCompressed(tex->PixelFormat);
+    ui32 width = tex->Width, height = tex->Height;
+    size_t offset = 0;
+    const ui32 numMips = tex->NumMips > 0 ? tex->NumMips : 1;
+    for (ui32 level = 0; level < numMips; ++level) {
+        const size_t levelSize = TextureProcessor::getImageSize(tex->PixelFormat, width, height, tex->Channels);
+        if (compressed) {
+            glCompressedTexImage2D(glTex->m_target, level, glTex->m_format, width, height, 0, static_cast<GLsizei>(levelSize), tex->Data + offset);
+        } else {
+            glTexImage2D(glTex->m_target, level, glTex->m_format, width, height, 0, glTex->m_format, GL_UNSIGNED_BYTE, tex->Data + offset);
+        }
+        offset += levelSize;
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (numMips > 1) {
+        glTexParameteri(glTex->m_target, GL_TEXTURE_MAX_LEVEL, numMips - 1);
+    } else if (!compressed) {
+        glGenerateMipmap(glTex->m_target);
+    }
+    if (numMips > 1 || !compressed) {
+        glTexParameteri(glTex->m_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+    glTexParameterf(glTex->m_target, GL_TEXTURE_MAX_ANISOTROPY_EXT, mOglCapabilities.mMaxAniso);
+    glBindTexture(glTex->m_target, 0);
+}
+
 OGLTexture *OGLRenderBackend::createTexture(const String &name, Texture *tex) {
     if (nullptr == tex) {
         return nullptr;
@@ -788,51 +837,52 @@ OGLTexture *OGLRenderBackend::createTexture(const String &name, Texture *tex) {
         return glTex;
     }
 
-    glTex = createEmptyTexture(name, tex->TargetType, tex->PixelFormat, tex->Width, tex->Height, tex->Channels);
-    glTexImage2D(glTex->m_target, 0, GL_RGB, tex->Width, tex->Height, 0, glTex->m_format, GL_UNSIGNED_BYTE, tex->Data);
-    glGenerateMipmap(glTex->m_target);
-    glTexParameterf(glTex->m_target, GL_TEXTURE_MAX_ANISOTROPY_EXT, mOglCapabilities.mMaxAniso);
-    glBindTexture(glTex->m_target, 0);
+    // Data still decoding or broken, bind the default texture until refreshTexture is called
+    const Texture *source = tex;
+    if (nullptr == tex->Data) {
+        source = TextureLoader::getDefaultTexture();
+    }
+
+    glTex = createEmptyTexture(name, tex->TargetType, source->PixelFormat, source->Width, source->Height, source->Channels);
+    uploadTextureData(glTex, source);
 
     return glTex;
 }
 
+bool OGLRenderBackend::refreshTexture(Texture *tex) {
+    if (nullptr == tex || nullptr == tex->Data) {
+        return false;
+    }
+
+    OGLTexture *glTex = findTexture(tex->TextureName);
+    if (nullptr == glTex) {
+        // Not used yet, createTexture will pick up the data
+        return false;
+    }
+    uploadTextureData(glTex, tex);
+
+    return true;
+}
+
 OGLTexture *OGLRenderBackend::createTextureFromFile(const String &name, const IO::Uri &fileloc) {
-    OGLTexture *tex = findTexture(name);
-    if (nullptr == tex) {
-        return tex;
+    OGLTexture *glTex = findTexture(name);
+    if (nullptr != glTex) {
+        return glTex;
     }
 
     // import the texture
     const String filename = fileloc.getAbsPath();
-    i32 width = 0, height = 0, channels = 0;
-    GLubyte *data = stbi_load(filename.c_str(), &width, &height, &channels, 0);
-    if (!data) {
+    Texture tex(name);
+    if (!TextureProcessor::import(filename, &tex, TextureImportOptions())) {
         osre_debug(Tag, "Cannot load texture " + filename);
         return nullptr;
     }
 
-    // swap the texture data
-    // todo: must be done by my codec
-    for (i32 j = 0; j * 2 < height; ++j) {
-        i32 index1 = j * width * channels;
-        i32 index2 = (height - 1 - j) * width * channels;
-        for (i32 i = width * channels; i > 0; --i) {
-            GLubyte temp = data[index1];
-            data[index1] = data[index2];
-            data[index2] = temp;
-            ++index1;
-            ++index2;
-        }
-    }
-
     // create texture and fill it
-    tex = createEmptyTexture(name, TextureTargetType::Texture2D, PixelFormatType::R8G8B8, width, height, channels);
-    glTexImage2D(tex->m_target, 0, GL_RGB, width, height, 0, tex->m_format, GL_UNSIGNED_BYTE, data);
-    glBindTexture(tex->m_target, 0);
+    glTex = createEmptyTexture(name, TextureTargetType::Texture2D, tex.PixelFormat, tex.Width, tex.Height, tex.Channels);
+    uploadTextureData(glTex, &tex);
 
-    stbi_image_free(data);
-    return tex;
+    return glTex;
 }
 
 OGLTexture *OGLRenderBackend::findTexture(const String &name) const {
@@ -840,7 +890,7 @@ OGLTexture *OGLRenderBackend::findTexture(const String &name) const {
         return nullptr;
     }
 
-    std::map<String, size_t>::const_iterator it = m_texLookupMap.find(name);
+    auto it = m_texLookupMap.find(StringId::find(name));
     if (it == m_texLookupMap.end()) {
         return nullptr;
     }
@@ -893,10 +943,7 @@ void OGLRenderBackend::releaseTexture(OGLTexture *oglTexture) {
 
     mFreeTexSlots.add(oglTexture->m_slot);
 
-    std::map<String, size_t>::iterator it = m_texLookupMap.find(oglTexture->m_name);
-    if (m_texLookupMap.end() != it) {
-        it = m_texLookupMap.erase(it);
-    }
+    m_texLookupMap.erase(oglTexture->m_name);
     oglTexture->m_slot = 0;
 }
 
@@ -922,9 +969,9 @@ OGLParameter *OGLRenderBackend::createParameter(const String &name, ParameterTyp
 
     // We need to create it
     param = new OGLParameter;
-    param->m_name = name;
+    param->m_name = StringId(name);
     param->m_type = type;
-    param->m_loc = NoneLocation;
+    param->m_slot = OGLShader::getParameterSlot(param->m_name);
     param->m_numItems = numItems;
     param->m_data = UniformDataBlob::create(type, param->m_numItems);
     if (nullptr != blob) {
@@ -942,8 +989,13 @@ OGLParameter *OGLRenderBackend::getParameter(const String &name) const {
         return nullptr;
     }
 
+    const StringId nameId = StringId::find(name);
+    if (nameId.isEmpty()) {
+        return nullptr;
+    }
+
     for (ui32 i = 0; i < mParameters.size(); ++i) {
-        if (mParameters[i]->m_name == name) {
+        if (mParameters[i]->m_name == nameId) {
             return mParameters[i];
         }
     }
@@ -962,65 +1014,64 @@ void OGLRenderBackend::setParameter(OGLParameter *param) {
         return;
     }
 
-    if (NoneLocation == param->m_loc) {
-        param->m_loc = mShaderInUse->getUniformLocation(param->m_name);
-        if (NoneLocation == param->m_loc) {
-            osre_debug(Tag, "Cannot location for parameter " + param->m_name + " in shader " + mShaderInUse->getName() + ".");
-            return;
-        }
+    // The location differs between the shaders, the slot of the name indexes the table of the active one
+    const GLint loc = mShaderInUse->getUniformLocation(param->m_slot);
+    if (NoneLocation == loc) {
+        osre_debug(Tag, "Cannot location for parameter " + param->m_name.getString() + " in shader " + mShaderInUse->getName() + ".");
+        return;
     }
 
     switch (param->m_type) {
         case ParameterType::PT_Int: {
             GLint data;
             ::memcpy(&data, param->m_data->getData(), sizeof(GLint));
-            glUniform1i(param->m_loc, data);
+            glUniform1i(loc, data);
         } break;
 
         case ParameterType::PT_IntArray: {
-            glUniform1iv(param->m_loc, (GLsizei)param->m_numItems, (i32 *)param->m_data->getData());
+            glUniform1iv(loc, (GLsizei)param->m_numItems, (i32 *)param->m_data->getData());
         } break;
 
         case ParameterType::PT_Float: {
             GLfloat value;
             ::memcpy(&value, param->m_data->getData(), sizeof(GLfloat));
-            glUniform1f(param->m_loc, value);
+            glUniform1f(loc, value);
         } break;
 
         case ParameterType::PT_FloatArray: {
-            glUniform1fv(param->m_loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
+            glUniform1fv(loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
 
         } break;
 
         case ParameterType::PT_Float2: {
             GLfloat value[2] = {};
             ::memcpy(&value[0], param->m_data->getData(), sizeof(GLfloat) * 2);
-            glUniform2f(param->m_loc, value[0], value[1]);
+            glUniform2f(loc, value[0], value[1]);
         } break;
 
         case ParameterType::PT_Float2Array: {
-            glUniform2fv(param->m_loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
+            glUniform2fv(loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
         } break;
 
         case ParameterType::PT_Float3: {
             GLfloat value[3] = {};
             ::memcpy(&value[0], param->m_data->getData(), sizeof(GLfloat) * 3);
-            glUniform3f(param->m_loc, value[0], value[1], value[2]);
+            glUniform3f(loc, value[0], value[1], value[2]);
         } break;
 
         case ParameterType::PT_Float3Array: {
-            glUniform3fv(param->m_loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
+            glUniform3fv(loc, (GLsizei)param->m_numItems, (f32 *)param->m_data->getData());
 
         } break;
 
         case ParameterType::PT_Mat4: {
             glm::mat4 mat;
             ::memcpy(&mat, param->m_data->getData(), sizeof(glm::mat4));
-            glUniformMatrix4fv(param->m_loc, 1, GL_FALSE, glm::value_ptr(mat));
+            glUniformMatrix4fv(loc, 1, GL_FALSE, glm::value_ptr(mat));
         } break;
 
         case ParameterType::PT_Mat4Array: {
-            glUniformMatrix4fv(param->m_loc, (GLsizei)param->m_numItems, GL_FALSE, (f32 *)param->m_data->getData());
+            glUniformMatrix4fv(loc, (GLsizei)param->m_numItems, GL_FALSE, (f32 *)param->m_data->getData());
         } break;
 
         default:
@@ -1031,6 +1082,9 @@ void OGLRenderBackend::setParameter(OGLParameter *param) {
 
 void OGLRenderBackend::releaseAllParameters() {
     ContainerClear(mParameters);
+    for (auto &param : mMatrixParams) {
+        param = nullptr;
+    }
 }
 
 void OGLRenderBackend::setParameter(OGLParameter **param, size_t numParam) {
@@ -1057,6 +1111,7 @@ size_t OGLRenderBackend::addPrimitiveGroup(PrimitiveGroup *grp) {
     oglGrp->m_indexType = OGLEnum::getGLIndexType(grp->m_indexType);
     oglGrp->m_startIndex = (ui32)grp->m_startIndex;
     oglGrp->m_numIndices = grp->m_numIndices;
+    oglGrp->m_baseVertex = (GLint)grp->m_baseVertex;
 
     const size_t idx = mPrimitives.size();
     mPrimitives.add(oglGrp);
@@ -1066,6 +1121,31 @@ size_t OGLRenderBackend::addPrimitiveGroup(PrimitiveGroup *grp) {
 
 void OGLRenderBackend::releaseAllPrimitiveGroups() {
     ContainerClear(mPrimitives);
+    mMeshPrimitives.clear();
+}
+
+void OGLRenderBackend::setMeshPrimitiveGroups(guid meshId, const cppcore::TArray<size_t> &primGroups) {
+    mMeshPrimitives[meshId] = primGroups;
+}
+
+void OGLRenderBackend::updateMeshPrimitiveGroups(guid meshId, const size_t *ranges, size_t numGroups) {
+    auto it = mMeshPrimitives.find(meshId);
+    if (it == mMeshPrimitives.end()) {
+        osre_debug(Tag, "No primitive groups registered for mesh.");
+        return;
+    }
+
+    const cppcore::TArray<size_t> &primGroups = it->second;
+    if (primGroups.size() != numGroups) {
+        osre_error(Tag, "Number of primitive groups does not match.");
+        return;
+    }
+
+    for (size_t i = 0; i < numGroups; ++i) {
+        OGLPrimGroup *grp = mPrimitives[primGroups[i]];
+        grp->m_startIndex = static_cast<ui32>(ranges[i * 2]);
+        grp->m_numIndices = ranges[i * 2 + 1];
+    }
 }
 
 OGLFrameBuffer *OGLRenderBackend::createFrameBuffer(const String &name, ui32 width, ui32 height,
@@ -1156,12 +1236,25 @@ void OGLRenderBackend::releaseFrameBuffer(OGLFrameBuffer *oglFB) {
 void OGLRenderBackend::render(size_t primpGrpIdx) {
     OGLPrimGroup *grp = mPrimitives[primpGrpIdx];
     if (grp != nullptr) {
-        glDrawRangeElements(grp->m_primitive,
-                grp->m_startIndex,
-                (GLuint)(grp->m_startIndex + grp->m_numIndices),
-                (GLsizei)grp->m_numIndices,
-                grp->m_indexType,
-                nullptr);
+        // The start index is passed as the byte offset into the bound index buffer
+        size_t indexSize = sizeof(GLuint);
+        if (grp->m_indexType == GL_UNSIGNED_SHORT) {
+            indexSize = sizeof(GLushort);
+        } else if (grp->m_indexType == GL_UNSIGNED_BYTE) {
+            indexSize = sizeof(GLubyte);
+        }
+        if (grp->m_baseVertex != 0) {
+            glDrawElementsBaseVertex(grp->m_primitive,
+                    (GLsizei)grp->m_numIndices,
+                    grp->m_indexType,
+                    (void *)(grp->m_startIndex * indexSize),
+                    grp->m_baseVertex);
+        } else {
+            glDrawElements(grp->m_primitive,
+                    (GLsizei)grp->m_numIndices,
+                    grp->m_indexType,
+                    (const void *)(grp->m_startIndex * indexSize));
+        }
     }
 }
 
@@ -1183,10 +1276,6 @@ void OGLRenderBackend::renderFrame() {
     osre_assert(nullptr != mRenderCtx);
 
     mRenderCtx->update();
-    if (nullptr != mFpsCounter) {
-        const ui32 fps = mFpsCounter->getFPS();
-        Profiling::PerformanceCounterRegistry::setCounter("fps", fps);
-    }
 }
 
 void OGLRenderBackend::setFixedPipelineStates(const RenderStates &states) {
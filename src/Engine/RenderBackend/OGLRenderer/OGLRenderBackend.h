@@ -22,7 +22,6 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #pragma once
 
-#include "Profiling/FPSCounter.h"
 #include "RenderBackend/RenderBackendService.h"
 #include "RenderBackend/RenderCommon.h"
 #include "RenderBackend/TransformMatrixBlock.h"
@@ -32,6 +31,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cppcore/Container/TArray.h>
 
 #include <map>
+#include <unordered_map>
 
 namespace OSRE {
 
@@ -49,7 +49,9 @@ namespace Platform {
 namespace RenderBackend {
 
 class OGLShader;
+class OGLShaderBinaryDriver;
 class Shader;
+class ShaderBinaryCache;
 
 struct ClearState;
 struct CullState;
@@ -102,7 +104,6 @@ public:
 
 	/// @brief 
 	bool destroy();
-	void setTimer(Platform::AbstractTimer *timer);
 	void setRenderContext(Platform::AbstractOGLRenderContext *renderCtx);
 	void clearRenderTarget(const ClearState &clearState);
 	void setViewport(i32 x, i32 y, i32 w, i32 h);
@@ -137,6 +138,7 @@ public:
     OGLTexture *createDefaultTexture(TextureTargetType target, PixelFormatType pixelFormat, ui32 width, ui32 height);
 	void updateTexture(OGLTexture *pOGLTextue, ui32 offsetX, ui32 offsetY, c8 *data, size_t size);
 	OGLTexture *createTexture(const String &name, Texture *tex);
+	bool refreshTexture(Texture *tex);
 	OGLTexture *createTextureFromFile(const String &name, const IO::Uri &fileloc);
 	OGLTexture *findTexture(const String &name) const;
 	bool bindTexture(OGLTexture *pOGLTextue, TextureStageType stageType);
@@ -150,6 +152,8 @@ public:
 	void releaseAllParameters();
 	size_t addPrimitiveGroup(PrimitiveGroup *grp);
 	void releaseAllPrimitiveGroups();
+    void setMeshPrimitiveGroups(guid meshId, const cppcore::TArray<size_t> &primGroups);
+    void updateMeshPrimitiveGroups(guid meshId, const size_t *ranges, size_t numGroups);
     OGLFrameBuffer *createFrameBuffer(const String &name, ui32 width, ui32 height, PixelFormatType pixelFormat, bool depthBuffer);
 	void bindFrameBuffer(OGLFrameBuffer *oglFB);
 	OGLFrameBuffer *getFrameBufferByName(const String &name) const;
@@ -161,6 +165,11 @@ public:
     void setExtensions(const String &extensions);
     const String &getExtensions() const;
     
+private:
+    static constexpr size_t NumMatrixParams = 3;
+
+	void uploadTextureData(OGLTexture *glTex, const Texture *tex);
+
 private:
     Color4 mClearColor;
     TransformMatrixBlock mMatrixBlock;
@@ -174,16 +183,19 @@ private:
 	cppcore::TArray<OGLTexture *> mTextures;
     cppcore::TArray<OGLTexture *> mBindedTextures;
 	cppcore::TArray<size_t> mFreeTexSlots;
-	std::map<String, size_t> m_texLookupMap;
+	std::unordered_map<Common::StringId, size_t, Common::StringId::Hash> m_texLookupMap;
 	cppcore::TArray<OGLParameter *> mParameters;
 	OGLShader *mShaderInUse;
 	cppcore::TArray<size_t> mFreeBufferSlots;
 	cppcore::TArray<OGLPrimGroup*> mPrimitives;
+	std::map<guid, cppcore::TArray<size_t>> mMeshPrimitives;
 	RenderStates *mFpState;
-	Profiling::FPSCounter *mFpsCounter;
 	OGLCapabilities mOglCapabilities;
 	cppcore::TArray<OGLFrameBuffer*> mFrameFuffers;
     OGLDriverInfo mOGLDriverInfo;
+    OGLShaderBinaryDriver *mShaderBinaryDriver;
+    ShaderBinaryCache *mShaderBinaryCache;
+    OGLParameter *mMatrixParams[NumMatrixParams];
 };
 
 } // Namespace RenderBackend
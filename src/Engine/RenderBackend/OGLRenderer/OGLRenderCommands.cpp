@@ -186,8 +186,12 @@ OGLVertexArray *setupBuffers(Mesh *mesh, OGLRenderBackend *rb, OGLShader *oglSha
 
     // enable vertex attribute arrays
     TArray<OGLVertexAttribute *> attributes;
-    rb->createVertexCompArray(mesh->getVertexType(), oglShader, attributes);
-    const size_t stride = Mesh::getVertexSize(mesh->getVertexType());
+    if (mesh->getVertexLayout() != nullptr) {
+        rb->createVertexCompArray(mesh->getVertexLayout(), oglShader, attributes);
+    } else {
+        rb->createVertexCompArray(mesh->getVertexType(), oglShader, attributes);
+    }
+    const size_t stride = mesh->getVertexStride();
     rb->bindVertexLayout(vertexArray, oglShader, stride, attributes);
     rb->releaseVertexCompArray(attributes);
 
@@ -204,7 +208,7 @@ OGLVertexArray *setupBuffers(Mesh *mesh, OGLRenderBackend *rb, OGLShader *oglSha
 
 void setupPrimDrawCmd(const char *id, bool useLocalMatrix, const glm::mat4 &model,
         const TArray<size_t> &primGroups, OGLRenderBackend *rb,
-        OGLRenderEventHandler *eh, OGLVertexArray *va) {
+        OGLRenderEventHandler *eh, OGLVertexArray *va, const glm::mat4 *dequant) {
     if (id == nullptr || rb == nullptr || eh == nullptr || va == nullptr) {
         osre_error(Tag, "Invalid parameter.");
         return;
@@ -220,6 +224,10 @@ void setupPrimDrawCmd(const char *id, bool useLocalMatrix, const glm::mat4 &mode
         drawPrimitiveCmdData->model = model;
         drawPrimitiveCmdData->localMatrix = useLocalMatrix;
     }
+    if (dequant != nullptr) {
+        drawPrimitiveCmdData->dequant = *dequant;
+        drawPrimitiveCmdData->dequantize = true;
+    }
     drawPrimitiveCmdData->id = id;
     drawPrimitiveCmdData->vertexArray = va;
     drawPrimitiveCmdData->primitives.reserve(primGroups.size());
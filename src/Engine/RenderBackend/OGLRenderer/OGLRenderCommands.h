@@ -69,10 +69,10 @@ void setupParameter(UniformVar* param, OGLRenderBackend* rb, OGLRenderEventHandl
 /// @brief Setup for opengl buffers.
 OGLVertexArray* setupBuffers(Mesh* mesh, OGLRenderBackend* rb, OGLShader* oglShader);
 
-/// @brief Setup for render calls.
+/// @brief Setup for render calls, dequant is the optional matrix for quantized vertex positions.
 void setupPrimDrawCmd(const char* id, bool useLocalMatrix, const glm::mat4& model,
     const cppcore::TArray<size_t>& primGroups, OGLRenderBackend* rb,
-    OGLRenderEventHandler* eh, OGLVertexArray* va);
+    OGLRenderEventHandler* eh, OGLVertexArray* va, const glm::mat4 *dequant = nullptr);
 
 /// @brief Setup for instanced render calls.
 void setupInstancedDrawCmd(const char* id, const cppcore::TArray<size_t>& ids, OGLRenderBackend* rb,
@@ -34,9 +34,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Platform/AbstractOGLRenderContext.h"
 #include "Platform/AbstractWindow.h"
 #include "Platform/PlatformInterface.h"
-#include "Profiling/PerformanceCounterRegistry.h"
+#include "Profiling/FrameStatistics.h"
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/TextureDecoder.h"
 
 #include <cppcore/Container/TArray.h>
 
@@ -120,7 +121,6 @@ bool OGLRenderEventHandler::onAttached(const EventData *) {
     }
 
     m_oglBackend = new OGLRenderBackend;
-    m_oglBackend->setTimer(PlatformInterface::getInstance()->getTimer());
 
     return true;
 }
@@ -184,15 +184,7 @@ bool OGLRenderEventHandler::onCreateRenderer(const EventData *eventData) {
     String path = App::AssetRegistry::resolvePathFromUri(fontUri);
     fontUri.setPath(path);
     m_renderCmdBuffer = new RenderCmdBuffer(m_oglBackend, m_renderCtx);
-
-    bool ok = Profiling::PerformanceCounterRegistry::create();
-    if (!ok) {
-        osre_error(Tag, "Error while destroying performance counters.");
-        return false;
-    }
-
     mActivePipeline = createRendererEvData->RequestedPipeline;
-    Profiling::PerformanceCounterRegistry::registerCounter("fps");
 
     return true;
 }
@@ -204,10 +196,6 @@ bool OGLRenderEventHandler::onDestroyRenderer(const Common::EventData *) {
         return false;
     }
 
-    if (!Profiling::PerformanceCounterRegistry::destroy()) {
-        osre_error(Tag, "Error while destroying performance counters.");
-    }
-
     onClearGeo(nullptr);
     m_renderCtx->destroy();
     delete m_renderCtx;
@@ -252,10 +240,19 @@ bool OGLRenderEventHandler::onRenderFrame(const EventData *) {
     osre_assert(nullptr != m_renderCmdBuffer);
     osre_assert(m_renderCtx != nullptr);
 
+    Profiling::FrameStatistics *frameStatistics = Profiling::FrameStatistics::getInstance();
+    if (frameStatistics != nullptr) {
+        frameStatistics->beginFrame(Profiling::FrameThread::Render);
+    }
+
     m_renderCmdBuffer->onPreRenderFrame(mActivePipeline);
     m_renderCmdBuffer->onRenderFrame();
     m_renderCmdBuffer->onPostRenderFrame();
 
+    if (frameStatistics != nullptr) {
+        frameStatistics->endFrame(Profiling::FrameThread::Render);
+    }
+
     return true;
 }
 
@@ -272,6 +269,9 @@ bool OGLRenderEventHandler::addMeshes(const c8 *id, cppcore::TArray<size_t> &pri
             const size_t primIdx(m_oglBackend->addPrimitiveGroup(currentMesh->getPrimitiveGroupAt(i)));
             primGroups.add(primIdx);
         }
+        if (currentMesh->getNumberOfLods() > 1) {
+            m_oglBackend->setMeshPrimitiveGroups(currentMesh->getId(), primGroups);
+        }
 
         // create the default material
         SetMaterialStageCmdData *data = setupMaterial(currentMesh->getMaterial(), m_oglBackend, this);
@@ -287,7 +287,8 @@ bool OGLRenderEventHandler::addMeshes(const c8 *id, cppcore::TArray<size_t> &pri
         // setup the render calls
         if (0 == currentMeshEntry->numInstances) {
             setupPrimDrawCmd(id, currentMesh->isLocal(), currentMesh->getLocalMatrix(),
-                    primGroups, m_oglBackend, this, m_vertexArray);
+                    primGroups, m_oglBackend, this, m_vertexArray,
+                    currentMesh->hasDequantMatrix() ? &currentMesh->getDequantMatrix() : nullptr);
         } else {
             setupInstancedDrawCmd(id, primGroups, m_oglBackend, this, m_vertexArray,
                     currentMeshEntry->numInstances);
@@ -358,6 +359,9 @@ bool OGLRenderEventHandler::onInitRenderPasses(const Common::EventData *eventDat
                         const size_t primIdx(m_oglBackend->addPrimitiveGroup(currentMesh->getPrimitiveGroupAt(i)));
                         primGroups.add(primIdx);
                     }
+                    if (currentMesh->getNumberOfLods() > 1) {
+                        m_oglBackend->setMeshPrimitiveGroups(currentMesh->getId(), primGroups);
+                    }
 
                     // create the default material
                     SetMaterialStageCmdData *data = setupMaterial(currentMesh->getMaterial(), m_oglBackend, this);
@@ -373,7 +377,8 @@ bool OGLRenderEventHandler::onInitRenderPasses(const Common::EventData *eventDat
                     // setup the render calls
                     if (0 == currentMeshEntry->numInstances) {
                         setupPrimDrawCmd(currentBatchData->m_id, currentMesh->isLocal(), currentMesh->getLocalMatrix(),
-                                primGroups, m_oglBackend, this, m_vertexArray);
+                                primGroups, m_oglBackend, this, m_vertexArray,
+                                currentMesh->hasDequantMatrix() ? &currentMesh->getDequantMatrix() : nullptr);
                     } else {
                         setupInstancedDrawCmd(currentBatchData->m_id, primGroups, m_oglBackend, this, m_vertexArray,
                                 currentMeshEntry->numInstances);
@@ -422,6 +427,16 @@ void OGLRenderEventHandler::onHandleCommit(FrameSubmitCmd *cmd) {
         m_oglBackend->bindBuffer(buffer);
         m_oglBackend->copyDataToBuffer(buffer, cmd->m_data, cmd->m_size, BufferAccessType::ReadWrite);
         m_oglBackend->unbindBuffer(buffer);
+    } else if (cmd->m_updateFlags & (ui32)FrameSubmitCmd::UpdateLod) {
+        const size_t numGroups = cmd->m_size / (2 * sizeof(size_t));
+        m_oglBackend->updateMeshPrimitiveGroups(cmd->m_meshId, reinterpret_cast<const size_t *>(cmd->m_data), numGroups);
+    } else if (cmd->m_updateFlags & (ui32)FrameSubmitCmd::UpdateTexture) {
+        // Decoded data is swapped in here, the render thread is the only reader of the texture data
+        if (cmd->m_decodedTexture != nullptr) {
+            TextureDecoder::apply(cmd->m_texture, cmd->m_decodedTexture);
+            cmd->m_decodedTexture = nullptr;
+        }
+        m_oglBackend->refreshTexture(cmd->m_texture);
     } else if (cmd->m_updateFlags & (ui32)FrameSubmitCmd::AddRenderData) {
         for (ui32 i = 0; i < cmd->m_updatedPasses.size(); ++i) {
             PassData *pd = cmd->m_updatedPasses[i];
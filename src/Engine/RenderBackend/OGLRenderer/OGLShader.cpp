@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IO/Stream.h"
 
 #include <iostream>
+#include <unordered_map>
 
 namespace OSRE::RenderBackend {
 
@@ -49,8 +50,6 @@ OGLShader::~OGLShader() {
         mIsInUse = false;
     }
 
-    ContainerClear(mAttribParams);
-    ContainerClear(mUniformParams);
     for (ui32 i = 0; i < static_cast<ui32>(ShaderType::Count); ++i) {
         if (0 != mShaders[i]) {
             glDeleteShader(mShaders[i]);
@@ -91,7 +90,7 @@ bool OGLShader::loadFromStream(ShaderType type, IO::Stream &stream) {
         return false;
     }
 
-    const size_t filesize = stream.getSize();
+    const size_t filesize = static_cast<size_t>(stream.getSize());
     if (0 == filesize) {
         return true;
     }
@@ -103,7 +102,7 @@ bool OGLShader::loadFromStream(ShaderType type, IO::Stream &stream) {
     return retCode;
 }
 
-bool OGLShader::createAndLink() {
+bool OGLShader::createAndLink(bool retrievable) {
     if (isCompiled()) {
         osre_warn(Tag, "Trying to compile shader program, which was compiled before.");
         return true;
@@ -124,6 +123,10 @@ bool OGLShader::createAndLink() {
         glAttachShader(mShaderprog, mShaders[static_cast<i32>(ShaderType::SH_GeometryShaderType)]);
     }
 
+    if (retrievable) {
+        glProgramParameteri(mShaderprog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     GLint status(0);
     glLinkProgram(mShaderprog);
     glGetProgramiv(mShaderprog, GL_LINK_STATUS, &status);
@@ -140,6 +143,38 @@ bool OGLShader::createAndLink() {
     return mIsCompiledAndLinked;
 }
 
+bool OGLShader::createFromBinaryCache(ShaderBinaryCache &cache, HashId key) {
+    if (isCompiled()) {
+        osre_warn(Tag, "Trying to load shader program, which was compiled before.");
+        return true;
+    }
+
+    mShaderprog = glCreateProgram();
+    if (0 == mShaderprog) {
+        osre_error(Tag, "Error while creating shader program.");
+        return false;
+    }
+    if (!cache.load(key, mShaderprog)) {
+        glDeleteProgram(mShaderprog);
+        mShaderprog = 0;
+        return false;
+    }
+
+    getActiveAttributeList();
+    getActiveUniformList();
+    mIsCompiledAndLinked = true;
+
+    return mIsCompiledAndLinked;
+}
+
+bool OGLShader::storeInBinaryCache(ShaderBinaryCache &cache, HashId key) const {
+    if (!isCompiled()) {
+        return false;
+    }
+
+    return cache.store(key, mShaderprog);
+}
+
 void OGLShader::use() {
     if (mIsInUse) {
         return;
@@ -158,35 +193,22 @@ void OGLShader::unuse() {
     glUseProgram(0);
 }
 
-bool OGLShader::hasAttribute(const String &attribute) {
-    if (mShaderprog == 0) {
-        return false;
-    }
-
-    const GLint location = glGetAttribLocation(mShaderprog, attribute.c_str());
-    return InvalidLocationId != location;
+bool OGLShader::hasAttribute(const String &attribute) const {
+    return InvalidLocationId != getAttributeLocation(attribute);
 }
 
 void OGLShader::addAttribute(const String &attribute) {
-    const GLint location = glGetAttribLocation(mShaderprog, attribute.c_str());
-    mAttributeMap[attribute] = location;
-    if (InvalidLocationId == location) {
+    if (InvalidLocationId == getAttributeLocation(attribute)) {
         osre_debug(Tag, "Cannot find attribute " + attribute + " in shader.");
     }
 }
 
-bool OGLShader::hasUniform(const String &uniform) {
-    if (0 == mShaderprog) {
-        return false;
-    }
-    const GLint location = glGetUniformLocation(mShaderprog, uniform.c_str());
-    return InvalidLocationId != location;
+bool OGLShader::hasUniform(const String &uniform) const {
+    return InvalidLocationId != getUniformLocation(uniform);
 }
 
 void OGLShader::addUniform(const String &uniform) {
-    const GLint location = glGetUniformLocation(mShaderprog, uniform.c_str());
-    mUniformLocationMap[uniform] = location;
-    if (InvalidLocationId == location) {
+    if (InvalidLocationId == getUniformLocation(uniform)) {
         osre_debug(Tag, "Cannot find uniform variable " + uniform + " in shader.");
     }
 }
@@ -202,51 +224,66 @@ static i32 getActiveParam(ui32 progId, GLenum type) {
     return params;
 }
 
-void OGLShader::getActiveAttributeList() {
-    const i32 numAtttibs(getActiveParam(mShaderprog, GL_ACTIVE_ATTRIBUTES));
-    if (numAtttibs < 1) {
+void OGLShader::setLocation(LocationArray &locations, const String &name, GLint location) {
+    const ui32 slot = getParameterSlot(name);
+    if (slot >= locations.size()) {
+        locations.resize(slot + 1, InvalidLocationId);
+    }
+    locations[slot] = location;
+}
+
+/// Arrays are reported as "name[0]", the parameters use the plain name. Struct array members
+/// like "lights[1].pos" keep their element index.
+static String getBaseName(const c8 *name) {
+    static constexpr c8 ArraySuffix[] = "[0]";
+    static constexpr size_t ArraySuffixLen = sizeof(ArraySuffix) - 1;
+
+    String baseName(name);
+    if (baseName.size() > ArraySuffixLen &&
+            0 == baseName.compare(baseName.size() - ArraySuffixLen, ArraySuffixLen, ArraySuffix)) {
+        baseName.resize(baseName.size() - ArraySuffixLen);
+    }
+
+    return baseName;
+}
+
+void OGLShader::setAttributeLocation(const c8 *name, GLint location) {
+    if (nullptr == name || InvalidLocationId == location) {
+        return;
+    }
+    setLocation(mAttributeLocations, getBaseName(name), location);
+}
+
+void OGLShader::setUniformLocation(const c8 *name, GLint location) {
+    if (nullptr == name || InvalidLocationId == location) {
         return;
     }
+    setLocation(mUniformLocations, getBaseName(name), location);
+}
 
+void OGLShader::getActiveAttributeList() {
+    mAttributeLocations.clear();
+    const i32 numAtttibs(getActiveParam(mShaderprog, GL_ACTIVE_ATTRIBUTES));
     for (i32 i = 0; i < numAtttibs; i++) {
         GLint actual_length(0), size(0);
         GLenum type;
-        c8 name[MaxLen];
+        c8 name[MaxLen] = { '\0' };
         glGetActiveAttrib(mShaderprog, i, MaxLen, &actual_length, &size, &type, name);
-        if (size > 1) {
-            for (i32 attribIdx = 0; attribIdx < size; attribIdx++) {
-                ActiveParameter *attribParam = new ActiveParameter;
-                std::stringstream stream;
-                stream << name << attribIdx;
-                strncpy(attribParam->name, stream.str().c_str(), stream.str().size());
-                attribParam->location = glGetAttribLocation(mShaderprog, attribParam->name);
-                mAttribParams.add(attribParam);
-            }
-        } else {
-            ActiveParameter *attribParam = new ActiveParameter;
-            strncpy(attribParam->name, name, strlen(name));
-            attribParam->location = glGetAttribLocation(mShaderprog, attribParam->name);
-            mAttribParams.add(attribParam);
-        }
+        setAttributeLocation(name, glGetAttribLocation(mShaderprog, name));
     }
 }
 
 void OGLShader::getActiveUniformList() {
+    mUniformLocations.clear();
     const i32 numUniforms(getActiveParam(mShaderprog, GL_ACTIVE_UNIFORMS));
-    if (numUniforms < 1) {
-        return;
-    }
-
     for (i32 i = 0; i < numUniforms; i++) {
         GLint actual_length(0), size(0);
         GLenum type;
-        c8 name[MaxLen];
-        ::memset(name, '\0', sizeof(c8) * MaxLen);
+        c8 name[MaxLen] = { '\0' };
         glGetActiveUniform(mShaderprog, i, MaxLen, &actual_length, &size, &type, name);
-        ActiveParameter *attribParam = new ActiveParameter;
-        strncpy(attribParam->name, name, strlen(name));
-        attribParam->location = glGetUniformLocation(mShaderprog, name);
-        mAttribParams.add(attribParam);
+
+        // Members of uniform blocks have no location and are skipped
+        setUniformLocation(name, glGetUniformLocation(mShaderprog, name));
     }
 }
 
@@ -265,22 +302,107 @@ bool OGLShader::isCompiled() const {
     return mIsCompiledAndLinked;
 }
 
-GLint OGLShader::getAttributeLocation(const String &attribute) {
-    const GLint loc = mAttributeMap[attribute];
-    return loc;
+GLint OGLShader::getAttributeLocation(const String &attribute) const {
+    return getAttributeLocation(findParameterSlot(attribute));
 }
 
-GLint OGLShader::getUniformLocation(const String &uniform) {
-    if (uniform.empty()) {
-        return InvalidLocationId;
+GLint OGLShader::getUniformLocation(const String &uniform) const {
+    return getUniformLocation(findParameterSlot(uniform));
+}
+
+/// The slots of all parameter names, only used on the render thread.
+static std::unordered_map<StringId, ui32, StringId::Hash> sParameterSlots;
+
+ui32 OGLShader::getParameterSlot(const String &name) {
+    return getParameterSlot(StringId(name));
+}
+
+ui32 OGLShader::getParameterSlot(StringId name) {
+    if (name.isEmpty()) {
+        return NoneSlot;
     }
 
-    std::map<String, GLint>::iterator it = mUniformLocationMap.find(uniform);
-    if (mUniformLocationMap.end() == it) {
-        return InvalidLocationId;
+    auto it = sParameterSlots.find(name);
+    if (it != sParameterSlots.end()) {
+        return it->second;
+    }
+    const ui32 slot = static_cast<ui32>(sParameterSlots.size());
+    sParameterSlots[name] = slot;
+
+    return slot;
+}
+
+ui32 OGLShader::findParameterSlot(const String &name) {
+    return findParameterSlot(StringId::find(name));
+}
+
+ui32 OGLShader::findParameterSlot(StringId name) {
+    if (name.isEmpty()) {
+        return NoneSlot;
+    }
+
+    auto it = sParameterSlots.find(name);
+    if (it == sParameterSlots.end()) {
+        return NoneSlot;
+    }
+
+    return it->second;
+}
+
+OGLShaderBinaryDriver::OGLShaderBinaryDriver(const String &driverId) :
+        ShaderBinaryDriver(),
+        mDriverId(driverId) {
+    // empty
+}
+
+bool OGLShaderBinaryDriver::isSupported() {
+    if (GLEW_VERSION_4_1 == 0 && GLEW_ARB_get_program_binary == 0) {
+        return false;
+    }
+
+    // Drivers may support the extension without any binary format
+    GLint numFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+
+    return numFormats > 0;
+}
+
+String OGLShaderBinaryDriver::getDriverId() const {
+    return mDriverId;
+}
+
+bool OGLShaderBinaryDriver::getProgramBinary(ui32 program, ui32 &format, ProgramBinary &binary) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return false;
+    }
+
+    binary.resize(static_cast<size_t>(length));
+    GLenum binaryFormat = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &binaryFormat, binary.data());
+    if (written <= 0) {
+        binary.clear();
+        return false;
+    }
+    binary.resize(static_cast<size_t>(written));
+    format = binaryFormat;
+
+    return true;
+}
+
+bool OGLShaderBinaryDriver::setProgramBinary(ui32 program, ui32 format, const uc8 *data, size_t size) {
+    if (data == nullptr || size == 0) {
+        return false;
     }
-    const GLint loc = mUniformLocationMap[uniform];
-    return loc;
+
+    // A driver update may reject the binary, the link status tells
+    glProgramBinary(program, format, data, static_cast<GLsizei>(size));
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+    return status == GL_TRUE;
 }
 
 } // namespace OSRE::RenderBackend
\ No newline at end of file
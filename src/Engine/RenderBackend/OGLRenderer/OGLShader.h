@@ -26,9 +26,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/osre_common.h"
 #include "Common/Object.h"
 #include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/OGLRenderer/OGLCommon.h"
+#include "RenderBackend/ShaderBinaryCache.h"
 
 #include <GL/glew.h>
-#include <map>
+#include <vector>
 
 namespace OSRE {
 
@@ -53,19 +55,8 @@ public:
     /// @brief Buffer length.
     static constexpr ui32 MaxLen = 64u;
 
-    /// @brief Declares an active parameter.
-    struct ActiveParameter {
-        c8    name[MaxLen];
-        GLint location;
-
-        ActiveParameter() :
-                name(), location(InvalidLocationId) {
-            ::memset(name, '\0', sizeof(c8) * MaxLen);
-        }
-    };
-
-    ///	@brief  Type for parameter shader arrays in OpenGL.
-    using ParameterArray = ::cppcore::TArray<ActiveParameter *>;
+    /// @brief  Type for the locations of a shader, indexed by the parameter slot.
+    using LocationArray = std::vector<GLint>;
 
     /// @brief  The class constructor.
     /// @param[in] name     The name for the shader.
@@ -87,8 +78,21 @@ public:
     bool loadFromStream( ShaderType type, IO::Stream &stream );
 
     /// @brief  Will create and link a shader program.
+    /// @param  retrievable [in] true to allow reading the program binary for the binary cache.
     /// @return true, if create & link was successful, false in case of an error.
-    bool createAndLink();
+    bool createAndLink(bool retrievable = false);
+
+    /// @brief  Will create the shader program from the binary cache, no source will be compiled.
+    /// @param  cache   [in] The binary cache.
+    /// @param  key     [in] The key of the program.
+    /// @return true, if the program was loaded, false if it must be compiled.
+    bool createFromBinaryCache(ShaderBinaryCache &cache, HashId key);
+
+    /// @brief  Will store the linked program in the binary cache.
+    /// @param  cache   [in] The binary cache.
+    /// @param  key     [in] The key of the program.
+    /// @return true, if the program was stored.
+    bool storeInBinaryCache(ShaderBinaryCache &cache, HashId key) const;
 
     /// @brief  Will bind this program to the current render context.
     void use();
@@ -100,9 +104,9 @@ public:
 	///         The shader program must be compiled before.
 	///	@param	attribute	[in] The name of the attribute to look for.
 	///	@return	true, if the attribute is used in the shader program, false if not.
-    bool hasAttribute( const String& attribute );
+    bool hasAttribute( const String& attribute ) const;
 
-    /// @brief  Adds a new attribute to the shader.
+    /// @brief  Will check that an attribute expected by the material is used by the shader.
     /// @param  attribute   [in] The name of the attribute.
     void addAttribute( const String& attribute );
 
@@ -110,16 +114,16 @@ public:
 	///         The shader program must be compiled before.
 	///	@param	uniform   	[in] The name of the attribute to look for.
 	///	@return	true, if the uniform is used in the shader program, false if not.
-	bool hasUniform( const String& uniform );
+	bool hasUniform( const String& uniform ) const;
 
-    /// @brief  Adds a new uniform to the shader.
+    /// @brief  Will check that a uniform expected by the material is used by the shader.
     /// @param  uniform     [in] The name of the uniform.
     void addUniform( const String& uniform );
 
-    /// @brief  Will create a list with all active attributes.
+    /// @brief  Will store the locations of all active attributes in the attribute table.
     void getActiveAttributeList();
 
-    /// @brief  Will create a list with all active uniforms.
+    /// @brief  Will store the locations of all active uniforms in the uniform table.
     void getActiveUniformList();
 
     /// @brief  Logs a compile and link error.
@@ -130,25 +134,108 @@ public:
 	///	@return	true, if the shader is compiled with success, false if not.
 	bool isCompiled() const;
 
-    GLint getAttributeLocation(const String &attribute);
-    GLint getUniformLocation(const String &uniform);
+    /// @brief  Will return the location of an attribute.
+    /// @param  attribute   [in] The name of the attribute.
+    /// @return The location or InvalidLocationId, if the attribute is not used.
+    GLint getAttributeLocation(const String &attribute) const;
+
+    /// @brief  Will return the location of an attribute by its slot.
+    /// @param  slot        [in] The parameter slot of the attribute name.
+    /// @return The location or InvalidLocationId, if the attribute is not used.
+    GLint getAttributeLocation(ui32 slot) const;
+
+    /// @brief  Will return the location of a uniform.
+    /// @param  uniform     [in] The name of the uniform.
+    /// @return The location or InvalidLocationId, if the uniform is not used.
+    GLint getUniformLocation(const String &uniform) const;
+
+    /// @brief  Will return the location of a uniform by its slot, used for each draw.
+    /// @param  slot        [in] The parameter slot of the uniform name.
+    /// @return The location or InvalidLocationId, if the uniform is not used.
+    GLint getUniformLocation(ui32 slot) const;
+
+    /// @brief  Will store the location of an active attribute as reported by the driver.
+    /// @param  name        [in] The reported name, a trailing "[0]" of an array is removed.
+    /// @param  location    [in] The location, InvalidLocationId is ignored.
+    void setAttributeLocation(const c8 *name, GLint location);
+
+    /// @brief  Will store the location of an active uniform as reported by the driver.
+    /// @param  name        [in] The reported name, a trailing "[0]" of an array is removed.
+    /// @param  location    [in] The location, InvalidLocationId is ignored.
+    void setUniformLocation(const c8 *name, GLint location);
+
+    /// @brief  Will return the slot of a parameter name, a new slot is assigned to unknown names.
+    ///         The slots are shared by all shaders and must only be used on the render thread.
+    /// @param  name        [in] The name of the uniform or attribute.
+    /// @return The slot.
+    static ui32 getParameterSlot(const String &name);
+
+    /// @brief  Will return the slot of an interned parameter name, a new slot is assigned to unknown names.
+    /// @param  name        [in] The interned name of the uniform or attribute.
+    /// @return The slot.
+    static ui32 getParameterSlot(Common::StringId name);
+
+    /// @brief  Will return the slot of a parameter name.
+    /// @param  name        [in] The name of the uniform or attribute.
+    /// @return The slot or NoneSlot, if no shader or parameter used the name yet.
+    static ui32 findParameterSlot(const String &name);
+
+    /// @brief  Will return the slot of an interned parameter name.
+    /// @param  name        [in] The interned name of the uniform or attribute.
+    /// @return The slot or NoneSlot, if no shader or parameter used the name yet.
+    static ui32 findParameterSlot(Common::StringId name);
 
     // No copying
     OGLShader( const OGLShader & ) = delete;
     OGLShader &operator = ( const OGLShader & ) = delete;
 
 private:
-    ParameterArray mAttribParams;
-    ParameterArray mUniformParams;
+    static void setLocation(LocationArray &locations, const String &name, GLint location);
 
+private:
     ui32 mShaderprog;
     ui32 mNumShader;
     ui32 mShaders[static_cast<size_t>(ShaderType::Count)];
-    std::map<String, GLint> mAttributeMap;
-    std::map<String, GLint> mUniformLocationMap;
+    LocationArray mAttributeLocations;
+    LocationArray mUniformLocations;
     bool mIsCompiledAndLinked;
 	bool mIsInUse;
 };
 
+inline GLint OGLShader::getAttributeLocation(ui32 slot) const {
+    return slot < mAttributeLocations.size() ? mAttributeLocations[slot] : InvalidLocationId;
+}
+
+inline GLint OGLShader::getUniformLocation(ui32 slot) const {
+    return slot < mUniformLocations.size() ? mUniformLocations[slot] : InvalidLocationId;
+}
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements the program binary access for the shader binary cache with 
+///         glGetProgramBinary and glProgramBinary.
+//-------------------------------------------------------------------------------------------------
+class OGLShaderBinaryDriver final : public ShaderBinaryDriver {
+public:
+    /// @brief  The class constructor.
+    /// @param  driverId    [in] The driver id, vendor, renderer and version.
+    explicit OGLShaderBinaryDriver(const String &driverId);
+
+    /// @brief  The class destructor.
+    ~OGLShaderBinaryDriver() override = default;
+
+    /// @brief  Returns true, if the context can retrieve and load program binaries.
+    /// @return true if supported.
+    static bool isSupported();
+
+    String getDriverId() const override;
+    bool getProgramBinary(ui32 program, ui32 &format, ProgramBinary &binary) override;
+    bool setProgramBinary(ui32 program, ui32 format, const uc8 *data, size_t size) override;
+
+private:
+    String mDriverId;
+};
+
 } // Namespace RenderBackend
 } // Namespace OSRE
@@ -25,6 +25,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "RenderBackend/OGLRenderer/OGLRenderBackend.h"
 #include "Debugging/osre_debugging.h"
 #include "Platform/AbstractOGLRenderContext.h"
+#include "Profiling/CpuProfiler.h"
 
 namespace OSRE::RenderBackend {
 
@@ -91,6 +92,7 @@ void RenderCmdBuffer::onPreRenderFrame(Pipeline *pipeline) {
 }
 
 void RenderCmdBuffer::onRenderFrame() {
+    OSRE_PROFILE_SCOPE("RenderCmdBuffer::onRenderFrame");
     if (mPipeline == nullptr) {
         return;
     }
@@ -157,7 +159,7 @@ void RenderCmdBuffer::clear() {
     mParamArray.resize(0);
 }
 
-static bool hasParam(const String &name, const ::cppcore::TArray<OGLParameter *> &paramArray, size_t &index) {
+static bool hasParam(StringId name, const ::cppcore::TArray<OGLParameter *> &paramArray, size_t &index) {
     index = paramArray.size();
     for (ui32 i = 0; i < paramArray.size(); i++) {
         if (name == paramArray[i]->m_name) {
@@ -229,9 +231,16 @@ bool RenderCmdBuffer::onDrawPrimitivesCmd(DrawPrimitivesCmdData *data) {
     }
 
     mRBService->bindVertexArray(data->vertexArray);
-    if (data->localMatrix) {
+    if (data->localMatrix || data->dequantize) {
         glm::mat4 model = mRBService->getMatrix(MatrixType::Model);
-        mRBService->setMatrix(MatrixType::Model, data->model * model);
+        if (data->localMatrix) {
+            model = data->model * model;
+        }
+        // The quantized positions must be restored before any other transformation
+        if (data->dequantize) {
+            model = model * data->dequant;
+        }
+        mRBService->setMatrix(MatrixType::Model, model);
         mRBService->applyMatrix();
     }
 
@@ -21,6 +21,8 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "RenderBackend/RenderBackendService.h"
+#include "Profiling/CpuProfiler.h"
+#include "Profiling/FrameStatistics.h"
 #include "Profiling/PerformanceCounterRegistry.h"
 #include "Properties/Settings.h"
 #include "RenderBackend/Mesh.h"
@@ -45,6 +47,7 @@ DECL_OSRE_LOG_MODULE(RenderBackendService)
 static constexpr c8 OGL_API[] = "opengl";
 static constexpr c8 Vulkan_API[] = "vulkan";
 static constexpr i32 IdxNotFound = -1;
+static constexpr ui32 NumTextureDecoderThreads = 2;
 
 static i32 hasPass(const c8 *id, const TArray<PassData *> &passDataArray) {
     if (nullptr == id) {
@@ -106,6 +109,14 @@ bool RenderBackendService::onOpen() {
         mOwnsSettingsConfig = true;
     }
 
+    // The counters are updated from the render thread, so create them before it starts
+    if (!Profiling::PerformanceCounterRegistry::create()) {
+        osre_error(Tag, "Cannot create performance counters.");
+    }
+    if (!Profiling::FrameStatistics::create()) {
+        osre_error(Tag, "Cannot create frame statistics.");
+    }
+
     // Spawn the thread for our render task
     if (mRenderTaskPtr == nullptr) {
         mRenderTaskPtr = SystemTask::create("render_task");
@@ -129,6 +140,19 @@ bool RenderBackendService::onOpen() {
         ok = false;
     }
 
+    // Decode textures in the background, the render thread shares the default texture
+    TextureLoader::getDefaultTexture();
+    if (mSettings->getBool(Settings::TextureCompression)) {
+        TextureImportOptions options;
+        options.Filter = MipFilter::Kaiser;
+        options.Compress = true;
+        options.UseCache = true;
+        mTextureDecoder.setImportOptions(options);
+    }
+    if (!mTextureDecoder.isRunning() && !mTextureDecoder.start(NumTextureDecoderThreads)) {
+        osre_error(Tag, "Cannot start texture decoder.");
+    }
+
     // Create the debug renderer instance
     if (!DbgRenderer::create(this)) {
         osre_error(Tag, "Cannot create Debug renderer");
@@ -147,6 +171,7 @@ bool RenderBackendService::onClose() {
         osre_error(Tag, "Cannot destroy Debug renderer");
     }
 
+    mTextureDecoder.stop();
     if (mRenderTaskPtr->isRunning()) {
         mRenderTaskPtr->detachEventHandler();
         mRenderTaskPtr->stop();
@@ -154,6 +179,9 @@ bool RenderBackendService::onClose() {
     delete mGPUFeatureSet;
     mGPUFeatureSet = nullptr;
 
+    Profiling::FrameStatistics::destroy();
+    Profiling::PerformanceCounterRegistry::destroy();
+
     if (mOwnsSettingsConfig) {
         delete mSettings;
         mSettings = nullptr;
@@ -173,6 +201,13 @@ bool RenderBackendService::onUpdate() {
         mFrameCreated = true;
     }
 
+    // Hand decoded data to the render thread, it will swap it in and replace the default texture
+    TArray<DecodedTexture> decodedTextures;
+    mTextureDecoder.dispatchCompleted(decodedTextures);
+    for (const DecodedTexture &decoded : decodedTextures) {
+        updateTexture(decoded.mTarget, decoded.mData);
+    }
+
     commitNextFrame();
 
     // Synchronizing event with render back-end
@@ -209,6 +244,7 @@ void RenderBackendService::initPasses() {
 }
 
 void RenderBackendService::commitNextFrame() {
+    OSRE_PROFILE_SCOPE("RenderBackendService::commitNextFrame");
     if (mRenderTaskPtr == nullptr) {
         return;
     }
@@ -284,6 +320,29 @@ void RenderBackendService::commitNextFrame() {
                 cmd->m_updateFlags |= (ui32)FrameSubmitCmd::AddRenderData;
             }
 
+            // Must be handled after the new meshes, the primitive groups are registered there
+            if (currentBatch->m_dirtyFlag & RenderBatchData::MeshLodDirty) {
+                for (ui32 k = 0; k < currentBatch->m_lodMeshArray.size(); ++k) {
+                    Mesh *currentMesh = currentBatch->m_lodMeshArray[k];
+                    FrameSubmitCmd *cmd = mSubmitFrame->enqueue(currentPass->m_id, currentBatch->m_id);
+                    cmd->m_updateFlags |= (ui32)FrameSubmitCmd::UpdateLod;
+                    cmd->m_meshId = currentMesh->getId();
+
+                    // Store start index and number of indices for each primitive group
+                    const size_t numGroups = currentMesh->getNumberOfPrimitiveGroups();
+                    const MeshLod *lod = currentMesh->getLodAt(currentMesh->getActiveLod());
+                    cmd->m_size = numGroups * 2 * sizeof(size_t);
+                    cmd->m_data = new c8[cmd->m_size];
+                    size_t *ranges = reinterpret_cast<size_t *>(cmd->m_data);
+                    for (size_t grpIdx = 0; grpIdx < numGroups; ++grpIdx) {
+                        const PrimitiveGroup *grp = lod != nullptr ? lod->mPrimGroups[grpIdx] : currentMesh->getPrimitiveGroupAt(grpIdx);
+                        ranges[grpIdx * 2] = grp->m_startIndex;
+                        ranges[grpIdx * 2 + 1] = grp->m_numIndices;
+                    }
+                }
+                currentBatch->m_lodMeshArray.resize(0);
+            }
+
             currentBatch->m_dirtyFlag = 0;
         }
     }
@@ -515,6 +574,23 @@ void RenderBackendService::addMesh(const MeshArray &meshArray, ui32 numInstances
     mCurrentBatch->m_dirtyFlag |= RenderBatchData::MeshDirty;
 }
 
+void RenderBackendService::updateTexture(Texture *tex, Texture *decoded) {
+    if (tex == nullptr) {
+        delete decoded;
+        return;
+    }
+
+    FrameSubmitCmd *cmd = mSubmitFrame->enqueue(nullptr, nullptr);
+    if (cmd == nullptr) {
+        osre_error(Tag, "Cannot enqueue the update of texture " + tex->TextureName);
+        delete decoded;
+        return;
+    }
+    cmd->m_updateFlags |= (ui32)FrameSubmitCmd::UpdateTexture;
+    cmd->m_texture = tex;
+    cmd->m_decodedTexture = decoded;
+}
+
 void RenderBackendService::updateMesh(Mesh *mesh) {
     if (nullptr == mCurrentBatch) {
         osre_error(Tag, "No active batch.");
@@ -530,6 +606,21 @@ void RenderBackendService::updateMesh(Mesh *mesh) {
     mCurrentBatch->m_dirtyFlag |= RenderBatchData::MeshUpdateDirty;
 }
 
+void RenderBackendService::updateMeshLod(Mesh *mesh) {
+    if (nullptr == mCurrentBatch) {
+        osre_error(Tag, "No active batch.");
+        return;
+    }
+
+    if (mesh == nullptr) {
+        osre_error(Tag, "Mesh is nullptr.");
+        return;
+    }
+
+    mCurrentBatch->m_lodMeshArray.add(mesh);
+    mCurrentBatch->m_dirtyFlag |= RenderBatchData::MeshLodDirty;
+}
+
 bool RenderBackendService::endRenderBatch() {
     if (nullptr == mCurrentBatch) {
         return false;
@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/Event.h"
 #include "RenderBackend/Pipeline.h"
 #include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/TextureDecoder.h"
 #include "Threading/SystemTask.h"
 #include "Common/glm_common.h"
 
@@ -258,6 +259,16 @@ public:
 
     void updateMesh(Mesh *mesh);
 
+    /// @brief Will upload the data of a changed texture with the next frame.
+    /// @param[in] tex          The texture, the data must stay valid until the frame was rendered.
+    /// @param[in] decoded      Optional new data, moved into the texture on the render thread. 
+    ///                         The service takes the ownership.
+    void updateTexture(Texture *tex, Texture *decoded = nullptr);
+
+    ///	@brief Will switch the drawn primitive groups of a mesh to its active level of detail.
+    /// @param[in] mesh         The mesh, must be added before.
+    void updateMeshLod(Mesh *mesh);
+
     bool endRenderBatch();
 
     bool endPass();
@@ -274,6 +285,10 @@ public:
 
     void syncRenderThread();
 
+    /// @brief Returns the decoder for background texture loading.
+    /// @return The texture decoder.
+    TextureDecoder &getTextureDecoder();
+
 protected:
     /// @brief  The open callback.
     bool onOpen() override;
@@ -309,8 +324,13 @@ private:
         Behaviour() : ResizeViewport(true) {}
     } mBehaviour;
     GPUFeatureSet *mGPUFeatureSet = nullptr;
+    TextureDecoder mTextureDecoder;
 };
 
+inline TextureDecoder &RenderBackendService::getTextureDecoder() {
+    return mTextureDecoder;
+}
+
 inline void RenderBackendService::enableAutoResizing(bool enabled) {
     mBehaviour.ResizeViewport = enabled;
 }
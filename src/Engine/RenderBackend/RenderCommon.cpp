@@ -26,6 +26,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "IO/Uri.h"
 #include "RenderBackend/Mesh.h"
 #include "RenderBackend/Shader.h"
+#include "RenderBackend/TextureDecoder.h"
 #include "Common/glm_common.h"
 
 #define STB_IMAGE_IMPLEMENTATION
@@ -175,6 +176,9 @@ void VertexLayout::clear() {
 
     m_offsets.clear();
     m_currentOffset = 0;
+    m_sizeInBytes = 0;
+    delete[] m_attributes;
+    m_attributes = nullptr;
 }
 
 size_t VertexLayout::sizeInBytes() {
@@ -282,7 +286,7 @@ BufferAccessType BufferData::getBufferAccessType() const {
 }
 
 PrimitiveGroup::PrimitiveGroup() :
-        m_primitive(PrimitiveType::LineList), m_startIndex(0), m_numIndices(0), m_indexType(IndexType::UnsignedShort) {
+        m_primitive(PrimitiveType::LineList), m_startIndex(0), m_numIndices(0), m_indexType(IndexType::UnsignedShort), m_baseVertex(0) {
     // empty
 }
 
@@ -303,6 +307,8 @@ Texture::Texture(const String &name) :
         Width(0),
         Height(0),
         Channels(0),
+        NumMips(1),
+        State(TextureState::Empty),
         TexHandle() {
     // empty
 }
@@ -316,6 +322,11 @@ void Texture::clear() {
     Data = nullptr;
 }
 
+TextureLoader::TextureLoader(TextureDecoder *decoder) :
+        mDecoder(decoder) {
+    // empty
+}
+
 size_t TextureLoader::load(const IO::Uri &uri, Texture *tex) {
     if (nullptr == tex) {
         return 0l;
@@ -323,39 +334,33 @@ size_t TextureLoader::load(const IO::Uri &uri, Texture *tex) {
 
     const String &filename = uri.getAbsPath();
     if (filename.find("$default") != String::npos) {
-        tex = TextureLoader::getDefaultTexture();
+        // The default texture is shared, nothing to decode
+        return TextureLoader::getDefaultTexture()->Size;
     }
 
-    String root = App::AssetRegistry::getPath("media");
     String path = App::AssetRegistry::resolvePathFromUri(uri);
-
-    i32 width = 0, height = 0, channels = 0;
-
-    tex->Data = stbi_load(path.c_str(), &width, &height, &channels, 0);
-    if (nullptr == tex->Data) {
+    if (!TextureDecoder::decodeFile(path, tex, true)) {
         osre_debug(Tag, "Cannot load texture " + filename);
+        tex->State = TextureState::Error;
         return 0;
     }
-    tex->Width = width;
-    tex->Height = height;
-    tex->Channels = channels;
-
-    // swap the texture data
-    for (i32 j = 0; j * 2 < height; ++j) {
-        i32 index1 = j * width * channels;
-        i32 index2 = (height - 1 - j) * width * channels;
-        for (i32 i = width * channels; i > 0; --i) {
-            uc8 temp = tex->Data[index1];
-            tex->Data[index1] = tex->Data[index2];
-            tex->Data[index2] = temp;
-            ++index1;
-            ++index2;
-        }
+    tex->State = TextureState::Ready;
+
+    return tex->Size;
+}
+
+bool TextureLoader::loadAsync(const IO::Uri &uri, Texture *tex) {
+    if (nullptr == tex || nullptr == mDecoder) {
+        return false;
     }
 
-    const size_t size = width * height * channels;
+    const String path = App::AssetRegistry::resolvePathFromUri(uri);
 
-    return size;
+    return mDecoder->decode(tex, path);
+}
+
+bool TextureLoader::isAsync() const {
+    return nullptr != mDecoder;
 }
 
 static Texture *DefaultTexture = nullptr;
@@ -365,22 +370,29 @@ Texture *TextureLoader::getDefaultTexture() {
         return DefaultTexture;
     }
 
+    // A checker board with 32 pixel cells, so missing textures are easy to spot
     constexpr ui32 Size = 256u;
+    constexpr ui32 CellSize = 32u;
     auto *texture = new Texture("default");
     texture->TargetType = TextureTargetType::Texture2D;
+    texture->PixelFormat = PixelFormatType::R8G8B8A8;
     texture->Width = Size;
     texture->Height = Size;
     texture->Channels = 4;
-    const size_t data_size = Size * Size;
-    texture->Data = new unsigned char[data_size * texture->Channels];
-    for (auto it = texture->Data; it < texture->Data + data_size; it += 20) {
-        memset(it, 0, 20);
-        if (((it - texture->Data) + 40) % (20 * 400) == 0) {
-            it += 40;
-        } else if (((it - texture->Data) + 20) % (20 * 400) != 0) {
-            it += 20;
+    texture->Size = Size * Size * texture->Channels;
+    texture->Data = new uc8[texture->Size];
+    uc8 *pixel = texture->Data;
+    for (ui32 y = 0; y < Size; ++y) {
+        for (ui32 x = 0; x < Size; ++x) {
+            const uc8 value = (((x / CellSize) + (y / CellSize)) & 1) ? 255 : 64;
+            *pixel++ = value;
+            *pixel++ = value;
+            *pixel++ = value;
+            *pixel++ = 255;
         }
     }
+    texture->State = TextureState::Ready;
+    DefaultTexture = texture;
 
     return DefaultTexture;
 }
@@ -395,11 +407,16 @@ bool TextureLoader::unload(Texture *tex) {
         return false;
     }
 
-    stbi_image_free(tex->Data);
-    tex->Data = nullptr;
+    if (nullptr != mDecoder) {
+        mDecoder->cancel(tex);
+    }
+    tex->clear();
+    tex->Size = 0;
     tex->Width = 0;
     tex->Height = 0;
     tex->Channels = 0;
+    tex->NumMips = 1;
+    tex->State = TextureState::Empty;
 
     return true;
 }
@@ -407,7 +424,8 @@ bool TextureLoader::unload(Texture *tex) {
 TextureResource::TextureResource(const String &name, const IO::Uri &uri) :
         TResource(name, uri),
         m_targetType(TextureTargetType::Texture2D),
-        m_stage(TextureStageType::TextureStage0) {
+        m_stage(TextureStageType::TextureStage0),
+        m_decodeQueued(false) {
     // empty
 }
 
@@ -432,6 +450,10 @@ ResourceState TextureResource::onLoad(const IO::Uri &uri, TextureLoader &loader)
         return getState();
     }
 
+    if (m_decodeQueued) {
+        return updateDecodeState();
+    }
+
     Texture *tex = create(uri.getResource());
     if (nullptr == tex) {
         return ResourceState::Error;
@@ -444,8 +466,20 @@ ResourceState TextureResource::onLoad(const IO::Uri &uri, TextureLoader &loader)
         return getState();
     }
 
-    getStats().m_memory = loader.load(uri, tex);
     tex->TargetType = m_targetType;
+    if (loader.isAsync()) {
+        // The data will arrive later, the render back-end uses the default texture until then
+        if (!loader.loadAsync(uri, tex)) {
+            setState(ResourceState::Error);
+            osre_debug(Tag, "Cannot queue texture " + uri.getAbsPath());
+            return getState();
+        }
+        m_decodeQueued = true;
+        setState(ResourceState::Loading);
+        return getState();
+    }
+
+    getStats().m_memory = loader.load(uri, tex);
     if (0 == getStats().m_memory) {
         setState(ResourceState::Error);
         osre_debug(Tag, "Cannot load texture " + uri.getAbsPath());
@@ -463,12 +497,30 @@ ResourceState TextureResource::onUnload(TextureLoader &loader) {
     }
 
     loader.unload(getRes());
+    m_decodeQueued = false;
     getStats().m_memory = 0;
     setState(ResourceState::Unloaded);
 
     return getState();
 }
 
+ResourceState TextureResource::updateDecodeState() {
+    // The render thread marks the texture as ready after it moved the decoded data into it
+    const Texture *tex = getRes();
+    const TextureState texState = tex->State;
+    if (texState == TextureState::Ready) {
+        m_decodeQueued = false;
+        getStats().m_memory = tex->Size;
+        setState(ResourceState::Loaded);
+    } else if (texState == TextureState::Error) {
+        m_decodeQueued = false;
+        setState(ResourceState::Error);
+        osre_debug(Tag, "Cannot decode texture " + getName());
+    }
+
+    return getState();
+}
+
 TransformState::TransformState() :
         m_translate(1.0f),
         m_scale(1.0f),
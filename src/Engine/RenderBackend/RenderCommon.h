@@ -34,6 +34,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <cppcore/Container/TStaticArray.h>
 #include <cppcore/Memory/TPoolAllocator.h>
 
+#include <atomic>
+
 namespace OSRE {
 namespace RenderBackend {
 
@@ -42,6 +44,7 @@ struct UniformVar;
 struct FrameBuffer;
 
 class Mesh;
+class TextureDecoder;
 class Shader;
 class Pipeline;
 class RenderBackendService;
@@ -82,6 +85,9 @@ enum class PixelFormatType {
     Invalid=-1,     ///< Marker for an invalid texture.
     R8G8B8 = 0,     ///< 24 bit data, r, g, b
     R8G8B8A8,       ///< 32 bit data, r, g, b, a
+    BC1,            ///< Block compressed r, g, b, 8 bytes per 4x4 block (DXT1).
+    BC3,            ///< Block compressed r, g, b, a, 16 bytes per 4x4 block (DXT5).
+    BC5,            ///< Block compressed r, g, 16 bytes per 4x4 block, used for normal maps (RGTC2).
     Count           ///< The number of formats
 };
 
@@ -90,6 +96,7 @@ enum class VertexType {
     Invalid = -1,       ///< Marker for an invalid data type.
     ColorVertex = 0,    ///< A simple vertex consisting of position and color.
     RenderVertex,       ///< A render vertex with position, color, normals and texture coordinates.
+    CompressedRenderVertex, ///< A render vertex with compressed attributes, described by the vertex layout of the mesh.
     Count               ///< Number of enums.
 };
 
@@ -217,6 +224,11 @@ enum class VertexFormat : int {
     UByte4,         ///< 4-component float (0.0f..255.0f) mapped to byte (0..255)
     Short2,         ///< 2-component float (-32768.0f..+32767.0f) mapped to short (-32768..+32768)
     Short4,         ///< 4-component float (-32768.0f..+32767.0f) mapped to short (-32768..+32768)
+    Half2,          ///< 2-component half float
+    Short2Norm,     ///< 2-component float (-1.0f..+1.0f) mapped to normalized short (-32767..+32767)
+    UShort2Norm,    ///< 2-component float (0.0f..1.0f) mapped to normalized unsigned short (0..65535)
+    UShort4Norm,    ///< 4-component float (0.0f..1.0f) mapped to normalized unsigned short (0..65535)
+    UByte4Norm,     ///< 4-component float (0.0f..1.0f) mapped to normalized unsigned byte (0..255)
     Count           ///< Number of enums.
 };
 
@@ -307,6 +319,17 @@ inline size_t getVertexFormatSize(VertexFormat format) {
         case VertexFormat::Short4:
             size = sizeof(ui16) * 4;
             break;
+        case VertexFormat::Half2:
+        case VertexFormat::Short2Norm:
+        case VertexFormat::UShort2Norm:
+            size = sizeof(ui16) * 2;
+            break;
+        case VertexFormat::UShort4Norm:
+            size = sizeof(ui16) * 4;
+            break;
+        case VertexFormat::UByte4Norm:
+            size = sizeof(uc8) * 4;
+            break;
         case VertexFormat::Count:
         case VertexFormat::Invalid:
             break;
@@ -402,6 +425,7 @@ struct OSRE_EXPORT PrimitiveGroup {
     size_t m_startIndex;
     size_t m_numIndices;
     IndexType m_indexType;
+    size_t m_baseVertex;    ///< The vertex added to each index, used for 16-bit sub-ranges of large meshes.
 
     /// @brief The class constructor
     PrimitiveGroup();
@@ -411,6 +435,14 @@ struct OSRE_EXPORT PrimitiveGroup {
     OSRE_NON_COPYABLE(PrimitiveGroup)
 };
 
+/// @brief  This enum describes the state of the texture data.
+enum class TextureState {
+    Empty = 0,  ///< No data assigned.
+    Pending,    ///< The data is decoded in the background, the default texture is used meanwhile.
+    Ready,      ///< The data is available.
+    Error       ///< The data could not be decoded.
+};
+
 ///	@brief
 struct OSRE_EXPORT Texture {
     String TextureName;
@@ -418,10 +450,12 @@ struct OSRE_EXPORT Texture {
     TextureTargetType TargetType;
     PixelFormatType PixelFormat;
     ui32 Size;
-    uc8 *Data;
+    uc8 *Data;          ///< The pixel data, all mip levels tightly packed, level 0 first.
     ui32 Width;
     ui32 Height;
     ui32 Channels;
+    ui32 NumMips;       ///< The number of mip levels stored in Data.
+    std::atomic<TextureState> State; ///< Set to Ready by the render thread, once decoded data was applied.
     Handle TexHandle;
 
     /// @brief The class constructor.
@@ -437,15 +471,25 @@ struct OSRE_EXPORT Texture {
 ///	@brief This class implements the texture loader.
 class OSRE_EXPORT TextureLoader {
 public:
-    TextureLoader() = default;
+    /// @brief The class constructor.
+    /// @param[in] decoder  The decoder for background loading, nullptr to load synchronously.
+    explicit TextureLoader(TextureDecoder *decoder = nullptr);
     ~TextureLoader() = default;
     size_t load(const IO::Uri &uri, Texture *tex);
+    bool loadAsync(const IO::Uri &uri, Texture *tex);
+    bool isAsync() const;
     bool unload(Texture *tex);
     static Texture *getDefaultTexture();
     static void releaseDefaultTexture();
+
+private:
+    TextureDecoder *mDecoder;
 };
 
 ///	@brief  This class is used to represent a texture resource.
+///
+/// With an asynchronous loader the resource stays in the Loading state until the render thread 
+/// applied the decoded data, load() has to be called again to pick up the new state.
 class OSRE_EXPORT TextureResource : public Common::TResource<Texture, TextureLoader> {
 public:
     TextureResource(const String &name, const IO::Uri &uri);
@@ -460,8 +504,11 @@ protected:
     Common::ResourceState onUnload(TextureLoader &loader) override;
 
 private:
+    Common::ResourceState updateDecodeState();
+
     TextureTargetType m_targetType;
     TextureStageType m_stage;
+    bool m_decodeQueued;
 };
 
 ///	@brief
@@ -691,7 +738,8 @@ struct RenderBatchData {
         MatrixBufferDirty = 1,  ///< The matrix buffer is dirty.
         UniformBufferDirty = 2, ///< The uniform buffer is dirty.
         MeshDirty = 4,          ///< The mesh is dirty.
-        MeshUpdateDirty = 8     ///< The mesh is updated.
+        MeshUpdateDirty = 8,    ///< The mesh is updated.
+        MeshLodDirty = 16       ///< The active level of detail of a mesh has changed.
     };
 
     const c8 *m_id;
@@ -699,6 +747,7 @@ struct RenderBatchData {
     cppcore::TArray<UniformVar *> m_uniforms;
     cppcore::TArray<MeshEntry *> m_meshArray;
     MeshArray m_updateMeshArray;
+    MeshArray m_lodMeshArray;
     ui32 m_dirtyFlag;
 
     /// @brief  The class constructor
@@ -709,6 +758,7 @@ struct RenderBatchData {
             m_uniforms(),
             m_meshArray(),
             m_updateMeshArray(),
+            m_lodMeshArray(),
             m_dirtyFlag(0) {
         osre_assert(id != nullptr);
     }
@@ -792,7 +842,9 @@ struct FrameSubmitCmd {
         UpdateBuffer = 2,
         UpdateMatrixes = 4,
         UpdateUniforms = 8,
-        AddRenderData = 16
+        AddRenderData = 16,
+        UpdateLod = 32,
+        UpdateTexture = 64
     };
 
     guid m_meshId;
@@ -801,6 +853,8 @@ struct FrameSubmitCmd {
     ui32 m_updateFlags;
     size_t m_size;
     c8 *m_data;
+    Texture *m_texture;
+    Texture *m_decodedTexture;  ///< Decoded data for m_texture, moved into it on the render thread.
     ::cppcore::TArray<MeshEntry*> m_newMeshes;
     ::cppcore::TArray<PassData*> m_updatedPasses;
 
@@ -812,6 +866,8 @@ struct FrameSubmitCmd {
             m_updateFlags(0),
             m_size(0),
             m_data(nullptr),
+            m_texture(nullptr),
+            m_decodedTexture(nullptr),
             m_newMeshes() {
         // empty
     }
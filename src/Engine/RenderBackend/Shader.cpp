@@ -152,7 +152,7 @@ size_t ShaderLoader::load(const Uri &uri, Shader *shader) {
     }
 
     const String &ext = uri.getExtension();
-    size_t size = stream->getSize();
+    size_t size = static_cast<size_t>(stream->getSize());
     cppcore::TArray<c8> buffer;
     buffer.resize(size);
     size_t readSize = stream->read(&buffer[0], size);
@@ -200,6 +200,7 @@ ResourceState ShaderResource::onLoad(const Uri &uri, ShaderLoader &loader) {
         setState(ResourceState::Error);
         return getState();
     }
+    setState(ResourceState::Loaded);
 
     return getState();
 }
@@ -56,6 +56,24 @@ String getGLSLRenderVertexLayout() {
     return GLSLRenderVertexLayout;
 }
 
+String getGLSLCompressedRenderVertexLayout() {
+    static const String GLSLCompressedRenderVertexLayout =
+            "// Compressed RenderVertex layout\n"
+            "layout(location = 0) in vec3 position;	  // object space vertex position, may be quantized\n"
+            "layout(location = 1) in vec2 normal;	  // octahedral encoded object space vertex normal\n"
+            "layout(location = 2) in vec3 color0;     // per-vertex diffuse colour\n"
+            "layout(location = 3) in vec2 texcoord0;  // per-vertex tex coord, stage 0\n"
+            "vec3 decodeOctNormal(vec2 e) {\n"
+            "    vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));\n"
+            "    float t = max(-n.z, 0.0);\n"
+            "    n.x += n.x >= 0.0 ? -t : t;\n"
+            "    n.y += n.y >= 0.0 ? -t : t;\n"
+            "    return normalize(n);\n"
+            "}\n" +
+            getNewLine();
+    return GLSLCompressedRenderVertexLayout;
+}
+
 String getGLSLColorVertexLayout() {
     static const String GLSLColorVertexLayout =
             "// Colorvertex layout\n"
@@ -33,6 +33,7 @@ String getGLSLVersionString_330();
 String getGLSLVersionString_400();
 String getNewLine();
 String getGLSLRenderVertexLayout();
+String getGLSLCompressedRenderVertexLayout();
 String getGLSLColorVertexLayout();
 String getGLSLCombinedMVPUniformSrc();
 
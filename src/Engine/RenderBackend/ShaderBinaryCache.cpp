@@ -0,0 +1,198 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/ShaderBinaryCache.h"
+#include "RenderBackend/Shader.h"
+#include "Common/Logger.h"
+#include "Common/StringUtils.h"
+#include "IO/Directory.h"
+#include "IO/FileStream.h"
+#include "IO/MappedFileStream.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace OSRE::RenderBackend {
+
+using namespace ::OSRE::IO;
+
+DECL_OSRE_LOG_MODULE(ShaderBinaryCache)
+
+static constexpr c8 Extension[] = "osb";
+static constexpr c8 Magic[4] = { 'O', 'S', 'P', 'B' };
+
+/// The cache file header, the binary follows directly.
+struct ShaderBinaryHeader {
+    c8 mMagic[4];
+    ui32 mVersion;
+    ui64 mKey;
+    ui64 mDriverHash;
+    ui64 mBinaryHash;
+    ui64 mBinarySize;
+    ui32 mFormat;
+    ui32 mReserved;
+};
+
+static ui64 hashString(ui64 hash, const String &str) {
+    // The length separates the strings, so moving text between them changes the hash
+    const ui64 len = str.size();
+    hash = Common::StringUtils::fnv1a64(&len, sizeof(len), hash);
+    return Common::StringUtils::fnv1a64(str.c_str(), str.size(), hash);
+}
+
+ShaderBinaryCache::ShaderBinaryCache(const String &folder, ShaderBinaryDriver *driver) :
+        mFolder(folder),
+        mDriver(driver),
+        mDriverHash(0),
+        mNumHits(0),
+        mNumMisses(0) {
+    if (mDriver != nullptr) {
+        mDriverHash = hashString(Common::StringUtils::Fnv64Offset, mDriver->getDriverId());
+    }
+}
+
+const c8 *ShaderBinaryCache::getExtension() {
+    return Extension;
+}
+
+HashId ShaderBinaryCache::computeKey(const Shader &shader, const String &defines, const String &driverId) {
+    ui64 hash = Common::StringUtils::fnv1a64(&Version, sizeof(Version));
+    for (size_t i = 0; i < static_cast<size_t>(ShaderType::Count); ++i) {
+        const ShaderType type = static_cast<ShaderType>(i);
+        hash = hashString(hash, shader.hasSource(type) ? String(shader.getSource(type)) : String());
+    }
+    hash = hashString(hash, defines);
+    hash = hashString(hash, driverId);
+
+    return hash != 0 ? hash : 1;
+}
+
+HashId ShaderBinaryCache::computeKey(const Shader &shader, const String &defines) const {
+    return computeKey(shader, defines, mDriver != nullptr ? mDriver->getDriverId() : String());
+}
+
+String ShaderBinaryCache::getCachePath(HashId key) const {
+    c8 name[32] = {};
+    ::snprintf(name, sizeof(name), "%016llx.", static_cast<unsigned long long>(key));
+    String path = mFolder.empty() ? String() : mFolder + "/";
+
+    return path + name + Extension;
+}
+
+bool ShaderBinaryCache::load(HashId key, ui32 program) {
+    if (mDriver == nullptr || key == 0) {
+        return false;
+    }
+
+    const String cachePath = getCachePath(key);
+    bool rejected = false;
+    {
+        MappedFileStream file(Uri("file://" + cachePath), Stream::AccessMode::MappedReadAccess);
+        if (!file.open()) {
+            ++mNumMisses;
+            return false;
+        }
+
+        const ui64 fileSize = file.getSize();
+        const uc8 *data = file.map(0, fileSize);
+        ShaderBinaryHeader header = {};
+        if (data == nullptr || fileSize < sizeof(header)) {
+            rejected = true;
+        } else {
+            ::memcpy(&header, data, sizeof(header));
+            const uc8 *binary = data + sizeof(header);
+            if (0 != ::memcmp(header.mMagic, Magic, sizeof(Magic)) || header.mVersion != Version || header.mKey != key) {
+                osre_debug(Tag, "Shader cache " + cachePath + " has an unsupported format.");
+                rejected = true;
+            } else if (header.mDriverHash != mDriverHash) {
+                osre_debug(Tag, "Shader cache " + cachePath + " was built by another driver.");
+                rejected = true;
+            } else if (header.mBinarySize != fileSize - sizeof(header) ||
+                       header.mBinaryHash != Common::StringUtils::fnv1a64(binary, static_cast<size_t>(header.mBinarySize))) {
+                osre_warn(Tag, "Shader cache " + cachePath + " is broken.");
+                rejected = true;
+            } else if (!mDriver->setProgramBinary(program, header.mFormat, binary, static_cast<size_t>(header.mBinarySize))) {
+                osre_debug(Tag, "Shader cache " + cachePath + " was rejected by the driver.");
+                rejected = true;
+            }
+        }
+    }
+
+    if (rejected) {
+        ++mNumMisses;
+        invalidate(key);
+        return false;
+    }
+    ++mNumHits;
+
+    return true;
+}
+
+bool ShaderBinaryCache::store(HashId key, ui32 program) {
+    if (mDriver == nullptr || key == 0) {
+        return false;
+    }
+
+    ui32 format = 0;
+    ProgramBinary binary;
+    if (!mDriver->getProgramBinary(program, format, binary) || binary.empty()) {
+        osre_debug(Tag, "Cannot get the program binary.");
+        return false;
+    }
+
+    if (!mFolder.empty() && !Directory::exists(mFolder) && !Directory::createDirectory(mFolder.c_str())) {
+        osre_warn(Tag, "Cannot create the shader cache folder " + mFolder + ".");
+        return false;
+    }
+
+    const String cachePath = getCachePath(key);
+    FileStream stream(Uri("file://" + cachePath), Stream::AccessMode::WriteAccessBinary);
+    if (!stream.open()) {
+        osre_warn(Tag, "Cannot open shader cache " + cachePath + " for writing.");
+        return false;
+    }
+
+    ShaderBinaryHeader header = {};
+    ::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mKey = key;
+    header.mDriverHash = mDriverHash;
+    header.mBinaryHash = Common::StringUtils::fnv1a64(binary.data(), binary.size());
+    header.mBinarySize = binary.size();
+    header.mFormat = format;
+
+    bool ok = stream.write(&header, sizeof(header)) == sizeof(header);
+    ok = ok && stream.write(binary.data(), binary.size()) == binary.size();
+    stream.close();
+    if (!ok) {
+        osre_warn(Tag, "Error while writing shader cache " + cachePath + ".");
+        ::remove(cachePath.c_str());
+    }
+
+    return ok;
+}
+
+void ShaderBinaryCache::invalidate(HashId key) {
+    ::remove(getCachePath(key).c_str());
+}
+
+} // namespace OSRE::RenderBackend
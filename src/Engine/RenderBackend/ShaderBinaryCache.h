@@ -0,0 +1,153 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "Common/osre_common.h"
+
+#include <vector>
+
+namespace OSRE::RenderBackend {
+
+class Shader;
+
+/// @brief  A program binary as returned by the driver.
+using ProgramBinary = std::vector<uc8>;
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  The interface to the driver functions used by the shader binary cache.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT ShaderBinaryDriver {
+public:
+    /// @brief The class destructor.
+    virtual ~ShaderBinaryDriver() = default;
+
+    /// @brief Will return a string identifying the driver, binaries of another driver are rejected.
+    /// @return The driver id, usually vendor, renderer and version.
+    virtual String getDriverId() const = 0;
+
+    /// @brief Will read the binary of a linked program.
+    /// @param[in]  program     The program id.
+    /// @param[out] format      The binary format.
+    /// @param[out] binary      The binary data.
+    /// @return true if successful.
+    virtual bool getProgramBinary(ui32 program, ui32 &format, ProgramBinary &binary) = 0;
+
+    /// @brief Will load a binary into a program.
+    /// @param[in] program      The program id.
+    /// @param[in] format       The binary format.
+    /// @param[in] data         The binary data.
+    /// @param[in] size         The size of the binary data.
+    /// @return true if the program was linked from the binary, false if the driver rejected it.
+    virtual bool setProgramBinary(ui32 program, ui32 format, const uc8 *data, size_t size) = 0;
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class stores linked shader programs on disk to skip the compilation on the next 
+///         launch.
+///
+/// A program is keyed by a hash of its sources, the defines and the driver id, so changed sources 
+/// or a driver update will miss the cache. Files with another driver, a broken header or rejected 
+/// by the driver are deleted, the caller falls back to compiling the program.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT ShaderBinaryCache {
+public:
+    /// @brief The current version of the cache file format.
+    static constexpr ui32 Version = 1;
+
+    /// @brief The class constructor.
+    /// @param[in] folder   The folder for the cache files, will be created on the first store.
+    /// @param[in] driver   The driver interface, not owned.
+    ShaderBinaryCache(const String &folder, ShaderBinaryDriver *driver);
+
+    /// @brief The class destructor.
+    ~ShaderBinaryCache() = default;
+
+    /// @brief Will return the file extension used for cache files.
+    /// @return The extension.
+    static const c8 *getExtension();
+
+    /// @brief Will compute the cache key of a shader.
+    /// @param[in] shader   The shader with the sources.
+    /// @param[in] defines  The defines the shader is compiled with.
+    /// @param[in] driverId The driver id.
+    /// @return The key, never 0.
+    static HashId computeKey(const Shader &shader, const String &defines, const String &driverId);
+
+    /// @brief Will compute the cache key of a shader for the driver of this cache.
+    /// @param[in] shader   The shader with the sources.
+    /// @param[in] defines  The defines the shader is compiled with.
+    /// @return The key, never 0.
+    HashId computeKey(const Shader &shader, const String &defines) const;
+
+    /// @brief Will return the path of the cache file for a key.
+    /// @param[in] key      The key.
+    /// @return The path.
+    String getCachePath(HashId key) const;
+
+    /// @brief Will load the cached binary into a program.
+    /// @param[in] key      The key of the program.
+    /// @param[in] program  The program to load into.
+    /// @return true if the program is linked, false if it must be compiled.
+    bool load(HashId key, ui32 program);
+
+    /// @brief Will store the binary of a linked program.
+    /// @param[in] key      The key of the program.
+    /// @param[in] program  The linked program.
+    /// @return true if successful.
+    bool store(HashId key, ui32 program);
+
+    /// @brief Will delete the cache file of a key.
+    /// @param[in] key      The key.
+    void invalidate(HashId key);
+
+    /// @brief Will return the number of programs loaded from the cache.
+    /// @return The number of hits.
+    ui32 getNumHits() const;
+
+    /// @brief Will return the number of programs not found in the cache or rejected.
+    /// @return The number of misses.
+    ui32 getNumMisses() const;
+
+    OSRE_NON_COPYABLE(ShaderBinaryCache)
+
+private:
+    String mFolder;
+    ShaderBinaryDriver *mDriver;
+    HashId mDriverHash;
+    ui32 mNumHits;
+    ui32 mNumMisses;
+};
+
+inline ui32 ShaderBinaryCache::getNumHits() const {
+    return mNumHits;
+}
+
+inline ui32 ShaderBinaryCache::getNumMisses() const {
+    return mNumMisses;
+}
+
+} // namespace OSRE::RenderBackend
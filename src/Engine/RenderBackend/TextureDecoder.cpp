@@ -0,0 +1,356 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/TextureDecoder.h"
+#include "Common/Logger.h"
+
+#include "stb_image.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace OSRE::RenderBackend {
+
+DECL_OSRE_LOG_MODULE(TextureDecoder)
+
+/// One enqueued decode request.
+struct DecodeRequest {
+    Texture *mTexture;
+    String mPath;
+    TextureImportOptions mOptions;
+    ui64 mTicket;
+};
+
+/// A finished decode, the data is kept in a texture owned by the decoder until dispatched.
+struct DecodeResult {
+    Texture *mTexture;
+    ui64 mTicket;
+    std::unique_ptr<Texture> mDecoded;
+    bool mSuccess;
+};
+
+struct TextureDecoderImpl {
+    mutable std::mutex mLock;
+    std::condition_variable mWakeup;
+    std::condition_variable mIdle;
+    std::deque<DecodeRequest> mPending;
+    std::vector<DecodeResult> mCompleted;
+    std::vector<std::thread> mWorkers;
+    std::unordered_map<Texture *, ui64> mTickets;
+    bool mRunning = false;
+    size_t mInFlight = 0;
+    ui64 mNextTicket = 1;
+
+    void execute(DecodeRequest &request);
+    void workerLoop();
+};
+
+/// Reads the whole file, the image is decoded from memory to touch the file only once.
+static bool readFile(const String &path, std::vector<uc8> &buffer) {
+    FILE *file = ::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    ::fseek(file, 0, SEEK_END);
+    const long fileSize = ::ftell(file);
+    ::fseek(file, 0, SEEK_SET);
+    if (fileSize <= 0) {
+        ::fclose(file);
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(fileSize));
+    const size_t numRead = ::fread(buffer.data(), 1, buffer.size(), file);
+    ::fclose(file);
+
+    return numRead == buffer.size();
+}
+
+void TextureDecoderImpl::execute(DecodeRequest &request) {
+    auto decoded = std::make_unique<Texture>(request.mPath);
+    const bool success = TextureProcessor::import(request.mPath, decoded.get(), request.mOptions);
+
+    std::lock_guard<std::mutex> guard(mLock);
+    mCompleted.push_back({ request.mTexture, request.mTicket, std::move(decoded), success });
+    --mInFlight;
+    if (mInFlight == 0 && mPending.empty()) {
+        mIdle.notify_all();
+    }
+}
+
+void TextureDecoderImpl::workerLoop() {
+    for (;;) {
+        DecodeRequest request;
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            mWakeup.wait(lock, [this]() { return !mRunning || !mPending.empty(); });
+            if (!mRunning) {
+                return;
+            }
+            request = std::move(mPending.front());
+            mPending.pop_front();
+            ++mInFlight;
+        }
+        execute(request);
+    }
+}
+
+TextureDecoder::TextureDecoder() :
+        mImpl(new TextureDecoderImpl) {
+    // empty
+}
+
+TextureDecoder::~TextureDecoder() {
+    stop();
+    delete mImpl;
+}
+
+bool TextureDecoder::start(ui32 numThreads) {
+    if (numThreads == 0) {
+        osre_error(Tag, "At least one decoder thread is required.");
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    if (mImpl->mRunning) {
+        osre_debug(Tag, "Decoder threads already running.");
+        return false;
+    }
+
+    mImpl->mRunning = true;
+    for (ui32 i = 0; i < numThreads; ++i) {
+        mImpl->mWorkers.emplace_back(&TextureDecoderImpl::workerLoop, mImpl);
+    }
+
+    return true;
+}
+
+void TextureDecoder::stop() {
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        if (!mImpl->mRunning) {
+            return;
+        }
+        mImpl->mRunning = false;
+    }
+    mImpl->mWakeup.notify_all();
+    for (auto &worker : mImpl->mWorkers) {
+        worker.join();
+    }
+    mImpl->mWorkers.clear();
+    mImpl->mIdle.notify_all();
+}
+
+bool TextureDecoder::isRunning() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    return mImpl->mRunning;
+}
+
+void TextureDecoder::setImportOptions(const TextureImportOptions &options) {
+    mOptions = options;
+}
+
+const TextureImportOptions &TextureDecoder::getImportOptions() const {
+    return mOptions;
+}
+
+bool TextureDecoder::decode(Texture *tex, const String &path) {
+    return decode(tex, path, mOptions);
+}
+
+bool TextureDecoder::decode(Texture *tex, const String &path, const TextureImportOptions &options) {
+    if (tex == nullptr || path.empty()) {
+        osre_error(Tag, "Invalid decode request.");
+        return false;
+    }
+
+    tex->State = TextureState::Pending;
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        const ui64 ticket = mImpl->mNextTicket++;
+        mImpl->mTickets[tex] = ticket;
+        mImpl->mPending.push_back({ tex, path, options, ticket });
+    }
+    mImpl->mWakeup.notify_one();
+
+    return true;
+}
+
+void TextureDecoder::cancel(Texture *tex) {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    if (mImpl->mTickets.erase(tex) == 0) {
+        return;
+    }
+
+    auto &pending = mImpl->mPending;
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+        [tex](const DecodeRequest &request) { return request.mTexture == tex; }), pending.end());
+    if (mImpl->mInFlight == 0 && pending.empty()) {
+        mImpl->mIdle.notify_all();
+    }
+}
+
+size_t TextureDecoder::dispatchCompleted(cppcore::TArray<DecodedTexture> &decodedTextures) {
+    std::vector<DecodeResult> completed;
+    {
+        std::lock_guard<std::mutex> guard(mImpl->mLock);
+        completed.reserve(mImpl->mCompleted.size());
+        for (auto &result : mImpl->mCompleted) {
+            // Drop results of canceled or re-issued requests
+            auto it = mImpl->mTickets.find(result.mTexture);
+            if (it == mImpl->mTickets.end() || it->second != result.mTicket) {
+                continue;
+            }
+            mImpl->mTickets.erase(it);
+            completed.push_back(std::move(result));
+        }
+        mImpl->mCompleted.clear();
+    }
+
+    for (auto &result : completed) {
+        if (!result.mSuccess) {
+            osre_debug(Tag, "Cannot decode texture " + result.mDecoded->TextureName);
+            result.mTexture->State = TextureState::Error;
+            continue;
+        }
+
+        // The target may be read by the render thread right now, so it is not touched here
+        decodedTextures.add({ result.mTexture, result.mDecoded.release() });
+    }
+
+    return completed.size();
+}
+
+void TextureDecoder::apply(Texture *tex, Texture *decoded) {
+    osre_assert(nullptr != tex);
+    osre_assert(nullptr != decoded);
+
+    tex->clear();
+    tex->Data = decoded->Data;
+    tex->Size = decoded->Size;
+    tex->Width = decoded->Width;
+    tex->Height = decoded->Height;
+    tex->Channels = decoded->Channels;
+    tex->NumMips = decoded->NumMips;
+    tex->PixelFormat = decoded->PixelFormat;
+    decoded->Data = nullptr;
+    delete decoded;
+    tex->State = TextureState::Ready;
+}
+
+void TextureDecoder::waitIdle() {
+    std::unique_lock<std::mutex> lock(mImpl->mLock);
+    if (mImpl->mRunning) {
+        mImpl->mIdle.wait(lock, [this]() {
+            return !mImpl->mRunning || (mImpl->mInFlight == 0 && mImpl->mPending.empty());
+        });
+        return;
+    }
+
+    // No decoder threads, so do the work here
+    while (!mImpl->mPending.empty()) {
+        DecodeRequest request = std::move(mImpl->mPending.front());
+        mImpl->mPending.pop_front();
+        ++mImpl->mInFlight;
+        lock.unlock();
+        mImpl->execute(request);
+        lock.lock();
+    }
+}
+
+size_t TextureDecoder::getNumPending() const {
+    std::lock_guard<std::mutex> guard(mImpl->mLock);
+    return mImpl->mTickets.size();
+}
+
+bool TextureDecoder::decodeFile(const String &path, Texture *tex, bool buildMips) {
+    if (tex == nullptr) {
+        return false;
+    }
+
+    std::vector<uc8> fileData;
+    if (!readFile(path, fileData)) {
+        return false;
+    }
+
+    // Gray images are expanded, so the data matches one of the pixel formats
+    i32 width = 0, height = 0, channels = 0;
+    const i32 fileSize = static_cast<i32>(fileData.size());
+    if (0 == stbi_info_from_memory(fileData.data(), fileSize, &width, &height, &channels)) {
+        return false;
+    }
+    const i32 reqChannels = (channels == 2 || channels == 4) ? 4 : 3;
+    uc8 *pixels = stbi_load_from_memory(fileData.data(), fileSize, &width, &height, &channels, reqChannels);
+    if (pixels == nullptr) {
+        return false;
+    }
+
+    const ui32 w = static_cast<ui32>(width);
+    const ui32 h = static_cast<ui32>(height);
+    const ui32 c = static_cast<ui32>(reqChannels);
+    const size_t size = static_cast<size_t>(w) * h * c;
+
+    // Flip into the bottom-up row order of OpenGL while copying into our own buffer
+    uc8 *data = new uc8[size];
+    const size_t rowSize = static_cast<size_t>(w) * c;
+    for (ui32 row = 0; row < h; ++row) {
+        ::memcpy(data + row * rowSize, pixels + (h - 1 - row) * rowSize, rowSize);
+    }
+    stbi_image_free(pixels);
+
+    tex->clear();
+    tex->Data = data;
+    tex->Size = static_cast<ui32>(size);
+    tex->Width = w;
+    tex->Height = h;
+    tex->Channels = c;
+    tex->NumMips = 1;
+    tex->PixelFormat = c == 4 ? PixelFormatType::R8G8B8A8 : PixelFormatType::R8G8B8;
+
+    return !buildMips || TextureProcessor::generateMips(tex, MipFilter::Box);
+}
+
+void TextureDecoder::flipRows(uc8 *data, ui32 width, ui32 height, ui32 channels) {
+    if (data == nullptr || height < 2) {
+        return;
+    }
+
+    const size_t rowSize = static_cast<size_t>(width) * channels;
+    std::vector<uc8> scratch(rowSize);
+    for (ui32 row = 0; row < height / 2; ++row) {
+        uc8 *top = data + row * rowSize;
+        uc8 *bottom = data + (height - 1 - row) * rowSize;
+        ::memcpy(scratch.data(), top, rowSize);
+        ::memcpy(top, bottom, rowSize);
+        ::memcpy(bottom, scratch.data(), rowSize);
+    }
+}
+
+} // Namespace OSRE::RenderBackend
@@ -0,0 +1,136 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "RenderBackend/TextureProcessor.h"
+
+#include <cppcore/Container/TArray.h>
+
+namespace OSRE::RenderBackend {
+
+// Forward declarations ---------------------------------------------------------------------------
+struct TextureDecoderImpl;
+
+/// @brief  A finished decode, handed out by TextureDecoder::dispatchCompleted().
+struct DecodedTexture {
+    Texture *mTarget;   ///< The texture passed to decode().
+    Texture *mData;     ///< The decoded data, owned by the receiver until passed to TextureDecoder::apply().
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief	This class decodes image files into ready-to-upload texture data on worker threads.
+///
+/// A texture handed to decode() is marked as pending, the render back-end binds the default 
+/// texture for it until the data arrives. Workers decode the image, flip it into the OpenGL row 
+/// order and process it as described by the import options. dispatchCompleted() hands out the 
+/// decoded data without touching the target textures, the render thread moves it into them with 
+/// apply() before uploading them again.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT TextureDecoder {
+public:
+    /// @brief  The default class constructor.
+    TextureDecoder();
+
+    /// @brief  The class destructor, will stop the workers.
+    ~TextureDecoder();
+
+    /// @brief  Will start the decoder threads.
+    /// @param  numThreads  [in] The number of decoder threads.
+    /// @return true, if successful.
+    bool start(ui32 numThreads);
+
+    /// @brief  Will stop the decoder threads, pending requests are kept.
+    void stop();
+
+    /// @brief  Returns true, if the decoder threads are running.
+    /// @return true if running.
+    bool isRunning() const;
+
+    /// @brief  Will set the import options used by decode() without explicit options.
+    /// @param  options     [in] The import options.
+    void setImportOptions(const TextureImportOptions &options);
+
+    /// @brief  Returns the import options used by decode() without explicit options.
+    /// @return The import options.
+    const TextureImportOptions &getImportOptions() const;
+
+    /// @brief  Will enqueue the decoding of an image file into a texture.
+    /// @param  tex         [in] The texture to fill, must stay alive until it was dispatched or canceled.
+    /// @param  path        [in] The path of the image file.
+    /// @return true, if the request was enqueued.
+    bool decode(Texture *tex, const String &path);
+
+    /// @brief  Will enqueue the decoding of an image file into a texture.
+    /// @param  tex         [in] The texture to fill, must stay alive until it was dispatched or canceled.
+    /// @param  path        [in] The path of the image file.
+    /// @param  options     [in] The import options for this texture.
+    /// @return true, if the request was enqueued.
+    bool decode(Texture *tex, const String &path, const TextureImportOptions &options);
+
+    /// @brief  Will drop all requests for the texture, a decode in flight will be discarded.
+    /// @param  tex         [in] The texture.
+    void cancel(Texture *tex);
+
+    /// @brief  Will hand out all finished decodes, failed ones mark their texture as broken.
+    /// @param  decodedTextures [out] Will receive the decoded data with the target textures.
+    /// @return The number of finished requests, including failed ones.
+    size_t dispatchCompleted(cppcore::TArray<DecodedTexture> &decodedTextures);
+
+    /// @brief  Will move decoded data into its texture and mark it as ready, the decoded texture 
+    ///         will be released. Must run on the thread which reads the texture data.
+    /// @param  tex         [in] The target texture.
+    /// @param  decoded     [in] The decoded data from dispatchCompleted().
+    static void apply(Texture *tex, Texture *decoded);
+
+    /// @brief  Will block until all enqueued decodes are finished. When no decoder thread is 
+    ///         running the images will be decoded on the calling thread.
+    void waitIdle();
+
+    /// @brief  Returns the number of requests not dispatched yet.
+    /// @return The number of pending requests.
+    size_t getNumPending() const;
+
+    /// @brief  Will decode an image file into the texture on the calling thread.
+    /// @param  path        [in] The path of the image file.
+    /// @param  tex         [in] The texture to fill.
+    /// @param  buildMips   [in] true to build the full mip chain with a box filter.
+    /// @return true, if successful.
+    static bool decodeFile(const String &path, Texture *tex, bool buildMips);
+
+    /// @brief  Will flip the rows of an image in place, one row copy per row.
+    /// @param  data        [in] The pixel data.
+    /// @param  width       [in] The width in pixels.
+    /// @param  height      [in] The height in pixels.
+    /// @param  channels    [in] The number of bytes per pixel.
+    static void flipRows(uc8 *data, ui32 width, ui32 height, ui32 channels);
+
+    OSRE_NON_COPYABLE(TextureDecoder)
+
+private:
+    TextureDecoderImpl *mImpl;
+    TextureImportOptions mOptions;
+};
+
+} // Namespace OSRE::RenderBackend
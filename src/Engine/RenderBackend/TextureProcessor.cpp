@@ -0,0 +1,834 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "RenderBackend/TextureProcessor.h"
+#include "RenderBackend/TextureDecoder.h"
+#include "RenderBackend/MeshCache.h"
+#include "Common/Logger.h"
+#include "Common/StringUtils.h"
+#include "IO/FileStream.h"
+#include "IO/MappedFileStream.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define OSRE_TEXTURE_SSE2
+#   include <emmintrin.h>
+#endif
+
+namespace OSRE::RenderBackend {
+
+using namespace ::OSRE::IO;
+
+DECL_OSRE_LOG_MODULE(TextureProcessor)
+
+static constexpr c8 Extension[] = "ostx";
+static constexpr c8 Magic[4] = { 'O', 'S', 'T', 'X' };
+static constexpr size_t DataAlignment = 16;
+static constexpr ui32 BlockDim = 4;
+static constexpr ui32 PixelsPerBlock = BlockDim * BlockDim;
+
+/// The cache file header, the mip chain follows at the next 16-byte boundary.
+struct TextureCacheHeader {
+    c8 mMagic[4];
+    ui32 mVersion;
+    ui64 mSourceHash;
+    i32 mPixelFormat;
+    ui32 mWidth;
+    ui32 mHeight;
+    ui32 mChannels;
+    ui32 mNumMips;
+    ui32 mReserved;
+    ui64 mDataSize;
+    ui64 mFileSize;
+};
+
+static size_t alignTo(size_t offset, size_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static size_t getBlockSize(PixelFormatType format) {
+    return format == PixelFormatType::BC1 ? 8 : 16;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Mip filters
+//-------------------------------------------------------------------------------------------------
+
+/// Average of four bytes, rounded.
+static inline uc8 average(ui32 a, ui32 b, ui32 c, ui32 d) {
+    return static_cast<uc8>((a + b + c + d + 2) / 4);
+}
+
+static void boxDownsample(const uc8 *src, ui32 width, ui32 height, ui32 channels, uc8 *dst) {
+    const ui32 dstWidth = std::max(1u, width / 2);
+    const ui32 dstHeight = std::max(1u, height / 2);
+    const size_t srcPitch = static_cast<size_t>(width) * channels;
+    for (ui32 y = 0; y < dstHeight; ++y) {
+        const uc8 *row0 = src + std::min(2 * y, height - 1) * srcPitch;
+        const uc8 *row1 = src + std::min(2 * y + 1, height - 1) * srcPitch;
+        uc8 *out = dst + static_cast<size_t>(y) * dstWidth * channels;
+        ui32 x = 0;
+#ifdef OSRE_TEXTURE_SSE2
+        if (channels == 4) {
+            // Two destination pixels per step: four source pixels of both rows widened to 16 bit
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i rounding = _mm_set1_epi16(2);
+            for (; x + 2 <= dstWidth && 2 * x + 4 <= width; x += 2) {
+                const __m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 8));
+                const __m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 8));
+                const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));
+                const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero));
+                const __m128i sumLo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+                const __m128i sumHi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+                __m128i sum = _mm_unpacklo_epi64(sumLo, sumHi);
+                sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(sum, zero));
+                out += 8;
+            }
+        }
+#endif
+        for (; x < dstWidth; ++x) {
+            const size_t x0 = std::min(2 * x, width - 1) * channels;
+            const size_t x1 = std::min(2 * x + 1, width - 1) * channels;
+            for (ui32 c = 0; c < channels; ++c) {
+                *out++ = average(row0[x0 + c], row0[x1 + c], row1[x0 + c], row1[x1 + c]);
+            }
+        }
+    }
+}
+
+static constexpr i32 KaiserTaps = 6;
+
+/// Weights of the Kaiser windowed sinc for a 2:1 reduction, the taps are at -2.5 ... 2.5 source pixels.
+static std::array<f32, KaiserTaps> computeKaiserWeights() {
+    constexpr d32 Pi = 3.14159265358979323846;
+    constexpr d32 Alpha = 4.0;
+    constexpr d32 Radius = 3.0;
+    auto besselI0 = [](d32 x) {
+        d32 sum = 1.0, term = 1.0;
+        for (i32 k = 1; k < 32; ++k) {
+            term *= (x / (2.0 * k)) * (x / (2.0 * k));
+            sum += term;
+        }
+        return sum;
+    };
+
+    d32 total = 0.0;
+    d32 raw[KaiserTaps];
+    for (i32 i = 0; i < KaiserTaps; ++i) {
+        const d32 d = i - 2.5;
+        const d32 x = d / 2.0;
+        const d32 sinc = std::sin(Pi * x) / (Pi * x);
+        const d32 r = d / Radius;
+        const d32 window = besselI0(Alpha * std::sqrt(1.0 - r * r)) / besselI0(Alpha);
+        raw[i] = sinc * window;
+        total += raw[i];
+    }
+
+    std::array<f32, KaiserTaps> weights;
+    for (i32 i = 0; i < KaiserTaps; ++i) {
+        weights[i] = static_cast<f32>(raw[i] / total);
+    }
+
+    return weights;
+}
+
+static void kaiserDownsample(const uc8 *src, ui32 width, ui32 height, ui32 channels, uc8 *dst) {
+    static const std::array<f32, KaiserTaps> weights = computeKaiserWeights();
+    const ui32 dstWidth = std::max(1u, width / 2);
+    const ui32 dstHeight = std::max(1u, height / 2);
+
+    // Horizontal pass into a float image with the destination width
+    std::vector<f32> tmp(static_cast<size_t>(dstWidth) * height * channels);
+    for (ui32 y = 0; y < height; ++y) {
+        const uc8 *row = src + static_cast<size_t>(y) * width * channels;
+        f32 *out = &tmp[static_cast<size_t>(y) * dstWidth * channels];
+        for (ui32 x = 0; x < dstWidth; ++x) {
+            for (ui32 c = 0; c < channels; ++c) {
+                f32 sum = 0.0f;
+                if (width == 1) {
+                    sum = row[c];
+                } else {
+                    for (i32 k = 0; k < KaiserTaps; ++k) {
+                        const i32 sx = std::clamp(static_cast<i32>(2 * x) - 2 + k, 0, static_cast<i32>(width) - 1);
+                        sum += weights[k] * row[sx * channels + c];
+                    }
+                }
+                out[x * channels + c] = sum;
+            }
+        }
+    }
+
+    // Vertical pass
+    const size_t tmpPitch = static_cast<size_t>(dstWidth) * channels;
+    for (ui32 y = 0; y < dstHeight; ++y) {
+        uc8 *out = dst + static_cast<size_t>(y) * tmpPitch;
+        for (size_t i = 0; i < tmpPitch; ++i) {
+            f32 sum = 0.0f;
+            if (height == 1) {
+                sum = tmp[i];
+            } else {
+                for (i32 k = 0; k < KaiserTaps; ++k) {
+                    const i32 sy = std::clamp(static_cast<i32>(2 * y) - 2 + k, 0, static_cast<i32>(height) - 1);
+                    sum += weights[k] * tmp[sy * tmpPitch + i];
+                }
+            }
+            out[i] = static_cast<uc8>(std::clamp(sum + 0.5f, 0.0f, 255.0f));
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+// Block codecs
+//-------------------------------------------------------------------------------------------------
+
+static ui16 packRGB565(const f32 *color) {
+    const ui32 r = static_cast<ui32>(std::clamp(color[0], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+    const ui32 g = static_cast<ui32>(std::clamp(color[1], 0.0f, 255.0f) * 63.0f / 255.0f + 0.5f);
+    const ui32 b = static_cast<ui32>(std::clamp(color[2], 0.0f, 255.0f) * 31.0f / 255.0f + 0.5f);
+    return static_cast<ui16>((r << 11) | (g << 5) | b);
+}
+
+static void unpackRGB565(ui16 value, i32 *color) {
+    const i32 r = (value >> 11) & 31;
+    const i32 g = (value >> 5) & 63;
+    const i32 b = value & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+/// Builds the four palette entries, the alpha of entry three is 0 in the three color mode.
+static void buildColorPalette(ui16 c0, ui16 c1, bool forceFourColors, i32 palette[4][4]) {
+    unpackRGB565(c0, palette[0]);
+    unpackRGB565(c1, palette[1]);
+    palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+    if (forceFourColors || c0 > c1) {
+        for (i32 c = 0; c < 3; ++c) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+    } else {
+        for (i32 c = 0; c < 3; ++c) {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+        palette[3][3] = 0;
+    }
+}
+
+static ui32 findColorIndices(const uc8 *rgba, const i32 palette[4][4], ui32 &error) {
+    ui32 indices = 0;
+    error = 0;
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        const uc8 *px = rgba + i * 4;
+        ui32 best = 0, bestDist = std::numeric_limits<ui32>::max();
+        for (ui32 p = 0; p < 4; ++p) {
+            const i32 dr = px[0] - palette[p][0];
+            const i32 dg = px[1] - palette[p][1];
+            const i32 db = px[2] - palette[p][2];
+            const ui32 dist = static_cast<ui32>(dr * dr + dg * dg + db * db);
+            if (dist < bestDist) {
+                bestDist = dist;
+                best = p;
+            }
+        }
+        indices |= best << (2 * i);
+        error += bestDist;
+    }
+
+    return indices;
+}
+
+static void writeColorBlock(ui16 c0, ui16 c1, ui32 indices, uc8 *block) {
+    block[0] = static_cast<uc8>(c0 & 0xFF);
+    block[1] = static_cast<uc8>(c0 >> 8);
+    block[2] = static_cast<uc8>(c1 & 0xFF);
+    block[3] = static_cast<uc8>(c1 >> 8);
+    for (ui32 i = 0; i < 4; ++i) {
+        block[4 + i] = static_cast<uc8>((indices >> (8 * i)) & 0xFF);
+    }
+}
+
+/// Encodes the colors in the four color mode: endpoints along the principal axis, refined by least squares.
+static void encodeColorBlock(const uc8 *rgba, uc8 *block) {
+    f32 mean[3] = { 0.0f, 0.0f, 0.0f };
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        for (ui32 c = 0; c < 3; ++c) {
+            mean[c] += rgba[i * 4 + c];
+        }
+    }
+    for (f32 &m : mean) {
+        m /= PixelsPerBlock;
+    }
+
+    f32 cov[6] = {};
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        const f32 r = rgba[i * 4] - mean[0];
+        const f32 g = rgba[i * 4 + 1] - mean[1];
+        const f32 b = rgba[i * 4 + 2] - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    // Power iteration for the principal axis
+    f32 axis[3] = { 1.0f, 1.0f, 1.0f };
+    for (i32 iter = 0; iter < 8; ++iter) {
+        const f32 x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        const f32 y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        const f32 z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        const f32 len = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+        if (len < 1e-6f) {
+            break;
+        }
+        axis[0] = x / len;
+        axis[1] = y / len;
+        axis[2] = z / len;
+    }
+    const f32 axisLen = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    f32 minProj = 0.0f, maxProj = 0.0f;
+    if (axisLen > 1e-6f) {
+        for (f32 &a : axis) {
+            a /= axisLen;
+        }
+        minProj = std::numeric_limits<f32>::max();
+        maxProj = -minProj;
+        for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+            const f32 proj = (rgba[i * 4] - mean[0]) * axis[0] + (rgba[i * 4 + 1] - mean[1]) * axis[1] +
+                             (rgba[i * 4 + 2] - mean[2]) * axis[2];
+            minProj = std::min(minProj, proj);
+            maxProj = std::max(maxProj, proj);
+        }
+    }
+
+    f32 e0[3], e1[3];
+    for (ui32 c = 0; c < 3; ++c) {
+        e0[c] = mean[c] + axis[c] * maxProj;
+        e1[c] = mean[c] + axis[c] * minProj;
+    }
+
+    ui16 bestC0 = 0, bestC1 = 0;
+    ui32 bestIndices = 0, bestError = std::numeric_limits<ui32>::max();
+    for (i32 iter = 0; iter < 3; ++iter) {
+        ui16 c0 = packRGB565(e0), c1 = packRGB565(e1);
+        if (c0 < c1) {
+            std::swap(c0, c1);
+        }
+        i32 palette[4][4];
+        buildColorPalette(c0, c1, true, palette);
+        ui32 error = 0;
+        const ui32 indices = findColorIndices(rgba, palette, error);
+        if (error < bestError) {
+            bestError = error;
+            bestC0 = c0;
+            bestC1 = c1;
+            bestIndices = indices;
+        }
+        if (c0 == c1 || error == 0) {
+            break;
+        }
+
+        // Least squares fit of both endpoints for the chosen indices
+        static constexpr f32 Weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+        f32 aa = 0.0f, ab = 0.0f, bb = 0.0f;
+        f32 ax[3] = {}, bx[3] = {};
+        for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+            const f32 a = Weights[(indices >> (2 * i)) & 3];
+            const f32 b = 1.0f - a;
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (ui32 c = 0; c < 3; ++c) {
+                ax[c] += a * rgba[i * 4 + c];
+                bx[c] += b * rgba[i * 4 + c];
+            }
+        }
+        const f32 det = aa * bb - ab * ab;
+        if (std::fabs(det) < 1e-6f) {
+            break;
+        }
+        for (ui32 c = 0; c < 3; ++c) {
+            e0[c] = (bb * ax[c] - ab * bx[c]) / det;
+            e1[c] = (aa * bx[c] - ab * ax[c]) / det;
+        }
+    }
+
+    writeColorBlock(bestC0, bestC1, bestIndices, block);
+}
+
+static void decodeColorBlock(const uc8 *block, bool forceFourColors, uc8 *rgba) {
+    const ui16 c0 = static_cast<ui16>(block[0] | (block[1] << 8));
+    const ui16 c1 = static_cast<ui16>(block[2] | (block[3] << 8));
+    const ui32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<ui32>(block[7]) << 24);
+    i32 palette[4][4];
+    buildColorPalette(c0, c1, forceFourColors, palette);
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        const i32 *color = palette[(indices >> (2 * i)) & 3];
+        for (ui32 c = 0; c < 4; ++c) {
+            rgba[i * 4 + c] = static_cast<uc8>(color[c]);
+        }
+    }
+}
+
+static void buildSingleChannelPalette(uc8 a0, uc8 a1, i32 palette[8]) {
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1) {
+        for (i32 i = 2; i < 8; ++i) {
+            palette[i] = ((8 - i) * a0 + (i - 1) * a1 + 3) / 7;
+        }
+    } else {
+        for (i32 i = 2; i < 6; ++i) {
+            palette[i] = ((6 - i) * a0 + (i - 1) * a1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+/// Encodes one channel into a BC4 block, the channel is read with the given stride.
+static void encodeSingleChannelBlock(const uc8 *values, ui32 stride, uc8 *block) {
+    uc8 minValue = 255, maxValue = 0;
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        minValue = std::min(minValue, values[i * stride]);
+        maxValue = std::max(maxValue, values[i * stride]);
+    }
+
+    block[0] = maxValue;
+    block[1] = minValue;
+    ui64 indices = 0;
+    if (maxValue != minValue) {
+        i32 palette[8];
+        buildSingleChannelPalette(maxValue, minValue, palette);
+        for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+            const i32 value = values[i * stride];
+            ui64 best = 0;
+            i32 bestDist = 256;
+            for (ui32 p = 0; p < 8; ++p) {
+                const i32 dist = std::abs(value - palette[p]);
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    best = p;
+                }
+            }
+            indices |= best << (3 * i);
+        }
+    }
+    for (ui32 i = 0; i < 6; ++i) {
+        block[2 + i] = static_cast<uc8>((indices >> (8 * i)) & 0xFF);
+    }
+}
+
+static void decodeSingleChannelBlock(const uc8 *block, uc8 *values, ui32 stride) {
+    i32 palette[8];
+    buildSingleChannelPalette(block[0], block[1], palette);
+    ui64 indices = 0;
+    for (ui32 i = 0; i < 6; ++i) {
+        indices |= static_cast<ui64>(block[2 + i]) << (8 * i);
+    }
+    for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+        values[i * stride] = static_cast<uc8>(palette[(indices >> (3 * i)) & 7]);
+    }
+}
+
+//-------------------------------------------------------------------------------------------------
+// TextureProcessor
+//-------------------------------------------------------------------------------------------------
+
+const c8 *TextureProcessor::getExtension() {
+    return Extension;
+}
+
+String TextureProcessor::getCachePath(const String &sourcePath) {
+    return sourcePath + "." + Extension;
+}
+
+bool TextureProcessor::import(const String &path, Texture *tex, const TextureImportOptions &options) {
+    if (tex == nullptr || path.empty()) {
+        return false;
+    }
+
+    // The options are part of the key, changed options invalidate the cache file
+    HashId key = 0;
+    String cachePath;
+    if (options.UseCache) {
+        key = MeshCache::computeSourceHash(path);
+        if (key != 0) {
+            const ui64 optionBits = (options.BuildMips ? 1u : 0u) | (static_cast<ui32>(options.Filter) << 1) |
+                                    ((options.Compress ? 1u : 0u) << 4) | (static_cast<ui64>(Version) << 8);
+            key = Common::StringUtils::fnv1a64(&optionBits, sizeof(optionBits), key);
+            cachePath = getCachePath(path);
+            if (loadCache(cachePath, key, tex)) {
+                return true;
+            }
+        }
+    }
+
+    if (!TextureDecoder::decodeFile(path, tex, false)) {
+        return false;
+    }
+    if (options.BuildMips && !generateMips(tex, options.Filter)) {
+        return false;
+    }
+    if (options.Compress && !compress(tex, tex->Channels == 4 ? PixelFormatType::BC3 : PixelFormatType::BC1)) {
+        return false;
+    }
+    if (key != 0 && !writeCache(cachePath, key, tex)) {
+        osre_debug(Tag, "Cannot write texture cache " + cachePath);
+    }
+
+    return true;
+}
+
+bool TextureProcessor::isCompressed(PixelFormatType format) {
+    return format == PixelFormatType::BC1 || format == PixelFormatType::BC3 || format == PixelFormatType::BC5;
+}
+
+size_t TextureProcessor::getImageSize(PixelFormatType format, ui32 width, ui32 height, ui32 channels) {
+    if (isCompressed(format)) {
+        const size_t blocksX = (std::max(1u, width) + BlockDim - 1) / BlockDim;
+        const size_t blocksY = (std::max(1u, height) + BlockDim - 1) / BlockDim;
+        return blocksX * blocksY * getBlockSize(format);
+    }
+
+    return static_cast<size_t>(width) * height * channels;
+}
+
+ui32 TextureProcessor::getNumMips(ui32 width, ui32 height) {
+    if (width == 0 || height == 0) {
+        return 0;
+    }
+
+    ui32 numMips = 1;
+    while (width > 1 || height > 1) {
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        ++numMips;
+    }
+
+    return numMips;
+}
+
+size_t TextureProcessor::getMipChainSize(PixelFormatType format, ui32 width, ui32 height, ui32 channels, ui32 numMips) {
+    size_t size = 0;
+    for (ui32 level = 0; level < numMips; ++level) {
+        size += getImageSize(format, width, height, channels);
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+
+    return size;
+}
+
+void TextureProcessor::downsample(const uc8 *src, ui32 width, ui32 height, ui32 channels, uc8 *dst, MipFilter filter) {
+    if (src == nullptr || dst == nullptr || width == 0 || height == 0) {
+        return;
+    }
+
+    if (filter == MipFilter::Kaiser) {
+        kaiserDownsample(src, width, height, channels, dst);
+    } else {
+        boxDownsample(src, width, height, channels, dst);
+    }
+}
+
+bool TextureProcessor::generateMips(Texture *tex, MipFilter filter) {
+    if (tex == nullptr || tex->Data == nullptr || isCompressed(tex->PixelFormat) || tex->Channels == 0) {
+        return false;
+    }
+
+    const ui32 numMips = getNumMips(tex->Width, tex->Height);
+    const size_t size = getMipChainSize(tex->PixelFormat, tex->Width, tex->Height, tex->Channels, numMips);
+    uc8 *data = new uc8[size];
+    const size_t levelSize = static_cast<size_t>(tex->Width) * tex->Height * tex->Channels;
+    ::memcpy(data, tex->Data, levelSize);
+
+    const uc8 *src = data;
+    uc8 *dst = data + levelSize;
+    ui32 width = tex->Width, height = tex->Height;
+    for (ui32 level = 1; level < numMips; ++level) {
+        downsample(src, width, height, tex->Channels, dst, filter);
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+        src = dst;
+        dst += static_cast<size_t>(width) * height * tex->Channels;
+    }
+
+    tex->clear();
+    tex->Data = data;
+    tex->Size = static_cast<ui32>(size);
+    tex->NumMips = numMips;
+
+    return true;
+}
+
+bool TextureProcessor::compress(Texture *tex, PixelFormatType format) {
+    if (tex == nullptr || tex->Data == nullptr || !isCompressed(format) || isCompressed(tex->PixelFormat)) {
+        return false;
+    }
+    if (tex->Channels != 3 && tex->Channels != 4) {
+        osre_debug(Tag, "Only RGB and RGBA textures can be compressed.");
+        return false;
+    }
+
+    const ui32 channels = tex->Channels;
+    const ui32 numMips = std::max(1u, tex->NumMips);
+    const size_t size = getMipChainSize(format, tex->Width, tex->Height, channels, numMips);
+    uc8 *data = new uc8[size];
+    const uc8 *src = tex->Data;
+    uc8 *dst = data;
+    ui32 width = tex->Width, height = tex->Height;
+    uc8 rgba[PixelsPerBlock * 4];
+    for (ui32 level = 0; level < numMips; ++level) {
+        for (ui32 by = 0; by < height; by += BlockDim) {
+            for (ui32 bx = 0; bx < width; bx += BlockDim) {
+                // Blocks crossing the border repeat the last row and column
+                for (ui32 j = 0; j < BlockDim; ++j) {
+                    const size_t row = std::min(by + j, height - 1) * static_cast<size_t>(width);
+                    for (ui32 i = 0; i < BlockDim; ++i) {
+                        const uc8 *px = src + (row + std::min(bx + i, width - 1)) * channels;
+                        uc8 *out = rgba + (j * BlockDim + i) * 4;
+                        out[0] = px[0];
+                        out[1] = px[1];
+                        out[2] = px[2];
+                        out[3] = channels == 4 ? px[3] : 255;
+                    }
+                }
+                encodeBlock(format, rgba, dst);
+                dst += getBlockSize(format);
+            }
+        }
+        src += static_cast<size_t>(width) * height * channels;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+
+    tex->clear();
+    tex->Data = data;
+    tex->Size = static_cast<ui32>(size);
+    tex->PixelFormat = format;
+
+    return true;
+}
+
+bool TextureProcessor::decompress(const Texture *src, Texture *dst) {
+    if (src == nullptr || dst == nullptr || src->Data == nullptr || !isCompressed(src->PixelFormat)) {
+        return false;
+    }
+
+    const ui32 channels = src->PixelFormat == PixelFormatType::BC5 ? 3 : 4;
+    const PixelFormatType format = channels == 4 ? PixelFormatType::R8G8B8A8 : PixelFormatType::R8G8B8;
+    const ui32 numMips = std::max(1u, src->NumMips);
+    const size_t size = getMipChainSize(format, src->Width, src->Height, channels, numMips);
+    uc8 *data = new uc8[size];
+    const uc8 *in = src->Data;
+    uc8 *out = data;
+    ui32 width = src->Width, height = src->Height;
+    uc8 rgba[PixelsPerBlock * 4];
+    for (ui32 level = 0; level < numMips; ++level) {
+        for (ui32 by = 0; by < height; by += BlockDim) {
+            for (ui32 bx = 0; bx < width; bx += BlockDim) {
+                decodeBlock(src->PixelFormat, in, rgba);
+                in += getBlockSize(src->PixelFormat);
+                for (ui32 j = 0; j < BlockDim && by + j < height; ++j) {
+                    for (ui32 i = 0; i < BlockDim && bx + i < width; ++i) {
+                        ::memcpy(out + ((by + j) * static_cast<size_t>(width) + bx + i) * channels, rgba + (j * BlockDim + i) * 4, channels);
+                    }
+                }
+            }
+        }
+        out += static_cast<size_t>(width) * height * channels;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+
+    dst->clear();
+    dst->Data = data;
+    dst->Size = static_cast<ui32>(size);
+    dst->Width = src->Width;
+    dst->Height = src->Height;
+    dst->Channels = channels;
+    dst->NumMips = numMips;
+    dst->PixelFormat = format;
+    dst->TargetType = src->TargetType;
+
+    return true;
+}
+
+void TextureProcessor::encodeBlock(PixelFormatType format, const uc8 *rgba, uc8 *block) {
+    switch (format) {
+        case PixelFormatType::BC1:
+            encodeColorBlock(rgba, block);
+            break;
+        case PixelFormatType::BC3:
+            encodeSingleChannelBlock(rgba + 3, 4, block);
+            encodeColorBlock(rgba, block + 8);
+            break;
+        case PixelFormatType::BC5:
+            encodeSingleChannelBlock(rgba, 4, block);
+            encodeSingleChannelBlock(rgba + 1, 4, block + 8);
+            break;
+        default:
+            osre_debug(Tag, "Unsupported block format.");
+            break;
+    }
+}
+
+void TextureProcessor::decodeBlock(PixelFormatType format, const uc8 *block, uc8 *rgba) {
+    switch (format) {
+        case PixelFormatType::BC1:
+            decodeColorBlock(block, false, rgba);
+            break;
+        case PixelFormatType::BC3:
+            decodeColorBlock(block + 8, true, rgba);
+            decodeSingleChannelBlock(block, rgba + 3, 4);
+            break;
+        case PixelFormatType::BC5:
+            decodeSingleChannelBlock(block, rgba, 4);
+            decodeSingleChannelBlock(block + 8, rgba + 1, 4);
+            for (ui32 i = 0; i < PixelsPerBlock; ++i) {
+                rgba[i * 4 + 2] = 0;
+                rgba[i * 4 + 3] = 255;
+            }
+            break;
+        default:
+            osre_debug(Tag, "Unsupported block format.");
+            break;
+    }
+}
+
+d32 TextureProcessor::computePSNR(const uc8 *lhs, const uc8 *rhs, size_t size) {
+    if (lhs == nullptr || rhs == nullptr || size == 0) {
+        return 0.0;
+    }
+
+    d32 sum = 0.0;
+    for (size_t i = 0; i < size; ++i) {
+        const d32 diff = static_cast<d32>(lhs[i]) - static_cast<d32>(rhs[i]);
+        sum += diff * diff;
+    }
+    if (sum == 0.0) {
+        return std::numeric_limits<d32>::infinity();
+    }
+    const d32 mse = sum / static_cast<d32>(size);
+
+    return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+bool TextureProcessor::writeCache(const String &cachePath, HashId sourceHash, const Texture *tex) {
+    if (cachePath.empty() || tex == nullptr || tex->Data == nullptr) {
+        return false;
+    }
+
+    FileStream stream(Uri("file://" + cachePath), Stream::AccessMode::WriteAccessBinary);
+    if (!stream.open()) {
+        osre_warn(Tag, "Cannot open texture cache " + cachePath + " for writing.");
+        return false;
+    }
+
+    const size_t dataOffset = alignTo(sizeof(TextureCacheHeader), DataAlignment);
+    TextureCacheHeader header = {};
+    ::memcpy(header.mMagic, Magic, sizeof(Magic));
+    header.mVersion = Version;
+    header.mSourceHash = sourceHash;
+    header.mPixelFormat = static_cast<i32>(tex->PixelFormat);
+    header.mWidth = tex->Width;
+    header.mHeight = tex->Height;
+    header.mChannels = tex->Channels;
+    header.mNumMips = tex->NumMips;
+    header.mDataSize = tex->Size;
+    header.mFileSize = dataOffset + tex->Size;
+
+    static constexpr c8 Zeros[DataAlignment] = {};
+    bool ok = stream.write(&header, sizeof(header)) == sizeof(header);
+    const size_t padding = dataOffset - sizeof(header);
+    ok = ok && (padding == 0 || stream.write(Zeros, padding) == padding);
+    ok = ok && stream.write(tex->Data, tex->Size) == tex->Size;
+    stream.close();
+    if (!ok) {
+        osre_warn(Tag, "Error while writing texture cache " + cachePath + ".");
+        ::remove(cachePath.c_str());
+    }
+
+    return ok;
+}
+
+bool TextureProcessor::loadCache(const String &cachePath, HashId sourceHash, Texture *tex) {
+    if (cachePath.empty() || tex == nullptr) {
+        return false;
+    }
+
+    MappedFileStream file(Uri("file://" + cachePath), Stream::AccessMode::MappedReadAccess);
+    if (!file.open()) {
+        return false;
+    }
+
+    const ui64 fileSize = file.getSize();
+    const uc8 *data = file.map(0, fileSize);
+    if (data == nullptr || fileSize < sizeof(TextureCacheHeader)) {
+        return false;
+    }
+
+    TextureCacheHeader header = {};
+    ::memcpy(&header, data, sizeof(header));
+    if (0 != ::memcmp(header.mMagic, Magic, sizeof(Magic)) || header.mVersion != Version) {
+        osre_debug(Tag, "Texture cache " + cachePath + " has an unsupported format.");
+        return false;
+    }
+    if (header.mSourceHash != sourceHash || header.mFileSize != fileSize) {
+        osre_debug(Tag, "Texture cache " + cachePath + " is stale.");
+        return false;
+    }
+
+    const auto format = static_cast<PixelFormatType>(header.mPixelFormat);
+    const size_t dataOffset = alignTo(sizeof(TextureCacheHeader), DataAlignment);
+    if (format <= PixelFormatType::Invalid || format >= PixelFormatType::Count || header.mNumMips == 0 ||
+            dataOffset + header.mDataSize != fileSize ||
+            getMipChainSize(format, header.mWidth, header.mHeight, header.mChannels, header.mNumMips) != header.mDataSize) {
+        osre_warn(Tag, "Texture cache " + cachePath + " is broken.");
+        return false;
+    }
+
+    tex->clear();
+    tex->Data = new uc8[header.mDataSize];
+    ::memcpy(tex->Data, data + dataOffset, header.mDataSize);
+    tex->Size = static_cast<ui32>(header.mDataSize);
+    tex->Width = header.mWidth;
+    tex->Height = header.mHeight;
+    tex->Channels = header.mChannels;
+    tex->NumMips = header.mNumMips;
+    tex->PixelFormat = format;
+
+    return true;
+}
+
+} // namespace OSRE::RenderBackend
@@ -0,0 +1,169 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#pragma once
+
+#include "RenderBackend/RenderCommon.h"
+
+namespace OSRE::RenderBackend {
+
+/// @brief  The filter used to compute the mip levels.
+enum class MipFilter {
+    Box = 0,    ///< 2x2 average, fast.
+    Kaiser,     ///< Kaiser windowed sinc, keeps more detail in the smaller levels.
+    Count       ///< Number of filters, not a valid filter.
+};
+
+/// @brief  Describes how an image file will be prepared for the GPU.
+struct TextureImportOptions {
+    bool BuildMips = true;              ///< Build the full mip chain.
+    MipFilter Filter = MipFilter::Box;  ///< The filter for the mip chain.
+    bool Compress = false;              ///< Encode RGB data as BC1 and RGBA data as BC3.
+    bool UseCache = false;              ///< Keep the processed texture in a cache file beside the source.
+};
+
+//-------------------------------------------------------------------------------------------------
+///	@ingroup	Engine
+///
+///	@brief  This class implements the CPU side texture processing: mip chain generation, 
+///         block compression and the processed texture cache.
+///
+/// The block encoders write the BC1 (DXT1), BC3 (DXT5) and BC5 (RGTC2) formats. The decoders 
+/// are used as fallback when the GPU does not support a format and to measure the quality.
+/// The cache file stores the processed mip chain in its upload layout, keyed by the source 
+/// hash and the import options.
+//-------------------------------------------------------------------------------------------------
+class OSRE_EXPORT TextureProcessor {
+public:
+    /// @brief The current version of the cache file format.
+    static constexpr ui32 Version = 1;
+
+    /// @brief Will return the file extension used for cache files.
+    /// @return The extension.
+    static const c8 *getExtension();
+
+    /// @brief Will return the path of the cache file for a source image.
+    /// @param[in] sourcePath   The path of the source image.
+    /// @return The cache file path.
+    static String getCachePath(const String &sourcePath);
+
+    /// @brief Will decode an image file and process it as requested by the options.
+    /// @param[in] path         The path of the image file.
+    /// @param[in] tex          The texture to fill.
+    /// @param[in] options      The import options.
+    /// @return true if successful.
+    static bool import(const String &path, Texture *tex, const TextureImportOptions &options);
+
+    /// @brief Returns true for block compressed formats.
+    /// @param[in] format       The pixel format.
+    /// @return true if compressed.
+    static bool isCompressed(PixelFormatType format);
+
+    /// @brief Returns the size of one image.
+    /// @param[in] format       The pixel format.
+    /// @param[in] width        The width in pixels.
+    /// @param[in] height       The height in pixels.
+    /// @param[in] channels     The number of bytes per pixel of uncompressed formats.
+    /// @return The size in bytes.
+    static size_t getImageSize(PixelFormatType format, ui32 width, ui32 height, ui32 channels);
+
+    /// @brief Returns the number of mip levels down to 1x1.
+    /// @param[in] width        The width of level 0.
+    /// @param[in] height       The height of level 0.
+    /// @return The number of levels.
+    static ui32 getNumMips(ui32 width, ui32 height);
+
+    /// @brief Returns the size of a tightly packed mip chain.
+    /// @param[in] format       The pixel format.
+    /// @param[in] width        The width of level 0.
+    /// @param[in] height       The height of level 0.
+    /// @param[in] channels     The number of bytes per pixel of uncompressed formats.
+    /// @param[in] numMips      The number of levels.
+    /// @return The size of all levels in bytes.
+    static size_t getMipChainSize(PixelFormatType format, ui32 width, ui32 height, ui32 channels, ui32 numMips);
+
+    /// @brief Will compute one mip level from the level above.
+    /// @param[in]  src         The source level.
+    /// @param[in]  width       The width of the source level.
+    /// @param[in]  height      The height of the source level.
+    /// @param[in]  channels    The number of bytes per pixel.
+    /// @param[out] dst         The destination, half the size in both directions, at least 1.
+    /// @param[in]  filter      The filter to use.
+    static void downsample(const uc8 *src, ui32 width, ui32 height, ui32 channels, uc8 *dst, MipFilter filter);
+
+    /// @brief Will replace the texture data by the full mip chain of level 0.
+    /// @param[in] tex          The texture with uncompressed data.
+    /// @param[in] filter       The filter to use.
+    /// @return true if successful.
+    static bool generateMips(Texture *tex, MipFilter filter);
+
+    /// @brief Will encode all mip levels of the texture into a block compressed format.
+    /// @param[in] tex          The texture with RGB or RGBA data.
+    /// @param[in] format       BC1, BC3 or BC5, BC5 stores the red and green channel.
+    /// @return true if successful.
+    static bool compress(Texture *tex, PixelFormatType format);
+
+    /// @brief Will decode a block compressed texture, BC1 and BC3 into RGBA, BC5 into RGB.
+    /// @param[in]  src         The compressed texture.
+    /// @param[out] dst         The texture to fill.
+    /// @return true if successful.
+    static bool decompress(const Texture *src, Texture *dst);
+
+    /// @brief Will encode one 4x4 block of RGBA pixels.
+    /// @param[in]  format      BC1, BC3 or BC5.
+    /// @param[in]  rgba        16 pixels, row by row.
+    /// @param[out] block       8 bytes for BC1, 16 bytes for BC3 and BC5.
+    static void encodeBlock(PixelFormatType format, const uc8 *rgba, uc8 *block);
+
+    /// @brief Will decode one 4x4 block into RGBA pixels.
+    /// @param[in]  format      BC1, BC3 or BC5.
+    /// @param[in]  block       The block data.
+    /// @param[out] rgba        16 pixels, row by row.
+    static void decodeBlock(PixelFormatType format, const uc8 *block, uc8 *rgba);
+
+    /// @brief Returns the peak signal-to-noise ratio between two images.
+    /// @param[in] lhs          The first image.
+    /// @param[in] rhs          The second image.
+    /// @param[in] size         The size of both images in bytes.
+    /// @return The PSNR in dB, infinity for identical images.
+    static d32 computePSNR(const uc8 *lhs, const uc8 *rhs, size_t size);
+
+    /// @brief Will write the texture into a cache file.
+    /// @param[in] cachePath    The path of the cache file.
+    /// @param[in] sourceHash   The key of the source image.
+    /// @param[in] tex          The processed texture.
+    /// @return true if successful.
+    static bool writeCache(const String &cachePath, HashId sourceHash, const Texture *tex);
+
+    /// @brief Will load a cache file into the texture.
+    /// @param[in] cachePath    The path of the cache file.
+    /// @param[in] sourceHash   The expected key.
+    /// @param[in] tex          The texture to fill.
+    /// @return true if successful, false if the file is missing, stale or broken.
+    static bool loadCache(const String &cachePath, HashId sourceHash, Texture *tex);
+
+private:
+    TextureProcessor() = default;
+    ~TextureProcessor() = default;
+};
+
+} // namespace OSRE::RenderBackend
@@ -24,6 +24,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/Event.h"
 #include "Debugging/osre_debugging.h"
 #include "Platform/Threading.h"
+#include "Profiling/CpuProfiler.h"
 #include "Threading/SystemTask.h"
 #include "Threading/TAsyncQueue.h"
 #include "Threading/TaskJob.h"
@@ -128,6 +129,7 @@ protected:
         osre_assert(nullptr != mActiveJobQueue);
 
         osre_debug(Tag, "SystemThread::run");
+        Profiling::CpuProfiler::setThreadName(getName());
         bool running = true;
         while (running) {
             mActiveJobQueue->awaitEnqueuedItem();
@@ -140,6 +142,7 @@ protected:
                     osre_debug(Tag, stream.str());
                 }
 
+                OSRE_PROFILE_SCOPE("SystemTaskThread::run");
                 const TaskJob *job = mActiveJobQueue->dequeue();
                 const Common::Event *ev = job->getEvent();
                 if (nullptr == ev) {
@@ -215,7 +218,7 @@ bool SystemTask::start(Thread *pThread) {
     // ensure task is not running
     if (nullptr != m_taskThread) {
         if (Thread::ThreadState::Running == m_taskThread->getCurrentState()) {
-            osre_debug(Tag, "Task " + Object::getName() + " is already running.");
+            osre_debugf(Tag, "Task %s is already running.", Object::getName().c_str());
             return false;
         }
     }
@@ -234,7 +237,7 @@ bool SystemTask::start(Thread *pThread) {
 
 bool SystemTask::stop() {
     if ( Thread::ThreadState::Running != m_taskThread->getCurrentState()) {
-        osre_debug(Tag, "Task " + getName() + " is not running.");
+        osre_debugf(Tag, "Task %s is not running.", getName().c_str());
         return false;
     }
 
@@ -45,6 +45,14 @@ void UiService::setCanvasRenderer(CanvasRenderer *canvasRenderer) {
     mCanvasRenderer = canvasRenderer;
 }
 
+TextureAtlas *UiService::getTextureAtlas() const {
+    if (mCanvasRenderer == nullptr) {
+        return nullptr;
+    }
+
+    return mCanvasRenderer->getTextureAtlas();
+}
+
 UiService *UiService::create() {
     return new UiService;
 }
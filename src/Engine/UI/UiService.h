@@ -29,6 +29,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 namespace OSRE {
 namespace RenderBackend {
     class CanvasRenderer;
+    class TextureAtlas;
 }
 }
 
@@ -56,6 +57,10 @@ public:
     /// @brief 
     /// @param canvasRenderer 
     void setCanvasRenderer(RenderBackend::CanvasRenderer *canvasRenderer);
+
+    /// @brief  Will return the texture atlas of the canvas renderer, images of all widgets share it.
+    /// @return The texture atlas, nullptr if no canvas renderer is set.
+    RenderBackend::TextureAtlas *getTextureAtlas() const;
     
     /// @brief  Will create a new instance.
     /// @return The new created instance.
@@ -0,0 +1,93 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "Common/Logger.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+
+static constexpr ui32 NumThreads = 4;
+static constexpr ui32 NumMessages = 250000;
+
+// Counts the written characters instead of writing them
+class NullLogStream : public AbstractLogStream {
+public:
+    size_t mNumChars = 0;
+
+    void write(const String &msg) override {
+        mNumChars += msg.size();
+    }
+};
+
+static void run(const c8 *name, ui32 capacity) {
+    Logger *logger = Logger::getInstance();
+    NullLogStream stream;
+    logger->registerLogStream(&stream);
+    if (capacity != 0) {
+        logger->startAsync(capacity);
+    }
+
+    const Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([]() {
+            const String domain = "Bench";
+            for (ui32 j = 0; j < NumMessages; ++j) {
+                osre_warn(domain, "A typical log message with some text in it");
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    const double callers = elapsedMs(start);
+    logger->flush();
+    const double drained = elapsedMs(start);
+    const ui64 numDropped = logger->getNumDroppedMessages();
+    logger->stopAsync();
+    logger->unregisterLogStream(&stream);
+
+    String caseName = String(name) + ", callers";
+    report(caseName.c_str(), callers, NumThreads * NumMessages);
+    caseName = String(name) + ", drained";
+    report(caseName.c_str(), drained, NumThreads * NumMessages);
+    ::printf("%-40s %10llu dropped\n", name, static_cast<unsigned long long>(numDropped));
+}
+
+int main() {
+    // The standard stream would measure the console, mute it
+    std::streambuf *coutBuffer = std::cout.rdbuf(nullptr);
+    run("sync", 0);
+    run("async, 2048 records", 2048);
+    run("async, 64K records", 1 << 16);
+    run("async, 1M records", 1 << 20);
+    std::cout.rdbuf(coutBuffer);
+    std::cout.clear();
+
+    return 0;
+}
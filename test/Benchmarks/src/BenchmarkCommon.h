@@ -22,43 +22,39 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #pragma once
 
-#include "Profiling/ProfilingCommon.h"
+#include "Common/osre_common.h"
 
-namespace OSRE {
-
-namespace Platform {
-    class AbstractTimer;
-}
+#include <chrono>
+#include <cstdio>
 
-namespace Profiling {
-//-------------------------------------------------------------------------------------------------
-///	@ingroup	Engine
-///
-///	@brief  This class implements a simple frames-per-second counter.
-//-------------------------------------------------------------------------------------------------
-class OSRE_EXPORT FPSCounter {
-public:
-    ///	@brief  The class constructor.
-    /// @param  timer   [in] The timer instance.
-    explicit FPSCounter(Platform::AbstractTimer *timer);
+namespace OSRE {
+namespace Benchmark {
 
-    ///	@brief  The class destructor.
-    ~FPSCounter() = default;
+using Clock = std::chrono::steady_clock;
 
-    ///	@brief  Returns the counted frames per seconds.
-    /// @return The counted frames per second.
-    ui32 getFPS();
+/// @brief  Will return the milliseconds passed since the given time point.
+/// @param[in] start    The start time point.
+/// @return The elapsed time in milliseconds.
+inline double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
 
-    FPSCounter() = delete;
-    FPSCounter( const FPSCounter & ) = delete;
-    FPSCounter & operator = ( const FPSCounter & ) = delete;
+/// @brief  Will print one result line, the total time and the time per operation.
+/// @param[in] name     The name of the measured case.
+/// @param[in] ms       The total time in milliseconds.
+/// @param[in] numOps   The number of measured operations.
+inline void report(const c8 *name, double ms, size_t numOps) {
+    const double ns = numOps == 0 ? 0.0 : ms * 1000000.0 / static_cast<double>(numOps);
+    ::printf("%-40s %10.2f ms %10.2f ns/op\n", name, ms, ns);
+}
 
-private:
-    Platform::AbstractTimer *m_timerPtr;
-    Time m_timeDiff;
-    i64 m_lastTime;
-    ui32 m_fps, m_lastFPS;
-};
+/// @brief  Will keep the compiler from dropping a computed value.
+/// @param[in] value    The value to keep.
+template <class T>
+inline void keep(const T &value) {
+    static volatile T sink;
+    sink = value;
+}
 
-} // Namespace Profiling
+} // Namespace Benchmark
 } // Namespace OSRE
@@ -0,0 +1,103 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "Common/AbstractEventHandler.h"
+#include "Common/Event.h"
+#include "Common/EventBus.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+
+static constexpr ui32 NumEventTypes = 50;
+
+class CountingHandler : public AbstractEventHandler {
+public:
+    ui64 mNumEvents = 0;
+
+    bool onEvent(const Event &, const EventData *) override {
+        ++mNumEvents;
+        return true;
+    }
+
+    bool onAttached(const EventData *) override {
+        return true;
+    }
+
+    bool onDetached(const EventData *) override {
+        return true;
+    }
+};
+
+/// Usage: osre_bench_eventbus [events per frame] [frames]
+int main(int argc, char *argv[]) {
+    const ui32 numEventsPerFrame = argc > 1 ? static_cast<ui32>(::atoi(argv[1])) : 1000000;
+    const ui32 numFrames = argc > 2 ? static_cast<ui32>(::atoi(argv[2])) : 10;
+
+    std::vector<String> names;
+    std::vector<std::unique_ptr<Event>> events;
+    std::vector<CountingHandler> handlers(NumEventTypes);
+    for (ui32 i = 0; i < NumEventTypes; ++i) {
+        names.push_back("BenchEvent" + std::to_string(i));
+    }
+    for (ui32 i = 0; i < NumEventTypes; ++i) {
+        events.emplace_back(new Event(names[i].c_str()));
+    }
+
+    EventBus bus;
+    bus.create();
+    for (ui32 i = 0; i < NumEventTypes; ++i) {
+        bus.subscribeEventHandler(&handlers[i], *events[i]);
+    }
+
+    double bestFrame = 0.0, bestPublish = 0.0;
+    for (ui32 frame = 0; frame < numFrames; ++frame) {
+        const Clock::time_point start = Clock::now();
+        for (ui32 i = 0; i < numEventsPerFrame; ++i) {
+            bus.publish(*events[i % NumEventTypes], nullptr);
+        }
+        const double publish = elapsedMs(start);
+        bus.update();
+        const double total = elapsedMs(start);
+        if (frame == 0 || total < bestFrame) {
+            bestFrame = total;
+            bestPublish = publish;
+        }
+    }
+
+    ui64 numDispatched = 0;
+    for (const CountingHandler &handler : handlers) {
+        numDispatched += handler.mNumEvents;
+    }
+    report("best frame, publish", bestPublish, numEventsPerFrame);
+    report("best frame, publish and dispatch", bestFrame, numEventsPerFrame);
+    ::printf("%-40s %10llu events\n", "dispatched", static_cast<unsigned long long>(numDispatched));
+    bus.destroy();
+
+    return 0;
+}
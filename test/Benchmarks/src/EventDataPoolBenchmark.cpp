@@ -0,0 +1,80 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "Platform/PlatformInterface.h"
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+using namespace ::OSRE::Platform;
+
+static constexpr size_t NumEvents = 1000000;
+static constexpr size_t NumAlive = 64;
+
+// The same payload as MouseMoveEventData, but allocated from the global heap
+class HeapMouseMoveEventData : public EventData {
+public:
+    HeapMouseMoveEventData() :
+            EventData(MouseMoveEvent, nullptr), m_absX(0), m_absY(0) {
+        // empty
+    }
+
+    i32 m_absX;
+    i32 m_absY;
+};
+
+// The pooled type, MouseMoveEventData only offers the constructor with the triggerer
+class PooledMouseMoveEventData : public MouseMoveEventData {
+public:
+    PooledMouseMoveEventData() :
+            MouseMoveEventData(nullptr) {
+        // empty
+    }
+};
+
+// Keeps a window of events alive, like a frame of queued input does
+template <class TEventData>
+static void measure(const c8 *name) {
+    EventData *alive[NumAlive] = {};
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < NumEvents; ++i) {
+        EventData *&slot = alive[i % NumAlive];
+        if (nullptr != slot) {
+            slot->release();
+        }
+        slot = new TEventData();
+    }
+    for (EventData *data : alive) {
+        data->release();
+    }
+    report(name, elapsedMs(start), NumEvents);
+}
+
+int main() {
+    for (ui32 i = 0; i < 3; ++i) {
+        measure<HeapMouseMoveEventData>("mouse move data, global heap");
+        measure<PooledMouseMoveEventData>("mouse move data, pool");
+    }
+
+    return 0;
+}
@@ -0,0 +1,68 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "Common/Logger.h"
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+
+DECL_OSRE_LOG_MODULE(LogLevelBenchmark)
+
+static constexpr size_t NumCalls = 10000000;
+
+template <class TCall>
+static void measure(const c8 *name, TCall call) {
+    const Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < NumCalls; ++i) {
+        call();
+    }
+    report(name, elapsedMs(start), NumCalls);
+}
+
+int main() {
+    // Debug messages are disabled in the normal mode, nothing reaches the streams
+    Logger::getInstance()->setVerboseMode(Logger::VerboseMode::Normal);
+    String name = "RenderTaskThread";
+    keep(name.size());
+    ::printf("OSRE_LOG_MIN_LEVEL is %d\n", OSRE_LOG_MIN_LEVEL);
+
+    // The helper functions evaluate their arguments like the macros did before
+    measure("eager, literal", []() {
+        debugPrint(Tag, __FILE__, __LINE__, "Nullptr to render-command detected.");
+    });
+    measure("eager, concatenated", [&name]() {
+        debugPrint(Tag, __FILE__, __LINE__, "Task " + name + " is already running.");
+    });
+    measure("osre_debug, literal", []() {
+        osre_debug(Tag, "Nullptr to render-command detected.");
+    });
+    measure("osre_debug, concatenated", [&name]() {
+        osre_debug(Tag, "Task " + name + " is already running.");
+    });
+    measure("osre_debugf", [&name]() {
+        osre_debugf(Tag, "Task %s is already running.", name.c_str());
+    });
+
+    return 0;
+}
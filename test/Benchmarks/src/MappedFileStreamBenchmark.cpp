@@ -0,0 +1,136 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "IO/FileStream.h"
+#include "IO/MappedFileStream.h"
+#include "IO/Uri.h"
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::IO;
+
+static constexpr size_t ChunkSize = 64 * 1024;
+static constexpr size_t RandomReadSize = 256;
+static constexpr size_t PageSize = 4096;
+
+static bool writeTestFile(const Uri &uri, size_t size) {
+    std::vector<uc8> chunk(ChunkSize);
+    FileStream stream(uri, Stream::AccessMode::WriteAccessBinary);
+    if (!stream.open()) {
+        return false;
+    }
+    for (size_t offset = 0; offset < size; offset += ChunkSize) {
+        for (size_t i = 0; i < ChunkSize; ++i) {
+            chunk[i] = static_cast<uc8>(((offset + i) * 2654435761u) >> 13);
+        }
+        stream.write(chunk.data(), ChunkSize);
+    }
+    stream.close();
+
+    return true;
+}
+
+/// Usage: osre_bench_mappedfilestream [file size in MB] [random reads]
+/// The file is read from the page cache, the first pass warms it up.
+int main(int argc, char *argv[]) {
+    const size_t fileSize = (argc > 1 ? static_cast<size_t>(::atoi(argv[1])) : 256) << 20;
+    const size_t numRandomReads = argc > 2 ? static_cast<size_t>(::atoi(argv[2])) : 200000;
+
+    const Uri uri("file://osre_bench_mapped.bin");
+    if (!writeTestFile(uri, fileSize)) {
+        ::printf("Cannot write the test file.\n");
+        return 1;
+    }
+
+    std::mt19937_64 rng(1);
+    std::vector<size_t> offsets(numRandomReads);
+    for (size_t &offset : offsets) {
+        offset = rng() % (fileSize - RandomReadSize);
+    }
+
+    std::vector<uc8> buffer(ChunkSize);
+    ui64 sum = 0;
+    for (ui32 pass = 0; pass < 2; ++pass) {
+        ::printf("pass %u\n", pass);
+        {
+            FileStream stream(uri, Stream::AccessMode::ReadAccessBinary);
+            stream.open();
+            const Clock::time_point start = Clock::now();
+            size_t numRead = 0;
+            while ((numRead = stream.read(buffer.data(), ChunkSize)) > 0) {
+                sum += buffer[numRead - 1];
+            }
+            report("sequential 64 KB reads, FileStream", elapsedMs(start), fileSize / ChunkSize);
+        }
+        {
+            MappedFileStream stream(uri, Stream::AccessMode::MappedReadAccess);
+            stream.open();
+            const Clock::time_point start = Clock::now();
+            size_t numRead = 0;
+            while ((numRead = stream.read(buffer.data(), ChunkSize)) > 0) {
+                sum += buffer[numRead - 1];
+            }
+            report("sequential 64 KB reads, mapped copy", elapsedMs(start), fileSize / ChunkSize);
+        }
+        {
+            MappedFileStream stream(uri, Stream::AccessMode::MappedReadAccess);
+            stream.open();
+            const Clock::time_point start = Clock::now();
+            const uc8 *view = stream.map(0, stream.getSize());
+            for (size_t i = 0; view != nullptr && i < fileSize; i += PageSize) {
+                sum += view[i];
+            }
+            report("sequential page touch, mapped view", elapsedMs(start), fileSize / PageSize);
+        }
+        {
+            FileStream stream(uri, Stream::AccessMode::ReadAccessBinary);
+            stream.open();
+            const Clock::time_point start = Clock::now();
+            for (size_t offset : offsets) {
+                stream.seek(static_cast<Stream::Offset>(offset), Stream::Origin::Begin);
+                stream.read(buffer.data(), RandomReadSize);
+                sum += buffer[0];
+            }
+            report("random 256 B reads, FileStream", elapsedMs(start), numRandomReads);
+        }
+        {
+            MappedFileStream stream(uri, Stream::AccessMode::MappedReadAccess);
+            stream.open();
+            const Clock::time_point start = Clock::now();
+            for (size_t offset : offsets) {
+                stream.seek(static_cast<Stream::Offset>(offset), Stream::Origin::Begin);
+                stream.read(buffer.data(), RandomReadSize);
+                sum += buffer[0];
+            }
+            report("random 256 B reads, mapped copy", elapsedMs(start), numRandomReads);
+        }
+    }
+    keep(sum);
+    ::remove("osre_bench_mapped.bin");
+
+    return 0;
+}
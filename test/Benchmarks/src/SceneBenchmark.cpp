@@ -0,0 +1,138 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "App/Entity.h"
+#include "App/Scene.h"
+#include "Common/Ids.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::App;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+
+static constexpr size_t NumLookups = 2000;
+
+// The lookup before the name index, kept as the reference
+static Entity *scanEntities(const Scene &scene, const String &name) {
+    const cppcore::TArray<Entity *> &entities = scene.getEntityArray();
+    for (size_t i = 0; i < entities.size(); ++i) {
+        if (entities[i]->getName() == name) {
+            return entities[i];
+        }
+    }
+
+    return nullptr;
+}
+
+/// Usage: osre_bench_scene [entities]
+int main(int argc, char *argv[]) {
+    const size_t numEntities = argc > 1 ? static_cast<size_t>(::atoi(argv[1])) : 100000;
+
+    std::vector<String> names;
+    for (size_t i = 0; i < numEntities; ++i) {
+        names.push_back("level/props/entity_" + std::to_string(i));
+    }
+    std::mt19937 rng(42);
+    std::vector<size_t> queries(NumLookups);
+    for (size_t &query : queries) {
+        query = rng() % numEntities;
+    }
+
+    Scene scene("bench_scene");
+    Ids ids;
+    std::vector<Entity *> entities;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < numEntities; ++i) {
+        entities.push_back(new Entity(names[i], ids, &scene));
+    }
+    report("add entities", elapsedMs(start), numEntities);
+
+    size_t numFound = 0;
+    start = Clock::now();
+    for (size_t query : queries) {
+        numFound += scanEntities(scene, names[query]) != nullptr ? 1 : 0;
+    }
+    report("find by name, linear scan", elapsedMs(start), NumLookups);
+
+    start = Clock::now();
+    for (size_t query : queries) {
+        numFound += scene.findEntity(names[query]) != nullptr ? 1 : 0;
+    }
+    report("find by name, index", elapsedMs(start), NumLookups);
+
+    std::vector<StringId> nameIds;
+    for (size_t query : queries) {
+        nameIds.push_back(StringId(names[query]));
+    }
+    start = Clock::now();
+    for (StringId nameId : nameIds) {
+        numFound += scene.findEntity(nameId) != nullptr ? 1 : 0;
+    }
+    report("find by name id, index", elapsedMs(start), NumLookups);
+
+    // Interned names which no entity has must not be slower than hits
+    std::vector<StringId> missingIds;
+    for (size_t i = 0; i < NumLookups; ++i) {
+        missingIds.push_back(StringId("level/props/missing_" + std::to_string(i)));
+    }
+    start = Clock::now();
+    for (StringId nameId : missingIds) {
+        numFound += scene.findEntity(nameId) != nullptr ? 1 : 0;
+    }
+    report("find missing name id, index", elapsedMs(start), NumLookups);
+
+    std::vector<EntityHandle> handles;
+    for (size_t query : queries) {
+        handles.push_back(scene.getEntityHandle(entities[query]));
+    }
+    start = Clock::now();
+    for (EntityHandle handle : handles) {
+        numFound += scene.getEntity(handle) != nullptr ? 1 : 0;
+    }
+    report("get by handle", elapsedMs(start), NumLookups);
+
+    start = Clock::now();
+    for (size_t query : queries) {
+        entities[query]->setName(names[query] + "_renamed");
+    }
+    report("rename", elapsedMs(start), NumLookups);
+
+    std::shuffle(entities.begin(), entities.end(), rng);
+    start = Clock::now();
+    for (Entity *entity : entities) {
+        scene.removeEntity(entity);
+    }
+    report("remove entities", elapsedMs(start), numEntities);
+    ::printf("%-40s %10zu\n", "found", numFound);
+
+    for (Entity *entity : entities) {
+        delete entity;
+    }
+
+    return 0;
+}
@@ -20,41 +20,48 @@ COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
 IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
-#include "Profiling/FPSCounter.h"
-#include "Common/Logger.h"
-#include "Platform/AbstractTimer.h"
+#include "BenchmarkCommon.h"
+#include "RenderBackend/OGLRenderer/OGLShader.h"
 
-namespace OSRE::Profiling {
+#include <cstring>
 
-using namespace ::OSRE::Common;
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::RenderBackend;
 
-static constexpr c8 Tag[] = "FPSCounter";
+static constexpr size_t NumBinds = 30000000;
 
-FPSCounter::FPSCounter( Platform::AbstractTimer *timer ) :
-        m_timerPtr(timer), m_timeDiff(0), m_lastTime(0), m_fps(0), m_lastFPS(0) {
-    if (m_timerPtr != nullptr) {
-        m_timeDiff = m_timerPtr->getTimeDiff();
-    }
+// Stands in for glUniformMatrix4fv, no GL context is needed
+static void bindMatrix(GLint location, const f32 *data) {
+    keep(location);
+    keep(data[0]);
 }
 
-static constexpr ui32 SecondsInMs = 1000;
-
-ui32 FPSCounter::getFPS() {
-    if (m_timerPtr== nullptr) {
-        osre_debug(Tag, "No valid timer instance.");
-        return 0;
+int main() {
+    static const c8 *Names[] = { "Model", "View", "Projection", "Normal", "tex0", "tex1", "color", "time", "light", "fog" };
+    OGLShader shader("bench_shader");
+    GLint location = 0;
+    for (const c8 *name : Names) {
+        shader.setUniformLocation(name, location++);
     }
 
-    m_timeDiff = m_timerPtr->getTimeDiff();
-    m_lastTime += m_timeDiff.milliSeconds;
-    m_fps++;
-    if (m_lastTime > SecondsInMs) {
-        m_lastTime = 0;
-        m_lastFPS = m_fps;
-        m_fps = 0;
+    f32 matrix[16] = {};
+    f32 data[16] = {};
+    const String name = "Projection";
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < NumBinds; ++i) {
+        ::memcpy(data, matrix, sizeof(matrix));
+        bindMatrix(shader.getUniformLocation(name), data);
     }
+    report("location by name", elapsedMs(start), NumBinds);
 
-    return m_lastFPS;
-}
+    const ui32 slot = OGLShader::findParameterSlot(name);
+    start = Clock::now();
+    for (size_t i = 0; i < NumBinds; ++i) {
+        ::memcpy(data, matrix, sizeof(matrix));
+        bindMatrix(shader.getUniformLocation(slot), data);
+    }
+    report("location by slot", elapsedMs(start), NumBinds);
 
+    return 0;
 }
@@ -0,0 +1,146 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "App/Entity.h"
+#include "App/TransformComponent.h"
+#include "Common/Ids.h"
+#include "Common/StringId.h"
+#include "RenderBackend/OGLRenderer/OGLCommon.h"
+
+#include <cstdlib>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::App;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::Common;
+using namespace ::OSRE::RenderBackend;
+
+static constexpr size_t NumChildren = 256;
+
+// The parameter as it was before the names were interned, kept as the reference
+struct StringParameter {
+    String m_name;
+};
+
+// The child lookup before the names were interned, kept as the reference
+static TransformComponent *findChildByString(const std::vector<TransformComponent *> &children, const String &name) {
+    for (TransformComponent *child : children) {
+        if (child->getName() == name) {
+            return child;
+        }
+    }
+
+    return nullptr;
+}
+
+template <class TParam, class TName>
+static size_t findParam(const TName &name, const std::vector<TParam *> &params) {
+    for (size_t i = 0; i < params.size(); ++i) {
+        if (name == params[i]->m_name) {
+            return i;
+        }
+    }
+
+    return params.size();
+}
+
+/// Usage: osre_bench_stringid [lookups]
+int main(int argc, char *argv[]) {
+    const size_t numLookups = argc > 1 ? static_cast<size_t>(::atoi(argv[1])) : 200000;
+
+    Ids ids;
+    Entity owner("bench_owner", ids, nullptr);
+    TransformComponent *root = new TransformComponent("bench_root", &owner, ids);
+    std::vector<String> names;
+    std::vector<TransformComponent *> children;
+    for (size_t i = 0; i < NumChildren; ++i) {
+        names.push_back("scene/entity_node_" + std::to_string(i));
+        children.push_back(new TransformComponent(names.back(), &owner, ids, root));
+    }
+
+    size_t numFound = 0;
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < numLookups; ++i) {
+        numFound += findChildByString(children, names[(i * 7) % NumChildren]) != nullptr ? 1 : 0;
+    }
+    report("child lookup, String compare", elapsedMs(start), numLookups);
+
+    start = Clock::now();
+    for (size_t i = 0; i < numLookups; ++i) {
+        numFound += root->findChild(names[(i * 7) % NumChildren]) != nullptr ? 1 : 0;
+    }
+    report("child lookup, StringId::find + compare", elapsedMs(start), numLookups);
+
+    std::vector<StringId> nameIds;
+    for (const String &name : names) {
+        nameIds.push_back(StringId(name));
+    }
+    start = Clock::now();
+    for (size_t i = 0; i < numLookups; ++i) {
+        numFound += root->findChild(nameIds[(i * 7) % NumChildren]) != nullptr ? 1 : 0;
+    }
+    report("child lookup, id compare", elapsedMs(start), numLookups);
+
+    // Binds a full parameter set, each parameter is matched against the bound ones
+    static const c8 *ParamNames[] = { "MVP", "Model", "View", "Projection", "NormalMatrix", "tex0", "tex1",
+        "LightPos", "LightColor", "Ambient", "Shininess", "Time" };
+    static constexpr size_t NumParams = sizeof(ParamNames) / sizeof(ParamNames[0]);
+    std::vector<StringParameter> stringParams(NumParams);
+    std::vector<OGLParameter> idParams(NumParams);
+    std::vector<StringParameter *> boundStringParams;
+    std::vector<OGLParameter *> boundIdParams;
+    for (size_t i = 0; i < NumParams; ++i) {
+        stringParams[i].m_name = ParamNames[i];
+        idParams[i].m_name = StringId(ParamNames[i]);
+        boundStringParams.push_back(&stringParams[i]);
+        boundIdParams.push_back(&idParams[i]);
+    }
+
+    size_t sum = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < numLookups; ++i) {
+        for (size_t j = 0; j < NumParams; ++j) {
+            sum += findParam(boundStringParams[(i + j) % NumParams]->m_name, boundStringParams);
+        }
+    }
+    report("parameter binding, String compare", elapsedMs(start), numLookups);
+
+    start = Clock::now();
+    for (size_t i = 0; i < numLookups; ++i) {
+        for (size_t j = 0; j < NumParams; ++j) {
+            sum += findParam(boundIdParams[(i + j) % NumParams]->m_name, boundIdParams);
+        }
+    }
+    report("parameter binding, id compare", elapsedMs(start), numLookups);
+    keep(sum);
+    ::printf("%-40s %10zu\n", "found", numFound);
+
+    // The root releases its children, so it goes first
+    delete root;
+    for (TransformComponent *child : children) {
+        delete child;
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "BenchmarkCommon.h"
+#include "RenderBackend/RenderCommon.h"
+#include "RenderBackend/TextureDecoder.h"
+
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+#include <thread>
+#include <vector>
+
+using namespace ::OSRE;
+using namespace ::OSRE::Benchmark;
+using namespace ::OSRE::RenderBackend;
+
+static constexpr ui32 NumImages = 200;
+static constexpr ui32 Width = 512;
+static constexpr ui32 Height = 512;
+static constexpr ui32 Channels = 4;
+
+static String getImagePath(ui32 index) {
+    return "bench_texture_" + std::to_string(index) + ".png";
+}
+
+static bool writeImages() {
+    std::vector<uc8> pixels(Width * Height * Channels);
+    for (ui32 i = 0; i < NumImages; ++i) {
+        for (ui32 y = 0; y < Height; ++y) {
+            for (ui32 x = 0; x < Width; ++x) {
+                uc8 *pixel = &pixels[(y * Width + x) * Channels];
+                pixel[0] = static_cast<uc8>(x ^ i);
+                pixel[1] = static_cast<uc8>(y + i);
+                pixel[2] = static_cast<uc8>((x * y) >> 4);
+                pixel[3] = static_cast<uc8>(255 - (x & y));
+            }
+        }
+        if (0 == stbi_write_png(getImagePath(i).c_str(), Width, Height, Channels, pixels.data(), Width * Channels)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The row flip used before, one byte swap at a time
+static void flipBytes(uc8 *data, ui32 width, ui32 height, ui32 channels) {
+    for (ui32 j = 0; j * 2 < height; ++j) {
+        ui32 i1 = j * width * channels;
+        ui32 i2 = (height - 1 - j) * width * channels;
+        for (ui32 k = width * channels; k > 0; --k) {
+            const uc8 tmp = data[i1];
+            data[i1] = data[i2];
+            data[i2] = tmp;
+            ++i1;
+            ++i2;
+        }
+    }
+}
+
+int main() {
+    if (!writeImages()) {
+        ::printf("Cannot write the test images.\n");
+        return 1;
+    }
+
+    std::vector<uc8> pixels(Width * Height * Channels, 1);
+    Clock::time_point start = Clock::now();
+    for (ui32 i = 0; i < NumImages; ++i) {
+        flipBytes(pixels.data(), Width, Height, Channels);
+    }
+    report("flip, byte loop", elapsedMs(start), NumImages);
+
+    start = Clock::now();
+    for (ui32 i = 0; i < NumImages; ++i) {
+        TextureDecoder::flipRows(pixels.data(), Width, Height, Channels);
+    }
+    report("flip, row copy", elapsedMs(start), NumImages);
+    keep(pixels[0]);
+
+    start = Clock::now();
+    for (ui32 i = 0; i < NumImages; ++i) {
+        Texture tex("bench");
+        TextureDecoder::decodeFile(getImagePath(i), &tex, true);
+    }
+    report("synchronous decode with mips", elapsedMs(start), NumImages);
+
+    // The main thread only enqueues and dispatches once per 16 ms frame
+    std::vector<Texture*> textures;
+    for (ui32 i = 0; i < NumImages; ++i) {
+        textures.push_back(new Texture("bench"));
+    }
+    TextureDecoder decoder;
+    decoder.start(2);
+    start = Clock::now();
+    Clock::time_point blockStart = Clock::now();
+    for (ui32 i = 0; i < NumImages; ++i) {
+        decoder.decode(textures[i], getImagePath(i));
+    }
+    double blocked = elapsedMs(blockStart), worstFrame = 0.0;
+    size_t numDone = 0;
+    while (numDone < NumImages) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        cppcore::TArray<DecodedTexture> decoded;
+        blockStart = Clock::now();
+        numDone += decoder.dispatchCompleted(decoded);
+        const double frame = elapsedMs(blockStart);
+        blocked += frame;
+        if (frame > worstFrame) {
+            worstFrame = frame;
+        }
+
+        // Done by the render thread in the engine
+        for (const DecodedTexture &entry : decoded) {
+            TextureDecoder::apply(entry.mTarget, entry.mData);
+        }
+    }
+    report("asynchronous decode, all ready", elapsedMs(start), NumImages);
+    report("asynchronous decode, main thread", blocked, NumImages);
+    report("asynchronous decode, worst frame", worstFrame, 1);
+    decoder.stop();
+
+    for (ui32 i = 0; i < NumImages; ++i) {
+        delete textures[i];
+        ::remove(getImagePath(i).c_str());
+    }
+
+    return 0;
+}
@@ -24,6 +24,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "App/AssetBundle.h"
 #include "IO/Uri.h"
 
+#include <cstdio>
+
 namespace OSRE {
 namespace UnitTest {
 
@@ -51,5 +53,30 @@ TEST_F(AssetBundleTest, add_remove_Test) {
     EXPECT_EQ(0u, bundle.getNumAssets());
 }
 
+TEST_F(AssetBundleTest, packTest) {
+    static constexpr c8 AssetName[] = "asset_bundle_test.txt";
+    FILE *file = ::fopen(AssetName, "wb");
+    ASSERT_NE(nullptr, file);
+    ::fputs("asset bundle test", file);
+    ::fclose(file);
+
+    AssetBundle invalidBundle("test.zip");
+    EXPECT_FALSE(invalidBundle.isValid());
+    EXPECT_FALSE(invalidBundle.pack(true));
+
+    AssetBundle bundle("asset_bundle_test.osar");
+    EXPECT_TRUE(bundle.isValid());
+    bundle.add(AssetName);
+    EXPECT_TRUE(bundle.pack(true));
+
+    IO::AssetArchive archive;
+    ASSERT_TRUE(archive.open(bundle.getName()));
+    EXPECT_NE(nullptr, archive.find(AssetName));
+    archive.close();
+
+    ::remove(AssetName);
+    ::remove(bundle.getName().c_str());
+}
+
 } // namespace App
 } // namespace OSRE
@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+
+#include "App/ResourceLoadQueue.h"
+#include "Common/TResource.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::App;
+using namespace ::OSRE::Common;
+
+class ResourceLoadQueueTest : public ::testing::Test {};
+
+struct TestLoader {
+    bool mFail = false;
+};
+
+class TestResource : public TResource<ui32, TestLoader> {
+public:
+    TestResource() :
+            TResource("test", IO::Uri()) {
+        // empty
+    }
+
+protected:
+    ResourceState onLoad(const IO::Uri &, TestLoader &loader) override {
+        setState(loader.mFail ? ResourceState::Error : ResourceState::Loaded);
+        return getState();
+    }
+
+    ResourceState onUnload(TestLoader &) override {
+        setState(ResourceState::Unloaded);
+        return getState();
+    }
+};
+
+TEST_F(ResourceLoadQueueTest, beginLoadTest) {
+    TestResource res;
+    EXPECT_EQ(ResourceState::Uninitialized, res.getState());
+    EXPECT_TRUE(res.beginLoad());
+    EXPECT_EQ(ResourceState::Loading, res.getState());
+    EXPECT_FALSE(res.beginLoad());
+
+    TestLoader loader;
+    EXPECT_EQ(ResourceState::Loaded, res.load(loader));
+    EXPECT_FALSE(res.beginLoad());
+
+    res.unload(loader);
+    EXPECT_TRUE(res.beginLoad());
+}
+
+TEST_F(ResourceLoadQueueTest, synchronousTest) {
+    ResourceLoadQueue queue;
+    std::vector<i32> order;
+    const LoadJobId first = queue.enqueue([&order]() { order.push_back(1); return true; },
+        [&order](bool success) { EXPECT_TRUE(success); order.push_back(-1); });
+    const LoadJobId second = queue.enqueue([&order]() { order.push_back(2); return false; },
+        [&order](bool success) { EXPECT_FALSE(success); order.push_back(-2); });
+    EXPECT_NE(0u, first);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2u, queue.getNumPending());
+
+    queue.waitIdle();
+    EXPECT_EQ(0u, queue.getNumPending());
+    ASSERT_EQ(2u, order.size());
+
+    // The callbacks are only called by dispatchCompleted
+    EXPECT_EQ(2u, queue.dispatchCompleted());
+    const std::vector<i32> expected = { 1, 2, -1, -2 };
+    EXPECT_EQ(expected, order);
+    EXPECT_EQ(0u, queue.dispatchCompleted());
+}
+
+TEST_F(ResourceLoadQueueTest, dependencyTest) {
+    ResourceLoadQueue queue;
+    ASSERT_TRUE(queue.start(4));
+
+    // The barrier waits for all textures, the material waits for the barrier
+    static constexpr ui32 NumTextures = 16;
+    std::atomic<ui32> numLoaded{ 0 };
+    std::atomic<bool> orderOk{ true };
+    LoadJobArray textures;
+    for (ui32 i = 0; i < NumTextures; ++i) {
+        textures.add(queue.enqueue([&numLoaded]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++numLoaded;
+            return true;
+        }));
+    }
+    LoadJobArray barrier;
+    barrier.add(queue.enqueue(LoadWorkFunc(), LoadCompletedFunc(), textures));
+    bool materialDone = false;
+    queue.enqueue([&numLoaded, &orderOk]() {
+        if (numLoaded != NumTextures) {
+            orderOk = false;
+        }
+        return true;
+    }, [&materialDone](bool success) { materialDone = success; }, barrier);
+
+    queue.waitIdle();
+    EXPECT_TRUE(orderOk);
+    EXPECT_EQ(NumTextures, numLoaded.load());
+    EXPECT_FALSE(materialDone);
+    EXPECT_EQ(NumTextures + 2, queue.dispatchCompleted());
+    EXPECT_TRUE(materialDone);
+    queue.stop();
+    EXPECT_FALSE(queue.isRunning());
+}
+
+TEST_F(ResourceLoadQueueTest, failedDependencyTest) {
+    ResourceLoadQueue queue;
+    TestResource res;
+    TestLoader loader;
+    loader.mFail = true;
+    ASSERT_TRUE(res.beginLoad());
+    LoadJobArray deps;
+    deps.add(queue.enqueue([&res, loader]() mutable { return res.load(loader) == ResourceState::Loaded; }));
+
+    // A failed dependency still releases the waiting job
+    bool called = false;
+    queue.enqueue(LoadWorkFunc(), [&called](bool success) { called = success; }, deps);
+    queue.waitIdle();
+    EXPECT_EQ(ResourceState::Error, res.getState());
+    EXPECT_EQ(2u, queue.dispatchCompleted());
+    EXPECT_TRUE(called);
+
+    // Finished and unknown dependencies are satisfied
+    deps.add(12345);
+    called = false;
+    queue.enqueue(LoadWorkFunc(), [&called](bool success) { called = success; }, deps);
+    queue.waitIdle();
+    EXPECT_EQ(1u, queue.dispatchCompleted());
+    EXPECT_TRUE(called);
+}
+
+TEST_F(ResourceLoadQueueTest, enqueueFromCallbackTest) {
+    ResourceLoadQueue queue;
+    ASSERT_TRUE(queue.start(2));
+    bool second = false;
+    queue.enqueue([]() { return true; }, [&queue, &second](bool) {
+        queue.enqueue([]() { return true; }, [&second](bool) { second = true; });
+    });
+    queue.waitIdle();
+    EXPECT_EQ(1u, queue.dispatchCompleted());
+    queue.waitIdle();
+    EXPECT_EQ(1u, queue.dispatchCompleted());
+    EXPECT_TRUE(second);
+}
+
+} // namespace OSRE::UnitTest
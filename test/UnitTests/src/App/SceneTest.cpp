@@ -0,0 +1,123 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+
+#include "App/Entity.h"
+#include "App/Scene.h"
+#include "Common/Ids.h"
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::App;
+using namespace ::OSRE::Common;
+
+class SceneTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F(SceneTest, addFindTest) {
+    Scene scene("scene_test");
+    Ids ids;
+    Entity *first = new Entity("scene_test_first", ids, &scene);
+    Entity *second = new Entity("scene_test_second", ids, nullptr);
+    const EntityHandle handle = scene.addEntity(second);
+    EXPECT_TRUE(handle.isValid());
+
+    // Adding an entity again returns its handle
+    EXPECT_EQ(handle.Index, scene.addEntity(second).Index);
+    EXPECT_EQ(2u, scene.getNumEntities());
+
+    EXPECT_EQ(first, scene.findEntity("scene_test_first"));
+    EXPECT_EQ(second, scene.getEntityByName("scene_test_second"));
+    EXPECT_EQ(second, scene.getEntity(handle));
+    EXPECT_EQ(handle.toGuid(), second->getGuid());
+    EXPECT_EQ(nullptr, scene.findEntity("scene_test_unknown"));
+
+    // The second entity has no owner, so it does not remove itself
+    EXPECT_TRUE(scene.removeEntity(second));
+    delete first;
+    delete second;
+    EXPECT_EQ(0u, scene.getNumEntities());
+}
+
+TEST_F(SceneTest, removeTest) {
+    Scene scene("scene_test");
+    Ids ids;
+    Entity *first = new Entity("scene_test_a", ids, &scene);
+    Entity *second = new Entity("scene_test_b", ids, &scene);
+    Entity *third = new Entity("scene_test_c", ids, &scene);
+    const EntityHandle firstHandle = scene.getEntityHandle(first);
+    const EntityHandle thirdHandle = scene.getEntityHandle(third);
+
+    EXPECT_TRUE(scene.removeEntity(firstHandle));
+    EXPECT_FALSE(scene.removeEntity(firstHandle));
+    EXPECT_FALSE(scene.removeEntity(first));
+    EXPECT_EQ(nullptr, scene.getEntity(firstHandle));
+    EXPECT_EQ(nullptr, scene.findEntity("scene_test_a"));
+    EXPECT_EQ(third, scene.getEntity(thirdHandle));
+    EXPECT_EQ(2u, scene.getNumEntities());
+
+    // The slot is reused with a new generation, the old handle stays invalid
+    const EntityHandle reused = scene.addEntity(first);
+    EXPECT_EQ(firstHandle.Index, reused.Index);
+    EXPECT_NE(firstHandle.Generation, reused.Generation);
+    EXPECT_EQ(nullptr, scene.getEntity(firstHandle));
+    EXPECT_EQ(first, scene.getEntity(reused));
+
+    delete first;
+    delete second;
+    delete third;
+    EXPECT_EQ(0u, scene.getNumEntities());
+}
+
+TEST_F(SceneTest, renameFindTest) {
+    Scene scene("scene_test");
+    Ids ids;
+    Entity *first = new Entity("scene_test_old", ids, &scene);
+    Entity *second = new Entity("scene_test_other", ids, &scene);
+
+    first->setName("scene_test_new");
+    EXPECT_EQ(nullptr, scene.findEntity("scene_test_old"));
+    EXPECT_EQ(first, scene.findEntity("scene_test_new"));
+    EXPECT_EQ(second, scene.findEntity("scene_test_other"));
+
+    // Both entities share a name now
+    second->setName("scene_test_new");
+    EXPECT_EQ(nullptr, scene.findEntity("scene_test_other"));
+    EXPECT_NE(nullptr, scene.findEntity("scene_test_new"));
+
+    EXPECT_TRUE(scene.removeEntity(first));
+    EXPECT_EQ(second, scene.findEntity("scene_test_new"));
+
+    // A removed entity is not indexed again when it is renamed
+    first->setName("scene_test_removed");
+    EXPECT_EQ(nullptr, scene.findEntity("scene_test_removed"));
+
+    delete first;
+    delete second;
+    EXPECT_EQ(0u, scene.getNumEntities());
+}
+
+} // namespace UnitTest
+} // namespace OSRE
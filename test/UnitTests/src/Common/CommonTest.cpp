@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include "osre_testcommon.h"
 #include "Common/osre_common.h"
+#include "Common/StringUtils.h"
 
 namespace OSRE {
 namespace UnitTest {
@@ -133,5 +134,22 @@ TEST_F(CommonTest, TResolutionTest) {
     EXPECT_EQ(res.getArea(), 20000);
 }
 
+TEST_F(CommonTest, FnvHashTest) {
+    using ::OSRE::Common::StringUtils;
+
+    EXPECT_EQ(StringUtils::Fnv32Offset, StringUtils::fnv1a32("", 0));
+    EXPECT_EQ(StringUtils::Fnv64Offset, StringUtils::fnv1a64("", 0));
+    EXPECT_EQ(0xe40c292cu, StringUtils::fnv1a32("a", 1));
+    EXPECT_EQ(0xaf63dc4c8601ec8cull, StringUtils::fnv1a64("a", 1));
+
+    // Hashing blocks in a row is the same as hashing them at once
+    const ui64 first = StringUtils::fnv1a64("foo", 3);
+    EXPECT_EQ(StringUtils::fnv1a64("foobar", 6), StringUtils::fnv1a64("bar", 3, first));
+
+    // Unlike hashName, FNV-1a is case-sensitive
+    EXPECT_EQ(StringUtils::hashName("Name"), StringUtils::hashName("name"));
+    EXPECT_NE(StringUtils::fnv1a64("Name", 4), StringUtils::fnv1a64("name", 4));
+}
+
 } // Namespace UnitTest
 } // Namespace OSRE
@@ -25,6 +25,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Common/Event.h"
 #include "Common/EventBus.h"
 
+#include <thread>
+#include <vector>
+
 namespace OSRE {
 namespace UnitTest {
 
@@ -98,5 +101,82 @@ TEST_F(EventBusTest, publishTest) {
     delete handler;
 }
 
+TEST_F(EventBusTest, typeIdTest) {
+    const Event sameEvent("TestEvent1");
+    EXPECT_EQ(TestEvent1.getTypeId(), sameEvent.getTypeId());
+    EXPECT_NE(TestEvent1.getTypeId(), TestEvent2.getTypeId());
+    EXPECT_LT(TestEvent2.getTypeId(), Event::getNumTypes());
+}
+
+TEST_F(EventBusTest, unsubscribeTest) {
+    EventBus bus;
+    bus.create();
+    TestEventHandler handler1, handler2;
+    bus.subscribeEventHandler(&handler1, TestEvent1);
+    bus.subscribeEventHandler(&handler2, TestEvent1);
+    bus.unsubscribeEventHandler(&handler1, TestEvent1);
+    bus.publish(TestEvent1, nullptr);
+    EXPECT_EQ(1u, bus.getNumQueuedEvents());
+    bus.update();
+    EXPECT_EQ(0u, bus.getNumQueuedEvents());
+    EXPECT_EQ(0u, handler1.EventCount1);
+    EXPECT_EQ(1u, handler2.EventCount1);
+    bus.destroy();
+}
+
+TEST_F(EventBusTest, eventDataLifetimeTest) {
+    EventBus bus;
+    bus.create();
+    TestEventHandler handler;
+    bus.subscribeEventHandler(&handler, TestEvent1);
+
+    // The publisher releases its reference before the update
+    EventData *data = new EventData(TestEvent1, nullptr);
+    bus.publish(TestEvent1, data);
+    data->release();
+    bus.update();
+    EXPECT_EQ(1u, handler.EventCount1);
+
+    data = new EventData(TestEvent1, nullptr);
+    bus.publish(TestEvent1, data);
+    data->release();
+    bus.destroy();
+}
+
+TEST_F(EventBusTest, publishFromThreadsTest) {
+    static constexpr ui32 NumThreads = 4;
+    static constexpr ui32 NumEvents = 1000;
+
+    EventBus bus;
+    bus.create();
+    TestEventHandler handler;
+    bus.subscribeEventHandler(&handler, TestEvent1);
+    bus.subscribeEventHandler(&handler, TestEvent2);
+
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([&bus]() {
+            for (ui32 j = 0; j < NumEvents; ++j) {
+                EventData *data = new EventData(TestEvent2, nullptr);
+                bus.publish(TestEvent2, data);
+                data->release();
+            }
+        });
+    }
+    for (ui32 i = 0; i < NumEvents; ++i) {
+        bus.publish(TestEvent1, nullptr);
+        if (i % 100 == 0) {
+            bus.update();
+        }
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    bus.update();
+    EXPECT_EQ(NumEvents, handler.EventCount1);
+    EXPECT_EQ(NumThreads * NumEvents, handler.EventCount2);
+    bus.destroy();
+}
+
 } // namespace UnitTest
 } // namespace OSRE
@@ -24,6 +24,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #include "Common/Logger.h"
 
+#include <thread>
+#include <vector>
+
 namespace OSRE::UnitTest {
 
 using namespace ::OSRE::Common;
@@ -49,5 +52,182 @@ TEST_F(LoggerTest, logStreamTest) {
     logStream.desactivate();
     EXPECT_FALSE(logStream.isActive());
 }
+
+TEST_F(LoggerTest, syncFormatTest) {
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    logger->warn("test", "message");
+    logger->info("", "no domain");
+    logger->debug("test", "not logged");
+    EXPECT_EQ("Warn: message(test) \n\nInfo: no domain \n\n", logStream->mText);
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+static String countCall(ui32 &numCalls) {
+    ++numCalls;
+    return "called";
+}
+
+TEST_F(LoggerTest, lazyEvaluationTest) {
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    logger->setVerboseMode(Logger::VerboseMode::Normal);
+    ui32 numCalls = 0;
+    osre_debug("test", countCall(numCalls));
+    osre_tracef("test", "%s", countCall(numCalls).c_str());
+    EXPECT_EQ(0u, numCalls);
+    EXPECT_FALSE(isLogEnabled(LogLevel::Debug));
+    EXPECT_TRUE(isLogEnabled(LogLevel::Warn));
+
+    // The runtime check does not depend on the compile-time level
+    logger->setVerboseMode(Logger::VerboseMode::Debug);
+    EXPECT_TRUE(isLogEnabled(LogLevel::Debug));
+    EXPECT_FALSE(isLogEnabled(LogLevel::Trace));
+    logger->setVerboseMode(Logger::VerboseMode::Normal);
+
+    osre_warn("test", countCall(numCalls));
+    EXPECT_EQ(1u, numCalls);
+    EXPECT_NE(String::npos, logStream->mText.find("Warn: called(test)"));
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+TEST_F(LoggerTest, formattedTest) {
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    const String domain = "test";
+    osre_warnf(domain, "Task %s has %d jobs.", "render", 3);
+    osre_errorf("test", "%s", String(1000, 'x').c_str());
+    EXPECT_NE(String::npos, logStream->mText.find("Warn: Task render has 3 jobs.(test)"));
+    EXPECT_NE(String::npos, logStream->mText.find("Err:  " + String(Logger::MaxMessageLength, 'x') + "...(test)"));
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+TEST_F(LoggerTest, asyncOrderTest) {
+    static constexpr ui32 NumThreads = 4;
+    static constexpr ui32 NumMessages = 500;
+
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    EXPECT_TRUE(logger->startAsync(NumThreads * NumMessages));
+    EXPECT_TRUE(logger->isAsync());
+    EXPECT_FALSE(logger->startAsync());
+
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([logger, i]() {
+            for (ui32 j = 0; j < NumMessages; ++j) {
+                logger->warn("t" + std::to_string(i), std::to_string(j));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger->flush();
+    EXPECT_EQ(0u, logger->getNumDroppedMessages());
+
+    // The messages of each thread are in order
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        const String domain = "(t" + std::to_string(i) + ")";
+        size_t pos = 0;
+        for (ui32 j = 0; j < NumMessages; ++j) {
+            pos = logStream->mText.find("Warn: " + std::to_string(j) + domain, pos);
+            ASSERT_NE(String::npos, pos);
+        }
+    }
+    logger->stopAsync();
+    EXPECT_FALSE(logger->isAsync());
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+TEST_F(LoggerTest, asyncDropTest) {
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    EXPECT_TRUE(logger->startAsync(4));
+    for (ui32 i = 0; i < 1000; ++i) {
+        logger->warn("test", "message");
+    }
+    logger->stopAsync();
+
+    const ui64 numDropped = logger->getNumDroppedMessages();
+    size_t numWritten = 0;
+    for (size_t pos = logStream->mText.find("Warn: message"); pos != String::npos; pos = logStream->mText.find("Warn: message", pos + 1)) {
+        ++numWritten;
+    }
+    EXPECT_EQ(1000u, numWritten + numDropped);
+    if (numDropped != 0) {
+        EXPECT_NE(String::npos, logStream->mText.find("log messages dropped."));
+    }
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+TEST_F(LoggerTest, asyncRestartTest) {
+    static constexpr ui32 NumThreads = 2;
+    static constexpr ui32 NumMessages = 1000;
+
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    EXPECT_TRUE(logger->startAsync(NumThreads * NumMessages));
+
+    // Stopping and restarting while other threads log must not lose a message
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([logger]() {
+            for (ui32 j = 0; j < NumMessages; ++j) {
+                logger->warn("test", "message");
+            }
+        });
+    }
+    for (ui32 i = 0; i < 50; ++i) {
+        logger->stopAsync();
+        EXPECT_TRUE(logger->startAsync((i % 2 + 1) * NumThreads * NumMessages));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger->stopAsync();
+
+    size_t numWritten = 0;
+    for (size_t pos = logStream->mText.find("Warn: message"); pos != String::npos; pos = logStream->mText.find("Warn: message", pos + 1)) {
+        ++numWritten;
+    }
+    EXPECT_EQ(NumThreads * NumMessages, numWritten);
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
+
+TEST_F(LoggerTest, asyncTruncationTest) {
+    TestLogStream *logStream = new TestLogStream;
+    Logger *logger = Logger::getInstance();
+    logger->registerLogStream(logStream);
+    EXPECT_TRUE(logger->startAsync());
+    logger->warn("test", String(1000, 'x'));
+    logger->flush();
+
+    const String expected = "Warn: " + String(Logger::MaxMessageLength, 'x') + "...(test)";
+    EXPECT_NE(String::npos, logStream->mText.find(expected));
+    EXPECT_EQ(String::npos, logStream->mText.find(String(Logger::MaxMessageLength + 1, 'x')));
+    logger->stopAsync();
+    logger->unregisterLogStream(logStream);
+    delete logStream;
+    Logger::kill();
+}
     
 } // namespace OSRE::UnitTest
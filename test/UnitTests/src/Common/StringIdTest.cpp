@@ -0,0 +1,130 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Common/StringId.h"
+
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::Common;
+
+class StringIdTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F(StringIdTest, internTest) {
+    const StringId id1("string_id_test_a");
+    const StringId id2(String("string_id_test_a"));
+    const StringId id3("string_id_test_b");
+    EXPECT_EQ(id1, id2);
+    EXPECT_NE(id1, id3);
+    EXPECT_EQ(id1.getHash(), id2.getHash());
+    EXPECT_EQ(StringId::hash("string_id_test_a", 16), id1.getHash());
+    EXPECT_EQ(String("string_id_test_a"), id1.getString());
+    EXPECT_STREQ("string_id_test_b", id3.c_str());
+}
+
+TEST_F(StringIdTest, emptyTest) {
+    const StringId empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(0u, empty.getIndex());
+    EXPECT_TRUE(empty.getString().empty());
+    EXPECT_EQ(empty, StringId(""));
+    EXPECT_EQ(empty, StringId(static_cast<const c8 *>(nullptr)));
+    EXPECT_EQ(empty.getHash(), StringId("").getHash());
+}
+
+TEST_F(StringIdTest, embeddedZeroTest) {
+    const String withZero("string_id_test\0zero", 19);
+    const StringId id1(withZero);
+    const StringId id2("string_id_test");
+    EXPECT_NE(id1, id2);
+    EXPECT_EQ(id1, StringId(withZero.data(), withZero.size()));
+    EXPECT_EQ(19u, id1.getString().size());
+    EXPECT_EQ(withZero, id1.getString());
+    EXPECT_EQ(StringId::hash(withZero.data(), withZero.size()), id1.getHash());
+    EXPECT_EQ(id1, StringId::find(withZero));
+}
+
+TEST_F(StringIdTest, growTest) {
+    // Spans several chunks of the string table
+    static constexpr i32 NumStrings = 10000;
+    std::vector<StringId> ids;
+    for (i32 i = 0; i < NumStrings; ++i) {
+        ids.push_back(StringId("string_id_grow_" + std::to_string(i)));
+        EXPECT_FALSE(ids.back().isEmpty());
+    }
+    for (i32 i = 0; i < NumStrings; ++i) {
+        EXPECT_EQ("string_id_grow_" + std::to_string(i), ids[i].getString());
+    }
+}
+
+TEST_F(StringIdTest, findTest) {
+    const size_t numStrings = StringId::getNumStrings();
+    EXPECT_TRUE(StringId::find("string_id_test_unknown").isEmpty());
+    EXPECT_EQ(numStrings, StringId::getNumStrings());
+
+    const StringId id("string_id_test_find");
+    EXPECT_EQ(id, StringId::find("string_id_test_find"));
+    EXPECT_EQ(id.getHash(), StringId::find("string_id_test_find").getHash());
+    EXPECT_EQ(numStrings + 1, StringId::getNumStrings());
+}
+
+TEST_F(StringIdTest, hashMapTest) {
+    std::unordered_map<StringId, i32, StringId::Hash> map;
+    map[StringId("string_id_test_x")] = 1;
+    map[StringId("string_id_test_y")] = 2;
+    EXPECT_EQ(1, map[StringId("string_id_test_x")]);
+    EXPECT_EQ(2, map[StringId("string_id_test_y")]);
+    EXPECT_EQ(2u, map.size());
+}
+
+TEST_F(StringIdTest, internFromThreadsTest) {
+    static constexpr i32 NumThreads = 4;
+    static constexpr i32 NumStrings = 2000;
+    std::vector<std::vector<StringId>> ids(NumThreads);
+    std::vector<std::thread> threads;
+    for (i32 t = 0; t < NumThreads; ++t) {
+        threads.emplace_back([t, &ids]() {
+            for (i32 i = 0; i < NumStrings; ++i) {
+                ids[t].push_back(StringId("string_id_thread_" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // All threads get the same ids, the strings stay readable
+    for (i32 i = 0; i < NumStrings; ++i) {
+        for (i32 t = 1; t < NumThreads; ++t) {
+            EXPECT_EQ(ids[0][i], ids[t][i]);
+        }
+        EXPECT_EQ("string_id_thread_" + std::to_string(i), ids[0][i].getString());
+    }
+}
+
+} // Namespace OSRE::UnitTest
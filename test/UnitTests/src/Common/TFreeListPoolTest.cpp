@@ -0,0 +1,95 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Common/TFreeListPool.h"
+
+#include <thread>
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::Common;
+
+class TFreeListPoolTest : public ::testing::Test {
+    // empty
+};
+
+struct PoolTestData {
+    ui64 mValue;
+    f32 mOther;
+};
+
+TEST_F(TFreeListPoolTest, allocReleaseTest) {
+    TFreeListPool<PoolTestData> pool(4);
+    EXPECT_EQ(0u, pool.getCapacity());
+
+    void *block1 = pool.alloc();
+    void *block2 = pool.alloc();
+    EXPECT_NE(block1, block2);
+    EXPECT_EQ(2u, pool.getNumUsed());
+    EXPECT_EQ(4u, pool.getCapacity());
+
+    // Released blocks are reused
+    pool.release(block1);
+    EXPECT_EQ(block1, pool.alloc());
+    pool.release(block1);
+    pool.release(block2);
+    pool.release(nullptr);
+    EXPECT_EQ(0u, pool.getNumUsed());
+}
+
+TEST_F(TFreeListPoolTest, growTest) {
+    TFreeListPool<PoolTestData> pool(4);
+    std::vector<PoolTestData*> objects;
+    for (ui32 i = 0; i < 10; ++i) {
+        void *block = pool.alloc();
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % alignof(PoolTestData));
+        objects.push_back(new (block) PoolTestData{ i, 0.0f });
+    }
+    EXPECT_EQ(12u, pool.getCapacity());
+    for (ui32 i = 0; i < 10; ++i) {
+        EXPECT_EQ(i, objects[i]->mValue);
+        pool.release(objects[i]);
+    }
+    EXPECT_EQ(0u, pool.getNumUsed());
+    EXPECT_EQ(12u, pool.getCapacity());
+}
+
+TEST_F(TFreeListPoolTest, threadTest) {
+    TFreeListPool<PoolTestData> pool;
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < 4; ++i) {
+        threads.emplace_back([&pool]() {
+            for (ui32 j = 0; j < 1000; ++j) {
+                void *block = pool.alloc();
+                pool.release(block);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0u, pool.getNumUsed());
+}
+
+} // namespace OSRE::UnitTest
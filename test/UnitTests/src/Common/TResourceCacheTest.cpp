@@ -0,0 +1,140 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Common/TResourceCache.h"
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::Common;
+
+class TResourceCacheTest : public ::testing::Test {
+protected:
+    struct TestResource {
+        static i32 sNumAlive;
+
+        TestResource(const String &, const IO::Uri &) {
+            ++sNumAlive;
+        }
+
+        ~TestResource() {
+            --sNumAlive;
+        }
+    };
+
+    using TestCache = TResourceCache<TResourceFactory<TestResource>, TestResource>;
+
+    void SetUp() override {
+        TestResource::sNumAlive = 0;
+    }
+};
+
+i32 TResourceCacheTest::TestResource::sNumAlive = 0;
+
+TEST_F(TResourceCacheTest, createFindTest) {
+    TestCache cache;
+    TestResource *res = cache.create("a");
+    ASSERT_NE(nullptr, res);
+    EXPECT_EQ(res, cache.create("a"));
+    EXPECT_EQ(1, TestResource::sNumAlive);
+
+    EXPECT_EQ(res, cache.find("a"));
+    EXPECT_EQ(res, cache.find(StringId("a")));
+    EXPECT_EQ(nullptr, cache.find("b"));
+    EXPECT_EQ(nullptr, cache.create(""));
+
+    const ResourceCacheStatistics &stats = cache.getStatistics();
+    EXPECT_EQ(2u, stats.Hits);
+    EXPECT_EQ(1u, stats.Misses);
+    EXPECT_EQ(1u, stats.NumResources);
+
+    cache.resetStatistics();
+    EXPECT_EQ(0u, stats.Hits);
+
+    cache.set("a", new TestResource("a2", IO::Uri()));
+    EXPECT_EQ(1, TestResource::sNumAlive);
+    cache.clear();
+    EXPECT_EQ(0, TestResource::sNumAlive);
+    EXPECT_EQ(0u, stats.NumResources);
+}
+
+TEST_F(TResourceCacheTest, refCountTest) {
+    TestCache cache;
+    TestResource *res = cache.create("a");
+    ResourceHandle handle = cache.acquire("a");
+    ASSERT_TRUE(handle.isValid());
+    EXPECT_EQ(res, cache.get(handle));
+    EXPECT_EQ(1u, cache.getRefCount("a"));
+
+    ResourceHandle second = cache.acquire("a");
+    EXPECT_EQ(2u, cache.getRefCount("a"));
+    EXPECT_FALSE(cache.acquire("b").isValid());
+
+    // Referenced resources survive evictUnused
+    EXPECT_EQ(0u, cache.evictUnused());
+    cache.release(handle);
+    EXPECT_FALSE(handle.isValid());
+    cache.release(second);
+    EXPECT_EQ(0u, cache.getRefCount("a"));
+    EXPECT_EQ(1u, cache.evictUnused());
+    EXPECT_EQ(0, TestResource::sNumAlive);
+    EXPECT_EQ(nullptr, cache.get(second));
+}
+
+TEST_F(TResourceCacheTest, budgetTest) {
+    TestCache cache(100);
+    cache.create("a");
+    cache.setSize("a", 40);
+    cache.create("b");
+    cache.setSize("b", 40);
+    ResourceHandle handleA = cache.acquire("a");
+
+    // "b" is the least recently used, but "a" is referenced and "c" is the newest
+    cache.create("c");
+    cache.setSize("c", 40);
+    EXPECT_EQ(nullptr, cache.find("b"));
+    EXPECT_NE(nullptr, cache.find("a"));
+    EXPECT_NE(nullptr, cache.find("c"));
+    EXPECT_EQ(80u, cache.getStatistics().Memory);
+    EXPECT_EQ(1u, cache.getStatistics().Evictions);
+
+    // Over budget while everything is referenced, the release evicts
+    ResourceHandle handleC = cache.acquire("c");
+    cache.create("d");
+    cache.setSize("d", 40);
+    EXPECT_EQ(120u, cache.getStatistics().Memory);
+    cache.find("d");
+    cache.release(handleA);
+    EXPECT_EQ(nullptr, cache.find("a"));
+    EXPECT_EQ(80u, cache.getStatistics().Memory);
+
+    // Lowering the budget evicts everything but the referenced and the newest entries
+    cache.setBudget(10);
+    EXPECT_EQ(2, TestResource::sNumAlive);
+    cache.release(handleC);
+    EXPECT_EQ(1, TestResource::sNumAlive);
+    EXPECT_NE(nullptr, cache.find("d"));
+}
+
+} // namespace UnitTest
+} // namespace OSRE
@@ -0,0 +1,163 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+
+#include "IO/ArchiveFileSystem.h"
+#include "IO/AssetArchive.h"
+#include "IO/FileStream.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::IO;
+
+class AssetArchiveTest : public ::testing::Test {
+protected:
+    static constexpr c8 ArchiveName[] = "asset_archive_test.osar";
+    static constexpr c8 TextName[] = "asset_archive_test.txt";
+    static constexpr c8 NoiseName[] = "asset_archive_test.bin";
+
+    void SetUp() override {
+        for (ui32 i = 0; i < 200; ++i) {
+            mText += "vertex " + std::to_string(i % 10) + "\n";
+        }
+        ui32 state = 42;
+        mNoise.resize(1000);
+        for (uc8 &value : mNoise) {
+            state = state * 1664525u + 1013904223u;
+            value = static_cast<uc8>(state >> 24);
+        }
+        writeFile(TextName, mText.data(), mText.size());
+        writeFile(NoiseName, mNoise.data(), mNoise.size());
+
+        AssetArchiveSourceArray sources;
+        sources.add({ "models/mesh.txt", TextName });
+        sources.add({ "textures\\noise.bin", NoiseName });
+        ASSERT_TRUE(AssetArchive::create(ArchiveName, sources, true));
+    }
+
+    void TearDown() override {
+        ::remove(ArchiveName);
+        ::remove(TextName);
+        ::remove(NoiseName);
+    }
+
+    static void writeFile(const c8 *name, const void *data, size_t size) {
+        FileStream stream(Uri(String("file://") + name), Stream::AccessMode::WriteAccessBinary);
+        ASSERT_TRUE(stream.open());
+        stream.write(data, size);
+        stream.close();
+    }
+
+    String mText;
+    std::vector<uc8> mNoise;
+};
+
+TEST_F(AssetArchiveTest, openTest) {
+    AssetArchive archive;
+    ASSERT_TRUE(archive.open(ArchiveName));
+    EXPECT_EQ(2u, archive.getNumEntries());
+    EXPECT_EQ(nullptr, archive.find("models/unknown.txt"));
+
+    // The text compresses well, the noise will be stored
+    const AssetArchiveEntry *text = archive.find("./models/mesh.txt");
+    ASSERT_NE(nullptr, text);
+    EXPECT_EQ(ArchiveCodec::Lz4, text->mCodec);
+    EXPECT_EQ(mText.size(), text->mSize);
+    EXPECT_LT(text->mStoredSize, text->mSize);
+    EXPECT_EQ(nullptr, archive.getView(*text));
+    std::vector<uc8> data(static_cast<size_t>(text->mSize));
+    ASSERT_TRUE(archive.extract(*text, data.data()));
+    EXPECT_EQ(mText, String(data.begin(), data.end()));
+
+    const AssetArchiveEntry *noise = archive.find("textures/noise.bin");
+    ASSERT_NE(nullptr, noise);
+    EXPECT_EQ(ArchiveCodec::Stored, noise->mCodec);
+    EXPECT_EQ(0u, noise->mOffset % AssetArchive::DefaultAlignment);
+    const uc8 *view = archive.getView(*noise);
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(mNoise, std::vector<uc8>(view, view + noise->mSize));
+}
+
+TEST_F(AssetArchiveTest, fileSystemTest) {
+    ArchiveFileSystem fs;
+    EXPECT_FALSE(fs.addArchive("not_existing.osar"));
+    ASSERT_TRUE(fs.addArchive(ArchiveName));
+    EXPECT_EQ(1u, fs.getNumArchives());
+
+    EXPECT_TRUE(fs.fileExist(Uri("file://models/mesh.txt")));
+    EXPECT_TRUE(fs.fileExist(Uri("archive://textures/noise.bin")));
+    EXPECT_FALSE(fs.fileExist(Uri("archive://textures/other.bin")));
+    EXPECT_EQ(nullptr, fs.open(Uri("archive://models/mesh.txt"), Stream::AccessMode::WriteAccessBinary));
+
+    Stream *stream = fs.open(Uri("archive://models/mesh.txt"), Stream::AccessMode::ReadAccessBinary);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(Uri::ArchiveScheme, stream->getUri().getScheme());
+    EXPECT_EQ(mText.size(), stream->getSize());
+    String text(static_cast<size_t>(stream->getSize()), ' ');
+    EXPECT_EQ(text.size(), stream->read(&text[0], text.size()));
+    EXPECT_EQ(mText, text);
+    fs.close(&stream);
+    EXPECT_EQ(nullptr, stream);
+}
+
+TEST_F(AssetArchiveTest, fileSystemOverrideTest) {
+    static constexpr c8 PatchName[] = "asset_archive_test_patch.osar";
+    static constexpr c8 PatchTextName[] = "asset_archive_test_patch.txt";
+    const String patchText = "patched";
+    writeFile(PatchTextName, patchText.data(), patchText.size());
+    AssetArchiveSourceArray sources;
+    sources.add({ "models/mesh.txt", PatchTextName });
+    sources.add({ "models/extra.txt", PatchTextName });
+    ASSERT_TRUE(AssetArchive::create(PatchName, sources, true));
+
+    ArchiveFileSystem fs;
+    ASSERT_TRUE(fs.addArchive(ArchiveName));
+    ASSERT_TRUE(fs.addArchive(PatchName));
+    EXPECT_EQ(2u, fs.getNumArchives());
+
+    // The archive added last wins for both lookups
+    const Uri mesh("archive://models/mesh.txt");
+    EXPECT_TRUE(fs.fileExist(mesh));
+    Stream *stream = fs.open(mesh, Stream::AccessMode::ReadAccessBinary);
+    ASSERT_NE(nullptr, stream);
+    String text(static_cast<size_t>(stream->getSize()), ' ');
+    EXPECT_EQ(text.size(), stream->read(&text[0], text.size()));
+    EXPECT_EQ(patchText, text);
+    fs.close(&stream);
+
+    // Entries of the first archive stay visible
+    EXPECT_TRUE(fs.fileExist(Uri("archive://textures/noise.bin")));
+    EXPECT_TRUE(fs.fileExist(Uri("archive://models/extra.txt")));
+    stream = fs.open(Uri("archive://textures/noise.bin"), Stream::AccessMode::ReadAccessBinary);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(mNoise.size(), stream->getSize());
+    fs.close(&stream);
+
+    ::remove(PatchName);
+    ::remove(PatchTextName);
+}
+
+} // namespace OSRE::UnitTest
@@ -0,0 +1,148 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+
+#include "IO/AsyncReader.h"
+#include "IO/FileStream.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::IO;
+
+class AsyncReaderTest : public ::testing::Test {
+protected:
+    static constexpr c8 Filename[] = "async_reader_test.bin";
+    static constexpr ui32 NumValues = 4096;
+
+    void SetUp() override {
+        FileStream stream(getUri(), Stream::AccessMode::WriteAccessBinary);
+        ASSERT_TRUE(stream.open());
+        for (ui32 i = 0; i < NumValues; ++i) {
+            stream.writeUI32(i);
+        }
+        stream.close();
+    }
+
+    void TearDown() override {
+        ::remove(Filename);
+    }
+
+    static Uri getUri() {
+        return Uri(String("file://") + Filename);
+    }
+
+    static ui32 readValue(const AsyncReadResult &result, size_t index) {
+        ui32 value = 0;
+        ::memcpy(&value, result.mData + index * sizeof(ui32), sizeof(ui32));
+        return value;
+    }
+};
+
+TEST_F(AsyncReaderTest, coalesceTest) {
+    AsyncReader reader;
+    std::vector<ui32> firstValues;
+    auto callback = [&firstValues](const AsyncReadResult &result) {
+        EXPECT_TRUE(result.mSuccess);
+        EXPECT_EQ(16u, result.mSize);
+        firstValues.push_back(readValue(result, 0));
+    };
+
+    // Three adjacent ranges and one far away
+    EXPECT_TRUE(reader.read(getUri(), 0, 16, callback));
+    EXPECT_TRUE(reader.read(getUri(), 16, 16, callback));
+    EXPECT_TRUE(reader.read(getUri(), 32, 16, callback));
+    EXPECT_TRUE(reader.read(getUri(), 3 * AsyncReader::MaxCoalesceGap, 16, callback));
+    EXPECT_EQ(4u, reader.getNumPending());
+
+    reader.waitIdle();
+    EXPECT_EQ(0u, reader.getNumPending());
+    EXPECT_EQ(2u, reader.getNumFileReads());
+    EXPECT_TRUE(firstValues.empty());
+
+    EXPECT_EQ(4u, reader.dispatchCompleted());
+    ASSERT_EQ(4u, firstValues.size());
+    EXPECT_EQ(0u, firstValues[0]);
+    EXPECT_EQ(4u, firstValues[1]);
+    EXPECT_EQ(8u, firstValues[2]);
+    EXPECT_EQ(3 * AsyncReader::MaxCoalesceGap / sizeof(ui32), firstValues[3]);
+}
+
+TEST_F(AsyncReaderTest, priorityTest) {
+    AsyncReader reader;
+    std::vector<IOPriority> order;
+    const ui64 farOffset = 2 * AsyncReader::MaxCoalesceGap;
+    reader.read(getUri(), 0, 4, [&order](const AsyncReadResult &) { order.push_back(IOPriority::Low); }, IOPriority::Low);
+    reader.read(getUri(), farOffset, 4, [&order](const AsyncReadResult &) { order.push_back(IOPriority::High); }, IOPriority::High);
+    reader.waitIdle();
+    reader.dispatchCompleted();
+
+    ASSERT_EQ(2u, order.size());
+    EXPECT_EQ(IOPriority::High, order[0]);
+    EXPECT_EQ(IOPriority::Low, order[1]);
+}
+
+TEST_F(AsyncReaderTest, readToEndTest) {
+    AsyncReader reader;
+    size_t size = 0;
+    bool success = false;
+    reader.read(getUri(), 8, 0, [&](const AsyncReadResult &result) {
+        size = result.mSize;
+        success = result.mSuccess;
+    });
+    reader.read(getUri(), NumValues * sizeof(ui32) - 4, 8, [&](const AsyncReadResult &result) {
+        EXPECT_FALSE(result.mSuccess);
+        EXPECT_EQ(4u, result.mSize);
+    });
+    reader.waitIdle();
+    reader.dispatchCompleted();
+
+    EXPECT_TRUE(success);
+    EXPECT_EQ(NumValues * sizeof(ui32) - 8, size);
+}
+
+TEST_F(AsyncReaderTest, threadedReadTest) {
+    AsyncReader reader;
+    ASSERT_TRUE(reader.start(2));
+    EXPECT_TRUE(reader.isRunning());
+
+    ui32 numOk = 0;
+    for (ui32 i = 0; i < NumValues; i += 64) {
+        reader.read(getUri(), i * sizeof(ui32), sizeof(ui32), [&numOk, i](const AsyncReadResult &result) {
+            if (result.mSuccess && readValue(result, 0) == i) {
+                ++numOk;
+            }
+        });
+    }
+    reader.waitIdle();
+    reader.dispatchCompleted();
+    reader.stop();
+
+    EXPECT_EQ(NumValues / 64, numOk);
+    EXPECT_FALSE(reader.isRunning());
+}
+
+} // namespace OSRE::UnitTest
@@ -0,0 +1,86 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+
+#include "IO/Lz4Codec.h"
+
+#include <vector>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::IO;
+
+class Lz4CodecTest : public ::testing::Test {
+    // empty
+};
+
+static bool roundTrip(const std::vector<uc8> &src, size_t &compressedSize) {
+    std::vector<uc8> compressed(Lz4Codec::compressBound(src.size()));
+    compressedSize = Lz4Codec::compress(src.data(), src.size(), compressed.data(), compressed.size());
+    if (compressedSize == 0) {
+        return false;
+    }
+
+    std::vector<uc8> decompressed(src.size());
+    if (!Lz4Codec::decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size())) {
+        return false;
+    }
+
+    return decompressed == src;
+}
+
+TEST_F(Lz4CodecTest, roundTripTest) {
+    size_t compressedSize = 0;
+    std::vector<uc8> empty;
+    EXPECT_TRUE(roundTrip(empty, compressedSize));
+
+    std::vector<uc8> text;
+    const String pattern = "The quick brown fox jumps over the lazy dog. ";
+    for (ui32 i = 0; i < 1000; ++i) {
+        text.insert(text.end(), pattern.begin(), pattern.end());
+    }
+    EXPECT_TRUE(roundTrip(text, compressedSize));
+    EXPECT_LT(compressedSize, text.size() / 10);
+
+    std::vector<uc8> noise(64 * 1024);
+    ui32 state = 12345;
+    for (uc8 &value : noise) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<uc8>(state >> 24);
+    }
+    EXPECT_TRUE(roundTrip(noise, compressedSize));
+    EXPECT_LE(compressedSize, Lz4Codec::compressBound(noise.size()));
+}
+
+TEST_F(Lz4CodecTest, brokenBlockTest) {
+    std::vector<uc8> src(4096, 7);
+    std::vector<uc8> compressed(Lz4Codec::compressBound(src.size()));
+    const size_t compressedSize = Lz4Codec::compress(src.data(), src.size(), compressed.data(), compressed.size());
+    ASSERT_NE(0u, compressedSize);
+
+    std::vector<uc8> decompressed(src.size());
+    EXPECT_FALSE(Lz4Codec::decompress(compressed.data(), compressedSize - 1, decompressed.data(), decompressed.size()));
+    EXPECT_FALSE(Lz4Codec::decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size() - 1));
+}
+
+} // namespace OSRE::UnitTest
@@ -0,0 +1,119 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+
+#include "IO/FileStream.h"
+#include "IO/MappedFileStream.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::IO;
+
+class MappedFileStreamTest : public ::testing::Test {
+protected:
+    static constexpr c8 Filename[] = "mapped_file_stream_test.bin";
+    static constexpr ui32 NumValues = 1024;
+
+    void SetUp() override {
+        FileStream stream(Uri(String("file://") + Filename), Stream::AccessMode::WriteAccessBinary);
+        ASSERT_TRUE(stream.open());
+        for (ui32 i = 0; i < NumValues; ++i) {
+            stream.writeUI32(i);
+        }
+        stream.close();
+    }
+
+    void TearDown() override {
+        ::remove(Filename);
+    }
+};
+
+TEST_F(MappedFileStreamTest, readTest) {
+    MappedFileStream stream(Uri(String("file://") + Filename), Stream::AccessMode::MappedReadAccess);
+    EXPECT_TRUE(stream.canBeMapped());
+    EXPECT_FALSE(stream.canWrite());
+    ASSERT_TRUE(stream.open());
+    EXPECT_EQ(NumValues * sizeof(ui32), stream.getSize());
+
+    ui32 value = 0;
+    for (ui32 i = 0; i < NumValues; ++i) {
+        EXPECT_EQ(1u, stream.readUI32(value));
+        EXPECT_EQ(i, value);
+    }
+    EXPECT_EQ(0u, stream.readUI32(value));
+    EXPECT_TRUE(stream.close());
+    EXPECT_FALSE(stream.isOpen());
+}
+
+TEST_F(MappedFileStreamTest, seekTest) {
+    MappedFileStream stream(Uri(String("file://") + Filename), Stream::AccessMode::MappedReadAccess);
+    ASSERT_TRUE(stream.open());
+
+    const Stream::Position end = stream.getSize();
+    EXPECT_EQ(end - sizeof(ui32), stream.seek(-static_cast<Stream::Offset>(sizeof(ui32)), Stream::Origin::End));
+    ui32 value = 0;
+    stream.readUI32(value);
+    EXPECT_EQ(NumValues - 1, value);
+
+    EXPECT_EQ(40u, stream.seek(40, Stream::Origin::Begin));
+    EXPECT_EQ(36u, stream.seek(-4, Stream::Origin::Current));
+    stream.readUI32(value);
+    EXPECT_EQ(9u, value);
+
+    // Positions outside of the file will be clamped
+    EXPECT_EQ(end, stream.seek(16, Stream::Origin::End));
+    EXPECT_EQ(0u, stream.seek(-16, Stream::Origin::Begin));
+
+    // The file based stream must report the same positions
+    FileStream fileStream(Uri(String("file://") + Filename), Stream::AccessMode::ReadAccessBinary);
+    ASSERT_TRUE(fileStream.open());
+    EXPECT_EQ(end, fileStream.getSize());
+    EXPECT_EQ(end - sizeof(ui32), fileStream.seek(-static_cast<Stream::Offset>(sizeof(ui32)), Stream::Origin::End));
+    EXPECT_EQ(36u, fileStream.seek(36, Stream::Origin::Begin));
+}
+
+TEST_F(MappedFileStreamTest, mapTest) {
+    MappedFileStream stream(Uri(String("file://") + Filename), Stream::AccessMode::MappedReadAccess);
+    ASSERT_TRUE(stream.open());
+
+    const uc8 *view = stream.map(8 * sizeof(ui32), 4 * sizeof(ui32));
+    ASSERT_NE(nullptr, view);
+    ui32 values[4] = {};
+    ::memcpy(values, view, sizeof(values));
+    for (ui32 i = 0; i < 4; ++i) {
+        EXPECT_EQ(8 + i, values[i]);
+    }
+    EXPECT_EQ(stream.getData() + 8 * sizeof(ui32), view);
+
+    EXPECT_EQ(nullptr, stream.map(stream.getSize() - 2, 4));
+    EXPECT_EQ(nullptr, stream.map(stream.getSize() + 1, 0));
+
+    FileStream fileStream(Uri(String("file://") + Filename), Stream::AccessMode::ReadAccessBinary);
+    EXPECT_FALSE(fileStream.canBeMapped());
+    EXPECT_EQ(nullptr, fileStream.map(0, 4));
+}
+
+} // namespace OSRE::UnitTest
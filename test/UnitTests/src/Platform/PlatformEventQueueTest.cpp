@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Common/EventTriggerer.h"
+#include "Platform/AbstractPlatformEventQueue.h"
+#include "Platform/PlatformInterface.h"
+
+namespace OSRE::UnitTest {
+
+using namespace ::OSRE::Common;
+using namespace ::OSRE::Platform;
+
+class PlatformEventQueueTest : public ::testing::Test {
+    // empty
+};
+
+class TestPlatformEventQueue : public AbstractPlatformEventQueue {
+public:
+    EventTriggerer mTriggerer;
+
+    TestPlatformEventQueue() {
+        mTriggerer.addTriggerableEvent(MouseButtonDownEvent);
+        mTriggerer.addTriggerableEvent(MouseMoveEvent);
+    }
+
+    ~TestPlatformEventQueue() override = default;
+    void registerEventListener(const EventPtrArray &, OSEventListener *) override {}
+    void unregisterEventListener(const EventPtrArray &, OSEventListener *) override {}
+    void unregisterAllEventHandler(const EventPtrArray &) override {}
+    void registerMenuCommand(ui32, MenuFunctor) override {}
+    void unregisterAllMenuCommands() override {}
+    void enablePolling(bool) override {}
+    bool isPolling() const override { return true; }
+
+    bool update() override {
+        processEvents(&mTriggerer);
+        return true;
+    }
+
+    MouseMoveEventData *moveMouse(i32 x, i32 y) {
+        MouseMoveEventData *data = getMouseMoveEventData(&mTriggerer);
+        data->m_absX = x;
+        data->m_absY = y;
+        return data;
+    }
+
+    size_t getNumQueuedEvents() {
+        return getActiveEventDataList()->size();
+    }
+
+protected:
+    void onQuit() override {}
+};
+
+TEST_F(PlatformEventQueueTest, coalesceMouseMoveTest) {
+    TestPlatformEventQueue queue;
+    MouseMoveEventData *first = queue.moveMouse(1, 2);
+    EXPECT_EQ(first, queue.moveMouse(3, 4));
+    EXPECT_EQ(3, first->m_absX);
+    EXPECT_EQ(4, first->m_absY);
+    EXPECT_EQ(1u, queue.getNumQueuedEvents());
+
+    // A button event in between keeps the order of the moves
+    queue.enqueueEvent(MouseButtonDownEvent, new MouseButtonEventData(true, &queue.mTriggerer));
+    EXPECT_NE(first, queue.moveMouse(5, 6));
+    EXPECT_EQ(3u, queue.getNumQueuedEvents());
+    queue.update();
+    EXPECT_EQ(0u, queue.getNumQueuedEvents());
+}
+
+TEST_F(PlatformEventQueueTest, pooledEventDataTest) {
+    EventData *data = new MouseMoveEventData(nullptr);
+    data->release();
+    EventData *reused = new MouseMoveEventData(nullptr);
+    EXPECT_EQ(data, reused);
+    reused->release();
+}
+
+} // namespace OSRE::UnitTest
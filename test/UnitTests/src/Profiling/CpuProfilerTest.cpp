@@ -0,0 +1,187 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Profiling/CpuProfiler.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::Profiling;
+
+class CpuProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CpuProfiler::clear();
+        CpuProfiler::setEnabled(true);
+    }
+
+    void TearDown() override {
+        CpuProfiler::setEnabled(false);
+        CpuProfiler::clear();
+    }
+
+    static size_t countEvents(const String &trace, const String &name) {
+        const String pattern = "{\"name\":\"" + name + "\",\"ph\":\"X\"";
+        size_t count = 0;
+        for (size_t pos = trace.find(pattern); pos != String::npos; pos = trace.find(pattern, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+};
+
+TEST_F(CpuProfilerTest, disabledRecordsNothingTest) {
+    CpuProfiler::setEnabled(false);
+    EXPECT_FALSE(CpuProfiler::isEnabled());
+    {
+        ProfileScope scope("disabled");
+    }
+    EXPECT_EQ(0u, countEvents(CpuProfiler::getChromeTrace(), "disabled"));
+}
+
+TEST_F(CpuProfilerTest, nestedScopesTest) {
+    {
+        ProfileScope outer("outer");
+        {
+            ProfileScope inner("inner");
+        }
+    }
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_EQ(1u, countEvents(trace, "outer"));
+    EXPECT_EQ(1u, countEvents(trace, "inner"));
+
+    // The inner scope is closed first.
+    EXPECT_LT(trace.find("\"inner\""), trace.find("\"outer\""));
+}
+
+TEST_F(CpuProfilerTest, threadNameTest) {
+    std::thread worker([]() {
+        CpuProfiler::setThreadName("profiler \"worker\"");
+        ProfileScope scope("work");
+    });
+    worker.join();
+
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_NE(String::npos, trace.find("\"thread_name\""));
+    EXPECT_NE(String::npos, trace.find("profiler \\\"worker\\\""));
+    EXPECT_EQ(1u, countEvents(trace, "work"));
+}
+
+TEST_F(CpuProfilerTest, threadNameWhileDisabledTest) {
+    // Naming a thread is cheap and the name must survive until profiling is enabled.
+    CpuProfiler::setEnabled(false);
+    std::thread worker([]() {
+        CpuProfiler::setThreadName("idle worker");
+        ProfileScope scope("idle");
+    });
+    worker.join();
+    CpuProfiler::setEnabled(true);
+
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_NE(String::npos, trace.find("idle worker"));
+    EXPECT_EQ(0u, countEvents(trace, "idle"));
+}
+
+TEST_F(CpuProfilerTest, multipleThreadsTest) {
+    static constexpr ui32 NumThreads = 4;
+    static constexpr ui32 NumScopes = 1000;
+    std::vector<std::thread> threads;
+    for (ui32 i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([]() {
+            for (ui32 j = 0; j < NumScopes; ++j) {
+                ProfileScope scope("threaded");
+            }
+        });
+    }
+
+    // Exporting while the threads record must be safe.
+    CpuProfiler::getChromeTrace();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(NumThreads * NumScopes, countEvents(CpuProfiler::getChromeTrace(), "threaded"));
+}
+
+TEST_F(CpuProfilerTest, wrapAroundTest) {
+    for (size_t i = 0; i < CpuProfiler::BufferSize; ++i) {
+        CpuProfiler::record("old", i, i + 1);
+    }
+    for (size_t i = 0; i < 10; ++i) {
+        CpuProfiler::record("new", i, i + 1);
+    }
+
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_EQ(CpuProfiler::BufferSize - 10, countEvents(trace, "old"));
+    EXPECT_EQ(10u, countEvents(trace, "new"));
+}
+
+TEST_F(CpuProfilerTest, clearTest) {
+    CpuProfiler::record("cleared", 0, 1);
+    CpuProfiler::clear();
+    CpuProfiler::record("kept", 2, 3);
+
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_EQ(0u, countEvents(trace, "cleared"));
+    EXPECT_EQ(1u, countEvents(trace, "kept"));
+}
+
+TEST_F(CpuProfilerTest, clearWhileRecordingTest) {
+    std::atomic<bool> running(true);
+    std::thread worker([&running]() {
+        while (running.load()) {
+            ProfileScope scope("racing");
+        }
+        ProfileScope scope("last");
+    });
+    for (ui32 i = 0; i < 100; ++i) {
+        CpuProfiler::clear();
+        std::this_thread::yield();
+    }
+    running.store(false);
+    worker.join();
+
+    // A clear made after the worker has finished drops everything, a record in flight cannot undo it
+    EXPECT_EQ(1u, countEvents(CpuProfiler::getChromeTrace(), "last"));
+    CpuProfiler::clear();
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_EQ(0u, countEvents(trace, "racing"));
+    EXPECT_EQ(0u, countEvents(trace, "last"));
+}
+
+TEST_F(CpuProfilerTest, chromeTraceFormatTest) {
+    CpuProfiler::record("format", 1500, 4000);
+
+    const String trace = CpuProfiler::getChromeTrace();
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(String::npos, trace.find("{\"name\":\"format\",\"ph\":\"X\",\"pid\":0,\"tid\":"));
+    EXPECT_NE(String::npos, trace.find("\"ts\":1.500,\"dur\":2.500}"));
+    EXPECT_NE(String::npos, trace.find("],\"displayTimeUnit\":\"ms\"}"));
+}
+
+} // Namespace UnitTest
+} // Namespace OSRE
@@ -0,0 +1,187 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "Profiling/FrameStatistics.h"
+
+#include <thread>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::Profiling;
+
+static constexpr ui64 OneMs = 1000000;
+
+class FrameStatisticsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        PerformanceCounterRegistry::create();
+        FrameStatistics::create(100);
+    }
+
+    void TearDown() override {
+        FrameStatistics::destroy();
+        PerformanceCounterRegistry::destroy();
+    }
+};
+
+TEST_F(FrameStatisticsTest, createTest) {
+    EXPECT_NE(nullptr, FrameStatistics::getInstance());
+    EXPECT_FALSE(FrameStatistics::create());
+    EXPECT_EQ(100u, FrameStatistics::getInstance()->getWindowSize());
+
+    const FrameStatistics::Summary summary = FrameStatistics::getInstance()->getSummary(FrameThread::Main);
+    EXPECT_EQ(0u, summary.mNumFrames);
+}
+
+TEST_F(FrameStatisticsTest, summaryTest) {
+    FrameStatistics *stats = FrameStatistics::getInstance();
+    for (ui64 i = 1; i <= 100; ++i) {
+        stats->addFrame(FrameThread::Render, i * OneMs / 10, 10 * OneMs);
+    }
+
+    const FrameStatistics::Summary summary = stats->getSummary(FrameThread::Render);
+    EXPECT_EQ(100u, summary.mNumFrames);
+    EXPECT_EQ(OneMs / 10, summary.mMin);
+    EXPECT_EQ(10 * OneMs, summary.mMax);
+    EXPECT_EQ(5050 * OneMs / 1000, summary.mAvg);
+    EXPECT_EQ(95 * OneMs / 10, summary.mP95);
+    EXPECT_EQ(99 * OneMs / 10, summary.mP99);
+    EXPECT_FLOAT_EQ(100.0f, summary.mFps);
+
+    // The main thread is collected separately
+    EXPECT_EQ(0u, stats->getSummary(FrameThread::Main).mNumFrames);
+}
+
+TEST_F(FrameStatisticsTest, rollingWindowTest) {
+    FrameStatistics *stats = FrameStatistics::getInstance();
+    stats->setWindowSize(4);
+    EXPECT_EQ(4u, stats->getWindowSize());
+    for (ui64 i = 1; i <= 10; ++i) {
+        stats->addFrame(FrameThread::Main, i * OneMs, 0);
+    }
+
+    const FrameStatistics::Summary summary = stats->getSummary(FrameThread::Main);
+    EXPECT_EQ(4u, summary.mNumFrames);
+    EXPECT_EQ(7 * OneMs, summary.mMin);
+    EXPECT_EQ(10 * OneMs, summary.mMax);
+    EXPECT_EQ(85 * OneMs / 10, summary.mAvg);
+    EXPECT_EQ(0.0f, summary.mFps);
+}
+
+TEST_F(FrameStatisticsTest, hitchTest) {
+    FrameStatistics *stats = FrameStatistics::getInstance();
+    ui32 numCalls = 0;
+    ui64 hitchTime = 0;
+    FrameThread hitchThread = FrameThread::Count;
+    stats->setHitchCallback([&](FrameThread thread, ui64 frameTime, ui64 averageFrameTime) {
+        ++numCalls;
+        hitchThread = thread;
+        hitchTime = frameTime;
+        EXPECT_EQ(10 * OneMs, averageFrameTime);
+    });
+
+    // No hitches before the window has enough frames
+    stats->addFrame(FrameThread::Main, 100 * OneMs, 0);
+    for (ui32 i = 0; i < 100; ++i) {
+        stats->addFrame(FrameThread::Main, 10 * OneMs, 0);
+    }
+    EXPECT_EQ(0u, numCalls);
+
+    stats->addFrame(FrameThread::Main, 15 * OneMs, 0);
+    EXPECT_EQ(0u, numCalls);
+    stats->setWindowSize(100);
+    for (ui32 i = 0; i < 100; ++i) {
+        stats->addFrame(FrameThread::Main, 10 * OneMs, 0);
+    }
+    stats->addFrame(FrameThread::Main, 50 * OneMs, 0);
+    EXPECT_EQ(1u, numCalls);
+    EXPECT_EQ(FrameThread::Main, hitchThread);
+    EXPECT_EQ(50 * OneMs, hitchTime);
+    EXPECT_EQ(1u, stats->getNumHitches(FrameThread::Main));
+
+    ui64 value = 0;
+    EXPECT_TRUE(PerformanceCounterRegistry::queryCounter(PerformanceCounterRegistry::getCounter("hitches"), value));
+    EXPECT_EQ(1u, value);
+
+    // Short frames are never hitches
+    stats->setHitchThreshold(2.0f, 100 * OneMs);
+    stats->addFrame(FrameThread::Main, 50 * OneMs, 0);
+    EXPECT_EQ(1u, numCalls);
+}
+
+TEST_F(FrameStatisticsTest, countersTest) {
+    FrameStatistics *stats = FrameStatistics::getInstance();
+    stats->addFrame(FrameThread::Main, 2 * OneMs, 0);
+    stats->addFrame(FrameThread::Render, 3 * OneMs, 20 * OneMs);
+
+    CounterSnapshotArray snapshot;
+    EXPECT_TRUE(PerformanceCounterRegistry::takeSnapshot(snapshot));
+    bool foundMain = false, foundRender = false, foundFps = false;
+    for (const CounterSnapshot &counter : snapshot) {
+        if (counter.mName == "frametime.main") {
+            foundMain = true;
+            EXPECT_EQ(1u, counter.mStats.mCount);
+            EXPECT_EQ(2 * OneMs, counter.mStats.mMax);
+        } else if (counter.mName == "frametime.render") {
+            foundRender = true;
+            EXPECT_EQ(3 * OneMs, counter.mStats.mMax);
+        } else if (counter.mName == "fps") {
+            foundFps = true;
+            EXPECT_EQ(50u, counter.mValue);
+        }
+    }
+    EXPECT_TRUE(foundMain);
+    EXPECT_TRUE(foundRender);
+    EXPECT_TRUE(foundFps);
+}
+
+TEST_F(FrameStatisticsTest, beginEndFrameTest) {
+    FrameStatistics *stats = FrameStatistics::getInstance();
+    std::thread render([stats]() {
+        for (ui32 i = 0; i < 3; ++i) {
+            stats->beginFrame(FrameThread::Render);
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            stats->endFrame(FrameThread::Render);
+        }
+    });
+    render.join();
+
+    // An end without a begin is ignored
+    stats->endFrame(FrameThread::Main);
+    EXPECT_EQ(0u, stats->getSummary(FrameThread::Main).mNumFrames);
+
+    const FrameStatistics::Summary summary = stats->getSummary(FrameThread::Render);
+    EXPECT_EQ(3u, summary.mNumFrames);
+    EXPECT_GE(summary.mMin, 2 * OneMs);
+    EXPECT_GT(summary.mFps, 0.0f);
+    EXPECT_LE(summary.mFps, 500.0f);
+
+    const String text = stats->getSummaryText();
+    EXPECT_NE(String::npos, text.find("main avg"));
+    EXPECT_NE(String::npos, text.find("render avg"));
+    EXPECT_NE(String::npos, text.find("fps"));
+}
+
+} // Namespace UnitTest
+} // Namespace OSRE
@@ -23,6 +23,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "osre_testcommon.h"
 #include "Profiling/PerformanceCounterRegistry.h"
 
+#include <thread>
+#include <vector>
+
 namespace OSRE {
 namespace UnitTest {
 
@@ -110,5 +113,137 @@ TEST_F( PerformanceCountersTest, resetCounterTest ) {
     EXPECT_TRUE( ok );
 }
 
+TEST_F( PerformanceCountersTest, counterHandleTest ) {
+    EXPECT_EQ( InvalidCounterHandle, PerformanceCounterRegistry::createCounter( TestKey, CounterKind::Gauge ) );
+    EXPECT_TRUE( PerformanceCounterRegistry::create() );
+
+    const CounterHandle gauge = PerformanceCounterRegistry::createCounter( TestKey, CounterKind::Gauge );
+    EXPECT_NE( InvalidCounterHandle, gauge );
+    EXPECT_EQ( gauge, PerformanceCounterRegistry::createCounter( TestKey, CounterKind::Gauge ) );
+    EXPECT_EQ( gauge, PerformanceCounterRegistry::getCounter( TestKey ) );
+    EXPECT_EQ( InvalidCounterHandle, PerformanceCounterRegistry::createCounter( TestKey, CounterKind::Monotonic ) );
+
+    const ui64 bigValue = 0x100000000ull;
+    EXPECT_TRUE( PerformanceCounterRegistry::setCounter( gauge, bigValue ) );
+    ui64 v = 0;
+    EXPECT_TRUE( PerformanceCounterRegistry::queryCounter( gauge, v ) );
+    EXPECT_EQ( bigValue, v );
+
+    const CounterHandle monotonic = PerformanceCounterRegistry::createCounter( "draw_calls", CounterKind::Monotonic );
+    EXPECT_FALSE( PerformanceCounterRegistry::setCounter( monotonic, 1 ) );
+    EXPECT_FALSE( PerformanceCounterRegistry::recordValue( monotonic, 1 ) );
+    EXPECT_TRUE( PerformanceCounterRegistry::addValueToCounter( monotonic, 3 ) );
+
+    // The handle is invalid while the counter is unregistered and reused after registering it again
+    EXPECT_TRUE( PerformanceCounterRegistry::unregisterCounter( TestKey ) );
+    EXPECT_FALSE( PerformanceCounterRegistry::setCounter( gauge, 1 ) );
+    EXPECT_EQ( InvalidCounterHandle, PerformanceCounterRegistry::getCounter( TestKey ) );
+    EXPECT_EQ( gauge, PerformanceCounterRegistry::createCounter( TestKey, CounterKind::Gauge ) );
+    EXPECT_TRUE( PerformanceCounterRegistry::queryCounter( gauge, v ) );
+    EXPECT_EQ( 0u, v );
+
+    EXPECT_TRUE( PerformanceCounterRegistry::destroy() );
+}
+
+TEST_F( PerformanceCountersTest, histogramTest ) {
+    LatencyHistogram histogram;
+    for ( ui64 i = 1; i <= 1000; ++i ) {
+        histogram.record( i * 1000 );
+    }
+
+    LatencyHistogram::Stats stats = histogram.getStats( false );
+    EXPECT_EQ( 1000u, stats.mCount );
+    EXPECT_EQ( 1000u, stats.mMin );
+    EXPECT_EQ( 1000000u, stats.mMax );
+    EXPECT_EQ( 500500u, stats.mMean );
+    EXPECT_NEAR( 500000.0, static_cast<double>( stats.mP50 ), 500000.0 * 0.032 );
+    EXPECT_NEAR( 900000.0, static_cast<double>( stats.mP90 ), 900000.0 * 0.032 );
+    EXPECT_NEAR( 990000.0, static_cast<double>( stats.mP99 ), 990000.0 * 0.032 );
+    EXPECT_GE( stats.mP99, 990000u );
+
+    stats = histogram.getStats( true );
+    EXPECT_EQ( 1000u, stats.mCount );
+    stats = histogram.getStats( true );
+    EXPECT_EQ( 0u, stats.mCount );
+}
+
+TEST_F( PerformanceCountersTest, histogramBucketTest ) {
+    EXPECT_EQ( 0u, LatencyHistogram::getBucketIndex( 0 ) );
+    EXPECT_EQ( 31u, LatencyHistogram::getBucketIndex( 31 ) );
+    EXPECT_EQ( 63u, LatencyHistogram::getBucketIndex( 63 ) );
+    EXPECT_EQ( LatencyHistogram::BucketCount - 1, LatencyHistogram::getBucketIndex( ~0ull ) );
+    EXPECT_EQ( ~0ull, LatencyHistogram::getBucketUpperBound( LatencyHistogram::BucketCount - 1 ) );
+
+    for ( ui64 value : { 1ull, 32ull, 100ull, 12345ull, 1ull << 40, ( 1ull << 40 ) + 12345 } ) {
+        const ui32 index = LatencyHistogram::getBucketIndex( value );
+        EXPECT_GE( LatencyHistogram::getBucketUpperBound( index ), value );
+        EXPECT_LT( LatencyHistogram::getBucketUpperBound( index - 1 ), value );
+    }
+}
+
+TEST_F( PerformanceCountersTest, snapshotTest ) {
+    EXPECT_TRUE( PerformanceCounterRegistry::create() );
+    const CounterHandle gauge = PerformanceCounterRegistry::createCounter( "gauge", CounterKind::Gauge );
+    const CounterHandle monotonic = PerformanceCounterRegistry::createCounter( "monotonic", CounterKind::Monotonic );
+    const CounterHandle latency = PerformanceCounterRegistry::createCounter( "latency", CounterKind::Histogram );
+
+    PerformanceCounterRegistry::setCounter( gauge, 7 );
+    PerformanceCounterRegistry::addValueToCounter( monotonic, 5 );
+    PerformanceCounterRegistry::recordValue( latency, 10 );
+    PerformanceCounterRegistry::recordValue( latency, 20 );
+
+    CounterSnapshotArray snapshot;
+    EXPECT_TRUE( PerformanceCounterRegistry::takeSnapshot( snapshot ) );
+    ASSERT_EQ( 3u, snapshot.size() );
+    EXPECT_EQ( "gauge", snapshot[0].mName );
+    EXPECT_EQ( 7u, snapshot[0].mValue );
+    EXPECT_EQ( 5u, snapshot[1].mDelta );
+    EXPECT_EQ( 2u, snapshot[2].mStats.mCount );
+    EXPECT_EQ( 20u, snapshot[2].mStats.mMax );
+
+    // The next frame reports the changes since the last snapshot only
+    PerformanceCounterRegistry::addValueToCounter( monotonic, 2 );
+    EXPECT_TRUE( PerformanceCounterRegistry::takeSnapshot( snapshot ) );
+    ASSERT_EQ( 3u, snapshot.size() );
+    EXPECT_EQ( 7u, snapshot[1].mValue );
+    EXPECT_EQ( 2u, snapshot[1].mDelta );
+    EXPECT_EQ( 2u, snapshot[2].mValue );
+    EXPECT_EQ( 0u, snapshot[2].mStats.mCount );
+
+    EXPECT_TRUE( PerformanceCounterRegistry::destroy() );
+}
+
+TEST_F( PerformanceCountersTest, concurrentUpdateTest ) {
+    EXPECT_TRUE( PerformanceCounterRegistry::create() );
+    const CounterHandle monotonic = PerformanceCounterRegistry::createCounter( "monotonic", CounterKind::Monotonic );
+    const CounterHandle latency = PerformanceCounterRegistry::createCounter( "latency", CounterKind::Histogram );
+
+    static constexpr ui32 NumThreads = 4;
+    static constexpr ui32 NumUpdates = 10000;
+    std::vector<std::thread> threads;
+    for ( ui32 i = 0; i < NumThreads; ++i ) {
+        threads.emplace_back( [monotonic, latency]() {
+            for ( ui32 j = 0; j < NumUpdates; ++j ) {
+                PerformanceCounterRegistry::addValueToCounter( monotonic, 1 );
+                PerformanceCounterRegistry::recordValue( latency, j );
+            }
+        } );
+    }
+    for ( std::thread &thread : threads ) {
+        thread.join();
+    }
+
+    ui64 v = 0;
+    EXPECT_TRUE( PerformanceCounterRegistry::queryCounter( monotonic, v ) );
+    EXPECT_EQ( NumThreads * NumUpdates, v );
+    CounterSnapshotArray snapshot;
+    EXPECT_TRUE( PerformanceCounterRegistry::takeSnapshot( snapshot ) );
+    ASSERT_EQ( 2u, snapshot.size() );
+    EXPECT_EQ( NumThreads * NumUpdates, snapshot[1].mStats.mCount );
+    EXPECT_EQ( NumUpdates - 1, snapshot[1].mStats.mMax );
+
+    EXPECT_TRUE( PerformanceCounterRegistry::destroy() );
+}
+
 } // Namespace UnitTest
 } // Namespace OSRE
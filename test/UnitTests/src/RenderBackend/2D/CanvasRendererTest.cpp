@@ -22,6 +22,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 -----------------------------------------------------------------------------------------------*/
 #include <gtest/gtest.h>
 #include "RenderBackend/2D/CanvasRenderer.h"
+#include "RenderBackend/2D/TextureAtlas.h"
 
 namespace OSRE {
 namespace UnitTest {
@@ -72,6 +73,16 @@ TEST_F(CanvasRendererTest, set_color_test) {
     EXPECT_EQ(Red, canvasRenderer.getColor());
 }
 
+TEST_F(CanvasRendererTest, texture_atlas_test) {
+    CanvasRenderer canvasRenderer(2, 0, 0, 1024, 768);
+
+    // The solid region for untextured shapes is always there
+    TextureAtlas *atlas = canvasRenderer.getTextureAtlas();
+    ASSERT_NE(nullptr, atlas);
+    EXPECT_EQ(1u, atlas->getNumRegions());
+    EXPECT_TRUE(atlas->isDirty());
+}
+
 
 } // Namespace UnitTest
 } // Namespace OSRE
@@ -0,0 +1,169 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/2D/TextureAtlas.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class TextureAtlasTest : public ::testing::Test {
+protected:
+    static void createImage(Texture &image, ui32 width, ui32 height, PixelFormatType format) {
+        const ui32 channels = format == PixelFormatType::R8G8B8A8 ? 4 : 3;
+        image.clear();
+        image.PixelFormat = format;
+        image.Width = width;
+        image.Height = height;
+        image.Channels = channels;
+        image.Size = width * height * channels;
+        image.Data = new uc8[image.Size];
+        for (ui32 i = 0; i < image.Size; ++i) {
+            image.Data[i] = static_cast<uc8>(i * 7 + 1);
+        }
+    }
+
+    static const uc8 *texel(Texture *tex, ui32 x, ui32 y) {
+        return tex->Data + (static_cast<size_t>(y) * tex->Width + x) * 4;
+    }
+};
+
+TEST_F(TextureAtlasTest, packerTest) {
+    // Deterministic sizes between 8 and 64 texels, placed tallest first
+    std::vector<std::pair<ui32, ui32>> sizes;
+    ui32 seed = 42;
+    for (ui32 i = 0; i < 200; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        const ui32 w = 8 + (seed >> 16) % 57;
+        seed = seed * 1103515245u + 12345u;
+        const ui32 h = 8 + (seed >> 16) % 57;
+        sizes.emplace_back(w, h);
+    }
+    std::sort(sizes.begin(), sizes.end(), [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+
+    static constexpr ui32 Size = 512;
+    SkylinePacker packer(Size, Size);
+    std::vector<uc8> used(Size * Size, 0);
+    ui32 numPlaced = 0;
+    for (const auto &size : sizes) {
+        ui32 x = 0, y = 0;
+        if (!packer.insert(size.first, size.second, x, y)) {
+            continue;
+        }
+        ++numPlaced;
+        ASSERT_LE(x + size.first, Size);
+        ASSERT_LE(y + size.second, Size);
+        for (ui32 j = y; j < y + size.second; ++j) {
+            for (ui32 i = x; i < x + size.first; ++i) {
+                ASSERT_EQ(0, used[j * Size + i]);
+                used[j * Size + i] = 1;
+            }
+        }
+    }
+    EXPECT_GT(numPlaced, 0u);
+    EXPECT_GT(packer.getEfficiency(), 0.8f);
+
+    ui32 x = 0, y = 0;
+    EXPECT_FALSE(packer.insert(Size + 1, 1, x, y));
+    EXPECT_FALSE(packer.insert(0, 1, x, y));
+
+    packer.reset();
+    EXPECT_EQ(0u, packer.getUsedHeight());
+    EXPECT_TRUE(packer.insert(Size, Size, x, y));
+    EXPECT_FALSE(packer.insert(1, 1, x, y));
+    EXPECT_FLOAT_EQ(1.0f, packer.getEfficiency());
+}
+
+TEST_F(TextureAtlasTest, addImageTest) {
+    TextureAtlas atlas("atlas", 64, 64, 1);
+    Texture *tex = atlas.getTexture();
+    EXPECT_EQ(PixelFormatType::R8G8B8A8, tex->PixelFormat);
+    EXPECT_TRUE(atlas.isDirty());
+    atlas.setClean();
+
+    Texture rgb("rgb");
+    createImage(rgb, 3, 2, PixelFormatType::R8G8B8);
+    const AtlasRegion *region = atlas.add("rgb", rgb);
+    ASSERT_NE(nullptr, region);
+    EXPECT_TRUE(atlas.isDirty());
+    EXPECT_EQ(1u, region->X);
+    EXPECT_EQ(1u, region->Y);
+    EXPECT_FLOAT_EQ(1.0f / 64.0f, region->UV0.x);
+    EXPECT_FLOAT_EQ(4.0f / 64.0f, region->UV1.x);
+    EXPECT_FLOAT_EQ(3.0f / 64.0f, region->UV1.y);
+    EXPECT_FLOAT_EQ(2.5f / 64.0f, region->map(glm::vec2(0.5f)).x);
+
+    // Texels are copied with an opaque alpha, the border repeats the edge texels
+    for (ui32 y = 0; y < 2; ++y) {
+        for (ui32 x = 0; x < 3; ++x) {
+            const uc8 *src = rgb.Data + (y * 3 + x) * 3;
+            const uc8 *dst = texel(tex, region->X + x, region->Y + y);
+            EXPECT_EQ(src[0], dst[0]);
+            EXPECT_EQ(src[2], dst[2]);
+            EXPECT_EQ(255, dst[3]);
+        }
+    }
+    EXPECT_EQ(0, ::memcmp(texel(tex, 0, 0), texel(tex, 1, 1), 4));
+    EXPECT_EQ(0, ::memcmp(texel(tex, 4, 3), texel(tex, 3, 2), 4));
+    EXPECT_EQ(0, ::memcmp(texel(tex, 0, 2), texel(tex, 1, 2), 4));
+
+    // The same name returns the existing region
+    EXPECT_EQ(region, atlas.add("rgb", rgb));
+    EXPECT_EQ(region, atlas.find("rgb"));
+    EXPECT_EQ(1u, atlas.getNumRegions());
+
+    Texture compressed("bc1");
+    createImage(compressed, 4, 4, PixelFormatType::R8G8B8);
+    compressed.PixelFormat = PixelFormatType::BC1;
+    EXPECT_EQ(nullptr, atlas.add("bc1", compressed));
+
+    Texture large("large");
+    createImage(large, 64, 8, PixelFormatType::R8G8B8A8);
+    EXPECT_EQ(nullptr, atlas.add("large", large));
+    EXPECT_EQ(nullptr, atlas.find("large"));
+}
+
+TEST_F(TextureAtlasTest, addSolidTest) {
+    TextureAtlas atlas("atlas", 32, 32, 2);
+    const AtlasRegion *region = atlas.addSolid("white", 4, 4, Color4(1, 0.5f, 0, 1));
+    ASSERT_NE(nullptr, region);
+    EXPECT_EQ(2u, region->X);
+    for (ui32 y = 0; y < 8; ++y) {
+        for (ui32 x = 0; x < 8; ++x) {
+            const uc8 *color = texel(atlas.getTexture(), x, y);
+            EXPECT_EQ(255, color[0]);
+            EXPECT_EQ(128, color[1]);
+            EXPECT_EQ(0, color[2]);
+            EXPECT_EQ(255, color[3]);
+        }
+    }
+    EXPECT_FLOAT_EQ(16.0f / (32.0f * 8.0f), atlas.getEfficiency());
+}
+
+} // namespace UnitTest
+} // namespace OSRE
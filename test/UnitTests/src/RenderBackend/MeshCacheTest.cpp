@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/MeshCache.h"
+#include "RenderBackend/Mesh.h"
+
+#include <cstdio>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class MeshCacheTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F(MeshCacheTest, writeAndLoadTest) {
+    const String cachePath = "mesh_cache_test.osmc";
+    const HashId sourceHash = 42;
+
+    Mesh *mesh = new Mesh("triangle", VertexType::RenderVertex, IndexType::UnsignedShort);
+    RenderVert vertices[3];
+    vertices[0].position = glm::vec3(-1, 0, 0);
+    vertices[1].position = glm::vec3(1, 0, 0);
+    vertices[2].position = glm::vec3(0, 1, 0);
+    mesh->createVertexBuffer(vertices, sizeof(vertices), BufferAccessType::ReadOnly);
+    ui16 indices[3] = { 0, 1, 2 };
+    mesh->createIndexBuffer(indices, sizeof(indices), IndexType::UnsignedShort, BufferAccessType::ReadOnly);
+    mesh->addPrimitiveGroup(3, PrimitiveType::TriangleList, 0);
+
+    MeshCacheEntryArray entries;
+    MeshCacheEntry entry;
+    entry.mMesh = mesh;
+    entry.mMaterialIndex = 0;
+    entry.mAabb.merge(-1, 0, 0);
+    entry.mAabb.merge(1, 1, 0);
+    entries.add(entry);
+
+    MeshCacheMaterialArray materials;
+    MeshCacheMaterial mat;
+    mat.Name = "mat";
+    mat.DiffuseTexture = "file://test.png";
+    materials.add(mat);
+
+    EXPECT_TRUE(MeshCache::write(cachePath, sourceHash, entries, materials));
+
+    MeshCacheEntryArray loadedEntries;
+    MeshCacheMaterialArray loadedMaterials;
+    EXPECT_FALSE(MeshCache::load(cachePath, sourceHash + 1, loadedEntries, loadedMaterials));
+    ASSERT_TRUE(MeshCache::load(cachePath, sourceHash, loadedEntries, loadedMaterials));
+    ASSERT_EQ(1u, loadedEntries.size());
+    ASSERT_EQ(1u, loadedMaterials.size());
+    EXPECT_EQ(mat.Name, loadedMaterials[0].Name);
+    EXPECT_EQ(mat.DiffuseTexture, loadedMaterials[0].DiffuseTexture);
+
+    Mesh *loaded = loadedEntries[0].mMesh;
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(mesh->getName(), loaded->getName());
+    EXPECT_EQ(0, loadedEntries[0].mMaterialIndex);
+    EXPECT_EQ(1u, loaded->getNumberOfPrimitiveGroups());
+    ASSERT_EQ(sizeof(vertices), loaded->getVertexBuffer()->getSize());
+    EXPECT_EQ(0, ::memcmp(vertices, loaded->getVertexBuffer()->getData(), sizeof(vertices)));
+    ASSERT_EQ(sizeof(indices), loaded->getIndexBuffer()->getSize());
+    EXPECT_EQ(0, ::memcmp(indices, loaded->getIndexBuffer()->getData(), sizeof(indices)));
+
+    delete loaded;
+    delete mesh;
+    ::remove(cachePath.c_str());
+}
+
+TEST_F(MeshCacheTest, sourceHashTest) {
+    const String sourcePath = "mesh_cache_source.obj";
+    FILE *file = ::fopen(sourcePath.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    ::fputs("v 0 0 0\n", file);
+    ::fclose(file);
+
+    EXPECT_EQ(0u, MeshCache::computeSourceHash("mesh_cache_missing.obj"));
+    const HashId hash = MeshCache::computeSourceHash(sourcePath, 1);
+    EXPECT_NE(0u, hash);
+    EXPECT_EQ(hash, MeshCache::computeSourceHash(sourcePath, 1));
+
+    // Different import options must not share a cache file
+    EXPECT_NE(hash, MeshCache::computeSourceHash(sourcePath, 2));
+    EXPECT_NE(hash, MeshCache::computeSourceHash(sourcePath));
+
+    ::remove(sourcePath.c_str());
+}
+
+} // namespace UnitTest
+} // namespace OSRE
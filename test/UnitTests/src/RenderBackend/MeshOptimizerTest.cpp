@@ -0,0 +1,260 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/Mesh/MeshOptimizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class MeshOptimizerTest : public ::testing::Test {
+protected:
+    static constexpr ui32 GridSize = 32;
+
+    // A regular grid with shuffled triangles, the worst case for the vertex cache
+    void createGrid(std::vector<glm::vec3> &positions, std::vector<ui32> &indices) {
+        for (ui32 y = 0; y <= GridSize; ++y) {
+            for (ui32 x = 0; x <= GridSize; ++x) {
+                positions.emplace_back(static_cast<f32>(x), static_cast<f32>(y), 0.0f);
+            }
+        }
+
+        std::vector<ui32> quads;
+        for (ui32 i = 0; i < GridSize * GridSize; ++i) {
+            quads.push_back(i);
+        }
+        std::mt19937 rng(42);
+        std::shuffle(quads.begin(), quads.end(), rng);
+        for (ui32 quad : quads) {
+            const ui32 x = quad % GridSize, y = quad / GridSize;
+            const ui32 i0 = y * (GridSize + 1) + x;
+            const ui32 i1 = i0 + 1, i2 = i0 + GridSize + 1, i3 = i2 + 1;
+            indices.insert(indices.end(), { i0, i1, i2, i1, i3, i2 });
+        }
+    }
+
+    // Parallel grids facing +z, emitted back to front, the worst case for the overdraw
+    static void createLayers(std::vector<glm::vec3> &positions, std::vector<ui32> &indices) {
+        static constexpr ui32 NumLayers = 4, LayerSize = 8;
+        for (ui32 layer = 0; layer < NumLayers; ++layer) {
+            const ui32 base = static_cast<ui32>(positions.size());
+            for (ui32 y = 0; y <= LayerSize; ++y) {
+                for (ui32 x = 0; x <= LayerSize; ++x) {
+                    positions.emplace_back(static_cast<f32>(x), static_cast<f32>(y), static_cast<f32>(layer));
+                }
+            }
+            for (ui32 y = 0; y < LayerSize; ++y) {
+                for (ui32 x = 0; x < LayerSize; ++x) {
+                    const ui32 i0 = base + y * (LayerSize + 1) + x;
+                    const ui32 i1 = i0 + 1, i2 = i0 + LayerSize + 1, i3 = i2 + 1;
+                    indices.insert(indices.end(), { i0, i1, i2, i1, i3, i2 });
+                }
+            }
+        }
+    }
+
+    static f32 edge(const glm::vec3 &a, const glm::vec3 &b, f32 x, f32 y) {
+        return (b.x - a.x) * (y - a.y) - (b.y - a.y) * (x - a.x);
+    }
+
+    // Rasterizes the triangles looking down the z-axis with back-face culling and a depth test,
+    // returns the number of shaded pixels per covered pixel.
+    static f32 computeOverdraw(const std::vector<glm::vec3> &positions, const std::vector<ui32> &indices) {
+        static constexpr i32 Resolution = 64;
+        static constexpr f32 PixelsPerUnit = 4.0f;
+        std::vector<f32> depth(Resolution * Resolution, -std::numeric_limits<f32>::max());
+        std::vector<bool> covered(Resolution * Resolution, false);
+        size_t numShaded = 0;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            const glm::vec3 p0 = positions[indices[i]] * glm::vec3(PixelsPerUnit, PixelsPerUnit, 1.0f);
+            const glm::vec3 p1 = positions[indices[i + 1]] * glm::vec3(PixelsPerUnit, PixelsPerUnit, 1.0f);
+            const glm::vec3 p2 = positions[indices[i + 2]] * glm::vec3(PixelsPerUnit, PixelsPerUnit, 1.0f);
+            const f32 area = edge(p0, p1, p2.x, p2.y);
+            if (area <= 0.0f) {
+                continue;
+            }
+
+            const i32 minX = std::max(0, static_cast<i32>(std::floor(std::min({ p0.x, p1.x, p2.x }))));
+            const i32 minY = std::max(0, static_cast<i32>(std::floor(std::min({ p0.y, p1.y, p2.y }))));
+            const i32 maxX = std::min(Resolution, static_cast<i32>(std::ceil(std::max({ p0.x, p1.x, p2.x }))));
+            const i32 maxY = std::min(Resolution, static_cast<i32>(std::ceil(std::max({ p0.y, p1.y, p2.y }))));
+            for (i32 y = minY; y < maxY; ++y) {
+                for (i32 x = minX; x < maxX; ++x) {
+                    const f32 cx = x + 0.5f, cy = y + 0.5f;
+                    const f32 w0 = edge(p1, p2, cx, cy), w1 = edge(p2, p0, cx, cy), w2 = edge(p0, p1, cx, cy);
+                    if (w0 < 0.0f || w1 < 0.0f || w2 < 0.0f) {
+                        continue;
+                    }
+                    const f32 z = (w0 * p0.z + w1 * p1.z + w2 * p2.z) / area;
+                    const size_t pixel = static_cast<size_t>(y * Resolution + x);
+                    covered[pixel] = true;
+                    if (z > depth[pixel]) {
+                        depth[pixel] = z;
+                        ++numShaded;
+                    }
+                }
+            }
+        }
+
+        const size_t numCovered = static_cast<size_t>(std::count(covered.begin(), covered.end(), true));
+        return numCovered != 0 ? static_cast<f32>(numShaded) / static_cast<f32>(numCovered) : 0.0f;
+    }
+
+    static std::vector<ui64> sortedTriangles(const std::vector<ui32> &indices) {
+        std::vector<ui32> keys;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            ui32 tri[3] = { indices[i], indices[i + 1], indices[i + 2] };
+            std::rotate(tri, std::min_element(tri, tri + 3), tri + 3);
+            keys.insert(keys.end(), tri, tri + 3);
+        }
+        std::vector<ui64> result;
+        for (size_t i = 0; i < keys.size(); i += 3) {
+            result.push_back((static_cast<ui64>(keys[i]) << 40) | (static_cast<ui64>(keys[i + 1]) << 20) | keys[i + 2]);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+TEST_F(MeshOptimizerTest, analyzeVertexCacheTest) {
+    const ui32 indices[] = { 0, 1, 2, 2, 1, 3 };
+    VertexCacheStatistics stats = MeshOptimizer::analyzeVertexCache(indices, 6, 4);
+    EXPECT_EQ(2u, stats.mNumTriangles);
+    EXPECT_EQ(4u, stats.mNumVertices);
+    EXPECT_EQ(4u, stats.mNumCacheMisses);
+    EXPECT_FLOAT_EQ(2.0f, stats.getACMR());
+    EXPECT_FLOAT_EQ(1.0f, stats.getATVR());
+}
+
+TEST_F(MeshOptimizerTest, optimizeVertexCacheTest) {
+    std::vector<glm::vec3> positions;
+    std::vector<ui32> indices;
+    createGrid(positions, indices);
+    const std::vector<ui64> triangles = sortedTriangles(indices);
+
+    const VertexCacheStatistics before = MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), positions.size());
+    EXPECT_TRUE(MeshOptimizer::optimizeVertexCache(indices.data(), indices.size(), positions.size()));
+    const VertexCacheStatistics after = MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), positions.size());
+
+    EXPECT_LT(after.getACMR(), before.getACMR());
+    EXPECT_LT(after.getACMR(), 1.0f);
+    EXPECT_EQ(triangles, sortedTriangles(indices));
+}
+
+TEST_F(MeshOptimizerTest, optimizeOverdrawTest) {
+    std::vector<glm::vec3> positions;
+    std::vector<ui32> indices;
+    createLayers(positions, indices);
+    const std::vector<ui64> triangles = sortedTriangles(indices);
+    const f32 before = computeOverdraw(positions, indices);
+    EXPECT_FLOAT_EQ(4.0f, before);
+
+    EXPECT_TRUE(MeshOptimizer::optimizeVertexCache(indices.data(), indices.size(), positions.size()));
+    const VertexCacheStatistics cacheBefore = MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), positions.size());
+    const uc8 *vertices = reinterpret_cast<const uc8 *>(positions.data());
+    EXPECT_TRUE(MeshOptimizer::optimizeOverdraw(indices.data(), indices.size(), vertices, positions.size(), sizeof(glm::vec3)));
+    const VertexCacheStatistics cacheAfter = MeshOptimizer::analyzeVertexCache(indices.data(), indices.size(), positions.size());
+
+    // The front layer is drawn first, every pixel is shaded once
+    const f32 after = computeOverdraw(positions, indices);
+    EXPECT_LT(after, before);
+    EXPECT_FLOAT_EQ(1.0f, after);
+    EXPECT_LE(cacheAfter.getACMR(), cacheBefore.getACMR() * 1.05f);
+    EXPECT_EQ(triangles, sortedTriangles(indices));
+}
+
+TEST_F(MeshOptimizerTest, optimizeVertexFetchTest) {
+    std::vector<glm::vec3> positions = { glm::vec3(0), glm::vec3(1), glm::vec3(2), glm::vec3(3) };
+    ui32 indices[] = { 3, 1, 2 };
+    uc8 *vertices = reinterpret_cast<uc8 *>(positions.data());
+    EXPECT_EQ(3u, MeshOptimizer::optimizeVertexFetch(vertices, positions.size(), sizeof(glm::vec3), indices, 3));
+    EXPECT_EQ(0u, indices[0]);
+    EXPECT_EQ(1u, indices[1]);
+    EXPECT_EQ(2u, indices[2]);
+    EXPECT_EQ(glm::vec3(3), positions[0]);
+    EXPECT_EQ(glm::vec3(1), positions[1]);
+    EXPECT_EQ(glm::vec3(2), positions[2]);
+    EXPECT_EQ(glm::vec3(0), positions[3]);
+}
+
+TEST_F(MeshOptimizerTest, selectIndexTypeTest) {
+    EXPECT_EQ(IndexType::UnsignedShort, MeshOptimizer::selectIndexType(100));
+    EXPECT_EQ(IndexType::UnsignedShort, MeshOptimizer::selectIndexType(65536));
+    EXPECT_EQ(IndexType::UnsignedInt, MeshOptimizer::selectIndexType(65537));
+}
+
+TEST_F(MeshOptimizerTest, weldVerticesTest) {
+    std::vector<glm::vec3> positions = { glm::vec3(0), glm::vec3(1), glm::vec3(0), glm::vec3(2), glm::vec3(1) };
+    ui32 indices[] = { 0, 1, 3, 2, 4, 3 };
+    uc8 *vertices = reinterpret_cast<uc8 *>(positions.data());
+    EXPECT_EQ(3u, MeshOptimizer::weldVertices(vertices, positions.size(), sizeof(glm::vec3), indices, 6));
+    EXPECT_EQ(glm::vec3(0), positions[0]);
+    EXPECT_EQ(glm::vec3(1), positions[1]);
+    EXPECT_EQ(glm::vec3(2), positions[2]);
+    const ui32 expected[] = { 0, 1, 2, 0, 1, 2 };
+    for (size_t i = 0; i < 6; ++i) {
+        EXPECT_EQ(expected[i], indices[i]);
+    }
+}
+
+TEST_F(MeshOptimizerTest, splitIndexRangesTest) {
+    std::vector<glm::vec3> positions;
+    std::vector<ui32> indices;
+    createGrid(positions, indices);
+
+    // Use small ranges, so the grid needs several of them
+    constexpr size_t MaxVertices = 100;
+    cppcore::TArray<ui32> vertexRemap;
+    cppcore::TArray<IndexRange> ranges;
+    std::vector<ui32> rangeIndices(indices.size());
+    EXPECT_TRUE(MeshOptimizer::splitIndexRanges(indices.data(), indices.size(), 3, MaxVertices, vertexRemap,
+            rangeIndices.data(), ranges));
+    EXPECT_GT(ranges.size(), 1u);
+
+    size_t numIndices = 0;
+    for (const IndexRange &range : ranges) {
+        EXPECT_EQ(numIndices, range.mStartIndex);
+        EXPECT_EQ(0u, range.mNumIndices % 3);
+        for (size_t i = range.mStartIndex; i < range.mStartIndex + range.mNumIndices; ++i) {
+            EXPECT_LT(rangeIndices[i], MaxVertices);
+            EXPECT_EQ(indices[i], vertexRemap[range.mBaseVertex + rangeIndices[i]]);
+        }
+        numIndices += range.mNumIndices;
+    }
+    EXPECT_EQ(indices.size(), numIndices);
+}
+
+TEST_F(MeshOptimizerTest, invalidIndicesTest) {
+    ui32 indices[] = { 0, 1, 5 };
+    EXPECT_FALSE(MeshOptimizer::optimizeVertexCache(indices, 3, 3));
+}
+
+} // namespace UnitTest
+} // namespace OSRE
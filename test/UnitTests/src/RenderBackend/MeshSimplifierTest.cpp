@@ -0,0 +1,164 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/Mesh/MeshSimplifier.h"
+#include "RenderBackend/Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class MeshSimplifierTest : public ::testing::Test {
+protected:
+    static constexpr ui32 GridSize = 32;
+
+    // A smooth height field in the unit square
+    void createTerrain(std::vector<ColorVert> &vertices, std::vector<ui32> &indices) {
+        for (ui32 y = 0; y <= GridSize; ++y) {
+            for (ui32 x = 0; x <= GridSize; ++x) {
+                ColorVert v;
+                v.position.x = static_cast<f32>(x) / GridSize;
+                v.position.y = static_cast<f32>(y) / GridSize;
+                v.position.z = getHeight(v.position.x, v.position.y);
+                vertices.push_back(v);
+            }
+        }
+        for (ui32 y = 0; y < GridSize; ++y) {
+            for (ui32 x = 0; x < GridSize; ++x) {
+                const ui32 i0 = y * (GridSize + 1) + x;
+                const ui32 i1 = i0 + 1, i2 = i0 + GridSize + 1, i3 = i2 + 1;
+                indices.insert(indices.end(), { i0, i1, i2, i1, i3, i2 });
+            }
+        }
+    }
+
+    static f32 getHeight(f32 x, f32 y) {
+        return 0.05f * std::sin(x * 6.0f) * std::cos(y * 5.0f);
+    }
+
+    // Returns the maximal vertical distance of the original vertices to the simplified surface
+    static f32 getMaxDeviation(const std::vector<ColorVert> &vertices, const ui32 *indices, size_t numIndices) {
+        f32 maxDeviation = 0.0f;
+        for (const ColorVert &v : vertices) {
+            const glm::vec3 &p = v.position;
+            for (size_t i = 0; i < numIndices; i += 3) {
+                const glm::vec3 &a = vertices[indices[i]].position;
+                const glm::vec3 &b = vertices[indices[i + 1]].position;
+                const glm::vec3 &c = vertices[indices[i + 2]].position;
+                const f32 det = (b.y - c.y) * (a.x - c.x) + (c.x - b.x) * (a.y - c.y);
+                if (std::fabs(det) < 1e-12f) {
+                    continue;
+                }
+                const f32 l0 = ((b.y - c.y) * (p.x - c.x) + (c.x - b.x) * (p.y - c.y)) / det;
+                const f32 l1 = ((c.y - a.y) * (p.x - c.x) + (a.x - c.x) * (p.y - c.y)) / det;
+                const f32 l2 = 1.0f - l0 - l1;
+                if (l0 >= -1e-5f && l1 >= -1e-5f && l2 >= -1e-5f) {
+                    const f32 z = l0 * a.z + l1 * b.z + l2 * c.z;
+                    maxDeviation = std::max(maxDeviation, std::fabs(z - p.z));
+                    break;
+                }
+            }
+        }
+
+        return maxDeviation;
+    }
+};
+
+TEST_F(MeshSimplifierTest, simplifyTest) {
+    std::vector<ColorVert> vertices;
+    std::vector<ui32> indices;
+    createTerrain(vertices, indices);
+
+    const f32 maxError = 0.01f;
+    const size_t target = indices.size() / 4;
+    std::vector<ui32> result(indices.size());
+    f32 error = 0.0f;
+    const size_t numResult = MeshSimplifier::simplify(indices.data(), indices.size(), reinterpret_cast<const uc8 *>(vertices.data()),
+            vertices.size(), sizeof(ColorVert), target, maxError, result.data(), &error);
+
+    EXPECT_EQ(0u, numResult % 3);
+    EXPECT_LE(numResult, target);
+    EXPECT_LE(error, maxError);
+    EXPECT_LE(getMaxDeviation(vertices, result.data(), numResult), maxError);
+}
+
+TEST_F(MeshSimplifierTest, errorBoundTest) {
+    std::vector<ColorVert> vertices;
+    std::vector<ui32> indices;
+    createTerrain(vertices, indices);
+
+    // A small error bound must stop the simplification before the target is reached
+    const f32 maxError = 0.0005f;
+    std::vector<ui32> result(indices.size());
+    f32 error = 0.0f;
+    const size_t numResult = MeshSimplifier::simplify(indices.data(), indices.size(), reinterpret_cast<const uc8 *>(vertices.data()),
+            vertices.size(), sizeof(ColorVert), 0, maxError, result.data(), &error);
+
+    EXPECT_GT(numResult, 0u);
+    EXPECT_LE(error, maxError);
+    EXPECT_LE(getMaxDeviation(vertices, result.data(), numResult), maxError);
+}
+
+TEST_F(MeshSimplifierTest, generateLodChainTest) {
+    std::vector<ColorVert> vertices;
+    std::vector<ui32> indices;
+    createTerrain(vertices, indices);
+
+    Mesh mesh("terrain", VertexType::ColorVertex, IndexType::UnsignedInt);
+    mesh.createVertexBuffer(vertices.data(), vertices.size() * sizeof(ColorVert), BufferAccessType::ReadOnly);
+    mesh.createIndexBuffer(indices.data(), indices.size() * sizeof(ui32), IndexType::UnsignedInt, BufferAccessType::ReadOnly);
+    mesh.addPrimitiveGroup(indices.size(), PrimitiveType::TriangleList, 0);
+
+    LodChainConfig config;
+    config.mNumLevels = 3;
+    config.mReduction = 0.5f;
+    config.mMaxError = 0.05f;
+    config.mScreenSize = 0.5f;
+    EXPECT_EQ(3u, MeshSimplifier::generateLodChain(&mesh, config));
+    ASSERT_EQ(4u, mesh.getNumberOfLods());
+
+    size_t budget = indices.size();
+    for (size_t i = 1; i < mesh.getNumberOfLods(); ++i) {
+        const MeshLod *lod = mesh.getLodAt(i);
+        ASSERT_NE(nullptr, lod);
+        ASSERT_EQ(1u, lod->mPrimGroups.size());
+        budget /= 2;
+        EXPECT_LE(lod->mPrimGroups[0]->m_numIndices, budget);
+        EXPECT_LE(lod->mError, config.mMaxError);
+        EXPECT_LE(lod->mPrimGroups[0]->m_startIndex + lod->mPrimGroups[0]->m_numIndices,
+                mesh.getIndexBuffer()->getSize() / sizeof(ui32));
+    }
+
+    EXPECT_EQ(0u, mesh.selectLod(1.0f));
+    EXPECT_EQ(1u, mesh.selectLod(0.4f));
+    EXPECT_EQ(2u, mesh.selectLod(0.2f));
+    EXPECT_EQ(3u, mesh.selectLod(0.01f));
+}
+
+} // namespace UnitTest
+} // namespace OSRE
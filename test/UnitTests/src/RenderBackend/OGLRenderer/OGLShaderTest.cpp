@@ -0,0 +1,92 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include <gtest/gtest.h>
+#include "RenderBackend/OGLRenderer/OGLShader.h"
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class OGLShaderTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F(OGLShaderTest, parameterSlotTest) {
+    EXPECT_EQ(NoneSlot, OGLShader::getParameterSlot(""));
+    EXPECT_EQ(NoneSlot, OGLShader::findParameterSlot("slot_test_unknown"));
+
+    // Slots are dense and stable, so they can index the location tables
+    const ui32 first = OGLShader::getParameterSlot("slot_test_a");
+    const ui32 second = OGLShader::getParameterSlot("slot_test_b");
+    EXPECT_NE(NoneSlot, first);
+    EXPECT_EQ(first + 1, second);
+    EXPECT_EQ(first, OGLShader::getParameterSlot("slot_test_a"));
+    EXPECT_EQ(second, OGLShader::findParameterSlot("slot_test_b"));
+}
+
+TEST_F(OGLShaderTest, unlinkedLocationTest) {
+    OGLShader shader("slot_test_shader");
+    const ui32 slot = OGLShader::getParameterSlot("slot_test_model");
+    EXPECT_EQ(InvalidLocationId, shader.getUniformLocation(slot));
+    EXPECT_EQ(InvalidLocationId, shader.getUniformLocation(NoneSlot));
+    EXPECT_EQ(InvalidLocationId, shader.getAttributeLocation("slot_test_position"));
+    EXPECT_FALSE(shader.hasUniform("slot_test_model"));
+
+    // A lookup of an unknown name must not create a slot
+    EXPECT_EQ(NoneSlot, OGLShader::findParameterSlot("slot_test_position"));
+}
+
+TEST_F(OGLShaderTest, reflectedLocationTest) {
+    OGLShader shader("reflect_test_shader");
+    shader.setUniformLocation("reflect_test_model", 3);
+    shader.setUniformLocation("reflect_test_bones[0]", 4);
+    shader.setUniformLocation("reflect_test_lights[0].pos", 10);
+    shader.setUniformLocation("reflect_test_lights[1].color", 11);
+    shader.setUniformLocation("reflect_test_block_member", InvalidLocationId);
+    shader.setAttributeLocation("reflect_test_position", 0);
+
+    EXPECT_EQ(3, shader.getUniformLocation("reflect_test_model"));
+    EXPECT_EQ(3, shader.getUniformLocation(OGLShader::findParameterSlot("reflect_test_model")));
+    EXPECT_TRUE(shader.hasUniform("reflect_test_model"));
+
+    // Arrays are used by their plain name
+    EXPECT_EQ(4, shader.getUniformLocation("reflect_test_bones"));
+    EXPECT_EQ(InvalidLocationId, shader.getUniformLocation("reflect_test_bones[0]"));
+
+    // Members of struct arrays keep their element index and do not collide
+    EXPECT_EQ(10, shader.getUniformLocation("reflect_test_lights[0].pos"));
+    EXPECT_EQ(11, shader.getUniformLocation("reflect_test_lights[1].color"));
+    EXPECT_EQ(InvalidLocationId, shader.getUniformLocation("reflect_test_lights"));
+
+    // Uniforms without a location do not get a slot
+    EXPECT_EQ(NoneSlot, OGLShader::findParameterSlot("reflect_test_block_member"));
+
+    // Attributes and uniforms are separate tables
+    EXPECT_EQ(0, shader.getAttributeLocation("reflect_test_position"));
+    EXPECT_EQ(InvalidLocationId, shader.getUniformLocation("reflect_test_position"));
+    EXPECT_EQ(InvalidLocationId, shader.getAttributeLocation("reflect_test_model"));
+}
+
+} // Namespace UnitTest
+} // Namespace OSRE
@@ -0,0 +1,192 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/ShaderBinaryCache.h"
+#include "RenderBackend/Shader.h"
+
+#include <cstdio>
+#include <map>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+/// Stores the "linked" program binaries in memory, a binary is the concatenated source.
+class FakeShaderBinaryDriver : public ShaderBinaryDriver {
+public:
+    explicit FakeShaderBinaryDriver(const String &driverId) :
+            mDriverId(driverId), mRejectAll(false) {
+        // empty
+    }
+
+    String getDriverId() const override {
+        return mDriverId;
+    }
+
+    bool getProgramBinary(ui32 program, ui32 &format, ProgramBinary &binary) override {
+        auto it = mPrograms.find(program);
+        if (it == mPrograms.end()) {
+            return false;
+        }
+        format = 7;
+        binary = it->second;
+        return true;
+    }
+
+    bool setProgramBinary(ui32 program, ui32 format, const uc8 *data, size_t size) override {
+        if (mRejectAll || format != 7) {
+            return false;
+        }
+        mPrograms[program] = ProgramBinary(data, data + size);
+        return true;
+    }
+
+    String mDriverId;
+    bool mRejectAll;
+    std::map<ui32, ProgramBinary> mPrograms;
+};
+
+class ShaderBinaryCacheTest : public ::testing::Test {
+protected:
+    static void setupShader(Shader &shader, const String &vs, const String &fs) {
+        shader.setSource(ShaderType::SH_VertexShaderType, vs);
+        shader.setSource(ShaderType::SH_FragmentShaderType, fs);
+    }
+
+    static ProgramBinary toBinary(const String &str) {
+        return ProgramBinary(str.begin(), str.end());
+    }
+
+    static bool fileExists(const String &path) {
+        FILE *file = ::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        ::fclose(file);
+        return true;
+    }
+};
+
+TEST_F(ShaderBinaryCacheTest, computeKeyTest) {
+    Shader shader("test"), other("other");
+    setupShader(shader, "void main() {}", "void main() { color = vec4(1); }");
+    setupShader(other, "void main() {}", "void main() { color = vec4(1); }");
+
+    // The name is not part of the key, the sources, the defines and the driver are
+    const HashId key = ShaderBinaryCache::computeKey(shader, "", "vendor|gpu|1.0");
+    EXPECT_NE(0u, key);
+    EXPECT_EQ(key, ShaderBinaryCache::computeKey(other, "", "vendor|gpu|1.0"));
+    EXPECT_NE(key, ShaderBinaryCache::computeKey(shader, "#define A", "vendor|gpu|1.0"));
+    EXPECT_NE(key, ShaderBinaryCache::computeKey(shader, "", "vendor|gpu|1.1"));
+    other.setSource(ShaderType::SH_FragmentShaderType, "void main() { color = vec4(0); }");
+    EXPECT_NE(key, ShaderBinaryCache::computeKey(other, "", "vendor|gpu|1.0"));
+
+    // Moving text between the stages changes the key
+    Shader a("a"), b("b");
+    setupShader(a, "ab", "c");
+    setupShader(b, "a", "bc");
+    EXPECT_NE(ShaderBinaryCache::computeKey(a, "", ""), ShaderBinaryCache::computeKey(b, "", ""));
+}
+
+TEST_F(ShaderBinaryCacheTest, storeAndLoadTest) {
+    FakeShaderBinaryDriver driver("vendor|gpu|1.0");
+    ShaderBinaryCache cache("", &driver);
+    Shader shader("test");
+    setupShader(shader, "void main() {}", "void main() {}");
+    const HashId key = cache.computeKey(shader, "");
+    cache.invalidate(key);
+
+    // Nothing cached yet, the program will be compiled and stored
+    EXPECT_FALSE(cache.load(key, 1));
+    EXPECT_EQ(1u, cache.getNumMisses());
+    EXPECT_FALSE(cache.store(key, 1));
+    driver.mPrograms[1] = toBinary("linked program");
+    EXPECT_TRUE(cache.store(key, 1));
+    EXPECT_TRUE(fileExists(cache.getCachePath(key)));
+
+    // The next launch loads the binary
+    EXPECT_TRUE(cache.load(key, 2));
+    EXPECT_EQ(1u, cache.getNumHits());
+    EXPECT_EQ(driver.mPrograms[1], driver.mPrograms[2]);
+
+    cache.invalidate(key);
+    EXPECT_FALSE(fileExists(cache.getCachePath(key)));
+}
+
+TEST_F(ShaderBinaryCacheTest, invalidationTest) {
+    FakeShaderBinaryDriver driver("vendor|gpu|1.0");
+    Shader shader("test");
+    setupShader(shader, "void main() {}", "void main() {}");
+    const HashId key = ShaderBinaryCache::computeKey(shader, "", driver.getDriverId());
+    driver.mPrograms[1] = toBinary("linked program");
+
+    // A driver update must not load the old binary, the file is deleted
+    {
+        ShaderBinaryCache cache("", &driver);
+        ASSERT_TRUE(cache.store(key, 1));
+    }
+    FakeShaderBinaryDriver newDriver("vendor|gpu|2.0");
+    newDriver.mPrograms[1] = driver.mPrograms[1];
+    {
+        ShaderBinaryCache cache("", &newDriver);
+        EXPECT_FALSE(cache.load(key, 2));
+        EXPECT_FALSE(fileExists(cache.getCachePath(key)));
+    }
+
+    // A binary rejected by the driver is deleted as well
+    {
+        ShaderBinaryCache cache("", &driver);
+        ASSERT_TRUE(cache.store(key, 1));
+        driver.mRejectAll = true;
+        EXPECT_FALSE(cache.load(key, 2));
+        EXPECT_FALSE(fileExists(cache.getCachePath(key)));
+        driver.mRejectAll = false;
+    }
+
+    // A corrupted or truncated file is rejected before it reaches the driver
+    {
+        ShaderBinaryCache cache("", &driver);
+        ASSERT_TRUE(cache.store(key, 1));
+        const String path = cache.getCachePath(key);
+        FILE *file = ::fopen(path.c_str(), "r+b");
+        ASSERT_NE(nullptr, file);
+        ::fseek(file, -1, SEEK_END);
+        ::fputc('X', file);
+        ::fclose(file);
+        EXPECT_FALSE(cache.load(key, 2));
+        EXPECT_FALSE(fileExists(path));
+        EXPECT_EQ(0u, driver.mPrograms.count(2));
+
+        ASSERT_TRUE(cache.store(key, 1));
+        file = ::fopen(path.c_str(), "wb");
+        ASSERT_NE(nullptr, file);
+        ::fputs("OSPB", file);
+        ::fclose(file);
+        EXPECT_FALSE(cache.load(key, 2));
+        EXPECT_FALSE(fileExists(path));
+    }
+}
+
+} // namespace UnitTest
+} // namespace OSRE
@@ -0,0 +1,149 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/TextureDecoder.h"
+#include "RenderBackend/RenderCommon.h"
+
+#include <cstdio>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class TextureDecoderTest : public ::testing::Test {
+protected:
+    /// Writes a binary PPM image, the pixel value encodes the row index.
+    static bool writeImage(const String &path, ui32 width, ui32 height) {
+        FILE *file = ::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        ::fprintf(file, "P6\n%u %u\n255\n", width, height);
+        for (ui32 y = 0; y < height; ++y) {
+            for (ui32 x = 0; x < width; ++x) {
+                const uc8 pixel[3] = { static_cast<uc8>(y), static_cast<uc8>(x), 7 };
+                ::fwrite(pixel, 1, 3, file);
+            }
+        }
+        ::fclose(file);
+        return true;
+    }
+};
+
+TEST_F(TextureDecoderTest, flipRowsTest) {
+    uc8 data[3 * 2] = { 1, 2, 3, 4, 5, 6 };
+    TextureDecoder::flipRows(data, 1, 3, 2);
+    EXPECT_EQ(5, data[0]);
+    EXPECT_EQ(6, data[1]);
+    EXPECT_EQ(3, data[2]);
+    EXPECT_EQ(4, data[3]);
+    EXPECT_EQ(1, data[4]);
+    EXPECT_EQ(2, data[5]);
+}
+
+TEST_F(TextureDecoderTest, decodeFileTest) {
+    const String path = "texture_decoder_test.ppm";
+    ASSERT_TRUE(writeImage(path, 4, 2));
+
+    Texture tex("test");
+    EXPECT_FALSE(TextureDecoder::decodeFile("not_existing.ppm", &tex, true));
+    ASSERT_TRUE(TextureDecoder::decodeFile(path, &tex, true));
+    EXPECT_EQ(4u, tex.Width);
+    EXPECT_EQ(2u, tex.Height);
+    EXPECT_EQ(3u, tex.Channels);
+    EXPECT_EQ(PixelFormatType::R8G8B8, tex.PixelFormat);
+    EXPECT_EQ(3u, tex.NumMips);
+    EXPECT_EQ(static_cast<ui32>((8 + 2 + 1) * 3), tex.Size);
+
+    // The last image row is the first row of the texture
+    EXPECT_EQ(1, tex.Data[0]);
+    EXPECT_EQ(0, tex.Data[4 * 3]);
+    EXPECT_EQ(7, tex.Data[2]);
+
+    ::remove(path.c_str());
+}
+
+TEST_F(TextureDecoderTest, decodeAsyncTest) {
+    const String path = "texture_decoder_async_test.ppm";
+    ASSERT_TRUE(writeImage(path, 8, 8));
+
+    TextureDecoder decoder;
+    EXPECT_TRUE(decoder.start(2));
+    Texture tex1("tex1"), tex2("tex2"), tex3("tex3");
+    EXPECT_TRUE(decoder.decode(&tex1, path));
+    TextureImportOptions options;
+    options.BuildMips = false;
+    EXPECT_TRUE(decoder.decode(&tex2, path, options));
+    EXPECT_TRUE(decoder.decode(&tex3, "not_existing.ppm"));
+    EXPECT_EQ(TextureState::Pending, tex1.State.load());
+    EXPECT_EQ(nullptr, tex1.Data);
+    decoder.waitIdle();
+
+    cppcore::TArray<DecodedTexture> decodedTextures;
+    EXPECT_EQ(3u, decoder.dispatchCompleted(decodedTextures));
+    ASSERT_EQ(2u, decodedTextures.size());
+    EXPECT_EQ(0u, decoder.getNumPending());
+    EXPECT_EQ(TextureState::Error, tex3.State.load());
+
+    // The targets are not touched until the data is applied
+    EXPECT_EQ(TextureState::Pending, tex1.State.load());
+    EXPECT_EQ(nullptr, tex1.Data);
+    for (const DecodedTexture &decoded : decodedTextures) {
+        TextureDecoder::apply(decoded.mTarget, decoded.mData);
+    }
+    EXPECT_EQ(TextureState::Ready, tex1.State.load());
+    EXPECT_EQ(4u, tex1.NumMips);
+    EXPECT_EQ(1u, tex2.NumMips);
+    EXPECT_NE(nullptr, tex2.Data);
+    decoder.stop();
+
+    ::remove(path.c_str());
+}
+
+TEST_F(TextureDecoderTest, cancelTest) {
+    const String path = "texture_decoder_cancel_test.ppm";
+    ASSERT_TRUE(writeImage(path, 4, 4));
+
+    // Without decoder threads the requests stay queued until waitIdle
+    TextureDecoder decoder;
+    Texture tex1("tex1"), tex2("tex2");
+    EXPECT_TRUE(decoder.decode(&tex1, path));
+    EXPECT_TRUE(decoder.decode(&tex2, path));
+    EXPECT_EQ(2u, decoder.getNumPending());
+    decoder.cancel(&tex1);
+    EXPECT_EQ(1u, decoder.getNumPending());
+    decoder.waitIdle();
+
+    cppcore::TArray<DecodedTexture> decodedTextures;
+    EXPECT_EQ(1u, decoder.dispatchCompleted(decodedTextures));
+    ASSERT_EQ(1u, decodedTextures.size());
+    EXPECT_EQ(&tex2, decodedTextures[0].mTarget);
+    TextureDecoder::apply(decodedTextures[0].mTarget, decodedTextures[0].mData);
+    EXPECT_EQ(nullptr, tex1.Data);
+
+    ::remove(path.c_str());
+}
+
+} // namespace UnitTest
+} // namespace OSRE
@@ -0,0 +1,273 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/TextureProcessor.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class TextureProcessorTest : public ::testing::Test {
+protected:
+    /// Fills a texture with smooth gradients and a little deterministic noise.
+    static void createImage(Texture &tex, ui32 width, ui32 height, ui32 channels) {
+        tex.clear();
+        tex.Width = width;
+        tex.Height = height;
+        tex.Channels = channels;
+        tex.NumMips = 1;
+        tex.PixelFormat = channels == 4 ? PixelFormatType::R8G8B8A8 : PixelFormatType::R8G8B8;
+        tex.Size = width * height * channels;
+        tex.Data = new uc8[tex.Size];
+        ui32 seed = 1234;
+        for (ui32 y = 0; y < height; ++y) {
+            for (ui32 x = 0; x < width; ++x) {
+                seed = seed * 1103515245u + 12345u;
+                const i32 noise = static_cast<i32>((seed >> 16) & 7) - 4;
+                uc8 *px = tex.Data + (y * width + x) * channels;
+                const i32 values[4] = { static_cast<i32>(x * 255 / width) + noise, static_cast<i32>(y * 255 / height) + noise,
+                    static_cast<i32>((x + y) * 127 / (width + height)) + 64, static_cast<i32>(255 - y * 255 / height) };
+                for (ui32 c = 0; c < channels; ++c) {
+                    px[c] = static_cast<uc8>(values[c] < 0 ? 0 : (values[c] > 255 ? 255 : values[c]));
+                }
+            }
+        }
+    }
+
+    /// PSNR of selected channels of two images with the given number of channels.
+    static d32 channelPSNR(const uc8 *lhs, ui32 lhsChannels, const uc8 *rhs, ui32 rhsChannels, size_t numPixels,
+            ui32 firstChannel, ui32 numChannels) {
+        std::vector<uc8> a, b;
+        for (size_t i = 0; i < numPixels; ++i) {
+            for (ui32 c = firstChannel; c < firstChannel + numChannels; ++c) {
+                a.push_back(lhs[i * lhsChannels + c]);
+                b.push_back(rhs[i * rhsChannels + c]);
+            }
+        }
+        return TextureProcessor::computePSNR(a.data(), b.data(), a.size());
+    }
+
+    /// Plain 2x2 average as reference for the box filter.
+    static void referenceBox(const uc8 *src, ui32 width, ui32 height, ui32 channels, std::vector<uc8> &dst) {
+        const ui32 dstWidth = width > 1 ? width / 2 : 1;
+        const ui32 dstHeight = height > 1 ? height / 2 : 1;
+        dst.resize(dstWidth * dstHeight * channels);
+        for (ui32 y = 0; y < dstHeight; ++y) {
+            for (ui32 x = 0; x < dstWidth; ++x) {
+                const ui32 x0 = 2 * x, x1 = 2 * x + 1 < width ? 2 * x + 1 : width - 1;
+                const ui32 y0 = 2 * y, y1 = 2 * y + 1 < height ? 2 * y + 1 : height - 1;
+                for (ui32 c = 0; c < channels; ++c) {
+                    const ui32 sum = src[(y0 * width + x0) * channels + c] + src[(y0 * width + x1) * channels + c] +
+                                     src[(y1 * width + x0) * channels + c] + src[(y1 * width + x1) * channels + c];
+                    dst[(y * dstWidth + x) * channels + c] = static_cast<uc8>((sum + 2) / 4);
+                }
+            }
+        }
+    }
+};
+
+TEST_F(TextureProcessorTest, mipChainSizeTest) {
+    EXPECT_EQ(3u, TextureProcessor::getNumMips(4, 4));
+    EXPECT_EQ(4u, TextureProcessor::getNumMips(8, 1));
+    EXPECT_EQ(static_cast<size_t>((16 + 4 + 1) * 4), TextureProcessor::getMipChainSize(PixelFormatType::R8G8B8A8, 4, 4, 4, 3));
+    EXPECT_EQ(static_cast<size_t>(4 * 8 + 8 + 8), TextureProcessor::getMipChainSize(PixelFormatType::BC1, 8, 8, 3, 3));
+    EXPECT_EQ(static_cast<size_t>(16), TextureProcessor::getImageSize(PixelFormatType::BC3, 3, 2, 4));
+    EXPECT_TRUE(TextureProcessor::isCompressed(PixelFormatType::BC5));
+    EXPECT_FALSE(TextureProcessor::isCompressed(PixelFormatType::R8G8B8));
+}
+
+TEST_F(TextureProcessorTest, boxFilterTest) {
+    // Odd sizes cover the scalar tail and the clamped border
+    const ui32 sizes[][2] = { { 37, 20 }, { 16, 16 }, { 5, 1 }, { 1, 7 } };
+    for (const auto &size : sizes) {
+        for (ui32 channels = 3; channels <= 4; ++channels) {
+            Texture tex("box");
+            createImage(tex, size[0], size[1], channels);
+            std::vector<uc8> expected;
+            referenceBox(tex.Data, tex.Width, tex.Height, channels, expected);
+            std::vector<uc8> result(expected.size());
+            TextureProcessor::downsample(tex.Data, tex.Width, tex.Height, channels, result.data(), MipFilter::Box);
+            EXPECT_EQ(expected, result);
+        }
+    }
+}
+
+TEST_F(TextureProcessorTest, kaiserFilterTest) {
+    Texture tex("kaiser");
+    createImage(tex, 64, 64, 4);
+    std::vector<uc8> box(32 * 32 * 4), kaiser(32 * 32 * 4);
+    TextureProcessor::downsample(tex.Data, 64, 64, 4, box.data(), MipFilter::Box);
+    TextureProcessor::downsample(tex.Data, 64, 64, 4, kaiser.data(), MipFilter::Kaiser);
+    EXPECT_GT(TextureProcessor::computePSNR(box.data(), kaiser.data(), box.size()), 35.0);
+
+    // The weights are normalized, a constant image stays constant
+    std::vector<uc8> flat(8 * 8 * 3, 77), out(4 * 4 * 3);
+    TextureProcessor::downsample(flat.data(), 8, 8, 3, out.data(), MipFilter::Kaiser);
+    for (uc8 value : out) {
+        EXPECT_EQ(77, value);
+    }
+}
+
+TEST_F(TextureProcessorTest, generateMipsTest) {
+    Texture tex("mips");
+    createImage(tex, 16, 8, 3);
+    std::vector<uc8> level0(tex.Data, tex.Data + tex.Size);
+    EXPECT_TRUE(TextureProcessor::generateMips(&tex, MipFilter::Box));
+    EXPECT_EQ(5u, tex.NumMips);
+    EXPECT_EQ(static_cast<ui32>((128 + 32 + 8 + 2 + 1) * 3), tex.Size);
+    EXPECT_TRUE(std::equal(level0.begin(), level0.end(), tex.Data));
+
+    std::vector<uc8> level1;
+    referenceBox(level0.data(), 16, 8, 3, level1);
+    EXPECT_TRUE(std::equal(level1.begin(), level1.end(), tex.Data + level0.size()));
+}
+
+TEST_F(TextureProcessorTest, bc1Test) {
+    Texture tex("bc1");
+    createImage(tex, 64, 62, 3);
+    std::vector<uc8> source(tex.Data, tex.Data + tex.Size);
+    EXPECT_TRUE(TextureProcessor::compress(&tex, PixelFormatType::BC1));
+    EXPECT_EQ(PixelFormatType::BC1, tex.PixelFormat);
+    EXPECT_EQ(static_cast<ui32>(16 * 16 * 8), tex.Size);
+
+    Texture decoded("decoded");
+    EXPECT_TRUE(TextureProcessor::decompress(&tex, &decoded));
+    EXPECT_EQ(4u, decoded.Channels);
+    EXPECT_GT(channelPSNR(source.data(), 3, decoded.Data, 4, 64 * 62, 0, 3), 35.0);
+
+    // A solid block is reproduced exactly by the 565 endpoints
+    uc8 solid[16 * 4], block[8], out[16 * 4];
+    for (ui32 i = 0; i < 16; ++i) {
+        solid[i * 4] = 255;
+        solid[i * 4 + 1] = 0;
+        solid[i * 4 + 2] = 132;
+        solid[i * 4 + 3] = 255;
+    }
+    TextureProcessor::encodeBlock(PixelFormatType::BC1, solid, block);
+    TextureProcessor::decodeBlock(PixelFormatType::BC1, block, out);
+    EXPECT_EQ(255, out[0]);
+    EXPECT_EQ(0, out[1]);
+    EXPECT_EQ(132, out[2]);
+    EXPECT_EQ(255, out[3]);
+}
+
+TEST_F(TextureProcessorTest, bc3Test) {
+    Texture tex("bc3");
+    createImage(tex, 32, 32, 4);
+    EXPECT_TRUE(TextureProcessor::generateMips(&tex, MipFilter::Box));
+    std::vector<uc8> source(tex.Data, tex.Data + 32 * 32 * 4);
+    EXPECT_TRUE(TextureProcessor::compress(&tex, PixelFormatType::BC3));
+    EXPECT_EQ(6u, tex.NumMips);
+
+    Texture decoded("decoded");
+    EXPECT_TRUE(TextureProcessor::decompress(&tex, &decoded));
+    EXPECT_EQ(6u, decoded.NumMips);
+    EXPECT_GT(channelPSNR(source.data(), 4, decoded.Data, 4, 32 * 32, 0, 3), 30.0);
+    EXPECT_GT(channelPSNR(source.data(), 4, decoded.Data, 4, 32 * 32, 3, 1), 45.0);
+}
+
+TEST_F(TextureProcessorTest, bc5Test) {
+    Texture tex("bc5");
+    createImage(tex, 32, 32, 3);
+    std::vector<uc8> source(tex.Data, tex.Data + tex.Size);
+    EXPECT_TRUE(TextureProcessor::compress(&tex, PixelFormatType::BC5));
+
+    Texture decoded("decoded");
+    EXPECT_TRUE(TextureProcessor::decompress(&tex, &decoded));
+    EXPECT_EQ(3u, decoded.Channels);
+    EXPECT_GT(channelPSNR(source.data(), 3, decoded.Data, 3, 32 * 32, 0, 2), 40.0);
+}
+
+TEST_F(TextureProcessorTest, cacheTest) {
+    const String cachePath = "texture_processor_test.ostx";
+    Texture tex("cache");
+    createImage(tex, 8, 8, 4);
+    EXPECT_TRUE(TextureProcessor::generateMips(&tex, MipFilter::Box));
+    EXPECT_TRUE(TextureProcessor::compress(&tex, PixelFormatType::BC3));
+    EXPECT_TRUE(TextureProcessor::writeCache(cachePath, 42, &tex));
+
+    Texture loaded("loaded");
+    EXPECT_FALSE(TextureProcessor::loadCache(cachePath, 43, &loaded));
+    EXPECT_TRUE(TextureProcessor::loadCache(cachePath, 42, &loaded));
+    EXPECT_EQ(PixelFormatType::BC3, loaded.PixelFormat);
+    EXPECT_EQ(tex.NumMips, loaded.NumMips);
+    EXPECT_EQ(tex.Size, loaded.Size);
+    EXPECT_EQ(0, ::memcmp(tex.Data, loaded.Data, tex.Size));
+
+    // A truncated file is rejected
+    FILE *file = ::fopen(cachePath.c_str(), "rb");
+    ASSERT_NE(nullptr, file);
+    std::vector<uc8> content(1024);
+    content.resize(::fread(content.data(), 1, content.size(), file));
+    ::fclose(file);
+    file = ::fopen(cachePath.c_str(), "wb");
+    ::fwrite(content.data(), 1, content.size() - 1, file);
+    ::fclose(file);
+    EXPECT_FALSE(TextureProcessor::loadCache(cachePath, 42, &loaded));
+
+    ::remove(cachePath.c_str());
+}
+
+TEST_F(TextureProcessorTest, importTest) {
+    const String path = "texture_processor_test.ppm";
+    FILE *file = ::fopen(path.c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    ::fprintf(file, "P6\n8 8\n255\n");
+    for (ui32 i = 0; i < 64; ++i) {
+        const uc8 pixel[3] = { static_cast<uc8>(i * 4), 128, static_cast<uc8>(255 - i * 4) };
+        ::fwrite(pixel, 1, 3, file);
+    }
+    ::fclose(file);
+
+    TextureImportOptions options;
+    options.Filter = MipFilter::Kaiser;
+    options.Compress = true;
+    options.UseCache = true;
+    Texture tex("import");
+    EXPECT_TRUE(TextureProcessor::import(path, &tex, options));
+    EXPECT_EQ(PixelFormatType::BC1, tex.PixelFormat);
+    EXPECT_EQ(4u, tex.NumMips);
+
+    // The second import is served from the cache file
+    const String cachePath = TextureProcessor::getCachePath(path);
+    file = ::fopen(cachePath.c_str(), "rb");
+    EXPECT_NE(nullptr, file);
+    if (file != nullptr) {
+        ::fclose(file);
+    }
+    Texture cached("cached");
+    EXPECT_TRUE(TextureProcessor::import(path, &cached, options));
+    EXPECT_EQ(tex.Size, cached.Size);
+    EXPECT_EQ(0, ::memcmp(tex.Data, cached.Data, tex.Size));
+
+    ::remove(cachePath.c_str());
+    ::remove(path.c_str());
+}
+
+} // namespace UnitTest
+} // namespace OSRE
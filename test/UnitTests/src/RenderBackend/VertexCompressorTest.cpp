@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------------------------
+The MIT License (MIT)
+
+Copyright (c) 2015-2025 OSRE ( Open Source Render Engine ) by Kim Kulling
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+-----------------------------------------------------------------------------------------------*/
+#include "osre_testcommon.h"
+#include "RenderBackend/Mesh/VertexCompressor.h"
+#include "RenderBackend/Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace OSRE {
+namespace UnitTest {
+
+using namespace ::OSRE::RenderBackend;
+
+class VertexCompressorTest : public ::testing::Test {
+    // empty
+};
+
+TEST_F(VertexCompressorTest, halfFloatTest) {
+    EXPECT_EQ(0x3c00, VertexCompressor::encodeHalf(1.0f));
+    EXPECT_EQ(0xc000, VertexCompressor::encodeHalf(-2.0f));
+    EXPECT_EQ(0x7bff, VertexCompressor::encodeHalf(65504.0f));
+    EXPECT_EQ(0x7c00, VertexCompressor::encodeHalf(1.0e6f));
+
+    for (f32 value = -100.0f; value < 100.0f; value += 0.37f) {
+        const f32 decoded = VertexCompressor::decodeHalf(VertexCompressor::encodeHalf(value));
+        EXPECT_LE(std::fabs(decoded - value), std::fabs(value) / 1024.0f + 1.0e-6f);
+    }
+}
+
+TEST_F(VertexCompressorTest, octNormalTest) {
+    for (i32 i = 0; i < 1000; ++i) {
+        const f32 theta = static_cast<f32>(i) * 0.731f;
+        const f32 z = -1.0f + 2.0f * static_cast<f32>(i) / 999.0f;
+        const f32 r = std::sqrt(std::max(0.0f, 1.0f - z * z));
+        const glm::vec3 n(r * std::cos(theta), r * std::sin(theta), z);
+
+        i16 x = 0, y = 0;
+        VertexCompressor::encodeOctNormal(n, x, y);
+        const glm::vec3 decoded = VertexCompressor::decodeOctNormal(x, y);
+        EXPECT_GT(glm::dot(n, decoded), 0.99999f);
+    }
+}
+
+TEST_F(VertexCompressorTest, compressMeshTest) {
+    RenderVert vertices[3];
+    for (i32 i = 0; i < 3; ++i) {
+        vertices[i].position = glm::vec3(2.0f * i, -1.0f * i, 0.5f);
+        vertices[i].normal = glm::vec3(0.0f, 0.0f, -1.0f);
+        vertices[i].color0 = glm::vec3(1.0f, 0.5f, 0.0f);
+        vertices[i].tex0 = glm::vec2(0.25f * i, 1.0f);
+    }
+
+    Mesh mesh("compressed", VertexType::RenderVertex, IndexType::UnsignedShort);
+    mesh.createVertexBuffer(vertices, sizeof(vertices), BufferAccessType::ReadOnly);
+
+    VertexCompressionConfig config;
+    VertexCompressionReport report;
+    EXPECT_TRUE(VertexCompressor::compress(&mesh, config, &report));
+    EXPECT_EQ(VertexType::CompressedRenderVertex, mesh.getVertexType());
+    ASSERT_NE(nullptr, mesh.getVertexLayout());
+    EXPECT_EQ(20u, mesh.getVertexStride());
+    EXPECT_EQ(3 * 20u, mesh.getVertexBuffer()->getSize());
+    EXPECT_EQ(sizeof(vertices), report.mSizeBefore);
+    EXPECT_GT(report.getSavedRatio(), 0.5f);
+    EXPECT_TRUE(mesh.hasDequantMatrix());
+
+    // The dequant matrix must restore the positions
+    const glm::mat4 &dequant = mesh.getDequantMatrix();
+    for (i32 i = 0; i < 3; ++i) {
+        ui16 q[4] = {};
+        ::memcpy(q, mesh.getVertexBuffer()->getData() + i * 20, sizeof(q));
+        const glm::vec4 p = dequant * glm::vec4(q[0] / 65535.0f, q[1] / 65535.0f, q[2] / 65535.0f, 1.0f);
+        EXPECT_NEAR(vertices[i].position.x, p.x, 1.0e-3f);
+        EXPECT_NEAR(vertices[i].position.y, p.y, 1.0e-3f);
+        EXPECT_NEAR(vertices[i].position.z, p.z, 1.0e-3f);
+    }
+
+    // Compressed meshes cannot be compressed again
+    EXPECT_FALSE(VertexCompressor::compress(&mesh, config, &report));
+}
+
+} // namespace UnitTest
+} // namespace OSRE